@@ -50,8 +50,306 @@
 
 #include <xc.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "adc.h"
+#include "sfr_field.h"
+#include "boot_profile.h"
+#include "clock.h"
+#include "timer1.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Channel control register 1 value. All channels share the AD1CH0CON1 layout
+   SAMC = 3 : Sampling time of 3 TAD
+   FRAC = 0 : Integer result
+   DIFF = 0 : Single ended input */
+#define ADC_CHANNEL_CON1(pinsel, trg1src)                                      \
+    (SFR_FIELD(AD1CH0CON1, PINSEL, pinsel) |                                   \
+     SFR_FIELD(AD1CH0CON1, SAMC, 3) |                                          \
+     SFR_FIELD(AD1CH0CON1, FRAC, 0) |                                          \
+     SFR_FIELD(AD1CH0CON1, DIFF, 0) |                                          \
+     SFR_FIELD(AD1CH0CON1, TRG1SRC, trg1src))
+
+/* Channel control register 2 value, conversion mode and the number of 
+   conversions accumulated in oversampling mode */
+#define ADC_MODE_SINGLE             0
+#define ADC_MODE_OVERSAMPLE         3
+#define ADC_CHANNEL_CON2(mode, accnum)                                         \
+    (SFR_FIELD(AD1CH0CON2, MODE, mode) |                                       \
+     SFR_FIELD(AD1CH0CON2, ACCNUM, accnum))
+
+/* Trigger sources of the PWM generators, TRG1SRC
+   PGx ADC Trigger t  : 2*x + 1 + t, 4 : PG1 ADC Trigger 1 up to 19
+   APGx ADC Trigger t : 2*x + 17 + t, 20 : APG1 ADC Trigger 1 up to 25 */
+#define ADC_TRG_PG(x, t)            (2*(x) + 1 + (t))
+#define ADC_TRG_APG(x, t)           (2*(x) + 17 + (t))
+
+/* Each motor is sampled on the ADC triggers of its own PWM generators
+   Dual shunt   : IA, IB on Trigger 1 of the first generator of the motor
+   Single shunt : IBUS1, IBUS2 on Trigger 1 and 2 of the second generator 
+   The phase voltages are sampled on Trigger 1 of the phase C generator, 
+   whose postscaler decimates them (PWM_MotorVoltageTriggerSet()), the 
+   channels unused by the shunt configuration are not triggered */
+#ifdef SINGLE_SHUNT
+#define ADC_PHASE_TRG(trg1src)      0
+#define ADC_BUS_TRG(trg1src)        (trg1src)
+#else
+#define ADC_PHASE_TRG(trg1src)      (trg1src)
+#define ADC_BUS_TRG(trg1src)        0
+#endif
+#define ADC_POT_TRG1SRC             ADC_TRG_PG(1, 1)
+#define ADC_VBUS_TRG1SRC            ADC_TRG_PG(1, 1)
+
+/* Ports of the analog input pins, ADC_CHANNEL_CONFIG_T.port */
+#define ADC_PORT_A                  0
+#define ADC_PORT_B                  1
+#define ADC_PORT_C                  2
+#define ADC_PORT_D                  3
+#define ADC_PORT_E                  4
+#define ADC_PORT_F                  5
+
+#define ADC_CHANNEL_CONFIG(motor, signal, core, channel, pinsel, port, pin,    \
+                           trg1src)                                            \
+    { (motor), (signal), (core), (channel), (port), (pin),                     \
+      ADC_CHANNEL_CON1(pinsel, trg1src) }
+
+#define ADC_CHANNEL_COUNT           23
+
+/* Channel registers of ADC_ChannelRegister() */
+#define ADC_CHANNEL_REG_CON1        0
+#define ADC_CHANNEL_REG_CON2        1
+#define ADC_CHANNEL_REG_DATA        2
+
+/* Case of the channel registers of ADC_ChannelRegister() */
+#define ADC_CHANNEL_CASE(core, channel, reg)                                   \
+    case ((core) - 1)*ADC_CORE_CHANNEL_COUNT + (channel):                      \
+        return &AD##core##CH##channel##reg
+#define ADC_CORE_CASES(core, reg)                                              \
+    ADC_CHANNEL_CASE(core, 0, reg); ADC_CHANNEL_CASE(core, 1, reg);            \
+    ADC_CHANNEL_CASE(core, 2, reg); ADC_CHANNEL_CASE(core, 3, reg);            \
+    ADC_CHANNEL_CASE(core, 4, reg); ADC_CHANNEL_CASE(core, 5, reg);            \
+    ADC_CHANNEL_CASE(core, 6, reg); ADC_CHANNEL_CASE(core, 7, reg)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+ADC_CORE_STATUS_T adcCoreStatus;
+ADC_FRAMES_T adcFrames;
+
+/* Data registers read by ADC_FrameCapture(), looked up by ADC_FrameInit() */
+static volatile uint32_t *adcFrameData[ADC_SIGNAL_COUNT][ADC_MOTOR_COUNT];
+/* Conversions per result of the current channels, ADC_ChannelSamples(), 
+   kept by ADC_FrameSamplesUpdate() so the capture does not read ADxCHyCON2 */
+static uint16_t adcFrameSamples[ADC_SIGNAL_IBUS2 + 1][ADC_MOTOR_COUNT];
+static bool adcFrameAccumulating;
+
+/* Channel assignment of the three motors. ADxANy is input y (PINSEL) of 
+   core x. The MC1 current, POT and VBUS inputs are those of the MC DIM, 
+   the MC2/MC3 inputs and the phase voltage inputs follow the wiring of the
+   inverter boards, their pins have to match the board schematic. The three
+   inverters share the DC bus, VBUS and POT are sampled once with MC1 */
+static const ADC_CHANNEL_CONFIG_T adcChannelConfig[ADC_CHANNEL_COUNT] =
+{
+    /* motor, signal, core, channel, pinsel, port, pin, trg1src */
+    /* IA : OA1OUT/AD1AN0/CVDAN2/CMP1A/RP3/RA2 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_IA,    1, 0, 0, 
+        ADC_PORT_A, 2,  ADC_PHASE_TRG(ADC_TRG_PG(1, 1))),
+    /* IB : OA2OUT/AD2AN0/CVDAN16/CVDTX0/CMP2A/RP17/RB0 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_IB,    2, 0, 0, 
+        ADC_PORT_B, 0,  ADC_PHASE_TRG(ADC_TRG_PG(1, 1))),
+    /* IBUS1, IBUS2 : OA3OUT/AD3AN0/CVDAN5/CMP3A/RP6/INT0/RA5 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_IBUS1, 3, 0, 0, 
+        ADC_PORT_A, 5,  ADC_BUS_TRG(ADC_TRG_PG(2, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_IBUS2, 3, 1, 0, 
+        ADC_PORT_A, 5,  ADC_BUS_TRG(ADC_TRG_PG(2, 2))),
+    /* POT : AD2AN5/CVDAN31/CVDTX15/RP32/RB15 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_POT,   2, 1, 5, 
+        ADC_PORT_B, 15, ADC_POT_TRG1SRC),
+    /* VBUS : AD3AN4/CVDTX29/RP81/RF0 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_VBUS,  3, 2, 4, 
+        ADC_PORT_F, 0,  ADC_VBUS_TRG1SRC),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_VA,    1, 1, 2, 
+        ADC_PORT_A, 3,  ADC_TRG_PG(3, 1)),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_VB,    2, 2, 2, 
+        ADC_PORT_B, 1,  ADC_TRG_PG(3, 1)),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC1, ADC_SIGNAL_VC,    3, 3, 2, 
+        ADC_PORT_A, 6,  ADC_TRG_PG(3, 1)),
+    
+    /* MC2 : APG1-APG3 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_IA,    1, 2, 3, 
+        ADC_PORT_A, 4,  ADC_PHASE_TRG(ADC_TRG_APG(1, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_IB,    2, 3, 3, 
+        ADC_PORT_B, 2,  ADC_PHASE_TRG(ADC_TRG_APG(1, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_IBUS1, 3, 4, 3, 
+        ADC_PORT_A, 7,  ADC_BUS_TRG(ADC_TRG_APG(2, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_IBUS2, 3, 5, 3, 
+        ADC_PORT_A, 7,  ADC_BUS_TRG(ADC_TRG_APG(2, 2))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_VA,    1, 3, 4, 
+        ADC_PORT_A, 8,  ADC_TRG_APG(3, 1)),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_VB,    2, 4, 4, 
+        ADC_PORT_B, 3,  ADC_TRG_APG(3, 1)),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC2, ADC_SIGNAL_VC,    1, 4, 5, 
+        ADC_PORT_A, 9,  ADC_TRG_APG(3, 1)),
+    
+    /* MC3 : PG6-PG8 */
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_IA,    1, 5, 6, 
+        ADC_PORT_A, 10, ADC_PHASE_TRG(ADC_TRG_PG(6, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_IB,    2, 5, 6, 
+        ADC_PORT_B, 4,  ADC_PHASE_TRG(ADC_TRG_PG(6, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_IBUS1, 3, 6, 6, 
+        ADC_PORT_F, 1,  ADC_BUS_TRG(ADC_TRG_PG(7, 1))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_IBUS2, 3, 7, 6, 
+        ADC_PORT_F, 1,  ADC_BUS_TRG(ADC_TRG_PG(7, 2))),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_VA,    1, 6, 7, 
+        ADC_PORT_A, 11, ADC_TRG_PG(8, 1)),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_VB,    2, 6, 7, 
+        ADC_PORT_B, 5,  ADC_TRG_PG(8, 1)),
+    ADC_CHANNEL_CONFIG(ADC_MOTOR_MC3, ADC_SIGNAL_VC,    1, 7, 8, 
+        ADC_PORT_E, 0,  ADC_TRG_PG(8, 1)),
+};
+
+/* ADxCHyCON2 of an accumulating channel, indexed by ADC_ACCUMULATE_T */
+static const uint32_t adcAccumulateCon2[ADC_ACCUMULATE_COUNT] =
+{
+    ADC_CHANNEL_CON2(ADC_MODE_OVERSAMPLE, ADC_ACCUMULATE_4),
+    ADC_CHANNEL_CON2(ADC_MODE_OVERSAMPLE, ADC_ACCUMULATE_16),
+    ADC_CHANNEL_CON2(ADC_MODE_OVERSAMPLE, ADC_ACCUMULATE_64),
+    ADC_CHANNEL_CON2(ADC_MODE_OVERSAMPLE, ADC_ACCUMULATE_256)
+};
+
+#ifdef BOOT_PROFILE
+/* Boot profiler stage names of the core warm-up */
+static const char * const adcCoreReadyName[ADC_CORE_COUNT] =
+{
+    "AD1 ADRDY", "AD2 ADRDY", "AD3 ADRDY"
+};
+#endif
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: ADC_CoreReady(uint16_t) </B>
+*
+* @brief Function reads the ready bit of an ADC core.
+*        
+* @param core ADC core index, 0 for AD1.
+* @return ADxCON.ADRDY.
+*/
+static bool ADC_CoreReady(uint16_t core)
+{
+    switch (core)
+    {
+        case 0:     return AD1CONbits.ADRDY;
+        case 1:     return AD2CONbits.ADRDY;
+        default:    return AD3CONbits.ADRDY;
+    }
+}
+
+/**
+* <B> Function: ADC_ChannelRegister(uint16_t, uint16_t, uint16_t) </B>
+*
+* @brief Function returns a control register or the data register of a
+* channel.
+*        
+* @param core ADC core, 1 for AD1.
+* @param channel channel of the core.
+* @param reg ADC_CHANNEL_REG_CON1, ADC_CHANNEL_REG_CON2 or ADC_CHANNEL_REG_DATA.
+* @return channel register.
+*/
+static volatile uint32_t *ADC_ChannelRegister(uint16_t core, uint16_t channel,
+                                              uint16_t reg)
+{
+    if (reg == ADC_CHANNEL_REG_DATA)
+    {
+        switch ((core - 1)*ADC_CORE_CHANNEL_COUNT + channel)
+        {
+            ADC_CORE_CASES(1, DATA);
+            ADC_CORE_CASES(2, DATA);
+            ADC_CORE_CASES(3, DATA);
+            default:    return &AD3CH7DATA;
+        }
+    }
+    if (reg == ADC_CHANNEL_REG_CON2)
+    {
+        switch ((core - 1)*ADC_CORE_CHANNEL_COUNT + channel)
+        {
+            ADC_CORE_CASES(1, CON2);
+            ADC_CORE_CASES(2, CON2);
+            ADC_CORE_CASES(3, CON2);
+            default:    return &AD3CH7CON2;
+        }
+    }
+    switch ((core - 1)*ADC_CORE_CHANNEL_COUNT + channel)
+    {
+        ADC_CORE_CASES(1, CON1);
+        ADC_CORE_CASES(2, CON1);
+        ADC_CORE_CASES(3, CON1);
+        default:    return &AD3CH7CON1;
+    }
+}
+
+/**
+* <B> Function: ADC_PinAnalogSet(uint16_t, uint16_t) </B>
+*
+* @brief Function sets a pin to analog, ANSELx. The pins are inputs after
+* SetupGPIOPorts().
+*        
+* @param port port of the pin, ADC_PORT_A for PORTA.
+* @param pin pin of the port.
+* @return none.
+*/
+static void ADC_PinAnalogSet(uint16_t port, uint16_t pin)
+{
+    switch (port)
+    {
+        case ADC_PORT_A:    ANSELA |= (1UL << pin);     break;
+        case ADC_PORT_B:    ANSELB |= (1UL << pin);     break;
+        case ADC_PORT_C:    ANSELC |= (1UL << pin);     break;
+        case ADC_PORT_D:    ANSELD |= (1UL << pin);     break;
+        case ADC_PORT_E:    ANSELE |= (1UL << pin);     break;
+        default:            ANSELF |= (1UL << pin);     break;
+    }
+}
+
+/**
+* <B> Function: ADC_ChannelConfig(uint16_t, uint16_t) </B>
+*
+* @brief Function looks up the channel of a signal of a motor. Signals shared
+* by the motors (VBUS, POT) use their MC1 channel.
+*        
+* @param motor ADC_MOTOR_T.
+* @param signal ADC_SIGNAL_T.
+* @return channel assignment of the signal.
+*/
+static const ADC_CHANNEL_CONFIG_T *ADC_ChannelConfig(uint16_t motor, 
+                                                     uint16_t signal)
+{
+    const ADC_CHANNEL_CONFIG_T *pShared = &adcChannelConfig[0];
+    uint16_t i;
+
+    for (i = 0; i < ADC_CHANNEL_COUNT; i++)
+    {
+        if (adcChannelConfig[i].signal != signal)
+        {
+            continue;
+        }
+        if (adcChannelConfig[i].motor == motor)
+        {
+            return &adcChannelConfig[i];
+        }
+        if (adcChannelConfig[i].motor == ADC_MOTOR_MC1)
+        {
+            pShared = &adcChannelConfig[i];
+        }
+    }
+    return pShared;
+}
 
 // </editor-fold>
 
@@ -59,73 +357,85 @@
 /**
 * <B> Function: InitializeADCs() </B>
 *
-* @brief Function initializes and enable the ADC Module
+* @brief Function initializes and enable the ADC Module and waits until the
+* ADC cores are ready. The start-up sequence instead powers the cores up in
+* HAL_ConfigurePeripherals() and configures the channels in 
+* HAL_EnablePeripherals(), while the cores warm up.
 *        
 * @param none.
-* @return none.
+* @return true if all ADC cores are ready, false if ADC_CoresReadyWait() 
+* timed out.
 * 
 * @example
 * <CODE> InitializeADCs(); </CODE>
 *
 */
-void InitializeADCs(void)
+bool InitializeADCs(void)
 {
-    /* Channel Configuration for IA*/
-    /*ADC1 Channel 0 for IA : OA1OUT/AD1AN0/CVDAN2/CMP1A/RP3/RA2 */
-    AD1CH0CON1bits.PINSEL = 0;       
-    AD1CH0CON1bits.SAMC = 3;              
-    AD1CH0CON1bits.FRAC = 0;
-    AD1CH0CON1bits.DIFF = 0;
-
-    /* Channel Configuration for IB*/
-    /*ADC2 Channel 0 for IB : OA2OUT/AD2AN0/CVDAN16/CVDTX0/CMP2A/RP17/RB0 */    
-    AD2CH0CON1bits.PINSEL = 0;       
-    AD2CH0CON1bits.SAMC = 3;              
-    AD2CH0CON1bits.FRAC = 0;
-    AD2CH0CON1bits.DIFF = 0;
+    bool ready;
     
-    /* Channel Configuration for IBUS1*/
-    /*ADC3 Channel 0 for IBUS1 : OA3OUT/AD3AN0/CVDAN5/CMP3A/RP6/INT0/RA5 */ 
-    AD3CH0CON1bits.PINSEL = 0;      
-    AD3CH0CON1bits.SAMC = 3;      
-    AD3CH0CON1bits.FRAC = 0;
-    AD3CH0CON1bits.DIFF = 0;
-
-    /* Channel Configuration for IBUS2*/
-    /*ADC3 Channel 1 for IBUS2 : OA3OUT/AD3AN0/CVDAN5/CMP3A/RP6/INT0/RA5 */ 
-    AD3CH1CON1bits.PINSEL = 0;      
-    AD3CH1CON1bits.SAMC = 3;      
-    AD3CH1CON1bits.FRAC = 0;
-    AD3CH1CON1bits.DIFF = 0;
+    ADC_AnalogInputsSet();
     
-    /* Channel Configuration for POT*/
-    /*ADC2 Channel 1 for POT : AD2AN5/CVDAN31/CVDTX15/RP32/RB15 */     
-    AD2CH1CON1bits.PINSEL = 5;      
-    AD2CH1CON1bits.SAMC = 3;              
-    AD2CH1CON1bits.FRAC = 0;
-    AD2CH1CON1bits.DIFF = 0;
-
-    /* Channel Configuration for VBUS*/
-    /*ADC1 Channel 4 for VBUS : AD3AN4/CVDTX29/RP81/RF0 */     
-    AD3CH2CON1bits.PINSEL = 4;   
-    AD3CH2CON1bits.SAMC = 3;         
-    AD3CH2CON1bits.FRAC = 0;
-    AD3CH2CON1bits.DIFF = 0;
-    
-    /* Turn on the ADC Core 1 */   
-    AD1CONbits.ON = 1;     
-    /* Waiting till the ADC Core 1 is ready*/
-    while(AD1CONbits.ADRDY == 0);  
-    
-    /* Turn on the ADC Core 2 */
-    AD2CONbits.ON = 1;             
-    /* Waiting till the ADC Core 2 is ready*/
-    while(AD2CONbits.ADRDY == 0);   
-    
-    /* Turn on the ADC Core 3 */   
-    AD3CONbits.ON = 1;     
-    /* Waiting till the ADC Core 3 is ready*/
-    while(AD3CONbits.ADRDY == 0);  
+    /* Turn on the ADC cores and wait until all of them are ready, the 
+       warm-up times of the cores overlap */
+    ADC_CoresPowerUp();
+    ADC_ChannelsConfigure();
+    BOOT_PROFILE_BEGIN("ADC cores ready");
+    ready = ADC_CoresReadyWait();
+    BOOT_PROFILE_END();
+    return ready;
+}
+
+/**
+* <B> Function: ADC_AnalogInputsSet() </B>
+*
+* @brief Function sets the input pins of all channels of adcChannelConfig[]
+* to analog. Call it after SetupGPIOPorts(), which sets all pins digital.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> ADC_AnalogInputsSet(); </CODE>
+*
+*/
+void ADC_AnalogInputsSet(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < ADC_CHANNEL_COUNT; i++)
+    {
+        ADC_PinAnalogSet(adcChannelConfig[i].port, adcChannelConfig[i].pin);
+    }
+}
+
+/**
+* <B> Function: ADC_ChannelsConfigure() </B>
+*
+* @brief Function writes the input and the trigger of the channels of the 
+* three motors, looks up the registers of the ADC frame and sets up the ADC
+* interrupts, left disabled.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> ADC_ChannelsConfigure(); </CODE>
+*
+*/
+void ADC_ChannelsConfigure(void)
+{
+    const ADC_CHANNEL_CONFIG_T *pConfig;
+    uint16_t i;
+
+    /* Channel configuration of the three motors */
+    for (i = 0; i < ADC_CHANNEL_COUNT; i++)
+    {
+        pConfig = &adcChannelConfig[i];
+        *ADC_ChannelRegister(pConfig->core, pConfig->channel, 
+                             ADC_CHANNEL_REG_CON1) = pConfig->con1;
+    }
+    ADC_FrameInit();
 
 #ifdef SINGLE_SHUNT 
     /*AD3CH1 - IBUS2 used for ADC Interrupt in Single Shunt*/
@@ -144,26 +454,392 @@ void InitializeADCs(void)
     /* Disable the AD2CH1 interrupt  */
     _AD2CH1IE = 0;
 #endif
+    /* MC2 and MC3 interrupt on their last current channel, IPL 7 */
+    MC2_ADC_INTERRUPT_PRIORITY = 7;
+    MC2_ClearADCIF();
+    MC2_DisableADCInterrupt();
+    MC3_ADC_INTERRUPT_PRIORITY = 7;
+    MC3_ClearADCIF();
+    MC3_DisableADCInterrupt();
+}
+
+/**
+* <B> Function: ADC_CoresPowerUp() </B>
+*
+* @brief Function turns on the ADC cores AD1-AD3 back to back and returns 
+* without waiting for them. Poll ADC_CoresReady() until it returns true, or
+* call ADC_CoresReadyWait(), before the first conversion is triggered.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> ADC_CoresPowerUp(); </CODE>
+*
+*/
+void ADC_CoresPowerUp(void)
+{
+    adcCoreStatus.readyMask = 0;
+    adcCoreStatus.polls = 0;
+    adcCoreStatus.startNs = BOOT_PROFILE_NOW();
     
-    /*Selecting the Trigger Sources for ADC Channels*/
-#ifdef SINGLE_SHUNT 
-    /*PWM2 ADC Trigger 1 for IBUS1 - AD3CH0*/
-    AD3CH0CON1bits.TRG1SRC = 6;   
-    /*PWM2 ADC Trigger 2 for IBUS2 - AD3CH1*/
-    AD3CH1CON1bits.TRG1SRC = 7;    
-#else 
-    /*PWM1 ADC Trigger 1 for IA - AD1CH0*/
-    AD1CH0CON1bits.TRG1SRC = 4;      
-    /*PWM1 ADC Trigger 1 for IB - AD2CH0*/
-    AD2CH0CON1bits.TRG1SRC = 4;    
+    AD1CONbits.ON = 1;
+    AD2CONbits.ON = 1;
+    AD3CONbits.ON = 1;
+}
 
-#endif
-    /*PWM1 ADC Trigger 1 for POT - AD2CH1*/
-    AD2CH1CON1bits.TRG1SRC = 4;      
+/**
+* <B> Function: ADC_CoresReady() </B>
+*
+* @brief Function polls the ADC cores that have not reported ready yet and
+* records the poll, and with BOOT_PROFILE the time, at which each of them
+* became ready.
+*        
+* @param none.
+* @return true once all ADC cores are ready.
+* 
+* @example
+* <CODE> while (ADC_CoresReady() == false); </CODE>
+*
+*/
+bool ADC_CoresReady(void)
+{
+    uint16_t i;
+
+    adcCoreStatus.polls++;
+    for (i = 0; i < ADC_CORE_COUNT; i++)
+    {
+        if (((adcCoreStatus.readyMask & (1 << i)) == 0) && ADC_CoreReady(i))
+        {
+            adcCoreStatus.readyMask |= (1 << i);
+            adcCoreStatus.readyPolls[i] = adcCoreStatus.polls;
+            BOOT_PROFILE_RECORD(adcCoreReadyName[i], adcCoreStatus.startNs);
+        }
+    }
+    return (adcCoreStatus.readyMask == ADC_CORE_READY_ALL);
+}
+
+/**
+* <B> Function: ADC_CoresReadyWait() </B>
+*
+* @brief Function polls ADC_CoresReady() until all ADC cores are ready or
+* CLOCK_TIMEOUT_MICROSEC has passed, timed with Timer1 on the FRC like the 
+* clock bring-up. After a timeout the cleared bits of adcCoreStatus.readyMask
+* are the cores that never reported ADRDY.
+*        
+* @param none.
+* @return true if all ADC cores are ready, false on timeout.
+* 
+* @example
+* <CODE> if (ADC_CoresReadyWait() == false) { return false; } </CODE>
+*
+*/
+bool ADC_CoresReadyWait(void)
+{
+    uint32_t start;
+    bool timer, ready;
+
+    /* The boot profiler may run Timer1 already with the same clock, it is
+       then only read */
+    timer = (T1CONbits.ON == 0);
+    if (timer)
+    {
+        TIMER1_Initialize();
+        TIMER1_InputClockFrcSet();
+        TIMER1_PeriodSet(0xFFFFFFFF);
+        TIMER1_CounterClear();
+        TIMER1_ModuleStart();
+    }
+    
+    start = TIMER1_CounterRead();
+    do
+    {
+        ready = ADC_CoresReady();
+    }
+    while ((ready == false) && 
+           ((TIMER1_CounterRead() - start) < CLOCK_TIMEOUT_COUNTS));
+    
+    if (timer)
+    {
+        TIMER1_ModuleStop();
+    }
+    return ready;
+}
+
+/**
+* <B> Function: ADC_FrameSamplesUpdate() </B>
+*
+* @brief Function reads the conversions per result of the current channels
+* of all motors for ADC_FrameCapture(). Call it after the mode of a channel
+* changed.
+*        
+* @param none.
+* @return none.
+*/
+static void ADC_FrameSamplesUpdate(void)
+{
+    uint16_t motor, signal;
+
+    adcFrameAccumulating = false;
+    for (signal = ADC_SIGNAL_IA; signal <= ADC_SIGNAL_IBUS2; signal++)
+    {
+        for (motor = 0; motor < ADC_MOTOR_COUNT; motor++)
+        {
+            adcFrameSamples[signal][motor] = ADC_ChannelSamples(motor, signal);
+            if (adcFrameSamples[signal][motor] > 1)
+            {
+                adcFrameAccumulating = true;
+            }
+        }
+    }
+}
+
+/**
+* <B> Function: ADC_FrameSum(uint16_t, uint16_t) </B>
+*
+* @brief Function reads the sum of an accumulating current channel in the 
+* Q15 format of ADC_FRAME_T.
+*        
+* @param signal ADC_SIGNAL_IA to ADC_SIGNAL_IBUS2.
+* @param motor ADC_MOTOR_T.
+* @return sum of the conversions.
+*/
+static int32_t ADC_FrameSum(uint16_t signal, uint16_t motor)
+{
+    uint16_t samples = adcFrameSamples[signal][motor];
+    uint32_t sum = *adcFrameData[signal][motor];
+
+    if (signal <= ADC_SIGNAL_IB)
+    {
+        return ADC_ACCUMULATED_PHASE_CURRENT(sum, samples);
+    }
+    return ADC_ACCUMULATED_BUS_CURRENT(sum, samples);
+}
+
+/**
+* <B> Function: ADC_ChannelData(uint16_t, uint16_t) </B>
+*
+* @brief Function returns the data register of a signal of a motor from the
+* channel assignment. Signals shared by the motors (VBUS, POT) are read 
+* from their MC1 channel. Look the register up once at initialization, not
+* in the control loop.
+*        
+* @param motor ADC_MOTOR_T.
+* @param signal ADC_SIGNAL_T.
+* @return ADxCHyDATA register of the signal.
+* 
+* @example
+* <CODE> pIa = ADC_ChannelData(ADC_MOTOR_MC2, ADC_SIGNAL_IA); </CODE>
+*
+*/
+volatile uint32_t *ADC_ChannelData(uint16_t motor, uint16_t signal)
+{
+    const ADC_CHANNEL_CONFIG_T *pConfig = ADC_ChannelConfig(motor, signal);
+
+    return ADC_ChannelRegister(pConfig->core, pConfig->channel, 
+                               ADC_CHANNEL_REG_DATA);
+}
+
+/**
+* <B> Function: ADC_ChannelAccumulate(uint16_t, uint16_t, uint16_t) </B>
+*
+* @brief Function puts the channel of a signal of a motor in oversampling 
+* mode. The channel then converts on each of its triggers and updates its 
+* data register and interrupt with the sum of ADC_ACCUMULATE_SAMPLES(accnum) 
+* conversions. Change the mode while the channel is not triggered, the 
+* accumulation restarts with the next trigger.
+*        
+* @param motor ADC_MOTOR_T.
+* @param signal ADC_SIGNAL_T.
+* @param accnum ADC_ACCUMULATE_T.
+* @return none.
+* 
+* @example
+* <CODE> ADC_ChannelAccumulate(ADC_MOTOR_MC1, ADC_SIGNAL_IA, 
+*                              ADC_ACCUMULATE_256); </CODE>
+*
+*/
+void ADC_ChannelAccumulate(uint16_t motor, uint16_t signal, uint16_t accnum)
+{
+    const ADC_CHANNEL_CONFIG_T *pConfig = ADC_ChannelConfig(motor, signal);
+
+    if (accnum >= ADC_ACCUMULATE_COUNT)
+    {
+        accnum = ADC_ACCUMULATE_256;
+    }
+    *ADC_ChannelRegister(pConfig->core, pConfig->channel, 
+                         ADC_CHANNEL_REG_CON2) = adcAccumulateCon2[accnum];
+    ADC_FrameSamplesUpdate();
+}
+
+/**
+* <B> Function: ADC_ChannelSingle(uint16_t, uint16_t) </B>
+*
+* @brief Function returns the channel of a signal of a motor to single 
+* conversion mode, one result per trigger.
+*        
+* @param motor ADC_MOTOR_T.
+* @param signal ADC_SIGNAL_T.
+* @return none.
+* 
+* @example
+* <CODE> ADC_ChannelSingle(ADC_MOTOR_MC1, ADC_SIGNAL_IA); </CODE>
+*
+*/
+void ADC_ChannelSingle(uint16_t motor, uint16_t signal)
+{
+    const ADC_CHANNEL_CONFIG_T *pConfig = ADC_ChannelConfig(motor, signal);
+
+    *ADC_ChannelRegister(pConfig->core, pConfig->channel, 
+                         ADC_CHANNEL_REG_CON2) = 
+        ADC_CHANNEL_CON2(ADC_MODE_SINGLE, 0);
+    ADC_FrameSamplesUpdate();
+}
+
+/**
+* <B> Function: ADC_ChannelSamples(uint16_t, uint16_t) </B>
+*
+* @brief Function returns the conversions summed in each result of the 
+* channel of a signal of a motor, from its ADxCHyCON2.
+*        
+* @param motor ADC_MOTOR_T.
+* @param signal ADC_SIGNAL_T.
+* @return 1 in single conversion mode, ADC_ACCUMULATE_SAMPLES(accnum) in 
+* oversampling mode.
+* 
+* @example
+* <CODE> samples = ADC_ChannelSamples(ADC_MOTOR_MC1, ADC_SIGNAL_IA); </CODE>
+*
+*/
+uint16_t ADC_ChannelSamples(uint16_t motor, uint16_t signal)
+{
+    const ADC_CHANNEL_CONFIG_T *pConfig = ADC_ChannelConfig(motor, signal);
+    uint32_t con2 = *ADC_ChannelRegister(pConfig->core, pConfig->channel, 
+                                         ADC_CHANNEL_REG_CON2);
+
+    if (((con2 & _AD1CH0CON2_MODE_MASK) >> _AD1CH0CON2_MODE_POSITION) != 
+            ADC_MODE_OVERSAMPLE)
+    {
+        return 1;
+    }
+    return ADC_ACCUMULATE_SAMPLES(
+        (con2 & _AD1CH0CON2_ACCNUM_MASK) >> _AD1CH0CON2_ACCNUM_POSITION);
+}
+
+/**
+* <B> Function: ADC_FrameInit() </B>
+*
+* @brief Function looks up the data registers of all signals of all motors 
+* and the conversions per result of the current channels for 
+* ADC_FrameCapture() and clears the frames.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> ADC_FrameInit(); </CODE>
+*
+*/
+void ADC_FrameInit(void)
+{
+    uint16_t motor, signal;
+
+    for (signal = 0; signal < ADC_SIGNAL_COUNT; signal++)
+    {
+        for (motor = 0; motor < ADC_MOTOR_COUNT; motor++)
+        {
+            adcFrameData[signal][motor] = ADC_ChannelData(motor, signal);
+        }
+    }
+    ADC_FrameSamplesUpdate();
+    adcFrames.ready = 0;
+    adcFrames.sequence = 0;
+    adcFrames.frame[0] = (ADC_FRAME_T){ .sequence = 0 };
+    adcFrames.frame[1] = adcFrames.frame[0];
+}
+
+/**
+* <B> Function: ADC_FrameCapture() </B>
+*
+* @brief Function copies the results of all motors into the frame not read 
+* by the control loops and then publishes it as the latest frame. Call it 
+* from one interrupt at the end of the PWM period, after the last conversion
+* of the three motors, instead of reading the results in one interrupt per 
+* motor. The sums of the current channels in oversampling mode go to the sum
+* fields of the frame.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> ADC_FrameCapture(); </CODE>
+*
+*/
+void ADC_FrameCapture(void)
+{
+    ADC_FRAME_T *pFrame = &adcFrames.frame[adcFrames.ready ^ 1];
+    uint16_t motor;
+
+    for (motor = 0; motor < ADC_MOTOR_COUNT; motor++)
+    {
+        pFrame->Ia[motor] = 
+            ADC_FRAME_PHASE_CURRENT(*adcFrameData[ADC_SIGNAL_IA][motor]);
+        pFrame->Ib[motor] = 
+            ADC_FRAME_PHASE_CURRENT(*adcFrameData[ADC_SIGNAL_IB][motor]);
+        pFrame->Ibus1[motor] = 
+            ADC_FRAME_BUS_CURRENT(*adcFrameData[ADC_SIGNAL_IBUS1][motor]);
+        pFrame->Ibus2[motor] = 
+            ADC_FRAME_BUS_CURRENT(*adcFrameData[ADC_SIGNAL_IBUS2][motor]);
+        pFrame->Va[motor] = (int16_t)*adcFrameData[ADC_SIGNAL_VA][motor];
+        pFrame->Vb[motor] = (int16_t)*adcFrameData[ADC_SIGNAL_VB][motor];
+        pFrame->Vc[motor] = (int16_t)*adcFrameData[ADC_SIGNAL_VC][motor];
+    }
+    pFrame->vbus = (int16_t)*adcFrameData[ADC_SIGNAL_VBUS][ADC_MOTOR_MC1];
+    pFrame->pot = (int16_t)*adcFrameData[ADC_SIGNAL_POT][ADC_MOTOR_MC1];
+    if (adcFrameAccumulating)
+    {
+        for (motor = 0; motor < ADC_MOTOR_COUNT; motor++)
+        {
+            if (adcFrameSamples[ADC_SIGNAL_IA][motor] > 1)
+            {
+                pFrame->IaSum[motor] = ADC_FrameSum(ADC_SIGNAL_IA, motor);
+            }
+            if (adcFrameSamples[ADC_SIGNAL_IB][motor] > 1)
+            {
+                pFrame->IbSum[motor] = ADC_FrameSum(ADC_SIGNAL_IB, motor);
+            }
+            if (adcFrameSamples[ADC_SIGNAL_IBUS1][motor] > 1)
+            {
+                pFrame->Ibus1Sum[motor] = ADC_FrameSum(ADC_SIGNAL_IBUS1, motor);
+            }
+            if (adcFrameSamples[ADC_SIGNAL_IBUS2][motor] > 1)
+            {
+                pFrame->Ibus2Sum[motor] = ADC_FrameSum(ADC_SIGNAL_IBUS2, motor);
+            }
+        }
+    }
+    pFrame->sequence = adcFrames.sequence++;
     
-    /*PWM1 ADC Trigger 1 for VBUS - AD3CH2*/
-    AD3CH2CON1bits.TRG1SRC = 4;     
+    adcFrames.ready ^= 1;
+}
 
+/**
+* <B> Function: ADC_FrameLatest() </B>
+*
+* @brief Function returns the last complete frame. It stays valid until the 
+* next-but-one ADC_FrameCapture(); compare its sequence to detect that a 
+* capture overtook the reader.
+*        
+* @param none.
+* @return last complete frame.
+* 
+* @example
+* <CODE> pFrame = ADC_FrameLatest(); </CODE>
+*
+*/
+const ADC_FRAME_T *ADC_FrameLatest(void)
+{
+    return &adcFrames.frame[adcFrames.ready];
 }
 
-// </editor-fold>
\ No newline at end of file
+// </editor-fold>
@@ -54,6 +54,7 @@
         
 #include <xc.h>
 #include <stdint.h>
+#include <stdbool.h>
         
 // </editor-fold>
 
@@ -91,11 +92,197 @@
     #define MC1_ClearADCIF()           			_AD2CH1IF = 0  
     #define MC1_ClearADCIF_ReadADCBUF()         MC1_ADCBUF_POT 
 #endif
+
+#ifdef SINGLE_SHUNT
+    /* IBUS2 (AD3CH5, AD3CH7) is the ADC Interrupt source in Single Shunt */
+    #define MC2_EnableADCInterrupt()            _AD3CH5IE = 1
+    #define MC2_DisableADCInterrupt()           _AD3CH5IE = 0
+    #define MC2_ADC_INTERRUPT                   _AD3CH5Interrupt
+    #define MC2_ADC_INTERRUPT_PRIORITY          _AD3CH5IP
+    #define MC2_ClearADCIF()                    _AD3CH5IF = 0
+    #define MC3_EnableADCInterrupt()            _AD3CH7IE = 1
+    #define MC3_DisableADCInterrupt()           _AD3CH7IE = 0
+    #define MC3_ADC_INTERRUPT                   _AD3CH7Interrupt
+    #define MC3_ADC_INTERRUPT_PRIORITY          _AD3CH7IP
+    #define MC3_ClearADCIF()                    _AD3CH7IF = 0
+#else
+    /* IB (AD2CH3, AD2CH5) is the ADC Interrupt source in Dual Shunt, IA 
+       converts at the same time on AD1 */
+    #define MC2_EnableADCInterrupt()            _AD2CH3IE = 1
+    #define MC2_DisableADCInterrupt()           _AD2CH3IE = 0
+    #define MC2_ADC_INTERRUPT                   _AD2CH3Interrupt
+    #define MC2_ADC_INTERRUPT_PRIORITY          _AD2CH3IP
+    #define MC2_ClearADCIF()                    _AD2CH3IF = 0
+    #define MC3_EnableADCInterrupt()            _AD2CH5IE = 1
+    #define MC3_DisableADCInterrupt()           _AD2CH5IE = 0
+    #define MC3_ADC_INTERRUPT                   _AD2CH5Interrupt
+    #define MC3_ADC_INTERRUPT_PRIORITY          _AD2CH5IP
+    #define MC3_ClearADCIF()                    _AD2CH5IF = 0
+#endif
+
+/* Signal whose channel interrupts for a motor, MCx_ADC_INTERRUPT */
+#ifdef SINGLE_SHUNT
+#define ADC_INTERRUPT_SIGNAL(motor)     ADC_SIGNAL_IBUS2
+#else
+#define ADC_INTERRUPT_SIGNAL(motor)                                            \
+    (((motor) == ADC_MOTOR_MC1) ? ADC_SIGNAL_POT : ADC_SIGNAL_IB)
+#endif
+
+/* ADC cores AD1-AD3, powered up together by ADC_CoresPowerUp() */
+#define ADC_CORE_COUNT          3
+#define ADC_CORE_READY_ALL      ((1 << ADC_CORE_COUNT) - 1)
+/* Channels ADxCH0-ADxCH7 of each core */
+#define ADC_CORE_CHANNEL_COUNT  8
+
+/* Conversions summed by a channel in oversampling mode, ADC_ACCUMULATE_T */
+#define ADC_ACCUMULATE_SAMPLES(accnum)  (4U << (2*(accnum)))
+
+/* Conversion of a data register to the Q15 format of MC1_ADCBUF_IA (phase)
+   and ADCBUF_IBUS1 (bus), as in ADC_FRAME_T */
+#define ADC_FRAME_PHASE_CURRENT(data)                                          \
+    (int16_t)((HALF_ADC_COUNT - (int32_t)(data))*16)
+#define ADC_FRAME_BUS_CURRENT(data)                                            \
+    (int16_t)(((int32_t)(data) - HALF_ADC_COUNT)*16)
+
+/* Sum of the conversions of an accumulating current channel in the Q15 
+   format of MC1_ADCBUF_IA (phase) and ADCBUF_IBUS1 (bus) */
+#define ADC_ACCUMULATED_PHASE_CURRENT(sum, samples)                            \
+    (((int32_t)(samples)*HALF_ADC_COUNT - (int32_t)(sum))*16)
+#define ADC_ACCUMULATED_BUS_CURRENT(sum, samples)                              \
+    (((int32_t)(sum) - (int32_t)(samples)*HALF_ADC_COUNT)*16)
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+/* Motors and the PWM generators that trigger their channels */
+typedef enum
+{
+    ADC_MOTOR_MC1 = 0,      /* PG1-PG3 */
+    ADC_MOTOR_MC2,          /* APG1-APG3 */
+    ADC_MOTOR_MC3,          /* PG6-PG8 */
+    ADC_MOTOR_COUNT
+} ADC_MOTOR_T;
+
+typedef enum
+{
+    ADC_SIGNAL_IA = 0,      /* Phase currents, dual shunt */
+    ADC_SIGNAL_IB,
+    ADC_SIGNAL_IBUS1,       /* Bus current samples, single shunt */
+    ADC_SIGNAL_IBUS2,
+    ADC_SIGNAL_VBUS,        /* DC bus voltage */
+    ADC_SIGNAL_VA,          /* Phase voltages */
+    ADC_SIGNAL_VB,
+    ADC_SIGNAL_VC,
+    ADC_SIGNAL_POT,         /* Speed reference potentiometer */
+    ADC_SIGNAL_COUNT
+} ADC_SIGNAL_T;
+
+/* Conversions accumulated per result, ADxCHyCON2.ACCNUM */
+typedef enum
+{
+    ADC_ACCUMULATE_4 = 0,
+    ADC_ACCUMULATE_16,
+    ADC_ACCUMULATE_64,
+    ADC_ACCUMULATE_256,
+    ADC_ACCUMULATE_COUNT
+} ADC_ACCUMULATE_T;
+
+/* Channel assigned to a signal of a motor */
+typedef struct
+{
+    uint8_t
+        motor,              /* ADC_MOTOR_T */
+        signal,             /* ADC_SIGNAL_T */
+        core,               /* ADC core, 1 for AD1 */
+        channel,            /* Channel of the core, ADxCHy */
+        port,               /* Port of the input pin, 0 for PORTA */
+        pin;                /* Pin of the port, set analog in ANSELx */
+    
+    uint32_t
+        con1;               /* ADxCHyCON1, input and trigger source */
+    
+} ADC_CHANNEL_CONFIG_T;
+
+/* Results of all motors of one PWM period. Currents in the Q15 format of 
+   MC1_ADCBUF_IA (phase) and ADCBUF_IBUS1 (bus), voltages in ADC counts as 
+   MC_ADCBUF_VDC. One array per signal, indexed by ADC_MOTOR_T. The sums of 
+   a current channel in oversampling mode, ADC_ChannelSamples() > 1, are in
+   the sum fields, the 16-bit result of such a channel is not valid */
+typedef struct
+{
+    int16_t
+        Ia[ADC_MOTOR_COUNT],
+        Ib[ADC_MOTOR_COUNT],
+        Ibus1[ADC_MOTOR_COUNT],
+        Ibus2[ADC_MOTOR_COUNT],
+        Va[ADC_MOTOR_COUNT],
+        Vb[ADC_MOTOR_COUNT],
+        Vc[ADC_MOTOR_COUNT],
+        vbus,               /* Shared by the motors */
+        pot;
+    
+    int32_t
+        IaSum[ADC_MOTOR_COUNT], /* Sums of the conversions in the Q15 */
+        IbSum[ADC_MOTOR_COUNT], /* format of the currents */
+        Ibus1Sum[ADC_MOTOR_COUNT],
+        Ibus2Sum[ADC_MOTOR_COUNT];
+    
+    uint16_t
+        sequence;           /* Frames captured before this one */
+    
+} ADC_FRAME_T;
+
+typedef struct
+{
+    ADC_FRAME_T
+        frame[2];           /* Frame being filled and last complete frame */
+    
+    volatile uint16_t
+        ready;              /* Index of the last complete frame */
+    
+    uint16_t
+        sequence;           /* Frames captured */
+    
+} ADC_FRAMES_T;
+
+typedef struct
+{
+    uint8_t
+        readyMask;          /* Bit n set once core n+1 reported ADRDY */
+    
+    uint16_t
+        polls,              /* ADC_CoresReady() calls since power-up */
+        readyPolls[ADC_CORE_COUNT]; /* Poll that saw ADRDY of each core */
+    
+    uint32_t
+        startNs;            /* Boot profiler time of the power-up */
+    
+} ADC_CORE_STATUS_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="VARIABLES ">
+
+extern ADC_CORE_STATUS_T adcCoreStatus;
+extern ADC_FRAMES_T adcFrames;
+
 // </editor-fold>
         
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
         
-void InitializeADCs(void);
+bool InitializeADCs(void);
+void ADC_AnalogInputsSet(void);
+void ADC_ChannelsConfigure(void);
+void ADC_CoresPowerUp(void);
+bool ADC_CoresReady(void);
+bool ADC_CoresReadyWait(void);
+volatile uint32_t *ADC_ChannelData(uint16_t motor, uint16_t signal);
+void ADC_ChannelAccumulate(uint16_t motor, uint16_t signal, uint16_t accnum);
+void ADC_ChannelSingle(uint16_t motor, uint16_t signal);
+uint16_t ADC_ChannelSamples(uint16_t motor, uint16_t signal);
+void ADC_FrameInit(void);
+void ADC_FrameCapture(void);
+const ADC_FRAME_T *ADC_FrameLatest(void);
 
 // </editor-fold>
 
@@ -61,14 +61,66 @@
 * @brief Function to initialize the peripheral PWM
 *        
 * @param none.
-* @return none.
+* @return false if the ADC cores did not become ready, see 
+* HAL_EnablePeripherals().
 * 
 * @example
 * <CODE> HAL_InitPeripherals(); </CODE>
 *
 */
-void HAL_InitPeripherals(void)
+bool HAL_InitPeripherals(void)
+{                    
+    HAL_ConfigurePeripherals();
+    return HAL_EnablePeripherals();
+}
+
+/**
+* <B> Function: HAL_ConfigurePeripherals() </B>
+*
+* @brief Function writes the peripheral registers with the peripherals left
+* disabled. It may run on FRC while the clock bring-up is in progress. The 
+* ADC cores are powered up here, their warm-up overlaps the bring-up.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> HAL_ConfigurePeripherals(); </CODE>
+*
+*/
+void HAL_ConfigurePeripherals(void)
+{                    
+    PWM_ConfigureGenerators(); 
+    ADC_AnalogInputsSet();
+    ADC_CoresPowerUp();
+}
+
+/**
+* <B> Function: HAL_EnablePeripherals() </B>
+*
+* @brief Function enables the peripherals configured by 
+* HAL_ConfigurePeripherals(). Call it once the clock bring-up is ready. It
+* configures the ADC channels and waits until the ADC cores are ready 
+* before the PWM generators start triggering conversions. If a core does 
+* not become ready within CLOCK_TIMEOUT_MICROSEC the PWM generators stay 
+* disabled; adcCoreStatus.readyMask shows the cores that did.
+*        
+* @param none.
+* @return true if the PWM generators are enabled, false if the ADC cores 
+* did not become ready.
+* 
+* @example
+* <CODE> if (HAL_EnablePeripherals()) { MotorControlStart(); } </CODE>
+*
+*/
+bool HAL_EnablePeripherals(void)
 {                    
-    InitPWMGenerators(); 
+    ADC_ChannelsConfigure();
+    if (ADC_CoresReadyWait() == false)
+    {
+        return false;
+    }
+    PWM_EnableGenerators(); 
+    return true;
 }
 // </editor-fold>
\ No newline at end of file
@@ -49,6 +49,7 @@
 
 #include "clock.h"
 #include "pwm.h"
+#include "adc.h"
 #include "port_config.h"
 
 // </editor-fold>
@@ -63,7 +64,9 @@
 
 // <editor-fold defaultstate="collapsed" desc="INTERFACE FUNCTIONS ">
 
-void HAL_InitPeripherals(void);
+bool HAL_InitPeripherals(void);
+void HAL_ConfigurePeripherals(void);
+bool HAL_EnablePeripherals(void);
 
 // </editor-fold>
 
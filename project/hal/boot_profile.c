@@ -0,0 +1,371 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file boot_profile.c
+ *
+ * @brief This module implements the boot time profiler.
+ * 
+ * Timer1 runs free from BootProfile_Start() with a 1:1 pre-scaler on the
+ * 8 MHz FRC, selected as its external clock, so that its rate does not 
+ * change when the system clock switches to PLL1 FOUT. Timestamps have a
+ * resolution of 125 ns; the time is kept in ns and wraps after 4.29 s. 
+ * BootProfile_Report() ends the profile and stops Timer1, which is then 
+ * free for the control (fast_loop.c).
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: HAL
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <xc.h>
+#include <stdint.h>
+
+#include "boot_profile.h"
+#include "timer1.h"
+#include "uart1.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Timer1 counts the 8 MHz FRC */
+#define BOOT_PROFILE_NS_PER_COUNT       (1000000000UL/TIMER1_FRC_CLOCK)
+/* UART1 clock from Clock Generator 8, see InitOscillator() */
+#define BOOT_PROFILE_UART_CLOCK         100000000UL
+/* Standard speed mode: Baud Rate = FREQ_UART_CLK/(16*(BRG+1)) */
+#define BOOT_PROFILE_UART_BRG                                                  \
+    ((BOOT_PROFILE_UART_CLOCK + 8*BOOT_PROFILE_BAUD_RATE)/                     \
+     (16*BOOT_PROFILE_BAUD_RATE) - 1)
+
+/* Column of the start time in the report */
+#define BOOT_PROFILE_NAME_WIDTH         28
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+BOOT_PROFILE_T bootProfile;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: BootProfile_PutChar(char) </B>
+*
+* @brief Function writes one character to UART1, waiting while the transmit
+* buffer is full.
+*        
+* @param character character.
+* @return none.
+*/
+static void BootProfile_PutChar(char character)
+{
+    while (UART1_StatusBufferFullTransmitGet());
+    UART1_DataWrite((uint32_t)(uint8_t)character);
+}
+
+/**
+* <B> Function: BootProfile_PutString(const char *, uint16_t) </B>
+*
+* @brief Function writes a string to UART1, padded with spaces to a width.
+*        
+* @param pString string.
+* @param width minimum number of characters written.
+* @return none.
+*/
+static void BootProfile_PutString(const char *pString, uint16_t width)
+{
+    uint16_t count = 0;
+
+    while (*pString != '\0')
+    {
+        BootProfile_PutChar(*pString++);
+        count++;
+    }
+    while (count++ < width)
+    {
+        BootProfile_PutChar(' ');
+    }
+}
+
+/**
+* <B> Function: BootProfile_PutMicrosec(uint32_t) </B>
+*
+* @brief Function writes a time in ns to UART1 as micro seconds with two
+* decimals, right aligned in 12 characters.
+*        
+* @param timeNs time in ns.
+* @return none.
+*/
+static void BootProfile_PutMicrosec(uint32_t timeNs)
+{
+    char digits[12];
+    uint32_t value = timeNs/10;
+    int16_t i = sizeof(digits);
+
+    do
+    {
+        digits[--i] = (char)('0' + value%10);
+        value /= 10;
+        if (i == (int16_t)sizeof(digits) - 2)
+        {
+            digits[--i] = '.';
+        }
+    } while ((value != 0) || (i > (int16_t)sizeof(digits) - 4));
+
+    while (i > 0)
+    {
+        digits[--i] = ' ';
+    }
+    for (i = 0; i < (int16_t)sizeof(digits); i++)
+    {
+        BootProfile_PutChar(digits[i]);
+    }
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: BootProfile_Start() </B>
+*
+* @brief Function clears the profile and starts Timer1 as a free running 
+* counter. Call it first in main().
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> BootProfile_Start(); </CODE>
+*
+*/
+void BootProfile_Start(void)
+{
+    bootProfile.count = 0;
+    bootProfile.depth = 0;
+    bootProfile.nowNs = 0;
+    bootProfile.lastCount = 0;
+
+    TIMER1_Initialize();
+    TIMER1_InputClockFrcSet();
+    TIMER1_PeriodSet(0xFFFFFFFF);
+    TIMER1_CounterClear();
+    TIMER1_ModuleStart();
+    
+    BootProfile_Now();
+}
+
+/**
+* <B> Function: BootProfile_Now() </B>
+*
+* @brief Function returns the time since BootProfile_Start().
+*        
+* @param none.
+* @return time in ns.
+* 
+* @example
+* <CODE> timeNs = BootProfile_Now(); </CODE>
+*
+*/
+uint32_t BootProfile_Now(void)
+{
+    uint32_t count = TIMER1_CounterRead();
+
+    bootProfile.nowNs += (count - bootProfile.lastCount)*
+                            BOOT_PROFILE_NS_PER_COUNT;
+    bootProfile.lastCount = count;
+
+    return bootProfile.nowNs;
+}
+
+/**
+* <B> Function: BootProfile_Begin(const char *) </B>
+*
+* @brief Function records the start of a stage. Stages nest and are closed
+* by BootProfile_End(), stages deeper than BOOT_PROFILE_DEPTH are not
+* recorded.
+*        
+* @param pName stage name, a string literal.
+* @return none.
+* 
+* @example
+* <CODE> BootProfile_Begin("InitOscillator"); </CODE>
+*
+*/
+void BootProfile_Begin(const char *pName)
+{
+    uint32_t nowNs = BootProfile_Now();
+    BOOT_PROFILE_ENTRY_T *pEntry;
+
+    if (bootProfile.depth < BOOT_PROFILE_DEPTH)
+    {
+        bootProfile.open[bootProfile.depth] = BOOT_PROFILE_ENTRY_COUNT;
+        if (bootProfile.count < BOOT_PROFILE_ENTRY_COUNT)
+        {
+            pEntry = &bootProfile.entry[bootProfile.count];
+            pEntry->pName = pName;
+            pEntry->depth = bootProfile.depth;
+            pEntry->startNs = nowNs;
+            pEntry->endNs = nowNs;
+            bootProfile.open[bootProfile.depth] = (uint8_t)bootProfile.count;
+        }
+        bootProfile.count++;
+    }
+    bootProfile.depth++;
+}
+
+/**
+* <B> Function: BootProfile_End() </B>
+*
+* @brief Function records the end of the innermost open stage.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> BootProfile_End(); </CODE>
+*
+*/
+void BootProfile_End(void)
+{
+    uint32_t nowNs = BootProfile_Now();
+    uint8_t index;
+
+    if (bootProfile.depth == 0)
+    {
+        return;
+    }
+    bootProfile.depth--;
+    if (bootProfile.depth < BOOT_PROFILE_DEPTH)
+    {
+        index = bootProfile.open[bootProfile.depth];
+        if (index < BOOT_PROFILE_ENTRY_COUNT)
+        {
+            bootProfile.entry[index].endNs = nowNs;
+        }
+    }
+}
+
+/**
+* <B> Function: BootProfile_Record(const char *, uint32_t) </B>
+*
+* @brief Function records a completed stage that started at a time taken 
+* earlier with BootProfile_Now(). The stage is placed at the nesting depth
+* of the caller and does not change it.
+*        
+* @param pName stage name, a string literal.
+* @param startNs start time of the stage.
+* @return none.
+* 
+* @example
+* <CODE> BootProfile_Record("PLL1 CLKRDY", startNs); </CODE>
+*
+*/
+void BootProfile_Record(const char *pName, uint32_t startNs)
+{
+    uint32_t nowNs = BootProfile_Now();
+    BOOT_PROFILE_ENTRY_T *pEntry;
+
+    if (bootProfile.depth >= BOOT_PROFILE_DEPTH)
+    {
+        return;
+    }
+    if (bootProfile.count < BOOT_PROFILE_ENTRY_COUNT)
+    {
+        pEntry = &bootProfile.entry[bootProfile.count];
+        pEntry->pName = pName;
+        pEntry->depth = bootProfile.depth;
+        pEntry->startNs = startNs;
+        pEntry->endNs = nowNs;
+    }
+    bootProfile.count++;
+}
+
+/**
+* <B> Function: BootProfile_Report() </B>
+*
+* @brief Function initializes UART1 for BOOT_PROFILE_BAUD_RATE, 8N1 and 
+* prints one line per recorded stage with its start time and duration.
+* Waits are indented below the stage they belong to. The profile ends with
+* the report, Timer1 is stopped.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> BootProfile_Report(); </CODE>
+*
+*/
+void BootProfile_Report(void)
+{
+    uint32_t nowNs = BootProfile_Now();
+    const BOOT_PROFILE_ENTRY_T *pEntry;
+    uint16_t i, count;
+
+    UART1_Initialize();
+    UART1_SpeedModeStandard();
+    UART1_BaudRateDividerSet(BOOT_PROFILE_UART_BRG);
+    UART1_ModuleEnable();
+
+    BootProfile_PutString("Boot profile [us]", BOOT_PROFILE_NAME_WIDTH);
+    BootProfile_PutString("       start    duration\r\n", 0);
+
+    count = bootProfile.count;
+    if (count > BOOT_PROFILE_ENTRY_COUNT)
+    {
+        count = BOOT_PROFILE_ENTRY_COUNT;
+    }
+    for (i = 0; i < count; i++)
+    {
+        pEntry = &bootProfile.entry[i];
+        BootProfile_PutString("", 2*pEntry->depth);
+        BootProfile_PutString(pEntry->pName, 
+                              BOOT_PROFILE_NAME_WIDTH - 2*pEntry->depth);
+        BootProfile_PutMicrosec(pEntry->startNs);
+        BootProfile_PutMicrosec(pEntry->endNs - pEntry->startNs);
+        BootProfile_PutString("\r\n", 0);
+    }
+    BootProfile_PutString("Report", BOOT_PROFILE_NAME_WIDTH);
+    BootProfile_PutMicrosec(nowNs);
+    BootProfile_PutString("\r\n", 0);
+    if (bootProfile.count > BOOT_PROFILE_ENTRY_COUNT)
+    {
+        BootProfile_PutString("Stages dropped, raise BOOT_PROFILE_ENTRY_COUNT"
+                              "\r\n", 0);
+    }
+    
+    /* End of the profile, Timer1 is restarted by its next user */
+    TIMER1_ModuleStop();
+}
+
+// </editor-fold>
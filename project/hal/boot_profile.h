@@ -0,0 +1,138 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file boot_profile.h
+ *
+ * @brief This header file lists the interface of the boot time profiler. 
+ * The profiler timestamps the initialization stages and the blocking waits
+ * of the start-up sequence with Timer1 and prints a report over UART1.
+ *
+ * Stages that do not nest with the caller, such as the steps of a state 
+ * machine polled from the main loop, are recorded when they complete with
+ * BOOT_PROFILE_RECORD() and the start time taken by BOOT_PROFILE_NOW().
+ *
+ * The profiler is built only when BOOT_PROFILE is defined; otherwise the 
+ * BOOT_PROFILE_xx() macros expand to the plain code and Timer1 and UART1 
+ * are left untouched. While it is built, Timer1 is reserved for it.
+ *
+ * Component: HAL
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __BOOT_PROFILE_H
+#define __BOOT_PROFILE_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <xc.h>
+#include <stdint.h>
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Number of stages and waits recorded, later ones are counted but dropped */
+#define BOOT_PROFILE_ENTRY_COUNT    48
+/* Nesting depth of stages (stage, wait inside a stage ..) */
+#define BOOT_PROFILE_DEPTH          4
+/* Report baud rate, 8N1 */
+#define BOOT_PROFILE_BAUD_RATE      115200UL
+
+#ifdef BOOT_PROFILE
+#define BOOT_PROFILE_START()        BootProfile_Start()
+#define BOOT_PROFILE_BEGIN(pName)   BootProfile_Begin(pName)
+#define BOOT_PROFILE_END()          BootProfile_End()
+#define BOOT_PROFILE_REPORT()       BootProfile_Report()
+#define BOOT_PROFILE_NOW()          BootProfile_Now()
+#define BOOT_PROFILE_RECORD(pName, startNs)                                    \
+    BootProfile_Record(pName, startNs)
+#else
+#define BOOT_PROFILE_START()
+#define BOOT_PROFILE_BEGIN(pName)
+#define BOOT_PROFILE_END()
+#define BOOT_PROFILE_REPORT()
+#define BOOT_PROFILE_NOW()          0
+#define BOOT_PROFILE_RECORD(pName, startNs)
+#endif
+
+/* Blocking wait recorded as a stage of its own */
+#define BOOT_PROFILE_WAIT(pName, condition)                                    \
+    do                                                                         \
+    {                                                                          \
+        BOOT_PROFILE_BEGIN(pName);                                             \
+        while (condition);                                                     \
+        BOOT_PROFILE_END();                                                    \
+    } while (0)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    const char *pName;      /* Stage name, a string literal */
+    uint32_t startNs;       /* Time since BootProfile_Start() in ns */
+    uint32_t endNs;
+    uint8_t depth;          /* 0 = top level stage */
+} BOOT_PROFILE_ENTRY_T;
+
+typedef struct
+{
+    BOOT_PROFILE_ENTRY_T entry[BOOT_PROFILE_ENTRY_COUNT];
+    uint8_t open[BOOT_PROFILE_DEPTH];   /* Entries of the open stages */
+    uint16_t count;                     /* Entries begun, may exceed
+                                           BOOT_PROFILE_ENTRY_COUNT */
+    uint8_t depth;                      /* Number of open stages */
+    uint32_t lastCount;                 /* TMR1 at the previous timestamp */
+    uint32_t nowNs;                     /* Time of the previous timestamp */
+} BOOT_PROFILE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+extern BOOT_PROFILE_T bootProfile;
+
+void BootProfile_Start(void);
+void BootProfile_Begin(const char *pName);
+void BootProfile_End(void);
+void BootProfile_Record(const char *pName, uint32_t startNs);
+uint32_t BootProfile_Now(void);
+void BootProfile_Report(void);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __BOOT_PROFILE_H
@@ -40,16 +40,222 @@
 
 #include <xc.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "clock.h"
+#include "boot_profile.h"
+#include "sfr_field.h"
 
 // </editor-fold>
 
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Clock generator control fields set by the bring-up, the other fields
+   keep their reset value. All generators share the CLK1CON layout
+   OE = 1 : Clock output to the peripherals is enabled
+   ON = 1 : Clock generator is enabled */
+#define CLOCK_GENERATOR_CON_MASK                                               \
+    (_CLK1CON_NOSC_MASK | _CLK1CON_OE_MASK | _CLK1CON_ON_MASK)
+#define CLOCK_GENERATOR_CON(nosc)                                              \
+    (SFR_FIELD(CLK1CON, NOSC, nosc) |                                          \
+     SFR_FIELD(CLK1CON, OE, 1) |                                               \
+     SFR_FIELD(CLK1CON, ON, 1))
+/* Integer divider of a clock generator, no fractional division */
+#define CLOCK_GENERATOR_DIV(intdiv)                                            \
+    (SFR_FIELD(CLK1DIV, INTDIV, intdiv) |                                      \
+     SFR_FIELD(CLK1DIV, FRACDIV, 0))
+
+/* Clock generator input selection, CLKxCON.NOSC */
+#define CLOCK_NOSC_FRC              1   /* 8 MHz FRC */
+#define CLOCK_NOSC_PLL1_FOUT        5   /* PLL1 FOUT output = 200 MHz */
+#define CLOCK_NOSC_PLL1_VCODIV      7   /* PLL1 VCO DIV output = 800 MHz */
+
+#define CLOCK_GENERATOR_COUNT       6
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+CLOCK_BRING_UP_T clockBringUp;
+
+/* Clock generators switched to PLL1, the switches are requested together */
+static const CLOCK_GENERATOR_CONFIG_T 
+    clockGeneratorConfig[CLOCK_GENERATOR_COUNT] =
+{
+    /** System Clock  
+    * Input Clock Selection (NOSC) = 5 :PLL1 FOUT output = 200 MHz
+    * Clock Division (INTDIV) = (0*2) - No Division
+    * Final Clock for System = 200 MHz */
+    {1, CLOCK_GENERATOR_CON(CLOCK_NOSC_PLL1_FOUT), CLOCK_GENERATOR_DIV(0)},
+    /** Clock used for PWM  
+    * Input Clock Selection (NOSC) = 7 :PLL1 VCO DIV output = 800 MHz
+    * Clock Division (INTDIV) = (1*2)
+    * Final Clock for PWM = 400 MHz */
+    {5, CLOCK_GENERATOR_CON(CLOCK_NOSC_PLL1_VCODIV), CLOCK_GENERATOR_DIV(1)},
+    /** Clock used for ADC  
+    * Input Clock Selection (NOSC) = 7 :PLL1 VCO DIV output = 800 MHz
+    * Clock Division (INTDIV) = (5*2)
+    * Final Clock for ADC = 80 MHz */
+    {6, CLOCK_GENERATOR_CON(CLOCK_NOSC_PLL1_VCODIV), CLOCK_GENERATOR_DIV(5)},
+    /** Clock used for DAC and CMP  
+    * Input Clock Selection (NOSC) = 7 :PLL1 VCO DIV output = 800 MHz
+    * Clock Division (INTDIV) = (1*2)
+    * Final Clock for DAC = 400 MHz */
+    {7, CLOCK_GENERATOR_CON(CLOCK_NOSC_PLL1_VCODIV), CLOCK_GENERATOR_DIV(1)},
+    /** Clock used for UART  
+    * Input Clock Selection (NOSC) = 5 :PLL1 FOUT output = 200 MHz
+    * Clock Division (INTDIV) = (1*2)
+    * Final Clock for UART = 100 MHz */
+    {8, CLOCK_GENERATOR_CON(CLOCK_NOSC_PLL1_FOUT), CLOCK_GENERATOR_DIV(1)},
+    /** Reference Clock Generator REFO1 output through PPS (PPS to be 22)
+    * Input Clock Selection (NOSC) = 5 :PLL1 FOUT output = 200 MHz 
+    * Clock Division (INTDIV) = (4000*2)
+    * Final Clock for REFO = 25 kHz*/
+    {12, CLOCK_GENERATOR_CON(CLOCK_NOSC_PLL1_FOUT), CLOCK_GENERATOR_DIV(4000)}
+};
+
+#ifdef BOOT_PROFILE
+/* Boot profiler stage names of the bring-up states */
+static const char * const clockStateName[] =
+{
+    "", "PLL1 OSWEN", "PLL1 PLLSWEN", "PLL1 FOUTSWEN", "PLL1 CLKRDY",
+    "CLKx OSWEN", "CLKx DIVSWEN"
+};
+#endif
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: CLOCK_GeneratorRegisters(uint16_t) </B>
+*
+* @brief Function returns the first register of a clock generator block.
+*        
+* @param generator clock generator number.
+* @return CLKxCON register.
+*/
+static volatile uint32_t *CLOCK_GeneratorRegisters(uint16_t generator)
+{
+    switch (generator)
+    {
+        case 1:     return &CLK1CON;
+        case 5:     return &CLK5CON;
+        case 6:     return &CLK6CON;
+        case 7:     return &CLK7CON;
+        case 8:     return &CLK8CON;
+        default:    return &CLK12CON;
+    }
+}
+
+/**
+* <B> Function: CLOCK_GeneratorsRequest(uint32_t) </B>
+*
+* @brief Function sets a switch request bit of every clock generator.
+*        
+* @param mask CLKxCON.OSWEN or CLKxCON.DIVSWEN.
+* @return none.
+*/
+static void CLOCK_GeneratorsRequest(uint32_t mask)
+{
+    volatile uint32_t *pRegs;
+    uint16_t i;
+
+    for (i = 0; i < CLOCK_GENERATOR_COUNT; i++)
+    {
+        pRegs = CLOCK_GeneratorRegisters(clockGeneratorConfig[i].generator);
+        CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_CON) |= mask;
+    }
+}
+
+/**
+* <B> Function: CLOCK_GeneratorsPending(uint32_t) </B>
+*
+* @brief Function tells whether a switch request of any clock generator is 
+* still in progress.
+*        
+* @param mask CLKxCON.OSWEN or CLKxCON.DIVSWEN.
+* @return true while a generator has not cleared its request bit.
+*/
+static bool CLOCK_GeneratorsPending(uint32_t mask)
+{
+    volatile uint32_t *pRegs;
+    uint16_t i;
+
+    for (i = 0; i < CLOCK_GENERATOR_COUNT; i++)
+    {
+        pRegs = CLOCK_GeneratorRegisters(clockGeneratorConfig[i].generator);
+        if (CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_CON) & mask)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* <B> Function: CLOCK_StateSet(CLOCK_STATE_T) </B>
+*
+* @brief Function records the completed state with the boot profiler and
+* enters the next one.
+*        
+* @param state next state.
+* @return none.
+*/
+static void CLOCK_StateSet(CLOCK_STATE_T state)
+{
+    BOOT_PROFILE_RECORD(clockStateName[clockBringUp.state], 
+                        clockBringUp.stateStartNs);
+    clockBringUp.state = state;
+    clockBringUp.stateStartCount = TIMER1_CounterRead();
+    clockBringUp.stateStartNs = BOOT_PROFILE_NOW();
+    
+    if (CLOCK_BringUpBusy() == false && clockBringUp.timer)
+    {
+        TIMER1_ModuleStop();
+        clockBringUp.timer = false;
+    }
+}
+
+/**
+* <B> Function: CLOCK_Fallback() </B>
+*
+* @brief Function switches every clock generator to FRC without division 
+* after a state timed out. The switches are requested and not waited for, 
+* PLL1 is left running.
+*        
+* @param none.
+* @return none.
+*/
+static void CLOCK_Fallback(void)
+{
+    volatile uint32_t *pRegs;
+    uint16_t i;
+
+    for (i = 0; i < CLOCK_GENERATOR_COUNT; i++)
+    {
+        pRegs = CLOCK_GeneratorRegisters(clockGeneratorConfig[i].generator);
+        CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_DIV) = CLOCK_GENERATOR_DIV(0);
+        CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_CON) = 
+            (CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_CON) & 
+                ~CLOCK_GENERATOR_CON_MASK) | 
+            CLOCK_GENERATOR_CON(CLOCK_NOSC_FRC) | 
+            _CLK1CON_OSWEN_MASK | _CLK1CON_DIVSWEN_MASK;
+    }
+    clockBringUp.faultState = clockBringUp.state;
+    CLOCK_StateSet(CLOCK_STATE_FALLBACK);
+}
+
+// </editor-fold>
+
+
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 /**
 * <B> Function: InitOscillator() </B>
 *
-* @brief Function to initialize the oscillator/clock module.
+* @brief Function to initialize the oscillator/clock module. The clock 
+* bring-up is started and polled until the clock generators run from PLL1
+* or have fallen back to FRC.
 *        
 * @param none.
 * @return none.
@@ -60,27 +266,53 @@
 */
 void InitOscillator (void)
 {
-    /** System Clock Control Register */
-    OSCCTRL = 0x0000;
-    /* Bit 0 = FRC_EN 8 MHz FRC Clock Enable bit
-     * 1 Enable FRC Oscillator
-       0 Disable FRC Oscillator */
-    OSCCTRLbits.FRCEN = 1;
-    /* Bit 2 = POSC_EN Primary Crystal Clock Enable bit 
+    CLOCK_BringUpStart();
+    while (CLOCK_BringUpBusy())
+    {
+        CLOCK_BringUpTask();
+    }
+}
+
+/**
+* <B> Function: CLOCK_BringUpStart() </B>
+*
+* @brief Function configures PLL1, requests its switch-over and loads the 
+* divider and input selection of every clock generator. It returns without
+* waiting, the device keeps running on FRC until CLOCK_BringUpTask() has
+* switched the clock generators.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> CLOCK_BringUpStart(); </CODE>
+*
+*/
+void CLOCK_BringUpStart(void)
+{
+    volatile uint32_t *pRegs;
+    const CLOCK_GENERATOR_CONFIG_T *pConfig;
+    uint16_t i;
+
+    /** System Clock Control Register 
+       Bit 0 = FRC_EN 8 MHz FRC Clock Enable bit
+       1 Enable FRC Oscillator
+       0 Disable FRC Oscillator
+       Bit 2 = POSC_EN Primary Crystal Clock Enable bit 
        1 Enable Primary Crystal/Resonator Oscillator
        0 Disable Primary Crystal/Resonator Oscillator  */
-    OSCCTRLbits.POSCEN = 0;
+    OSCCTRL = SFR_FIELD(OSCCTRL, FRCEN, 1) |
+              SFR_FIELD(OSCCTRL, POSCEN, 0);
  
-    /** OSCCFG : Oscillator Configuration Register */
-    OSCCFG = 0;
-    /** Bit 0 = POSCMD0 Primary Oscillator Configuration bit(1)
+    /** OSCCFG : Oscillator Configuration Register 
+        Bit 0 = POSCMD0 Primary Oscillator Configuration bit(1)
         1 Oscillator mode selected (3.5 MHz-32 MHz)
-        0 External clock mode selected */
-    OSCCFGbits.POSCMD = 0;
-    /** Bit 5 = POSCIOFNC Primary CLKO Enable Configuration bit
+        0 External clock mode selected 
+        Bit 5 = POSCIOFNC Primary CLKO Enable Configuration bit
         1 CLKO output signal active on the OSC2 pin; 
         0 CLKO output disabled */
-    OSCCFGbits.POSCIOFNC = 0;
+    OSCCFG = SFR_FIELD(OSCCFG, POSCMD, 0) |
+             SFR_FIELD(OSCCFG, POSCIOFNC, 0);
        
 /* In this device Internal RC Oscillator is 8MHz
      * Also,In all Motor Control Development boards primary oscillator or 
@@ -107,117 +339,151 @@ void InitOscillator (void)
      */
     
     /* PLL Feedback Divider bits (also denoted as 'M', PLL multiplier)
-     * M = (PLLFBDbits.PLLFBDIV)= 150     */
-      PLL1DIVbits.PLLFBDIV = 100;
-
-    /* PLL Phase Detector I/P Divider Select bits(denoted as 'N1',PLL pre-scaler)
-     * N1 = PLL1DIVbits.REFDIV = 1        */
-      PLL1DIVbits.PLLPRE = 1;
-
-    /* PLL Output Divider #1 Ratio bits((denoted as 'N2' or POSTDIV#1)
-     * N2 = PLL1DIVbits.POSTDIV1 = 3      */
-    PLL1DIVbits.POSTDIV1 = 4;
-    
-    /* PLL Output Divider #2 Ratio bits((denoted as 'N3' or POSTDIV#2)
+     * M = (PLLFBDbits.PLLFBDIV)= 100
+     * PLL Phase Detector I/P Divider Select bits(denoted as 'N1',PLL pre-scaler)
+     * N1 = PLL1DIVbits.REFDIV = 1
+     * PLL Output Divider #1 Ratio bits((denoted as 'N2' or POSTDIV#1)
+     * N2 = PLL1DIVbits.POSTDIV1 = 4
+     * PLL Output Divider #2 Ratio bits((denoted as 'N3' or POSTDIV#2)
      * N3 = PLL1DIVbits.POSTDIV2 = 1      */
-    PLL1DIVbits.POSTDIV2 = 1;
+    PLL1DIV = SFR_FIELD(PLL1DIV, PLLFBDIV, 100) |
+              SFR_FIELD(PLL1DIV, PLLPRE, 1) |
+              SFR_FIELD(PLL1DIV, POSTDIV1, 4) |
+              SFR_FIELD(PLL1DIV, POSTDIV2, 1);
     /* Bit 6 = PLL1_EN PLL1 Enable bit
       1 Enable PLL1
       0 Disable PLL1 */
     OSCCTRLbits.PLL1EN = 1;
-    PLL1CONbits.NOSC = 1;
-    PLL1CONbits.ON = 1;
-    PLL1CONbits.OE = 0;
+    PLL1CON = (PLL1CON & ~(_PLL1CON_NOSC_MASK | _PLL1CON_ON_MASK | 
+                           _PLL1CON_OE_MASK)) |
+              SFR_FIELD(PLL1CON, NOSC, 1) |
+              SFR_FIELD(PLL1CON, ON, 1) |
+              SFR_FIELD(PLL1CON, OE, 0);
     PLL1CONbits.OSWEN = 1;
     VCO1DIV = 1;
-    while (PLL1CONbits.OSWEN);
-    
-    PLL1CONbits.PLLSWEN = 1;
-    while (PLL1CONbits.PLLSWEN == 1);
-    PLL1CONbits.FOUTSWEN = 1;
-    while (PLL1CONbits.PLLSWEN == 1);
-    while(PLL1CONbits.CLKRDY == 0);
-    
-    /* Configuring Clock for Individual Peripherals*/
     
-    /** System Clock  
-    * Input Clock Selection (NOSC) = 5 :PLL1 FOUT output = 200 MHz
-    * Clock Division (INTDIV) = (0*2) - No Division
-    * Final Clock for System = 200 MHz */
-    CLK1DIVbits.INTDIV = 0;
-    CLK1CONbits.OE = 1;
-    CLK1CONbits.ON = 1;
-    CLK1CONbits.NOSC = 5; 
-    CLK1CONbits.OSWEN = 1; 
-    while (CLK1CONbits.OSWEN);
-    CLK1CONbits.DIVSWEN =1;
-    while (CLK1CONbits.DIVSWEN);
-    
-    /** Clock used for PWM  
-    * Input Clock Selection (NOSC) = 7 :PLL1 VCO DIV output = 800 MHz
-    * Clock Division (INTDIV) = (1*2)
-    * Final Clock for PWM = 400 MHz */
-    CLK5DIVbits.INTDIV = 1;
-    CLK5CONbits.OE = 1;
-    CLK5CONbits.ON = 1;
-    CLK5CONbits.NOSC = 7;
-    CLK5CONbits.OSWEN = 1;
-    while (CLK5CONbits.OSWEN);
-    CLK5CONbits.DIVSWEN =1;
-    while (CLK5CONbits.DIVSWEN);
-    
-    /** Clock used for ADC  
-    * Input Clock Selection (NOSC) = 7 :PLL1 VCO DIV output = 800 MHz
-    * Clock Division (INTDIV) = (5*2)
-    * Final Clock for ADC = 80 MHz */
-    CLK6DIVbits.INTDIV = 5;
-    CLK6CONbits.OE = 1;
-    CLK6CONbits.ON = 1;
-    CLK6CONbits.NOSC = 7; 
-    CLK6CONbits.OSWEN = 1; 
-    while (CLK6CONbits.OSWEN);
-    CLK6CONbits.DIVSWEN =1;
-    while (CLK6CONbits.DIVSWEN);
+    /* Configuring Clock for Individual Peripherals. The new input and 
+       divider take effect with the OSWEN and DIVSWEN requests issued once
+       PLL1 is locked */
+    for (i = 0; i < CLOCK_GENERATOR_COUNT; i++)
+    {
+        pConfig = &clockGeneratorConfig[i];
+        pRegs = CLOCK_GeneratorRegisters(pConfig->generator);
+        CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_DIV) = pConfig->div;
+        CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_CON) = 
+            (CLOCK_GENERATOR_REG(pRegs, CLOCK_REG_CON) & 
+                ~CLOCK_GENERATOR_CON_MASK) | pConfig->con;
+    }
     
-    /** Clock used for DAC and CMP  
-    * Input Clock Selection (NOSC) = 7 :PLL1 VCO DIV output = 800 MHz
-    * Clock Division (INTDIV) = (1*2)
-    * Final Clock for DAC = 400 MHz */
-    CLK7DIVbits.INTDIV = 1;
-    CLK7CONbits.OE = 1;
-    CLK7CONbits.ON = 1;
-    CLK7CONbits.NOSC = 7; 
-    CLK7CONbits.OSWEN = 1; 
-    while (CLK7CONbits.OSWEN);
-    CLK7CONbits.DIVSWEN =1;
-    while (CLK7CONbits.DIVSWEN);
- 
-    /** Clock used for UART  
-    * Input Clock Selection (NOSC) = 5 :PLL1 FOUT output = 200 MHz
-    * Clock Division (INTDIV) = (1*2)
-    * Final Clock for UART = 100 MHz */
-    CLK8DIVbits.INTDIV = 1;
-    CLK8CONbits.OE = 1;
-    CLK8CONbits.ON = 1;
-    CLK8CONbits.NOSC = 5; 
-    CLK8CONbits.OSWEN = 1; 
-    while (CLK8CONbits.OSWEN);
-    CLK8CONbits.DIVSWEN =1;
-    while (CLK8CONbits.DIVSWEN);
+    /* Timer1 on the FRC times out the states. The boot profiler may run it
+       already with the same clock, it is then only read */
+    clockBringUp.timer = (T1CONbits.ON == 0);
+    if (clockBringUp.timer)
+    {
+        TIMER1_Initialize();
+        TIMER1_InputClockFrcSet();
+        TIMER1_PeriodSet(0xFFFFFFFF);
+        TIMER1_CounterClear();
+        TIMER1_ModuleStart();
+    }
     
-    /** Reference Clock Generator REFO1 output through PPS (PPS to be 22)
-    * Input Clock Selection (NOSC) = 5 :PLL1 FOUT output = 200 MHz 
-    * Clock Division (INTDIV) = (4000*2)
-    * Final Clock for REFO = 25 kHz*/
-    CLK12DIVbits.INTDIV = 4000;
-    CLK12CONbits.OE = 1;
-    CLK12CONbits.ON = 1;
-    CLK12CONbits.NOSC = 5; 
-    CLK12CONbits.OSWEN = 1; 
-    while (CLK12CONbits.OSWEN);
-    CLK12CONbits.DIVSWEN =1;
-    while (CLK12CONbits.DIVSWEN);
+    clockBringUp.faultState = CLOCK_STATE_IDLE;
+    clockBringUp.state = CLOCK_STATE_PLL_SWITCH;
+    clockBringUp.stateStartCount = TIMER1_CounterRead();
+    clockBringUp.stateStartNs = BOOT_PROFILE_NOW();
+}
+
+/**
+* <B> Function: CLOCK_BringUpTask() </B>
+*
+* @brief Function polls the switch in progress once and, when it has 
+* completed, requests the next one. It never waits and can be called from
+* the main loop or a periodic interrupt. A state that is not left within 
+* CLOCK_TIMEOUT_MICROSEC, measured with Timer1 on the FRC, switches the 
+* clock generators to FRC.
+*        
+* @param none.
+* @return CLOCK_STATE_T after the poll.
+* 
+* @example
+* <CODE> while (CLOCK_BringUpTask() != CLOCK_STATE_READY); </CODE>
+*
+*/
+CLOCK_STATE_T CLOCK_BringUpTask(void)
+{
+    switch (clockBringUp.state)
+    {
+        case CLOCK_STATE_PLL_SWITCH:
+            if (PLL1CONbits.OSWEN == 0)
+            {
+                PLL1CONbits.PLLSWEN = 1;
+                CLOCK_StateSet(CLOCK_STATE_PLL_DIVIDER);
+            }
+            break;
+        case CLOCK_STATE_PLL_DIVIDER:
+            if (PLL1CONbits.PLLSWEN == 0)
+            {
+                PLL1CONbits.FOUTSWEN = 1;
+                CLOCK_StateSet(CLOCK_STATE_PLL_FOUT);
+            }
+            break;
+        case CLOCK_STATE_PLL_FOUT:
+            if (PLL1CONbits.FOUTSWEN == 0)
+            {
+                CLOCK_StateSet(CLOCK_STATE_PLL_LOCK);
+            }
+            break;
+        case CLOCK_STATE_PLL_LOCK:
+            if (PLL1CONbits.CLKRDY == 1)
+            {
+                CLOCK_GeneratorsRequest(_CLK1CON_OSWEN_MASK);
+                CLOCK_StateSet(CLOCK_STATE_GENERATOR_SWITCH);
+            }
+            break;
+        case CLOCK_STATE_GENERATOR_SWITCH:
+            if (CLOCK_GeneratorsPending(_CLK1CON_OSWEN_MASK) == false)
+            {
+                CLOCK_GeneratorsRequest(_CLK1CON_DIVSWEN_MASK);
+                CLOCK_StateSet(CLOCK_STATE_GENERATOR_DIVIDER);
+            }
+            break;
+        case CLOCK_STATE_GENERATOR_DIVIDER:
+            if (CLOCK_GeneratorsPending(_CLK1CON_DIVSWEN_MASK) == false)
+            {
+                CLOCK_StateSet(CLOCK_STATE_READY);
+            }
+            break;
+        default:
+            return (CLOCK_STATE_T)clockBringUp.state;
+    }
     
+    if (CLOCK_BringUpBusy() && 
+        ((TIMER1_CounterRead() - clockBringUp.stateStartCount) >= 
+            CLOCK_TIMEOUT_COUNTS))
+    {
+        CLOCK_Fallback();
+    }
+    return (CLOCK_STATE_T)clockBringUp.state;
+}
+
+/**
+* <B> Function: CLOCK_BringUpBusy() </B>
+*
+* @brief Function tells whether the clock bring-up is still in progress.
+*        
+* @param none.
+* @return true from CLOCK_BringUpStart() until the bring-up is ready or has
+* fallen back to FRC.
+* 
+* @example
+* <CODE> while (CLOCK_BringUpBusy()) { CLOCK_BringUpTask(); } </CODE>
+*
+*/
+bool CLOCK_BringUpBusy(void)
+{
+    return (clockBringUp.state != CLOCK_STATE_IDLE) &&
+           (clockBringUp.state != CLOCK_STATE_READY) &&
+           (clockBringUp.state != CLOCK_STATE_FALLBACK);
 }
 
 // </editor-fold>
\ No newline at end of file
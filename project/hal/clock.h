@@ -5,6 +5,11 @@
  * @brief This header file lists the functions and definitions - to configure 
  * and enable Clock/Oscillator/PLL Module and its features
  * 
+ * The clock bring-up runs as a state machine: CLOCK_BringUpStart() starts
+ * PLL1 and returns while the device still runs on FRC, CLOCK_BringUpTask()
+ * advances the switch-over one step per call from the main loop or an 
+ * interrupt. InitOscillator() runs both to completion.
+ * 
  * Definitions in this file are for dsPIC33AK512MC510
  * 
  * Component: CLOCK/OSCILLATOR
@@ -48,12 +53,90 @@
         
 #include <xc.h>
 #include <stdint.h>
+#include <stdbool.h>
+
+#include "timer1.h"
         
 // </editor-fold>
 
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Time one bring-up state may take before CLOCK_BringUpTask() gives up 
+   and falls back to FRC, measured with Timer1 on the FRC whatever the rate
+   of the calls. The budget covers a PLL lock time of several milli seconds */
+#define CLOCK_TIMEOUT_MICROSEC      10000UL
+#define CLOCK_TIMEOUT_COUNTS                                                   \
+    (CLOCK_TIMEOUT_MICROSEC*(TIMER1_FRC_CLOCK/1000000UL))
+
+/* Register of a clock generator, addressed from its CLKxCON register */
+#define CLOCK_REG_CON               0
+#define CLOCK_REG_DIV               1
+
+#ifndef CLOCK_GENERATOR_REG
+#define CLOCK_GENERATOR_REG(pBase, reg) (pBase)[reg]
+#endif
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+/* States of the clock bring-up, in the order they are passed */
+typedef enum
+{
+    CLOCK_STATE_IDLE = 0,           /* CLOCK_BringUpStart() not called */
+    CLOCK_STATE_PLL_SWITCH,         /* PLL1CON.OSWEN, PLL1 input to FRC */
+    CLOCK_STATE_PLL_DIVIDER,        /* PLL1CON.PLLSWEN, PLL1DIV dividers */
+    CLOCK_STATE_PLL_FOUT,           /* PLL1CON.FOUTSWEN, FOUT divider */
+    CLOCK_STATE_PLL_LOCK,           /* PLL1CON.CLKRDY */
+    CLOCK_STATE_GENERATOR_SWITCH,   /* CLKxCON.OSWEN of every generator */
+    CLOCK_STATE_GENERATOR_DIVIDER,  /* CLKxCON.DIVSWEN of every generator */
+    CLOCK_STATE_READY,              /* Clock generators run from PLL1 */
+    CLOCK_STATE_FALLBACK            /* Timed out, clock generators run from 
+                                       FRC without division */
+} CLOCK_STATE_T;
+
+/* Clock generator switched to PLL1 by the bring-up */
+typedef struct
+{
+    uint8_t
+        generator;          /* Clock generator number, CLKxCON */
+    
+    uint32_t
+        con,                /* CLKxCON, NOSC, OE and ON */
+        div;                /* CLKxDIV */
+    
+} CLOCK_GENERATOR_CONFIG_T;
+
+typedef struct
+{
+    uint8_t
+        state,              /* CLOCK_STATE_T */
+        faultState;         /* State that timed out, CLOCK_STATE_IDLE if 
+                               none */
+    
+    bool
+        timer;              /* Timer1 started by the bring-up */
+    
+    uint32_t
+        stateStartCount,    /* Timer1 when the state was entered */
+        stateStartNs;       /* Boot profiler time the state was entered */
+    
+} CLOCK_BRING_UP_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="VARIABLES ">
+
+extern CLOCK_BRING_UP_T clockBringUp;
+
+// </editor-fold>
+
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
         
 void InitOscillator(void);
+void CLOCK_BringUpStart(void);
+CLOCK_STATE_T CLOCK_BringUpTask(void);
+bool CLOCK_BringUpBusy(void);
 
 // </editor-fold>
 
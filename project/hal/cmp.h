@@ -61,6 +61,15 @@
 extern "C" {
 #endif
 
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Flash location of the DAC calibration register FPDMDAC */
+#ifndef FPDMDAC_ADDRESS
+#define FPDMDAC_ADDRESS     (uint32_t*)(0x7F20E0)
+#endif
+
+// </editor-fold>
+
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
             
 void InitializeCMPs(void);
@@ -0,0 +1,362 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file fast_loop.c
+ *
+ * @brief This module runs the current control of the three motors from one
+ * ADC interrupt per PWM cycle.
+ *
+ * The interleaved motors sample their currents at different times of the
+ * PWM cycle. MCAPP_FastLoopOrder() cuts the cycle at the longest interval
+ * between two samples : the motor sampled after it comes first, the motor
+ * sampled before it last. Only the ADC interrupt of the last motor is 
+ * enabled; MCAPP_FastLoopService() then runs MCAPP_FocService() of the 
+ * three motors in the order of their samples, oldest first, and saves the
+ * context switches of the two other interrupts.
+ *
+ * The duty cycles of a motor take effect at its next start of cycle, which
+ * is the deadline of its update. The elapsed time of each update is 
+ * measured with Timer1 from the interrupt entry; updates that complete 
+ * after the deadline are counted in misses and take effect one cycle late.
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: FAST LOOP
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include <xc.h>
+
+#include "fast_loop.h"
+#include "adc.h"
+#include "pwm.h"
+#include "pwm_trigger.h"
+#include "timer1.h"
+#include "measure.h"
+#include "foc.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: FastLoop_SampleTime(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the time of the last current sample of a motor
+* from its trigger registers : PGxTRIGA of the phase A generator, or the
+* later bus current trigger of the phase B generator with SINGLE_SHUNT.
+*        
+* @param pTiming PWM timing.
+* @param motor PWM_MOTOR_T.
+* @return sample in ticks of 1/16 PWM clock after the PG5 start of cycle,
+* less than the PWM cycle.
+* 
+* @example
+* <CODE> sample = FastLoop_SampleTime(&pwmTiming, PWM_MOTOR_MC1); </CODE>
+*
+*/
+static uint32_t FastLoop_SampleTime(const PWM_TIMING_T *pTiming, 
+                                    uint16_t motor)
+{
+    uint32_t period = 2 * (pTiming->loopTimeTcy + PWM_TICKS_PER_CLOCK);
+    uint32_t trigger, sample;
+#ifdef SINGLE_SHUNT
+    volatile uint32_t *pRegs = PWM_MotorRegisters(motor, 1);
+    uint32_t trigB = PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGB);
+
+    trigger = PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGA);
+    if (trigB > trigger)
+    {
+        trigger = trigB;
+    }
+#else
+    trigger = PWM_GENERATOR_REG(PWM_MotorRegisters(motor, 0), PWM_REG_TRIGA);
+#endif
+
+    sample = PWM_MotorSocOffset(pTiming, motor) + 
+                trigger * PWM_MotorTicksPerCount(motor);
+    return sample % period;
+}
+
+/**
+* <B> Function: FastLoop_DeadlineSet(MCAPP_FAST_LOOP_T *) </B>
+*
+* @brief Function calculates the deadline of each motor, its next start of
+* cycle after the interrupt of the motor sampled last.
+*        
+* @param pFastLoop scheduler, sample[], last and trigger initialized.
+* @return none.
+*/
+static void FastLoop_DeadlineSet(MCAPP_FAST_LOOP_T *pFastLoop)
+{
+    const PWM_TRIGGER_T *pTrigger = &pFastLoop->trigger;
+    uint32_t period = pTrigger->period, entry, deadline;
+    uint16_t motor;
+
+    entry = (pFastLoop->sample[pFastLoop->last] + 
+                PWM_TRIGGER_TICKS(FAST_LOOP_LATENCY_MICROSEC)) % period;
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        deadline = (pTrigger->socOffset[motor] + period - entry) % period;
+        if (deadline == 0)
+        {
+            deadline = period;
+        }
+        pFastLoop->deadline[motor] = deadline / FAST_LOOP_TICKS_PER_COUNT;
+    }
+}
+
+#ifndef SINGLE_SHUNT
+/**
+* <B> Function: FastLoop_TriggersSchedule(MCAPP_FAST_LOOP_T *) </B>
+*
+* @brief Function places the current triggers of the next cycle from the 
+* duty cycles just written and writes them only if the samples keep the 
+* order of MCAPP_FastLoopOrder(), the interrupt of the last motor then 
+* still comes after the samples of all motors. A schedule that changes the 
+* order is dropped, the triggers stay, and reorders is incremented.
+*        
+* @param pFastLoop scheduler.
+* @return none.
+*/
+static void FastLoop_TriggersSchedule(MCAPP_FAST_LOOP_T *pFastLoop)
+{
+    PWM_TRIGGER_T *pTrigger = &pFastLoop->trigger;
+    uint32_t period = pTrigger->period;
+    uint32_t sample[PWM_MOTOR_COUNT], first, after, previous = 0;
+    uint16_t motor, i;
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        PWM_TriggerDutySet(pTrigger, motor, pFastLoop->pFoc[motor]->svpwm.duty,
+                           pFastLoop->pFoc[motor]->svpwm.duty);
+    }
+    PWM_TriggerSchedule(pTrigger);
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        sample[motor] = (pTrigger->socOffset[motor] + 
+                         pTrigger->trigger[motor] * pTrigger->scale[motor]) 
+                            % period;
+    }
+    /* Samples after the first one in the order of the motors */
+    first = sample[pFastLoop->order[0]];
+    for (i = 1; i < PWM_MOTOR_COUNT; i++)
+    {
+        after = (sample[pFastLoop->order[i]] + period - first) % period;
+        if (after <= previous)
+        {
+            pFastLoop->reorders++;
+            return;
+        }
+        previous = after;
+    }
+
+    PWM_TriggerUpdate(pTrigger);
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        pFastLoop->sample[motor] = sample[motor];
+    }
+    FastLoop_DeadlineSet(pFastLoop);
+}
+#endif
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_FastLoopInit(MCAPP_FAST_LOOP_T *, MCAPP_FOC_T *,
+*                                  MCAPP_MEASURE_T *, const PWM_TIMING_T *)
+* </B>
+*
+* @brief Function initializes the scheduler of the three motors, starts 
+* Timer1 free running if it is not running yet and orders the motors by 
+* their sampling time. Initialize the control of the motors and write 
+* their triggers first.
+*        
+* @param pFastLoop scheduler.
+* @param pFoc current control of the motors, indexed by PWM_MOTOR_T.
+* @param pMeasure measurement of the motors, indexed by PWM_MOTOR_T.
+* @param pTiming PWM timing.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_FastLoopInit(&fastLoop, focMotor, measureMotor, &pwmTiming);
+* </CODE>
+*
+*/
+void MCAPP_FastLoopInit(MCAPP_FAST_LOOP_T *pFastLoop, MCAPP_FOC_T *pFoc,
+                        MCAPP_MEASURE_T *pMeasure, 
+                        const PWM_TIMING_T *pTiming)
+{
+    uint16_t motor;
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        pFastLoop->pFoc[motor] = &pFoc[motor];
+        pFastLoop->pMeasure[motor] = &pMeasure[motor];
+        pFastLoop->elapsed[motor] = 0;
+        pFastLoop->elapsedMax[motor] = 0;
+        pFastLoop->misses[motor] = 0;
+    }
+    pFastLoop->entry = 0;
+    pFastLoop->runs = 0;
+    pFastLoop->reorders = 0;
+
+    /* Shared with the boot profiler, which runs it the same way */
+    if (T1CONbits.ON == 0)
+    {
+        TIMER1_Initialize();
+        TIMER1_PeriodSet(0xFFFFFFFF);
+        TIMER1_CounterClear();
+        TIMER1_ModuleStart();
+    }
+
+    MCAPP_FastLoopOrder(pFastLoop, pTiming);
+}
+
+/**
+* <B> Function: MCAPP_FastLoopOrder(MCAPP_FAST_LOOP_T *, const PWM_TIMING_T *)
+* </B>
+*
+* @brief Function orders the motors by the sampling time of their triggers
+* and calculates the deadline of each motor. The cycle is cut at the 
+* longest interval between two samples, in which the interrupt of the last
+* motor runs. It initializes the trigger scheduler (pwm_trigger.c) of the 
+* timing, whose schedules MCAPP_FastLoopService() applies only while they
+* keep this order. Call it again after PWM_SetTiming() or 
+* PWM_SetInterleave(), with the ADC interrupt of the previous last motor 
+* disabled.
+*        
+* @param pFastLoop scheduler.
+* @param pTiming PWM timing.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_FastLoopOrder(&fastLoop, &pwmTiming); </CODE>
+*
+*/
+void MCAPP_FastLoopOrder(MCAPP_FAST_LOOP_T *pFastLoop, 
+                         const PWM_TIMING_T *pTiming)
+{
+    uint32_t period = 2 * (pTiming->loopTimeTcy + PWM_TICKS_PER_CLOCK);
+    uint32_t interval, longest;
+    uint16_t sorted[PWM_MOTOR_COUNT];
+    uint16_t i, j, first;
+
+    PWM_TriggerInit(&pFastLoop->trigger, pTiming);
+
+    /* Insertion sort of the samples after the PG5 start of cycle */
+    for (i = 0; i < PWM_MOTOR_COUNT; i++)
+    {
+        pFastLoop->sample[i] = FastLoop_SampleTime(pTiming, i);
+        for (j = i; (j > 0) && 
+            (pFastLoop->sample[sorted[j - 1]] > pFastLoop->sample[i]); j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = i;
+    }
+
+    /* Longest interval ahead of a sample, the first one wraps the cycle */
+    first = 0;
+    longest = pFastLoop->sample[sorted[0]] + period - 
+                pFastLoop->sample[sorted[PWM_MOTOR_COUNT - 1]];
+    for (i = 1; i < PWM_MOTOR_COUNT; i++)
+    {
+        interval = pFastLoop->sample[sorted[i]] - 
+                    pFastLoop->sample[sorted[i - 1]];
+        if (interval > longest)
+        {
+            longest = interval;
+            first = i;
+        }
+    }
+    for (i = 0; i < PWM_MOTOR_COUNT; i++)
+    {
+        pFastLoop->order[i] = sorted[(first + i) % PWM_MOTOR_COUNT];
+    }
+    pFastLoop->last = pFastLoop->order[PWM_MOTOR_COUNT - 1];
+
+    FastLoop_DeadlineSet(pFastLoop);
+}
+
+/**
+* <B> Function: MCAPP_FastLoopService(MCAPP_FAST_LOOP_T *) </B>
+*
+* @brief Function captures the ADC results of the three motors into one 
+* frame and runs the current control of the motors in the order of their
+* samples from that frame. It records the elapsed time of each update 
+* against its deadline. Once the duty cycles of all motors are written it
+* places the current triggers of the next cycle around their edges, except
+* with SINGLE_SHUNT, where SingleShunt_PwmUpdate() places the bus current 
+* triggers. The triggers are updated with the duty cycles at the next start
+* of cycle of each motor. Call it from the ADC interrupt of the last motor.
+*        
+* @param pFastLoop scheduler.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_FastLoopService(&fastLoop); </CODE>
+*
+*/
+void MCAPP_FastLoopService(MCAPP_FAST_LOOP_T *pFastLoop)
+{
+    uint32_t elapsed;
+    uint16_t motor, i;
+
+    pFastLoop->entry = TIMER1_CounterRead();
+    ADC_FrameCapture();
+    for (i = 0; i < PWM_MOTOR_COUNT; i++)
+    {
+        motor = pFastLoop->order[i];
+        MCAPP_FocService(pFastLoop->pFoc[motor], pFastLoop->pMeasure[motor]);
+
+        elapsed = TIMER1_CounterRead() - pFastLoop->entry;
+        pFastLoop->elapsed[motor] = elapsed;
+        if (elapsed > pFastLoop->elapsedMax[motor])
+        {
+            pFastLoop->elapsedMax[motor] = elapsed;
+        }
+        if (elapsed >= pFastLoop->deadline[motor])
+        {
+            pFastLoop->misses[motor]++;
+        }
+    }
+#ifndef SINGLE_SHUNT
+    FastLoop_TriggersSchedule(pFastLoop);
+#endif
+    pFastLoop->runs++;
+}
+
+// </editor-fold>
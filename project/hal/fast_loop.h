@@ -0,0 +1,119 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file fast_loop.h
+ *
+ * @brief This header file lists the functions and definitions of the 
+ * scheduler of the current control of the three motors.
+ *
+ * Component: FAST LOOP
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __FAST_LOOP_H
+#define __FAST_LOOP_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "pwm.h"
+#include "timer1.h"
+#include "pwm_trigger.h"
+#include "measure.h"
+#include "foc.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Ticks of 1/16 PWM clock per count of Timer1, which runs 1:1 */
+#define FAST_LOOP_TICKS_PER_COUNT                                             \
+    (uint32_t)(((uint64_t)PWM_TICKS_PER_CLOCK*PWM_CLOCK_MHZ*1000000UL)/       \
+                TIMER1_CLOCK)
+
+/* Start of the last sample to the first instruction of the interrupt :
+   sampling, conversion and interrupt latency */
+#define FAST_LOOP_LATENCY_MICROSEC      1.0f
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    MCAPP_FOC_T
+        *pFoc[PWM_MOTOR_COUNT];     /* Control of the motors */
+
+    MCAPP_MEASURE_T
+        *pMeasure[PWM_MOTOR_COUNT];
+
+    PWM_TRIGGER_T
+        trigger;                    /* Current triggers of the motors */
+
+    uint32_t
+        sample[PWM_MOTOR_COUNT],    /* Current sample after the PG5 SOC, 
+                                       ticks of 1/16 PWM clock */
+        deadline[PWM_MOTOR_COUNT],  /* Next start of cycle of the motor after
+                                       the interrupt, Timer1 counts */
+        elapsed[PWM_MOTOR_COUNT],   /* Interrupt entry to the end of the 
+                                       update of the motor, Timer1 counts */
+        elapsedMax[PWM_MOTOR_COUNT],
+        misses[PWM_MOTOR_COUNT],    /* Updates completed after the deadline */
+        entry,                      /* Timer1 at the interrupt entry */
+        runs,                       /* Interrupts serviced */
+        reorders;                   /* Trigger schedules dropped as they 
+                                       changed the order of the samples */
+
+    uint16_t
+        order[PWM_MOTOR_COUNT],     /* Motors by sampling time */
+        last;                       /* PWM_MOTOR_T sampled last, whose ADC 
+                                       interrupt runs the scheduler */
+
+} MCAPP_FAST_LOOP_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_FastLoopInit(MCAPP_FAST_LOOP_T *, MCAPP_FOC_T *, 
+                        MCAPP_MEASURE_T *, const PWM_TIMING_T *);
+void MCAPP_FastLoopOrder(MCAPP_FAST_LOOP_T *, const PWM_TIMING_T *);
+void MCAPP_FastLoopService(MCAPP_FAST_LOOP_T *);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __FAST_LOOP_H
@@ -0,0 +1,507 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file foc.c
+ *
+ * @brief This module runs the field oriented current control of a motor
+ * every PWM cycle, from the ADC interrupt of the motor.
+ *
+ * MCAPP_FocService() reads the current, VBUS and, every samplingFactor 
+ * cycles, phase voltage samples of the motor into its MCAPP_MEASURE_T, 
+ * measures the current offsets after start-up and then calls 
+ * MCAPP_FocUpdate(): Clarke and Park transform of the calibrated phase 
+ * currents, a PI regulator with anti-windup per axis, inverse Park
+ * transform and space vector modulation (svpwm.c), which writes the duty
+ * cycles to PGxDC of the phase generators of the motor (PWM_PDC1-3 for
+ * MC1). The control runs in Q15 in both builds of measure.c; with floating
+ * point currents they are converted once per cycle.
+ *
+ * The electrical angle advances by speed every cycle. The speed loop, or a
+ * rotor position estimator, sets angle, speed and the current references
+ * between the updates. The sensorless observer (observer.c) runs every 
+ * cycle; with sensorless set its angle and speed replace them.
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "foc.h"
+#include "adc.h"
+#include "pwm.h"
+#include "pwm_trigger.h"
+#include "svpwm.h"
+#include "trig.h"
+#include "observer.h"
+#include "measure.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Calibrated current of measure.c to Q15 of MC1_PEAK_CURRENT */
+#ifdef MEASURE_FIXED_POINT
+#define FOC_CURRENT_Q15(current)    (current)
+#else
+#define FOC_CURRENT_Q15(current)                                               \
+    FOC_SaturateQ15((int32_t)((current)*(32768.0f/MC1_PEAK_CURRENT)))
+#endif
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: FOC_SaturateQ15(int32_t) </B>
+*
+* @brief Function limits a value to the Q15 range.
+*
+* @param value value.
+* @return value limited to -32768..32767.
+*/
+static inline int16_t FOC_SaturateQ15(int32_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+
+/**
+* <B> Function: FOC_OffsetChannels(uint16_t, bool) </B>
+*
+* @brief Function sets the current channels of a motor and the channel of 
+* its ADC interrupt to accumulate FOC_OFFSET_ACCUMULATE conversions per 
+* result, or back to single conversion mode. Accumulating, the interrupt 
+* comes once per sum.
+*
+* @param motor PWM_MOTOR_T.
+* @param accumulate true to accumulate.
+* @return none.
+*/
+static void FOC_OffsetChannels(uint16_t motor, bool accumulate)
+{
+#ifdef SINGLE_SHUNT
+    static const uint16_t signal[] = 
+        {ADC_SIGNAL_IBUS1, ADC_INTERRUPT_SIGNAL(0)};
+#else
+    const uint16_t signal[] = 
+        {ADC_SIGNAL_IA, ADC_SIGNAL_IB, ADC_INTERRUPT_SIGNAL(motor)};
+#endif
+    uint16_t i;
+
+    for (i = 0; i < sizeof(signal)/sizeof(signal[0]); i++)
+    {
+        if (accumulate)
+        {
+            ADC_ChannelAccumulate(motor, signal[i], FOC_OFFSET_ACCUMULATE);
+        }
+        else
+        {
+            ADC_ChannelSingle(motor, signal[i]);
+        }
+    }
+}
+
+/**
+* <B> Function: FOC_CurrentOffset(MCAPP_FOC_T *, MCAPP_MEASURE_T *,
+*                                  const ADC_FRAME_T *) </B>
+*
+* @brief Function runs one step of the current offset measurement from the 
+* sums of the accumulating current channels in the frame. The first call 
+* starts the accumulation and the first sum is dropped, as the channels of 
+* the motors switched at different points of the PWM cycle. The channels 
+* return to single conversion mode once the offsets are measured.
+*
+* @param pFoc current control.
+* @param pMeasure measurement of the motor.
+* @param pFrame latest ADC frame.
+* @return none.
+*/
+static void FOC_CurrentOffset(MCAPP_FOC_T *pFoc, MCAPP_MEASURE_T *pMeasure,
+                              const ADC_FRAME_T *pFrame)
+{
+    const uint16_t samples = ADC_ACCUMULATE_SAMPLES(FOC_OFFSET_ACCUMULATE);
+
+    if (pFoc->offsetState == FOC_OFFSET_IDLE)
+    {
+        FOC_OffsetChannels(pFoc->motor, true);
+        pFoc->offsetState = FOC_OFFSET_FIRST;
+        return;
+    }
+    if (pFoc->offsetState == FOC_OFFSET_FIRST)
+    {
+        pFoc->offsetState = FOC_OFFSET_SUM;
+        return;
+    }
+#ifdef SINGLE_SHUNT
+    MCAPP_MeasureCurrentOffsetSum(pMeasure, 0, 0, 
+        pFrame->Ibus1Sum[pFoc->motor], samples);
+#else
+    MCAPP_MeasureCurrentOffsetSum(pMeasure, pFrame->IaSum[pFoc->motor],
+        pFrame->IbSum[pFoc->motor], 0, samples);
+#endif
+    if (MCAPP_MeasureCurrentOffsetStatus(pMeasure))
+    {
+        FOC_OffsetChannels(pFoc->motor, false);
+        pFoc->offsetState = FOC_OFFSET_IDLE;
+    }
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_FocPiInit(MCAPP_FOC_PI_T *, int16_t, uint16_t,
+*                               int16_t, int16_t) </B>
+*
+* @brief Function initializes a PI regulator with zero integral term and
+* output limits of the full Q15 range.
+*
+* @param pPi PI regulator.
+* @param kp proportional gain, Q15 * 2^kpShift.
+* @param kpShift scale of the proportional gain, at most 15.
+* @param ki integral gain per cycle, Q15.
+* @param kc anti-windup gain, Q15.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FocPiInit(&pi, FOC_KP, FOC_KP_SHIFT, FOC_KI, FOC_KC); </CODE>
+*
+*/
+void MCAPP_FocPiInit(MCAPP_FOC_PI_T *pPi, int16_t kp, uint16_t kpShift,
+                     int16_t ki, int16_t kc)
+{
+    pPi->kp = kp;
+    pPi->kpShift = kpShift;
+    pPi->ki = ki;
+    pPi->kc = kc;
+    pPi->outMax = INT16_MAX;
+    pPi->outMin = -INT16_MAX;
+    pPi->integrator = 0;
+    pPi->out = 0;
+}
+
+/**
+* <B> Function: MCAPP_FocPiLimit(MCAPP_FOC_PI_T *, int16_t, int16_t) </B>
+*
+* @brief Function sets the output limits of a PI regulator.
+*
+* @param pPi PI regulator.
+* @param outMin lower limit, Q15.
+* @param outMax upper limit, Q15, not below outMin.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FocPiLimit(&pi, -vmax, vmax); </CODE>
+*
+*/
+void MCAPP_FocPiLimit(MCAPP_FOC_PI_T *pPi, int16_t outMin, int16_t outMax)
+{
+    pPi->outMin = outMin;
+    pPi->outMax = outMax;
+}
+
+/**
+* <B> Function: MCAPP_FocPiUpdate(MCAPP_FOC_PI_T *, int16_t, int16_t) </B>
+*
+* @brief Function runs one cycle of a PI regulator. The output is limited;
+* the part of the unlimited output beyond the limit, weighted by kc, is
+* taken back from the integral term so that it does not wind up while the
+* output is limited.
+*
+* @param pPi PI regulator.
+* @param reference reference, Q15.
+* @param measured measured value, Q15.
+* @return output, Q15.
+*
+* @example
+* <CODE> vd = MCAPP_FocPiUpdate(&piId, idRef, id); </CODE>
+*
+*/
+int16_t MCAPP_FocPiUpdate(MCAPP_FOC_PI_T *pPi, int16_t reference,
+                          int16_t measured)
+{
+    int32_t error, unlimited, out, excess;
+    int64_t integrator;
+
+    error = FOC_SaturateQ15((int32_t)reference - measured);
+    unlimited = (pPi->integrator >> 15) +
+                (((int32_t)pPi->kp * error) >> (15 - pPi->kpShift));
+    out = unlimited;
+    if (out > pPi->outMax)
+    {
+        out = pPi->outMax;
+    }
+    else if (out < pPi->outMin)
+    {
+        out = pPi->outMin;
+    }
+    excess = FOC_SaturateQ15(unlimited - out);
+
+    integrator = (int64_t)pPi->integrator + (int32_t)pPi->ki * error -
+                 (int32_t)pPi->kc * excess;
+    if (integrator > ((int64_t)pPi->outMax << 15))
+    {
+        integrator = (int64_t)pPi->outMax << 15;
+    }
+    else if (integrator < ((int64_t)pPi->outMin << 15))
+    {
+        integrator = (int64_t)pPi->outMin << 15;
+    }
+    pPi->integrator = (int32_t)integrator;
+    pPi->out = (int16_t)out;
+    return pPi->out;
+}
+
+/**
+* <B> Function: MCAPP_FocInit(MCAPP_FOC_T *, uint16_t, const PWM_TIMING_T *)
+* </B>
+*
+* @brief Function initializes the current control of a motor for a PWM
+* timing, stopped, with zero references and the default gains. Call it
+* again after PWM_SetTiming().
+*
+* @param pFoc current control.
+* @param motor PWM_MOTOR_T.
+* @param pTiming PWM timing, normally pwmTiming.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FocInit(&foc, PWM_MOTOR_MC1, &pwmTiming); </CODE>
+*
+*/
+void MCAPP_FocInit(MCAPP_FOC_T *pFoc, uint16_t motor,
+                   const PWM_TIMING_T *pTiming)
+{
+#ifdef SINGLE_SHUNT
+    uint32_t scale = PWM_MotorTicksPerCount(motor), delay;
+#endif
+
+    pFoc->motor = motor;
+    MCAPP_FocPiInit(&pFoc->piId, FOC_KP, FOC_KP_SHIFT, FOC_KI, FOC_KC);
+    MCAPP_FocPiInit(&pFoc->piIq, FOC_KP, FOC_KP_SHIFT, FOC_KI, FOC_KC);
+    SVPWM_Init(&pFoc->svpwm, motor, pTiming, SVPWM_LINEAR);
+    MCAPP_ObserverInit(&pFoc->observer, OBSERVER_RS_OHM, OBSERVER_LS_HENRY,
+                       pTiming->frequencyHz);
+#ifdef SINGLE_SHUNT
+    delay = pTiming->deadtime + 
+            PWM_TRIGGER_TICKS(PWM_TRIGGER_SETTLE_MICROSEC) / scale;
+    SingleShunt_InitializeParameters(&pFoc->singleShunt,
+            PWM_MotorPeriod(pTiming, motor), 
+            delay + PWM_TRIGGER_TICKS(PWM_TRIGGER_SAMPLE_MICROSEC) / scale,
+            delay);
+#endif
+
+    pFoc->ialpha = 0;
+    pFoc->ibeta = 0;
+    pFoc->id = 0;
+    pFoc->iq = 0;
+    pFoc->idRef = 0;
+    pFoc->iqRef = 0;
+    pFoc->vd = 0;
+    pFoc->vq = 0;
+    pFoc->valpha = 0;
+    pFoc->vbeta = 0;
+    pFoc->sin = 0;
+    pFoc->cos = INT16_MAX;
+    pFoc->speed = 0;
+    pFoc->angle = 0;
+    pFoc->vbusCount = 0;
+    pFoc->enable = 0;
+    pFoc->sensorless = 0;
+    pFoc->offsetState = FOC_OFFSET_IDLE;
+    pFoc->updates = 0;
+    MCAPP_FocVbusSet(pFoc, 0);
+}
+
+/**
+* <B> Function: MCAPP_FocVbusSet(MCAPP_FOC_T *, int16_t) </B>
+*
+* @brief Function sets the DC link voltage of the modulator and limits both
+* current regulators to the largest voltage of linear modulation,
+* VBUS/sqrt(3). MCAPP_FocUpdate() calls it every 2^FOC_VBUS_SHIFT cycles.
+*
+* @param pFoc current control.
+* @param vbus DC link voltage, Q15 of the VBUS full scale.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FocVbusSet(&foc, FOC_VBUS_Q15(count)); </CODE>
+*
+*/
+void MCAPP_FocVbusSet(MCAPP_FOC_T *pFoc, int16_t vbus)
+{
+    int16_t limit;
+
+    SVPWM_VbusSet(&pFoc->svpwm, vbus);
+    limit = (int16_t)(((int32_t)pFoc->svpwm.vbus * FOC_INV_SQRT3) >> 15);
+    MCAPP_FocPiLimit(&pFoc->piId, -limit, limit);
+    MCAPP_FocPiLimit(&pFoc->piIq, -limit, limit);
+}
+
+/**
+* <B> Function: MCAPP_FocUpdate(MCAPP_FOC_T *, const MCAPP_MEASURE_T *) </B>
+*
+* @brief Function runs one cycle of the current control from the calibrated
+* phase currents and writes the duty cycles of the next cycle.
+*
+* @param pFoc current control.
+* @param pMeasure measurement of the motor, after
+*        MCAPP_MeasureCurrentCalibrate().
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FocUpdate(&foc, &measure); </CODE>
+*
+*/
+void MCAPP_FocUpdate(MCAPP_FOC_T *pFoc, const MCAPP_MEASURE_T *pMeasure)
+{
+    int32_t ia, ib;
+
+    if (++pFoc->vbusCount >= (1 << FOC_VBUS_SHIFT))
+    {
+        pFoc->vbusCount = 0;
+        MCAPP_FocVbusSet(pFoc, 
+                         FOC_VBUS_Q15(pMeasure->measureVdc.count));
+    }
+
+    /* Clarke */
+    ia = FOC_CURRENT_Q15(pMeasure->measureCurrent.Ia_actual);
+    ib = FOC_CURRENT_Q15(pMeasure->measureCurrent.Ib_actual);
+    pFoc->ialpha = (int16_t)ia;
+    pFoc->ibeta = FOC_SaturateQ15(((ia + 2*ib) * FOC_INV_SQRT3) >> 15);
+
+    /* Rotor position observer, the voltages of the previous cycle after 
+       the limit of the modulator are applied until the next sample */
+    MCAPP_ObserverUpdate(&pFoc->observer, pFoc->ialpha, pFoc->ibeta,
+                         pFoc->svpwm.valpha, pFoc->svpwm.vbeta);
+    if (pFoc->sensorless)
+    {
+        pFoc->angle = pFoc->observer.angle;
+        pFoc->speed = pFoc->observer.speed;
+    }
+
+    /* Park */
+    TRIG_SinCosQ15(pFoc->angle, &pFoc->sin, &pFoc->cos);
+    pFoc->id = FOC_SaturateQ15(((int32_t)pFoc->ialpha * pFoc->cos + 
+                                (int32_t)pFoc->ibeta * pFoc->sin) >> 15);
+    pFoc->iq = FOC_SaturateQ15(((int32_t)pFoc->ibeta * pFoc->cos - 
+                                (int32_t)pFoc->ialpha * pFoc->sin) >> 15);
+
+    /* Current regulators */
+    pFoc->vd = MCAPP_FocPiUpdate(&pFoc->piId, pFoc->idRef, pFoc->id);
+    pFoc->vq = MCAPP_FocPiUpdate(&pFoc->piIq, pFoc->iqRef, pFoc->iq);
+
+    /* Inverse Park */
+    pFoc->valpha = FOC_SaturateQ15(((int32_t)pFoc->vd * pFoc->cos - 
+                                    (int32_t)pFoc->vq * pFoc->sin) >> 15);
+    pFoc->vbeta = FOC_SaturateQ15(((int32_t)pFoc->vd * pFoc->sin + 
+                                   (int32_t)pFoc->vq * pFoc->cos) >> 15);
+
+    /* Modulation, the duty cycles take effect at the next start of cycle */
+#ifdef SINGLE_SHUNT
+    SVPWM_Calculate(&pFoc->svpwm, pFoc->valpha, pFoc->vbeta);
+    SingleShunt_DutyShift(&pFoc->singleShunt, pFoc->svpwm.duty);
+    SingleShunt_PwmUpdate(&pFoc->singleShunt, pFoc->motor);
+#else
+    SVPWM_Update(&pFoc->svpwm, pFoc->valpha, pFoc->vbeta);
+#endif
+
+    pFoc->angle += (uint16_t)pFoc->speed;
+    pFoc->updates++;
+}
+
+/**
+* <B> Function: MCAPP_FocService(MCAPP_FOC_T *, MCAPP_MEASURE_T *) </B>
+*
+* @brief Function reads the samples of the motor from the latest ADC frame
+* and runs the current control. Until the current offsets are measured the
+* current channels accumulate in hardware, their sums go to the offset 
+* measurement and the duty cycles stay at 50%; the control then starts with
+* enable set. The phase voltages are read every samplingFactor
+* calls from start-up on. Call it after ADC_FrameCapture(), 
+* MCAPP_FastLoopService() captures the frame once for the three motors.
+*
+* @param pFoc current control.
+* @param pMeasure measurement of the motor, MCAPP_MeasureCurrentInit() and
+*        MCAPP_MeasurePhaseVoltInit() called.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_FocService(&foc, &measure); </CODE>
+*
+*/
+void MCAPP_FocService(MCAPP_FOC_T *pFoc, MCAPP_MEASURE_T *pMeasure)
+{
+    MCAPP_MEASURE_CURRENT_T *pCurrent = &pMeasure->measureCurrent;
+    const ADC_FRAME_T *pFrame = ADC_FrameLatest();
+    uint16_t motor = pFoc->motor;
+
+    pCurrent->Ia = pFrame->Ia[motor];
+    pCurrent->Ib = pFrame->Ib[motor];
+#ifdef SINGLE_SHUNT
+    pCurrent->Ibus1 = pFrame->Ibus1[motor];
+    pCurrent->Ibus2 = pFrame->Ibus2[motor];
+    pCurrent->Ibus = pCurrent->Ibus1;
+#endif
+    pMeasure->measureVdc.count = pFrame->vbus;
+    MCAPP_MeasurePhaseVolt(pMeasure, pFrame->Va[motor], pFrame->Vb[motor], 
+                           pFrame->Vc[motor]);
+
+    if (MCAPP_MeasureCurrentOffsetStatus(pMeasure) == 0)
+    {
+        FOC_CurrentOffset(pFoc, pMeasure, pFrame);
+        return;
+    }
+    if (pFoc->enable == 0)
+    {
+        MCAPP_FocVbusSet(pFoc, FOC_VBUS_Q15(pMeasure->measureVdc.count));
+        pFoc->enable = 1;
+    }
+#ifdef SINGLE_SHUNT
+    MCAPP_MeasureCurrentCalibrate(pMeasure, &pFoc->singleShunt);
+#else
+    MCAPP_MeasureCurrentCalibrate(pMeasure, 0);
+#endif
+    MCAPP_FocUpdate(pFoc, pMeasure);
+}
+
+// </editor-fold>
@@ -0,0 +1,169 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file foc.h
+ *
+ * @brief This header file lists the functions and definitions of the field
+ * oriented current control of a motor.
+ *
+ * Component: FOC
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __FOC_H
+#define __FOC_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "adc.h"
+#include "pwm.h"
+#include "svpwm.h"
+#include "observer.h"
+#include "measure.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* 1/sqrt(3) in Q15 */
+#define FOC_INV_SQRT3           18919
+
+/* Gains of the current regulators, Q15 : Kp * 2^FOC_KP_SHIFT, Ki per
+   control cycle, Kc of the anti-windup. Tune them for the motor */
+#define FOC_KP                  16384
+#define FOC_KP_SHIFT            0
+#define FOC_KI                  1638
+#define FOC_KC                  32767
+
+/* The duty cycle gain of the modulator follows VBUS every
+   2^FOC_VBUS_SHIFT control cycles */
+#define FOC_VBUS_SHIFT          4
+
+/* VBUS in ADC counts (MC_ADCBUF_VDC) to the Q15 voltage of the voltage
+   commands : the full scale of the VBUS measurement */
+#define FOC_VBUS_Q15(count)     (int16_t)((count) << 3)
+
+/* Conversions the current channels sum in hardware while the offsets are
+   measured, ADC_ACCUMULATE_T */
+#define FOC_OFFSET_ACCUMULATE   ADC_ACCUMULATE_64
+
+/* Offset measurement of MCAPP_FocService(), offsetState */
+#define FOC_OFFSET_IDLE         0   /* Channels in single conversion mode */
+#define FOC_OFFSET_FIRST        1   /* First sum, may be incomplete */
+#define FOC_OFFSET_SUM          2   /* Sums go to the offset measurement */
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int32_t
+        integrator;         /* Integral term, Q30 */
+
+    int16_t
+        kp,                 /* Proportional gain, Q15 * 2^kpShift */
+        ki,                 /* Integral gain per cycle, Q15 */
+        kc,                 /* Anti-windup gain, Q15 */
+        outMax,             /* Output limits, Q15 */
+        outMin,
+        out;                /* Last output, Q15 */
+
+    uint16_t
+        kpShift;
+
+} MCAPP_FOC_PI_T;
+
+typedef struct
+{
+    MCAPP_FOC_PI_T
+        piId,               /* d and q axis current regulators */
+        piIq;
+
+    SVPWM_T
+        svpwm;              /* Modulator of the motor */
+
+    MCAPP_OBSERVER_T
+        observer;           /* Sensorless rotor position observer */
+
+#ifdef SINGLE_SHUNT
+    SINGLE_SHUNT_PARM_T
+        singleShunt;
+#endif
+
+    int16_t
+        ialpha,             /* Currents, Q15 of MC1_PEAK_CURRENT */
+        ibeta,
+        id,
+        iq,
+        idRef,              /* Current references, set by the speed loop */
+        iqRef,
+        vd,                 /* Voltages, Q15 of the VBUS full scale */
+        vq,
+        valpha,
+        vbeta,
+        sin,                /* Sine and cosine of the angle, Q15 */
+        cos,
+        speed;              /* Angle increment per control cycle */
+
+    uint16_t
+        angle,              /* Electrical angle, 65536 per turn */
+        motor,              /* PWM_MOTOR_T */
+        vbusCount,          /* Control cycles since the VBUS update */
+        enable,             /* Current control running */
+        sensorless,         /* Angle and speed from the observer */
+        offsetState,        /* FOC_OFFSET_IDLE, _FIRST or _SUM */
+        updates;            /* Control cycles */
+
+} MCAPP_FOC_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_FocPiInit(MCAPP_FOC_PI_T *, int16_t, uint16_t, int16_t, int16_t);
+void MCAPP_FocPiLimit(MCAPP_FOC_PI_T *, int16_t, int16_t);
+int16_t MCAPP_FocPiUpdate(MCAPP_FOC_PI_T *, int16_t, int16_t);
+void MCAPP_FocInit(MCAPP_FOC_T *, uint16_t, const PWM_TIMING_T *);
+void MCAPP_FocVbusSet(MCAPP_FOC_T *, int16_t);
+void MCAPP_FocUpdate(MCAPP_FOC_T *, const MCAPP_MEASURE_T *);
+void MCAPP_FocService(MCAPP_FOC_T *, MCAPP_MEASURE_T *);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __FOC_H
@@ -49,11 +49,102 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
-//#include "measure.h"
+#include "measure.h"
 
 // </editor-fold>
 
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Offset correction and conversion of the current samples, see
+   MEASURE_FIXED_POINT in measure.h */
+#ifdef MEASURE_FIXED_POINT
+#define MEASURE_OFFSET_CORRECT(sample, offset)                                 \
+    MCAPP_SaturateQ15((int32_t)(sample) - (offset))
+#define MEASURE_CURRENT(sample)             (sample)
+#define MEASURE_CURRENT_NEGATE_SUM(a, b)                                       \
+    MCAPP_SaturateQ15(-(int32_t)(a) - (b))
+/* Average of the offset samples rounded to nearest */
+#define MEASURE_OFFSET_AVERAGE(sum)                                            \
+    (int16_t)(((sum) + (1 << (OFFSET_COUNT_BITS - 1))) >> OFFSET_COUNT_BITS)
+#else
+#define MEASURE_OFFSET_CORRECT(sample, offset)  ((sample) - (offset))
+#define MEASURE_CURRENT(sample)             (float)((sample)*ADC_CURRENT_SCALE)
+#define MEASURE_CURRENT_NEGATE_SUM(a, b)    (-(a) - (b))
+#define MEASURE_OFFSET_AVERAGE(sum)         (int16_t)((sum) >> OFFSET_COUNT_BITS)
+#endif
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+#ifdef MEASURE_FIXED_POINT
+/**
+* <B> Function: MCAPP_SaturateQ15(int32_t)  </B>
+*
+* @brief Function limits a value to the Q15 range.
+*        
+* @param value value to limit.
+* @return value limited to -32768..32767.
+*/
+static inline int16_t MCAPP_SaturateQ15(int32_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+#endif
+
+/**
+* <B> Function: MCAPP_MeasureOffsetTrack(int32_t *, int16_t *, int16_t,
+*                       int16_t, const MCAPP_MEASURE_OFFSET_TRACK_T *)  </B>
+*
+* @brief Function filters one offset sample with a time constant of 2^shift
+*        samples and moves the offset towards the filter output by at most 
+*        slewMax.
+*        
+* @param pFilter filter state, offset scaled by 2^shift.
+* @param pOffset offset to update.
+* @param sample current sample taken at zero current.
+* @param initial offset when tracking started.
+* @param pTrack tracking time constant and slew limit.
+* @return absolute drift of the offset from initial.
+*/
+static int16_t MCAPP_MeasureOffsetTrack(int32_t *pFilter, int16_t *pOffset,
+                    int16_t sample, int16_t initial, 
+                    const MCAPP_MEASURE_OFFSET_TRACK_T *pTrack)
+{
+    int32_t target, step;
+    
+    *pFilter += (int32_t)sample - (*pFilter >> pTrack->shift);
+    target = (*pFilter + (1L << pTrack->shift >> 1)) >> pTrack->shift;
+    
+    step = target - *pOffset;
+    if (step > pTrack->slewMax)
+    {
+        step = pTrack->slewMax;
+    }
+    else if (step < -pTrack->slewMax)
+    {
+        step = -pTrack->slewMax;
+    }
+    *pOffset = (int16_t)(*pOffset + step);
+    
+    step = (int32_t)*pOffset - initial;
+    return (int16_t)((step < 0) ? -step : step);
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
 /**
 * <B> Function: MCAPP_MeasureCurrentInit(MCAPP_MEASURE_CURRENT_T *)  </B>
 *
@@ -99,17 +190,49 @@ void MCAPP_MeasureCurrentOffset(MCAPP_MEASURE_T *pMotorInputs)
     
     pCurrent = &pMotorInputs->measureCurrent;
     
-    pCurrent->sumIa += pCurrent->Ia;
-    pCurrent->sumIb += pCurrent->Ib;
-    pCurrent->sumIbus += pCurrent->Ibus;
-    pCurrent->counter++;
+    MCAPP_MeasureCurrentOffsetSum(pMotorInputs, pCurrent->Ia, pCurrent->Ib,
+                                  pCurrent->Ibus, 1);
+}
+
+/**
+* <B> Function: MCAPP_MeasureCurrentOffsetSum(MCAPP_MEASURE_T *, int32_t, 
+*                                             int32_t, int32_t, uint16_t) </B>
+*
+* @brief Function to add sums of current samples to the offset measurement, 
+*        such as the results of ADC channels accumulating in hardware 
+*        (ADC_ChannelAccumulate(), ADC_ACCUMULATED_PHASE_CURRENT()). The 
+*        offsets are computed once OFFSET_COUNT_MAX samples were added.
+*        
+* @param Pointer to the data structure containing measured current.
+* @param Sum of the Ia samples.
+* @param Sum of the Ib samples.
+* @param Sum of the Ibus samples.
+* @param Samples in each sum, a power of two up to OFFSET_COUNT_MAX.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureCurrentOffsetSum(&measure, sumIa, sumIb, sumIbus, 
+*                                      256); </CODE>
+*
+*/
+void MCAPP_MeasureCurrentOffsetSum(MCAPP_MEASURE_T *pMotorInputs, 
+                    int32_t sumIa, int32_t sumIb, int32_t sumIbus, 
+                    uint16_t samples)
+{
+    MCAPP_MEASURE_CURRENT_T *pCurrent;
+    
+    pCurrent = &pMotorInputs->measureCurrent;
+    
+    pCurrent->sumIa += sumIa;
+    pCurrent->sumIb += sumIb;
+    pCurrent->sumIbus += sumIbus;
+    pCurrent->counter += (int16_t)samples;
 
     if (pCurrent->counter >= OFFSET_COUNT_MAX)
     {
-        pCurrent->offsetIa = (int16_t)(pCurrent->sumIa >> OFFSET_COUNT_BITS);
-        pCurrent->offsetIb = (int16_t)(pCurrent->sumIb >> OFFSET_COUNT_BITS);
-        pCurrent->offsetIbus =
-            (int16_t)(pCurrent->sumIbus >> OFFSET_COUNT_BITS);
+        pCurrent->offsetIa = MEASURE_OFFSET_AVERAGE(pCurrent->sumIa);
+        pCurrent->offsetIb = MEASURE_OFFSET_AVERAGE(pCurrent->sumIb);
+        pCurrent->offsetIbus = MEASURE_OFFSET_AVERAGE(pCurrent->sumIbus);
 
         pCurrent->counter = 0;
         pCurrent->sumIa = 0;
@@ -123,7 +246,8 @@ void MCAPP_MeasureCurrentOffset(MCAPP_MEASURE_T *pMotorInputs)
 * <B> Function: MCAPP_MeasureCurrentCalibrate(MCAPP_MEASURE_T *,SINGLE_SHUNT_PARM_T *)  </B>
 *
 * @brief Function to compensate offset from measured current samples and convert 
-* to actual values from ADc counts.
+* to actual values from ADc counts. Built with MEASURE_FIXED_POINT the 
+* currents stay in Q15 and the offset correction saturates.
 *        
 * @param Pointer to the data structure containing measured current.
 * @return none.
@@ -139,25 +263,32 @@ void MCAPP_MeasureCurrentCalibrate(MCAPP_MEASURE_T *pMotorInputs, SINGLE_SHUNT_P
     pCurrent = &pMotorInputs->measureCurrent;
     
     /* offset correction*/
-    pCurrent->Ia = pCurrent->Ia - pCurrent->offsetIa;
-    pCurrent->Ib = pCurrent->Ib  - pCurrent->offsetIb;
-    pCurrent->Ibus = pCurrent->Ibus - pCurrent->offsetIbus;
+    pCurrent->Ia = MEASURE_OFFSET_CORRECT(pCurrent->Ia, pCurrent->offsetIa);
+    pCurrent->Ib = MEASURE_OFFSET_CORRECT(pCurrent->Ib, pCurrent->offsetIb);
+    pCurrent->Ibus = MEASURE_OFFSET_CORRECT(pCurrent->Ibus, 
+                                            pCurrent->offsetIbus);
     
     /*Convert ADC Counts to real value*/
-    pCurrent->Ia_actual = (float)(pCurrent->Ia * ADC_CURRENT_SCALE);
-    pCurrent->Ib_actual = (float)(pCurrent->Ib * ADC_CURRENT_SCALE);
+    pCurrent->Ia_actual = MEASURE_CURRENT(pCurrent->Ia);
+    pCurrent->Ib_actual = MEASURE_CURRENT(pCurrent->Ib);
     /* Ia + Ib + Ic  = 0; in a balanced 3-phase system*/
-    pCurrent->Ic_actual = -pCurrent->Ia_actual - pCurrent->Ib_actual; 
+    pCurrent->Ic_actual = MEASURE_CURRENT_NEGATE_SUM(pCurrent->Ia_actual, 
+                                                     pCurrent->Ib_actual); 
     
 #ifdef SINGLE_SHUNT
     /* offset correction*/
-    pCurrent->Ibus1 = pCurrent->Ibus1 - pCurrent->offsetIbus;
-    pCurrent->Ibus2 = pCurrent->Ibus2 - pCurrent->offsetIbus;
+    pCurrent->Ibus1 = MEASURE_OFFSET_CORRECT(pCurrent->Ibus1, 
+                                             pCurrent->offsetIbus);
+    pCurrent->Ibus2 = MEASURE_OFFSET_CORRECT(pCurrent->Ibus2, 
+                                             pCurrent->offsetIbus);
     /*Convert ADC Counts to real value*/
-    pSingleShunt->Ibus1 = (float)(pCurrent->Ibus1* ADC_CURRENT_SCALE);
-    pSingleShunt->Ibus2 = (float)(pCurrent->Ibus2* ADC_CURRENT_SCALE);
+    pSingleShunt->Ibus1 = MEASURE_CURRENT(pCurrent->Ibus1);
+    pSingleShunt->Ibus2 = MEASURE_CURRENT(pCurrent->Ibus2);
     /* Reconstruct Phase currents from Bus Current*/ 
     SingleShunt_PhaseCurrentReconstruction(pSingleShunt);
+    pCurrent->Ia_actual = pSingleShunt->Ia;
+    pCurrent->Ib_actual = pSingleShunt->Ib;
+    pCurrent->Ic_actual = pSingleShunt->Ic;
 #endif 
     
 }
@@ -179,10 +310,393 @@ int16_t MCAPP_MeasureCurrentOffsetStatus (MCAPP_MEASURE_T *pMotorInputs)
 }
 
 
+/**
+* <B> Function: MCAPP_MeasureCurrentTrackInit(MCAPP_MEASURE_T *, uint16_t,
+*                                             int16_t)  </B>
+*
+* @brief Function to start tracking the drift of the current offsets from the 
+*        offsets computed by MCAPP_MeasureCurrentOffset(). Tracking stays 
+*        disabled until the offset measurement has completed.
+*        
+* @param Pointer to the data structure containing measured current.
+* @param Time constant of 2^shift tracked samples (MEASURE_TRACK_SHIFT).
+* @param Largest offset change per tracked sample (MEASURE_TRACK_SLEW_MAX).
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureCurrentTrackInit(&measure, MEASURE_TRACK_SHIFT,
+*                                      MEASURE_TRACK_SLEW_MAX); </CODE>
+*
+*/
+void MCAPP_MeasureCurrentTrackInit(MCAPP_MEASURE_T *pMotorInputs, 
+                                   uint16_t shift, int16_t slewMax)
+{
+    MCAPP_MEASURE_CURRENT_T *pCurrent;
+    MCAPP_MEASURE_OFFSET_TRACK_T *pTrack;
+    
+    pCurrent = &pMotorInputs->measureCurrent;
+    pTrack = &pCurrent->offsetTrack;
+    
+    if (shift > MEASURE_TRACK_SHIFT_MAX)
+    {
+        shift = MEASURE_TRACK_SHIFT_MAX;
+    }
+    pTrack->shift = shift;
+    pTrack->slewMax = slewMax;
+    pTrack->filterIa = (int32_t)pCurrent->offsetIa << shift;
+    pTrack->filterIb = (int32_t)pCurrent->offsetIb << shift;
+    pTrack->filterIbus = (int32_t)pCurrent->offsetIbus << shift;
+    pTrack->initialIa = pCurrent->offsetIa;
+    pTrack->initialIb = pCurrent->offsetIb;
+    pTrack->initialIbus = pCurrent->offsetIbus;
+    pTrack->drift = 0;
+    pTrack->driftMax = 0;
+    pTrack->updates = 0;
+    pTrack->enable = (uint16_t)(pCurrent->status != 0);
+}
+
+/**
+* <B> Function: MCAPP_MeasureCurrentTrack(MCAPP_MEASURE_T *, uint16_t)  </B>
+*
+* @brief Function to update the current offsets from raw samples taken while
+*        the measured currents are zero, before MCAPP_MeasureCurrentCalibrate()
+*        corrects them. Phase currents are zero only with the PWM outputs off
+*        and the motor currents decayed; the bus current is also zero during
+*        the zero vectors. Does nothing unless tracking is enabled.
+*        
+* @param Pointer to the data structure containing measured current.
+* @param Currents at zero, MEASURE_TRACK_PHASE and/or MEASURE_TRACK_BUS.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureCurrentTrack(&measure, MEASURE_TRACK_BUS); </CODE>
+*
+*/
+void MCAPP_MeasureCurrentTrack(MCAPP_MEASURE_T *pMotorInputs, uint16_t zero)
+{
+    MCAPP_MEASURE_CURRENT_T *pCurrent;
+    MCAPP_MEASURE_OFFSET_TRACK_T *pTrack;
+    int16_t drift;
+    
+    pCurrent = &pMotorInputs->measureCurrent;
+    pTrack = &pCurrent->offsetTrack;
+    
+    if (pTrack->enable == 0)
+    {
+        return;
+    }
+    
+    pTrack->drift = 0;
+    if (zero & MEASURE_TRACK_PHASE)
+    {
+        drift = MCAPP_MeasureOffsetTrack(&pTrack->filterIa, &pCurrent->offsetIa,
+                                    pCurrent->Ia, pTrack->initialIa, pTrack);
+        pTrack->drift = drift;
+        drift = MCAPP_MeasureOffsetTrack(&pTrack->filterIb, &pCurrent->offsetIb,
+                                    pCurrent->Ib, pTrack->initialIb, pTrack);
+        if (drift > pTrack->drift)
+        {
+            pTrack->drift = drift;
+        }
+    }
+    if (zero & MEASURE_TRACK_BUS)
+    {
+        drift = MCAPP_MeasureOffsetTrack(&pTrack->filterIbus, 
+                                    &pCurrent->offsetIbus, pCurrent->Ibus, 
+                                    pTrack->initialIbus, pTrack);
+        if (drift > pTrack->drift)
+        {
+            pTrack->drift = drift;
+        }
+    }
+    if (pTrack->drift > pTrack->driftMax)
+    {
+        pTrack->driftMax = pTrack->drift;
+    }
+    pTrack->updates++;
+}
+
+/**
+* <B> Function: MCAPP_MeasureCurrentDrift(MCAPP_MEASURE_T *)  </B>
+*
+* @brief Function to read the largest drift of the tracked current offsets 
+*        from the offsets at the start of tracking.
+*        
+* @param Pointer to the data structure containing measured current.
+* @return largest drift since MCAPP_MeasureCurrentTrackInit() in Q15 counts.
+* 
+* @example
+* <CODE> drift = MCAPP_MeasureCurrentDrift(&measure); </CODE>
+*
+*/
+int16_t MCAPP_MeasureCurrentDrift(MCAPP_MEASURE_T *pMotorInputs)
+{
+    return pMotorInputs->measureCurrent.offsetTrack.driftMax;
+}
+
+/**
+* <B> Function: MCAPP_MeasurePhaseVoltInit(MCAPP_MEASURE_T *, int16_t)  </B>
+*
+* @brief Function to reset the phase voltage measurement. The phase voltages
+*        are sampled once every samplingFactor ADC interrupts; configure the
+*        ADC triggers of the phase voltages with the same factor.
+*        
+* @param Pointer to the data structure containing measured voltages.
+* @param ADC interrupts per phase voltage sample, at least 1.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasurePhaseVoltInit(&measure, MEASURE_PHASEVOLT_FACTOR); 
+* </CODE>
+*
+*/
+void MCAPP_MeasurePhaseVoltInit(MCAPP_MEASURE_T *pMotorInputs, 
+                                int16_t samplingFactor)
+{
+    MCAPP_MEASURE_PHASEVOLT_T *pPhaseVolt;
+    
+    pPhaseVolt = &pMotorInputs->measurePhaseVolt;
+    
+    pPhaseVolt->Va = 0;
+    pPhaseVolt->Vb = 0;
+    pPhaseVolt->Vc = 0;
+    pPhaseVolt->status = 0;
+    pPhaseVolt->samplingFactor = (samplingFactor < 1) ? 1 : samplingFactor;
+    pPhaseVolt->counter = 0;
+    pPhaseVolt->updates = 0;
+}
+
+/**
+* <B> Function: MCAPP_MeasurePhaseVolt(MCAPP_MEASURE_T *, int16_t, int16_t,
+*                   int16_t)  </B>
+*
+* @brief Function to count the ADC interrupts and, once every samplingFactor
+*        of them, read the phase voltage results and convert them to Q15 of
+*        MC1_PEAK_VOLTAGE. The results are read only on that interrupt; as 
+*        the conversions are triggered once every samplingFactor PWM cycles
+*        they are at most samplingFactor cycles old. status is set with the 
+*        first sample.
+*        
+* @param Pointer to the data structure containing measured voltages.
+* @param ADC results of Va, Vb and Vc, counts as in ADC_FRAME_T.
+* @return 1 if a new sample was stored, 0 otherwise.
+* 
+* @example
+* <CODE> MCAPP_MeasurePhaseVolt(&measure, pFrame->Va[motor], 
+*                                pFrame->Vb[motor], pFrame->Vc[motor]); 
+* </CODE>
+*
+*/
+int16_t MCAPP_MeasurePhaseVolt(MCAPP_MEASURE_T *pMotorInputs, 
+                               int16_t va, int16_t vb, int16_t vc)
+{
+    MCAPP_MEASURE_PHASEVOLT_T *pPhaseVolt;
+    
+    pPhaseVolt = &pMotorInputs->measurePhaseVolt;
+    
+    pPhaseVolt->counter++;
+    if (pPhaseVolt->counter < pPhaseVolt->samplingFactor)
+    {
+        return 0;
+    }
+    pPhaseVolt->counter = 0;
+    
+    pPhaseVolt->Va = MEASURE_PHASEVOLT_Q15(va);
+    pPhaseVolt->Vb = MEASURE_PHASEVOLT_Q15(vb);
+    pPhaseVolt->Vc = MEASURE_PHASEVOLT_Q15(vc);
+    pPhaseVolt->status = 1;
+    pPhaseVolt->updates++;
+    return 1;
+}
+
+/**
+* <B> Function: MCAPP_MeasureMotorsInit(MCAPP_MEASURE_MOTORS_T *)  </B>
+*
+* @brief Function to reset variables used for current offset measurement of 
+*        all motors.
+*
+* @param Pointer to the data structure containing measured currents.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_MeasureMotorsInit(&motors); </CODE>
+*
+*/
+void MCAPP_MeasureMotorsInit(MCAPP_MEASURE_MOTORS_T *pMotors)
+{
+    uint16_t motor;
+    
+    for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+    {
+        pMotors->sumIa[motor] = 0;
+        pMotors->sumIb[motor] = 0;
+        pMotors->sumIbus[motor] = 0;
+    }
+    pMotors->counter = 0;
+    pMotors->status = 0;
+}
+
+/**
+* <B> Function: MCAPP_MeasureMotorsOffset(MCAPP_MEASURE_MOTORS_T *)  </B>
+*
+* @brief Function to accumulate one current sample of every motor and compute
+*        the current offsets of all motors after OFFSET_COUNT_MAX samples.
+*        
+* @param Pointer to the data structure containing measured currents.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureMotorsOffset(&motors); </CODE>
+*
+*/
+void MCAPP_MeasureMotorsOffset(MCAPP_MEASURE_MOTORS_T *pMotors)
+{
+    int32_t sumIa[MEASURE_MOTOR_COUNT], sumIb[MEASURE_MOTOR_COUNT], 
+            sumIbus[MEASURE_MOTOR_COUNT];
+    uint16_t motor;
+    
+    for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+    {
+        sumIa[motor] = pMotors->Ia[motor];
+        sumIb[motor] = pMotors->Ib[motor];
+        sumIbus[motor] = pMotors->Ibus[motor];
+    }
+    MCAPP_MeasureMotorsOffsetSum(pMotors, sumIa, sumIb, sumIbus, 1);
+}
+
+/**
+* <B> Function: MCAPP_MeasureMotorsOffsetSum(MCAPP_MEASURE_MOTORS_T *,
+*       const int32_t *, const int32_t *, const int32_t *, uint16_t)  </B>
+*
+* @brief Function to add sums of current samples of every motor to the offset
+*        measurement, as MCAPP_MeasureCurrentOffsetSum() does for one motor.
+*        
+* @param Pointer to the data structure containing measured currents.
+* @param Sums of the Ia samples, one per motor.
+* @param Sums of the Ib samples, one per motor.
+* @param Sums of the Ibus samples, one per motor.
+* @param Samples in each sum, a power of two up to OFFSET_COUNT_MAX.
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureMotorsOffsetSum(&motors, sumIa, sumIb, sumIbus, 
+*                                     256); </CODE>
+*
+*/
+void MCAPP_MeasureMotorsOffsetSum(MCAPP_MEASURE_MOTORS_T *pMotors,
+                    const int32_t *pSumIa, const int32_t *pSumIb, 
+                    const int32_t *pSumIbus, uint16_t samples)
+{
+    uint16_t motor;
+    
+    for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+    {
+        pMotors->sumIa[motor] += pSumIa[motor];
+        pMotors->sumIb[motor] += pSumIb[motor];
+        pMotors->sumIbus[motor] += pSumIbus[motor];
+    }
+    pMotors->counter += (int16_t)samples;
+
+    if (pMotors->counter >= OFFSET_COUNT_MAX)
+    {
+        for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+        {
+            pMotors->offsetIa[motor] = 
+                MEASURE_OFFSET_AVERAGE(pMotors->sumIa[motor]);
+            pMotors->offsetIb[motor] = 
+                MEASURE_OFFSET_AVERAGE(pMotors->sumIb[motor]);
+            pMotors->offsetIbus[motor] = 
+                MEASURE_OFFSET_AVERAGE(pMotors->sumIbus[motor]);
+            pMotors->sumIa[motor] = 0;
+            pMotors->sumIb[motor] = 0;
+            pMotors->sumIbus[motor] = 0;
+        }
+        pMotors->counter = 0;
+        pMotors->status = 1;
+    }
+}
+
+/**
+* <B> Function: MCAPP_MeasureMotorsCalibrate(MCAPP_MEASURE_MOTORS_T *,
+*                                            SINGLE_SHUNT_PARM_T *)  </B>
+*
+* @brief Function to compensate offset from the measured current samples of 
+* all motors and convert them to actual values, as 
+* MCAPP_MeasureCurrentCalibrate() does for one motor.
+*        
+* @param Pointer to the data structure containing measured currents.
+* @param Array of MEASURE_MOTOR_COUNT single shunt parameters, one per motor
+*        (used with SINGLE_SHUNT only).
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureMotorsCalibrate(&motors, singleShunt); </CODE>
+*
+*/
+void MCAPP_MeasureMotorsCalibrate(MCAPP_MEASURE_MOTORS_T *pMotors, 
+                                  SINGLE_SHUNT_PARM_T *pSingleShunt)
+{
+    uint16_t motor;
+    
+    for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+    {
+        /* offset correction*/
+        pMotors->Ia[motor] = MEASURE_OFFSET_CORRECT(pMotors->Ia[motor], 
+                                                    pMotors->offsetIa[motor]);
+        pMotors->Ib[motor] = MEASURE_OFFSET_CORRECT(pMotors->Ib[motor], 
+                                                    pMotors->offsetIb[motor]);
+        pMotors->Ibus[motor] = MEASURE_OFFSET_CORRECT(pMotors->Ibus[motor], 
+                                                    pMotors->offsetIbus[motor]);
+
+        /*Convert ADC Counts to real value*/
+        pMotors->Ia_actual[motor] = MEASURE_CURRENT(pMotors->Ia[motor]);
+        pMotors->Ib_actual[motor] = MEASURE_CURRENT(pMotors->Ib[motor]);
+        /* Ia + Ib + Ic  = 0; in a balanced 3-phase system*/
+        pMotors->Ic_actual[motor] = MEASURE_CURRENT_NEGATE_SUM(
+                        pMotors->Ia_actual[motor], pMotors->Ib_actual[motor]);
+    }
+    
+#ifdef SINGLE_SHUNT
+    for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+    {
+        /* offset correction*/
+        pMotors->Ibus1[motor] = MEASURE_OFFSET_CORRECT(pMotors->Ibus1[motor],
+                                                    pMotors->offsetIbus[motor]);
+        pMotors->Ibus2[motor] = MEASURE_OFFSET_CORRECT(pMotors->Ibus2[motor],
+                                                    pMotors->offsetIbus[motor]);
+        /*Convert ADC Counts to real value*/
+        pSingleShunt[motor].Ibus1 = MEASURE_CURRENT(pMotors->Ibus1[motor]);
+        pSingleShunt[motor].Ibus2 = MEASURE_CURRENT(pMotors->Ibus2[motor]);
+        /* Reconstruct Phase currents from Bus Current*/ 
+        SingleShunt_PhaseCurrentReconstruction(&pSingleShunt[motor]);
+        pMotors->Ia_actual[motor] = pSingleShunt[motor].Ia;
+        pMotors->Ib_actual[motor] = pSingleShunt[motor].Ib;
+        pMotors->Ic_actual[motor] = pSingleShunt[motor].Ic;
+    }
+#endif 
+}
+
+/**
+* <B> Function: MCAPP_MeasureMotorsOffsetStatus(MCAPP_MEASURE_MOTORS_T *)  </B>
+*
+* @brief Function to read the offset measurement status of all motors.
+*        
+* @param Pointer to the data structure containing measured currents.
+* @return status bit after computing the offsets.
+* 
+* @example
+* <CODE> MCAPP_MeasureMotorsOffsetStatus(&motors); </CODE>
+*
+*/
+int16_t MCAPP_MeasureMotorsOffsetStatus(MCAPP_MEASURE_MOTORS_T *pMotors)
+{
+    return pMotors->status;
+}
+
 /**
 * <B> Function: MCAPP_MeasureAvgInit(MCAPP_MEASURE_AVG_T *, uint16_t )          </B>
 *
-* @brief Function to initialize the moving average filter
+* @brief Function to initialize the moving average filter as block average
 *
 * @param Pointer to the data structure containing filter data. 
 * @param moving average filter scaler 
@@ -194,20 +708,62 @@ int16_t MCAPP_MeasureCurrentOffsetStatus (MCAPP_MEASURE_T *pMotorInputs)
 */
 void MCAPP_MeasureAvgInit(MCAPP_MEASURE_AVG_T *pFilterData,uint16_t scaler)
 {
+    MCAPP_MeasureAvgInitMode(pFilterData, scaler, MEASURE_AVG_BLOCK, NULL);
+}
+
+/**
+* <B> Function: MCAPP_MeasureAvgInitMode(MCAPP_MEASURE_AVG_T *, uint16_t, 
+*                                       uint16_t, int16_t *)          </B>
+*
+* @brief Function to initialize the moving average filter. MEASURE_AVG_BLOCK 
+* updates the output once per block of 2^scaler samples. MEASURE_AVG_SLIDING 
+* updates it every sample with the average of the last 2^scaler samples, kept 
+* in pBuffer. MEASURE_AVG_RECURSIVE updates it every sample with an 
+* exponential average of time constant 2^scaler samples and needs no buffer.
+*
+* @param Pointer to the data structure containing filter data. 
+* @param moving average filter scaler 
+* @param filter mode, MCAPP_MEASURE_AVG_MODE_T
+* @param buffer of 2^scaler samples for MEASURE_AVG_SLIDING, NULL otherwise
+* @return none.
+* 
+* @example
+* <CODE> MCAPP_MeasureAvgInitMode(&filterData, 4, MEASURE_AVG_SLIDING, 
+*                                 buffer); </CODE>
+*
+*/
+void MCAPP_MeasureAvgInitMode(MCAPP_MEASURE_AVG_T *pFilterData, 
+                    uint16_t scaler, uint16_t mode, int16_t *pBuffer)
+{
+    uint16_t index;
+    
     pFilterData->scaler = scaler;
     pFilterData->maxIndex = (uint16_t)((1 << scaler));
     pFilterData->index = 0;
     pFilterData->sum = 0;
+    pFilterData->avg = 0;
     pFilterData->status = 0;
+    pFilterData->mode = mode;
+    pFilterData->pBuffer = pBuffer;
+    
+    if (mode == MEASURE_AVG_SLIDING)
+    {
+        for (index = 0; index < pFilterData->maxIndex; index++)
+        {
+            pBuffer[index] = 0;
+        }
+    }
 }
 
 /**
 * <B> Function: int16_t MCAPP_MeasureAvg(MCAPP_MEASURE_AVG_T *)         </B>
 *
-* @brief Function implementing moving average filter 
+* @brief Function implementing moving average filter, with the mode selected 
+* by MCAPP_MeasureAvgInitMode(). status is set once 2^scaler samples were 
+* filtered.
 *
 * @param Pointer to the data structure containing filter data.
-* @return none.
+* @return filter output.
 * 
 * @example
 * <CODE> MC_MovingAvgFilter(&filterData);                          </CODE>
@@ -215,18 +771,50 @@ void MCAPP_MeasureAvgInit(MCAPP_MEASURE_AVG_T *pFilterData,uint16_t scaler)
 */
 int16_t MCAPP_MeasureAvg(MCAPP_MEASURE_AVG_T *pFilterData)
 {    
-    pFilterData->sum += pFilterData->input;
-
-    if (pFilterData->index < pFilterData->maxIndex)
+    switch (pFilterData->mode)
     {
-        pFilterData->index++;
-    }
-    else
-    {
-        pFilterData->avg = pFilterData->sum >> pFilterData->scaler; 
-        pFilterData->sum = 0;
-        pFilterData->index = 0;
-        pFilterData->status = 1;
+        case MEASURE_AVG_SLIDING:
+            /* Running sum of the ring buffer: add the new sample and drop 
+               the one 2^scaler samples old */
+            pFilterData->sum += (int32_t)pFilterData->input - 
+                                pFilterData->pBuffer[pFilterData->index];
+            pFilterData->pBuffer[pFilterData->index] = pFilterData->input;
+            pFilterData->avg = (int16_t)(pFilterData->sum >> pFilterData->scaler);
+            pFilterData->index++;
+            if (pFilterData->index >= pFilterData->maxIndex)
+            {
+                pFilterData->index = 0;
+                pFilterData->status = 1;
+            }
+            break;
+            
+        case MEASURE_AVG_RECURSIVE:
+            /* sum holds 2^scaler times the average */
+            pFilterData->sum += (int32_t)pFilterData->input - 
+                                pFilterData->avg;
+            pFilterData->avg = (int16_t)(pFilterData->sum >> pFilterData->scaler);
+            if (pFilterData->index < pFilterData->maxIndex)
+            {
+                pFilterData->index++;
+            }
+            else
+            {
+                pFilterData->status = 1;
+            }
+            break;
+            
+        default:
+            pFilterData->sum += pFilterData->input;
+            pFilterData->index++;
+
+            if (pFilterData->index >= pFilterData->maxIndex)
+            {
+                pFilterData->avg = pFilterData->sum >> pFilterData->scaler; 
+                pFilterData->sum = 0;
+                pFilterData->index = 0;
+                pFilterData->status = 1;
+            }
+            break;
     }
     return pFilterData->avg;
 }
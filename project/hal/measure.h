@@ -56,8 +56,9 @@ extern "C" {
 
 #include <stdint.h>
     
-//#include "singleshunt.h"    
-//#include "mc1_user_params.h"
+#ifdef SINGLE_SHUNT
+#include "singleshunt.h"    
+#endif
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
@@ -65,13 +66,98 @@ extern "C" {
 #define OFFSET_COUNT_BITS   (int16_t)10
 #define OFFSET_COUNT_MAX    (int16_t)(1 << OFFSET_COUNT_BITS)
 
+/* Offset tracking defaults: time constant of 2^MEASURE_TRACK_SHIFT tracked
+   samples, offset change limited to MEASURE_TRACK_SLEW_MAX counts (one 12 bit
+   ADC LSB in Q15) per tracked sample */
+#define MEASURE_TRACK_SHIFT     (uint16_t)12
+#define MEASURE_TRACK_SHIFT_MAX (uint16_t)15
+#define MEASURE_TRACK_SLEW_MAX  (int16_t)16
+
+/* Currents at zero in the sampling window, see MCAPP_MeasureCurrentTrack() */
+#define MEASURE_TRACK_PHASE     0x0001  /* Ia and Ib, PWM outputs off */
+#define MEASURE_TRACK_BUS       0x0002  /* Ibus, PWM off or zero vector */
+
+/* Motors measured together by the MCAPP_MeasureMotors functions */
+#ifndef MEASURE_MOTOR_COUNT
+#define MEASURE_MOTOR_COUNT 3
+#endif
+
+/* Peak current of the current sense amplifiers in Amperes, represented by
+   the Q15 full scale of the ADC results (MC1_ADCBUF_IA, ADCBUF_IBUS1 ..) */
+#ifndef MC1_PEAK_CURRENT
+#define MC1_PEAK_CURRENT    22.0f
+#endif
+#ifndef ADC_CURRENT_SCALE
+#define ADC_CURRENT_SCALE   (MC1_PEAK_CURRENT/32768.0f)
+#endif
+
+/* Peak voltage in Volts represented by the Q15 full scale of the VBUS 
+   measurement (MC_ADCBUF_VDC), and of the voltage commands of foc.c */
+#ifndef MC1_PEAK_VOLTAGE
+#define MC1_PEAK_VOLTAGE    80.0f
+#endif
+
+/* Phase voltages in ADC counts to Q15 of MC1_PEAK_VOLTAGE, the dividers of
+   the phase voltages have the scale of the VBUS divider */
+#define MEASURE_PHASEVOLT_Q15(count)    (int16_t)((count) << 3)
+
+/* Default ratio of the phase voltage sampling time to the ADC interrupt, 
+   one sample every MEASURE_PHASEVOLT_FACTOR PWM cycles */
+#ifndef MEASURE_PHASEVOLT_FACTOR
+#define MEASURE_PHASEVOLT_FACTOR    4
+#endif
+
+/* Build with MEASURE_FIXED_POINT defined to keep the calibrated currents in
+   Q15 of MC1_PEAK_CURRENT with saturating arithmetic, otherwise they are 
+   converted to Amperes in float */
+#ifdef MEASURE_FIXED_POINT
+#define MCAPP_CURRENT_TO_AMPERE(current)    ((float)(current)*ADC_CURRENT_SCALE)
+#else
+#define MCAPP_CURRENT_TO_AMPERE(current)    (current)
+#endif
+
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc="VARIABLE TYPE DEFINITIONS ">
 
+#ifdef MEASURE_FIXED_POINT
+typedef int16_t MCAPP_CURRENT_T;    /* Q15 of MC1_PEAK_CURRENT */
+#else
+typedef float MCAPP_CURRENT_T;      /* Amperes */
+#endif
+
+#ifndef SINGLE_SHUNT
+/* Single shunt reconstruction is not built, the parameter is unused */
+typedef void SINGLE_SHUNT_PARM_T;
+#endif
+
 typedef struct
 {
-    float
+    int32_t
+        filterIa,       /* Tracked Ia offset scaled by 2^shift */
+        filterIb,       /* Tracked Ib offset scaled by 2^shift */
+        filterIbus;     /* Tracked Ibus offset scaled by 2^shift */
+    
+    int16_t
+        initialIa,      /* Ia offset when tracking started */
+        initialIb,      /* Ib offset when tracking started */
+        initialIbus,    /* Ibus offset when tracking started */
+        slewMax,        /* Largest offset change per tracked sample */
+        drift,          /* Largest drift of the last tracked sample */
+        driftMax;       /* Largest drift since tracking started */
+    
+    uint16_t
+        shift,          /* Time constant of 2^shift tracked samples */
+        enable;         /* Tracking enabled */
+    
+    uint32_t
+        updates;        /* Tracked samples */
+
+} MCAPP_MEASURE_OFFSET_TRACK_T;
+
+typedef struct
+{
+    MCAPP_CURRENT_T
         Ia_actual,
         Ib_actual,
         Ic_actual;
@@ -93,8 +179,53 @@ typedef struct
         sumIb,          /* Accumulation of Ib */
         sumIbus;        /* Accumulation of Ibus */
 
+    MCAPP_MEASURE_OFFSET_TRACK_T
+        offsetTrack;    /* Offset drift tracking after the calibration */
+
 } MCAPP_MEASURE_CURRENT_T;
 
+/* Current measurement of MEASURE_MOTOR_COUNT motors, one array per quantity
+   indexed by motor so that the motors are processed in one pass. The offset
+   measurement of all motors runs together and shares counter and status */
+typedef struct
+{
+    int16_t
+        Ia[MEASURE_MOTOR_COUNT],          /* A phase Current Feedback */
+        Ib[MEASURE_MOTOR_COUNT],          /* B phase Current Feedback */
+        Ibus[MEASURE_MOTOR_COUNT],        /* Bus current Feedback */
+        offsetIa[MEASURE_MOTOR_COUNT],    /* A phase current offset */
+        offsetIb[MEASURE_MOTOR_COUNT],    /* B phase current offset */
+        offsetIbus[MEASURE_MOTOR_COUNT];  /* BUS current offset */
+#ifdef SINGLE_SHUNT
+    int16_t
+        Ibus1[MEASURE_MOTOR_COUNT],       /* Bus Current during active vector 1 */
+        Ibus2[MEASURE_MOTOR_COUNT];       /* Bus Current during active vector 2 */
+#endif
+
+    MCAPP_CURRENT_T
+        Ia_actual[MEASURE_MOTOR_COUNT],
+        Ib_actual[MEASURE_MOTOR_COUNT],
+        Ic_actual[MEASURE_MOTOR_COUNT];
+
+    int32_t
+        sumIa[MEASURE_MOTOR_COUNT],       /* Accumulation of Ia */
+        sumIb[MEASURE_MOTOR_COUNT],       /* Accumulation of Ib */
+        sumIbus[MEASURE_MOTOR_COUNT];     /* Accumulation of Ibus */
+
+    int16_t
+        counter,        /* counter */
+        status;         /* flag to indicate offset measurement completion */
+
+} MCAPP_MEASURE_MOTORS_T;
+
+typedef enum
+{
+    MEASURE_AVG_BLOCK = 0,      /* Average of each block of 2^scaler samples */
+    MEASURE_AVG_SLIDING = 1,    /* Average of the last 2^scaler samples */
+    MEASURE_AVG_RECURSIVE = 2   /* Exponential average, time constant 2^scaler */
+            
+}MCAPP_MEASURE_AVG_MODE_T;
+
 typedef struct
 {
     int16_t input;
@@ -104,6 +235,8 @@ typedef struct
     int16_t avg;
     int32_t sum;
     uint16_t status;
+    uint16_t mode;          /* MCAPP_MEASURE_AVG_MODE_T */
+    int16_t *pBuffer;       /* Last 2^scaler samples, MEASURE_AVG_SLIDING */
     
 }MCAPP_MEASURE_AVG_T;
 
@@ -123,7 +256,12 @@ typedef struct
         Vb,                 /* B phase terminal voltage w.r.t. DC_Neg */
         Vc,                 /* C phase terminal voltage w.r.t. DC_Neg */
         status,             /* Status if phase voltages are available */
-        samplingFactor;     /* Ratio of sampling time to ADC interrupt */
+        samplingFactor,     /* Ratio of sampling time to ADC interrupt */
+        counter;            /* ADC interrupts since the last sample */
+    
+    uint16_t
+        updates;            /* Samples stored, detects a new sample */
+    
 }MCAPP_MEASURE_PHASEVOLT_T;
 
 typedef struct
@@ -148,11 +286,29 @@ typedef struct
 // <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
 
 void MCAPP_MeasureCurrentOffset (MCAPP_MEASURE_T *);
+void MCAPP_MeasureCurrentOffsetSum (MCAPP_MEASURE_T *, int32_t, int32_t, 
+                                    int32_t, uint16_t);
 void MCAPP_MeasureCurrentCalibrate (MCAPP_MEASURE_T *, SINGLE_SHUNT_PARM_T *);
 void MCAPP_MeasureCurrentInit (MCAPP_MEASURE_T *);
 int16_t MCAPP_MeasureCurrentOffsetStatus (MCAPP_MEASURE_T *);
+void MCAPP_MeasureCurrentTrackInit (MCAPP_MEASURE_T *, uint16_t, int16_t);
+void MCAPP_MeasureCurrentTrack (MCAPP_MEASURE_T *, uint16_t);
+int16_t MCAPP_MeasureCurrentDrift (MCAPP_MEASURE_T *);
+
+void MCAPP_MeasurePhaseVoltInit (MCAPP_MEASURE_T *, int16_t);
+int16_t MCAPP_MeasurePhaseVolt (MCAPP_MEASURE_T *, int16_t, int16_t, int16_t);
+
+void MCAPP_MeasureMotorsInit (MCAPP_MEASURE_MOTORS_T *);
+void MCAPP_MeasureMotorsOffset (MCAPP_MEASURE_MOTORS_T *);
+void MCAPP_MeasureMotorsOffsetSum (MCAPP_MEASURE_MOTORS_T *, const int32_t *,
+                        const int32_t *, const int32_t *, uint16_t);
+void MCAPP_MeasureMotorsCalibrate (MCAPP_MEASURE_MOTORS_T *, 
+                                   SINGLE_SHUNT_PARM_T *);
+int16_t MCAPP_MeasureMotorsOffsetStatus (MCAPP_MEASURE_MOTORS_T *);
 
 void MCAPP_MeasureAvgInit(MCAPP_MEASURE_AVG_T *,uint16_t );
+void MCAPP_MeasureAvgInitMode(MCAPP_MEASURE_AVG_T *, uint16_t, uint16_t, 
+                              int16_t *);
 int16_t MCAPP_MeasureAvg(MCAPP_MEASURE_AVG_T *);
 // </editor-fold>
 
@@ -0,0 +1,303 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file observer.c
+ *
+ * @brief This module estimates the electrical angle and the speed of a 
+ * motor without position sensor, from the measured phase currents and the
+ * voltage commands, once per control cycle.
+ *
+ * A sliding mode observer runs a model of the stator current in the alpha
+ * beta frame, L di/dt = v - R i - e. The back EMF e of the model is the 
+ * switching function z = kSlide * sign(estimated - measured current), 
+ * linear within the boundary layer, which drives the estimated currents to
+ * the measured ones; its average is the back EMF of the motor. Two low 
+ * pass filters extract it, with the electrical frequency as corner down to
+ * OBSERVER_FILTER_MIN_HZ. The speed is the filtered change of the angle of
+ * the back EMF (TRIG_Atan2Q15()). The back EMF leads the rotor flux by 90 
+ * degrees in the direction of rotation and the filters are behind by their
+ * phase lag, 45 degrees each at the corner : the estimated angle corrects 
+ * both.
+ *
+ * The voltage commands take effect at the next start of cycle of the PWM
+ * and are applied until the following one, which contains the next 
+ * sample: the model predicts the next currents with the command of the 
+ * previous control cycle. The estimate is valid above a few percent of the
+ * rated speed; below, the back EMF is hidden by the errors of the model.
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: OBSERVER
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "observer.h"
+#include "measure.h"
+#include "trig.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* pi in Q13 : radians per cycle in Q15 of the speed, 2*pi/65536 per 
+   angle count */
+#define OBSERVER_PI_Q13         25736
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: OBSERVER_SaturateQ15(int32_t) </B>
+*
+* @brief Function limits a value to the Q15 range.
+*
+* @param value value.
+* @return -32768 to 32767.
+*
+*/
+static inline int16_t OBSERVER_SaturateQ15(int32_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return (int16_t)value;
+}
+
+/**
+* <B> Function: OBSERVER_Axis(const MCAPP_OBSERVER_T *, int16_t, int16_t,
+*                             int16_t *, int16_t *, int32_t *, int32_t *)
+* </B>
+*
+* @brief Function runs one axis of the observer : the switching function of
+* the current error, the current model over the next cycle and the back EMF
+* filters.
+*
+* @param pObserver observer.
+* @param current measured current, Q15.
+* @param voltage voltage applied until the next sample, Q15.
+* @param pEstimate estimated current, Q15.
+* @param pZ switching function, Q15.
+* @param pFilter first back EMF filter.
+* @param pAngleFilter second back EMF filter.
+* @return none.
+*
+*/
+static void OBSERVER_Axis(const MCAPP_OBSERVER_T *pObserver, int16_t current,
+                          int16_t voltage, int16_t *pEstimate, int16_t *pZ,
+                          int32_t *pFilter, int32_t *pAngleFilter)
+{
+    int32_t error = (int32_t)*pEstimate - current;
+    int32_t boundary = 1L << pObserver->boundaryShift;
+    int32_t z;
+
+    if (error >= boundary)
+    {
+        z = pObserver->kSlide;
+    }
+    else if (error <= -boundary)
+    {
+        z = -pObserver->kSlide;
+    }
+    else
+    {
+        z = (pObserver->kSlide * error) >> pObserver->boundaryShift;
+    }
+    *pZ = (int16_t)z;
+
+    *pEstimate = OBSERVER_SaturateQ15(
+        (((int32_t)pObserver->f * *pEstimate) >> 15) +
+        (((int32_t)pObserver->g * (voltage - z)) >> (15 - pObserver->gShift)));
+
+    *pFilter += (int32_t)pObserver->kFilter * (z - (*pFilter >> 15));
+    *pAngleFilter += (int32_t)pObserver->kFilter * 
+                        ((*pFilter >> 15) - (*pAngleFilter >> 15));
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: MCAPP_ObserverInit(MCAPP_OBSERVER_T *, float, float, 
+*                                  uint32_t) </B>
+*
+* @brief Function calculates the current model of the observer from the
+* motor parameters and the control frequency, with the default gains and
+* filters, and resets the estimates. The linear zone of the switching function is the 
+* smallest one in which one cycle of the model does not overshoot.
+*
+* @param pObserver observer.
+* @param rs stator resistance in Ohm.
+* @param ls stator inductance in Henry.
+* @param frequencyHz control frequency, normally the PWM frequency.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ObserverInit(&observer, OBSERVER_RS_OHM, OBSERVER_LS_HENRY,
+*                           pwmTiming.frequencyHz); </CODE>
+*
+*/
+void MCAPP_ObserverInit(MCAPP_OBSERVER_T *pObserver, float rs, float ls,
+                        uint32_t frequencyHz)
+{
+    float ts = 1.0f / frequencyHz;
+    float gain = ts / ls * (MC1_PEAK_VOLTAGE / MC1_PEAK_CURRENT);
+    float decay = 1.0f - rs * ts / ls;
+    int32_t step;
+
+    pObserver->f = (int16_t)((decay > 0.0f) ? (decay * 32767.0f) : 0.0f);
+    pObserver->gShift = 0;
+    while ((gain >= 1.0f) && (pObserver->gShift < 15))
+    {
+        gain *= 0.5f;
+        pObserver->gShift++;
+    }
+    pObserver->g = (int16_t)(gain * 32767.0f);
+
+    pObserver->kSlide = OBSERVER_KSLIDE;
+    pObserver->kFilterMin = (int16_t)(2.0f * TRIG_PI * 
+                            OBSERVER_FILTER_MIN_HZ * ts * 32768.0f);
+    pObserver->kSpeed = OBSERVER_SPEED_GAIN;
+
+    /* Current step of the model for the full switching function */
+    step = ((int32_t)pObserver->g * pObserver->kSlide) >> 
+                (15 - pObserver->gShift);
+    pObserver->boundaryShift = 0;
+    while (((1L << pObserver->boundaryShift) < step) && 
+           (pObserver->boundaryShift < 15))
+    {
+        pObserver->boundaryShift++;
+    }
+
+    MCAPP_ObserverReset(pObserver);
+}
+
+/**
+* <B> Function: MCAPP_ObserverReset(MCAPP_OBSERVER_T *) </B>
+*
+* @brief Function clears the estimates of the observer, at the start of the
+* motor.
+*
+* @param pObserver observer.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ObserverReset(&observer); </CODE>
+*
+*/
+void MCAPP_ObserverReset(MCAPP_OBSERVER_T *pObserver)
+{
+    pObserver->ealphaFilter = 0;
+    pObserver->ebetaFilter = 0;
+    pObserver->ealphaAngleFilter = 0;
+    pObserver->ebetaAngleFilter = 0;
+    pObserver->speedFilter = 0;
+    pObserver->kFilter = pObserver->kFilterMin;
+    pObserver->wFilter = 0;
+    pObserver->ialpha = 0;
+    pObserver->ibeta = 0;
+    pObserver->zalpha = 0;
+    pObserver->zbeta = 0;
+    pObserver->ealpha = 0;
+    pObserver->ebeta = 0;
+    pObserver->speed = 0;
+    pObserver->emfAngle = 0;
+    pObserver->angle = 0;
+}
+
+/**
+* <B> Function: MCAPP_ObserverUpdate(MCAPP_OBSERVER_T *, int16_t, int16_t,
+*                                    int16_t, int16_t) </B>
+*
+* @brief Function runs one cycle of the observer : estimates angle and
+* speed from the current samples and predicts the currents of the next 
+* sample. Call it once per control cycle, before the voltage commands of
+* the cycle are calculated.
+*
+* @param pObserver observer.
+* @param ialpha measured alpha current, Q15 of MC1_PEAK_CURRENT.
+* @param ibeta measured beta current.
+* @param valpha alpha voltage command of the previous cycle, Q15 of
+*        MC1_PEAK_VOLTAGE.
+* @param vbeta beta voltage command of the previous cycle.
+* @return none.
+*
+* @example
+* <CODE> MCAPP_ObserverUpdate(&observer, ialpha, ibeta, valpha, vbeta);
+* </CODE>
+*
+*/
+void MCAPP_ObserverUpdate(MCAPP_OBSERVER_T *pObserver, int16_t ialpha, 
+                          int16_t ibeta, int16_t valpha, int16_t vbeta)
+{
+    int32_t speed;
+    uint16_t angle, lag;
+
+    OBSERVER_Axis(pObserver, ialpha, valpha, &pObserver->ialpha, 
+                  &pObserver->zalpha, &pObserver->ealphaFilter,
+                  &pObserver->ealphaAngleFilter);
+    OBSERVER_Axis(pObserver, ibeta, vbeta, &pObserver->ibeta, 
+                  &pObserver->zbeta, &pObserver->ebetaFilter,
+                  &pObserver->ebetaAngleFilter);
+    pObserver->ealpha = (int16_t)(pObserver->ealphaAngleFilter >> 15);
+    pObserver->ebeta = (int16_t)(pObserver->ebetaAngleFilter >> 15);
+
+    /* Speed from the angle of the back EMF */
+    angle = TRIG_Atan2Q15(pObserver->ebeta, pObserver->ealpha);
+    speed = (int16_t)(angle - pObserver->emfAngle);
+    pObserver->emfAngle = angle;
+    pObserver->speedFilter += (int32_t)pObserver->kSpeed * 
+                                (speed - (pObserver->speedFilter >> 15));
+    pObserver->speed = (int16_t)(pObserver->speedFilter >> 15);
+
+    /* The back EMF leads the rotor flux by 90 degrees in the direction of
+       rotation and the filters are behind by their phase lag */
+    lag = 2 * TRIG_Atan2Q15(pObserver->wFilter, pObserver->kFilter) - 
+                TRIG_ANGLE_QUARTER;
+    pObserver->angle = angle + ((pObserver->speed < 0) ? -lag : lag);
+
+    /* Electrical frequency per cycle, the corner of the filters above the
+       minimum */
+    speed = (pObserver->speed < 0) ? -pObserver->speed : pObserver->speed;
+    speed = (speed * OBSERVER_PI_Q13) >> 13;
+    pObserver->wFilter = (int16_t)((speed > INT16_MAX) ? INT16_MAX : speed);
+    pObserver->kFilter = (pObserver->wFilter > pObserver->kFilterMin) ?
+                            pObserver->wFilter : pObserver->kFilterMin;
+}
+
+// </editor-fold>
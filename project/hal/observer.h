@@ -0,0 +1,123 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file observer.h
+ *
+ * @brief This header file lists the functions and definitions of the 
+ * sensorless rotor position observer of a motor.
+ *
+ * Component: OBSERVER
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __OBSERVER_H
+#define __OBSERVER_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Stator resistance and inductance of the motor, phase to star point */
+#define OBSERVER_RS_OHM         0.5f
+#define OBSERVER_LS_HENRY       0.0005f
+
+/* Gain of the switching function, Q15 of MC1_PEAK_VOLTAGE : above the 
+   largest back EMF */
+#define OBSERVER_KSLIDE         8192
+
+/* Lowest corner frequency of the back EMF filters, which follow the 
+   electrical frequency above it. Their phase lag is compensated */
+#define OBSERVER_FILTER_MIN_HZ  100.0f
+
+/* Gain of the speed filter, Q15 per control cycle */
+#define OBSERVER_SPEED_GAIN     1024
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int32_t
+        ealphaFilter,       /* Back EMF filters, Q15 * 2^15 */
+        ebetaFilter,
+        ealphaAngleFilter,
+        ebetaAngleFilter,
+        speedFilter;        /* Speed, angle per cycle * 2^15 */
+
+    int16_t
+        f,                  /* Current model 1 - Rs*Ts/Ls, Q15 */
+        g,                  /* Current model Ts/Ls, Q15 of the currents per
+                               Q15 of the voltages * 2^-gShift */
+        kSlide,             /* Gain of the switching function, Q15 */
+        kFilterMin,         /* Back EMF filter gain below OBSERVER_FILTER_MIN_HZ,
+                               Q15 */
+        kSpeed,             /* Speed filter gain, Q15 */
+        kFilter,            /* Back EMF filter gain, Q15 */
+        wFilter,            /* Estimated speed in radians per cycle, Q15 */
+        ialpha,             /* Estimated currents, Q15 */
+        ibeta,
+        zalpha,             /* Switching function, Q15 */
+        zbeta,
+        ealpha,             /* Back EMF after both filters, Q15 */
+        ebeta,
+        speed;              /* Estimated speed, angle per control cycle */
+
+    uint16_t
+        gShift,
+        boundaryShift,      /* Linear zone of the switching function, 
+                               2^boundaryShift Q15 of the current error */
+        emfAngle,           /* Angle of the filtered back EMF */
+        angle;              /* Estimated electrical angle, 65536 per turn */
+
+} MCAPP_OBSERVER_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void MCAPP_ObserverInit(MCAPP_OBSERVER_T *, float, float, uint32_t);
+void MCAPP_ObserverReset(MCAPP_OBSERVER_T *);
+void MCAPP_ObserverUpdate(MCAPP_OBSERVER_T *, int16_t, int16_t, int16_t, 
+                          int16_t);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __OBSERVER_H
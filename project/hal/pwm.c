@@ -42,6 +42,340 @@
 #include <stdint.h>
 
 #include "pwm.h"
+#include "sfr_field.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* PWM Mode Selection bits
+   110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
+   100 = Center-Aligned PWM mode(interrupt/register update once per cycle)
+   The phase generators of the motors use dual edge mode with single shunt, 
+   the rising edge (PGxPHASE) and falling edge (PGxDC) are then shifted 
+   independently to open the bus current sampling windows */
+#define PWM_MODSEL          4
+#ifdef SINGLE_SHUNT
+#define PWM_MOTOR_MODSEL    6
+/* Generator placing the bus current triggers of a motor: ADC Trigger 1 on 
+   PGxTRIGA, ADC Trigger 2 on PGxTRIGB */
+#define PWM_BUS_TRIGGER_EVT2    PWM_FIELD(EVT2, ADTR2EN2, 1)
+#else
+#define PWM_MOTOR_MODSEL    4
+#define PWM_BUS_TRIGGER_EVT2    0
+#endif
+
+/* Value of a register field. All generators share the PG1 register layout,
+   constant values are checked to fit the field at compile time */
+#define PWM_FIELD(reg, field, value)    SFR_FIELD(PG1##reg, field, value)
+#define PWM_FIELD_VAR(reg, field, value)                                       \
+    SFR_FIELD_VAR(PG1##reg, field, value)
+
+/* Generator settings with the register words composed from their fields:
+ - PGxCON : CLKSEL = 1, MODSEL = modsel, TRGCNT = 0, MDCSEL = MPHSEL = 0,
+   UPDMOD = 0, ON = 0 while the generator is configured
+ - PGxIOCON1 : PENH = 1, complementary mode, active-high, no override
+ - PGxEVT1 : ADTR1EN1 = 1, UPDTRG = 1 (write of PGxDC sets UPDATE), 
+   PGTRGSEL = 0 (EOC), FLT1IEN = 1, IEVTSEL = 3 (no time base interrupt) */
+#define PWM_GENERATOR_CONFIG(generator, modsel, socs, trgmod, msten, mpersel, \
+                             penl, pwmpci, pps, period, duty, spci2, evt2)     \
+    {                                                                          \
+        (generator), (period), (duty),                                         \
+        PWM_FIELD(CON, CLKSEL, 1) |                                            \
+        PWM_FIELD(CON, MODSEL, modsel) |                                       \
+        PWM_FIELD(CON, MPERSEL, mpersel) |                                     \
+        PWM_FIELD(CON, MSTEN, msten) |                                         \
+        PWM_FIELD(CON, TRGMOD, trgmod) |                                       \
+        PWM_FIELD(CON, SOCS, socs),                                            \
+        PWM_FIELD(IOCON1, PENH, 1) |                                           \
+        PWM_FIELD(IOCON1, PENL, penl),                                         \
+        PWM_FIELD(EVT1, ADTR1EN1, 1) |                                         \
+        PWM_FIELD(EVT1, UPDTRG, 1) |                                           \
+        PWM_FIELD(EVT1, FLT1IEN, 1) |                                          \
+        PWM_FIELD(EVT1, IEVTSEL, 3) |                                          \
+        PWM_FIELD(EVT1, PWMPCI, pwmpci),                                       \
+        PWM_FIELD(SPCI1, PPS, pps),                                            \
+        (spci2),                                                               \
+        (evt2)                                                                 \
+    }
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+PWM_TIMING_T pwmTiming = 
+{
+    PWMFREQUENCY_HZ,
+    LOOPTIME_TCY,
+    AUX_PWM_LOOPTIME_TCY,
+    DEADTIME,
+    MIN_DUTY,
+    MAX_DUTY,
+    DEADTIME_MICROSEC,
+    {PWM_INTERLEAVE_MC1_DEG, PWM_INTERLEAVE_MC2_DEG, PWM_INTERLEAVE_MC3_DEG}
+};
+
+/* Generator settings in enable order, the master PG5 is enabled last:
+ - PG1-PG3 (motor) : MPER, re-triggered by PCI Sync on the PG5 rising edge,
+   PG3 also restarts on its own EOC
+ - PG6-PG8 : MPER, triggered by the PG5 EOC
+ - APG1-APG3 : own period, re-triggered by PCI Sync on the PG5 falling edge
+ - PG5 : master, free running on its local EOC, broadcasts UPDATE */
+static const PWM_GENERATOR_CONFIG_T pwmGeneratorConfig[PWM_GENERATOR_COUNT] =
+{
+    /* generator,       modsel,           socs, trgmod, msten, mpersel, penl,
+       pwmpci, pps, period,              duty,                   spci2,
+       evt2 */
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG2,  PWM_MOTOR_MODSEL, 0xF, 1, 0, 1, 1,
+        4, 0, PWM_VALUE_ZERO,          PWM_VALUE_MOTOR_DUTY,          8388608,
+        PWM_BUS_TRIGGER_EVT2),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG3,  PWM_MOTOR_MODSEL, 3,   1, 0, 1, 1,
+        4, 0, PWM_VALUE_ZERO,          PWM_VALUE_MOTOR_DUTY,          8388608,
+        0),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG1,  PWM_MOTOR_MODSEL, 0xF, 1, 0, 1, 1,
+        4, 0, PWM_VALUE_ZERO,          PWM_VALUE_MOTOR_DUTY,          8388608,
+        0),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG7,  PWM_MOTOR_MODSEL, 5,   1, 0, 1, 1,
+        0, 0, PWM_VALUE_LOOPTIME,      PWM_VALUE_LOOPTIME_HALF,       0,
+        PWM_BUS_TRIGGER_EVT2),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG8,  PWM_MOTOR_MODSEL, 5,   1, 0, 1, 1,
+        0, 0, PWM_VALUE_LOOPTIME,      PWM_VALUE_LOOPTIME_HALF,       0,
+        0),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG6,  PWM_MOTOR_MODSEL, 5,   1, 0, 1, 1,
+        0, 0, PWM_VALUE_LOOPTIME,      PWM_VALUE_LOOPTIME_HALF,       0,
+        0),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_APG1, PWM_MOTOR_MODSEL, 0xF, 1, 0, 0, 1,
+        3, 1, PWM_VALUE_AUX_LOOPTIME,  PWM_VALUE_AUX_LOOPTIME_HALF,   8388608,
+        0),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_APG2, PWM_MOTOR_MODSEL, 0xF, 1, 0, 0, 1,
+        3, 1, PWM_VALUE_AUX_LOOPTIME,  PWM_VALUE_AUX_LOOPTIME_HALF,   8388608,
+        PWM_BUS_TRIGGER_EVT2),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_APG3, PWM_MOTOR_MODSEL, 0xF, 1, 0, 0, 1,
+        3, 1, PWM_VALUE_AUX_LOOPTIME,  PWM_VALUE_AUX_LOOPTIME_HALF,   8388608,
+        0),
+    PWM_GENERATOR_CONFIG(PWM_GENERATOR_PG5,  PWM_MODSEL,       0,   0, 1, 0, 0,
+        0, 0, PWM_VALUE_LOOPTIME,      PWM_VALUE_LOOPTIME_THIRD,      0,
+        0),
+};
+
+/* Phase A, B and C generators of the motors, the phase B generator places 
+   the bus current triggers of its motor (ADC_TRG_PG(2, t) for MC1) */
+static const uint8_t pwmMotorGenerator[PWM_MOTOR_COUNT][3] =
+{
+    {PWM_GENERATOR_PG1,  PWM_GENERATOR_PG2,  PWM_GENERATOR_PG3},
+    {PWM_GENERATOR_APG1, PWM_GENERATOR_APG2, PWM_GENERATOR_APG3},
+    {PWM_GENERATOR_PG6,  PWM_GENERATOR_PG7,  PWM_GENERATOR_PG8}
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: PWM_GeneratorRegisters(uint16_t) </B>
+*
+* @brief Function returns the first register (PGxCON) of the register block
+* of a generator.
+*        
+* @param generator PWM_GENERATOR_T.
+* @return PGxCON register.
+*/
+static volatile uint32_t *PWM_GeneratorRegisters(uint16_t generator)
+{
+    switch (generator)
+    {
+        case PWM_GENERATOR_PG1:     return &PG1CON;
+        case PWM_GENERATOR_PG2:     return &PG2CON;
+        case PWM_GENERATOR_PG3:     return &PG3CON;
+        case PWM_GENERATOR_PG4:     return &PG4CON;
+        case PWM_GENERATOR_PG5:     return &PG5CON;
+        case PWM_GENERATOR_PG6:     return &PG6CON;
+        case PWM_GENERATOR_PG7:     return &PG7CON;
+        case PWM_GENERATOR_PG8:     return &PG8CON;
+        case PWM_GENERATOR_APG1:    return &APG1CON;
+        case PWM_GENERATOR_APG2:    return &APG2CON;
+        default:                    return &APG3CON;
+    }
+}
+
+/**
+* <B> Function: PWM_TimingValue(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the period or duty cycle value selected by a 
+* PWM_VALUE_T.
+*        
+* @param pTiming PWM timing.
+* @param value PWM_VALUE_T.
+* @return register value.
+*/
+static uint32_t PWM_TimingValue(const PWM_TIMING_T *pTiming, uint16_t value)
+{
+    switch (value)
+    {
+        case PWM_VALUE_LOOPTIME:            return pTiming->loopTimeTcy;
+        case PWM_VALUE_LOOPTIME_HALF:       
+        case PWM_VALUE_MOTOR_DUTY:          return pTiming->loopTimeTcy>>1;
+        case PWM_VALUE_LOOPTIME_THIRD:      return pTiming->loopTimeTcy/3;
+        case PWM_VALUE_AUX_LOOPTIME:        return pTiming->auxLoopTimeTcy;
+        case PWM_VALUE_AUX_LOOPTIME_HALF:   return pTiming->auxLoopTimeTcy>>1;
+        default:                            return 0;
+    }
+}
+
+/**
+* <B> Function: PWM_MotorSyncEdge(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the time of the start of cycle trigger of the 
+* generators of a motor after the start of cycle of the master PG5, as set 
+* up by the generator table:
+*  - MC1 : PCI Sync on the PG5 rising edge, half - PG5DC + dead time
+*  - MC2 : PCI Sync on the PG5 falling edge, half + PG5DC
+*  - MC3 : PG5 EOC
+*        
+* @param pTiming PWM timing.
+* @param motor PWM_MOTOR_T.
+* @return time in ticks of 1/16 PWM clock.
+*/
+static uint32_t PWM_MotorSyncEdge(const PWM_TIMING_T *pTiming, uint16_t motor)
+{
+    uint32_t half = pTiming->loopTimeTcy + PWM_TICKS_PER_CLOCK;
+    uint32_t masterDuty = PWM_TimingValue(pTiming, PWM_VALUE_LOOPTIME_THIRD);
+    
+    switch (motor)
+    {
+        case PWM_MOTOR_MC1: return half - masterDuty + pTiming->deadtime;
+        case PWM_MOTOR_MC2: return half + masterDuty;
+        default:            return 0;
+    }
+}
+
+/**
+* <B> Function: PWM_MotorSocDelay(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the delay of the start of cycle of a motor after
+* its trigger that places the motors at their interleaving offsets. All
+* motors are shifted by the same time, as little as the sync edges allow.
+*        
+* @param pTiming PWM timing.
+* @param motor PWM_MOTOR_T.
+* @return delay in ticks of 1/16 PWM clock, less than the PWM cycle.
+*/
+static uint32_t PWM_MotorSocDelay(const PWM_TIMING_T *pTiming, uint16_t motor)
+{
+    uint32_t period = 2 * (pTiming->loopTimeTcy + PWM_TICKS_PER_CLOCK);
+    uint32_t target[PWM_MOTOR_COUNT], delay;
+    int32_t late, shift = 0;
+    uint16_t i;
+    
+    for (i = 0; i < PWM_MOTOR_COUNT; i++)
+    {
+        target[i] = (uint32_t)(((uint64_t)pTiming->interleaveDeg[i] * period) 
+                               / 360);
+        /* Sync edge after the target, within half a cycle */
+        late = (int32_t)PWM_MotorSyncEdge(pTiming, i) - (int32_t)target[i];
+        if (late > (int32_t)(period >> 1))
+        {
+            late -= (int32_t)period;
+        }
+        else if (late < -(int32_t)(period >> 1))
+        {
+            late += (int32_t)period;
+        }
+        if (late > shift)
+        {
+            shift = late;
+        }
+    }
+    
+    delay = target[motor] + (uint32_t)shift + period - 
+            PWM_MotorSyncEdge(pTiming, motor);
+    while (delay >= period)
+    {
+        delay -= period;
+    }
+    return delay;
+}
+
+/**
+* <B> Function: PWM_GeneratorPhase(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns PGxPHASE of a generator in center aligned mode: 
+* the start of cycle delay of its motor, minDuty for the master.
+*        
+* @param pTiming PWM timing.
+* @param generator PWM_GENERATOR_T.
+* @return register value.
+*/
+static uint32_t PWM_GeneratorPhase(const PWM_TIMING_T *pTiming, 
+                                   uint16_t generator)
+{
+    uint16_t motor, phase;
+    
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        for (phase = 0; phase < 3; phase++)
+        {
+            if (pwmMotorGenerator[motor][phase] == generator)
+            {
+                return PWM_MotorSocDelay(pTiming, motor) / 
+                            PWM_MotorTicksPerCount(motor);
+            }
+        }
+    }
+    return pTiming->minDuty;
+}
+
+/**
+* <B> Function: PWM_GeneratorMaxDuty(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the largest duty cycle of a generator: the period
+* of its motor less the dead time, in the register counts of the generator,
+* maxDuty for the generators of no motor.
+*        
+* @param pTiming PWM timing.
+* @param generator PWM_GENERATOR_T.
+* @return register value.
+*/
+static uint32_t PWM_GeneratorMaxDuty(const PWM_TIMING_T *pTiming, 
+                                     uint16_t generator)
+{
+    uint16_t motor, phase;
+    
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        for (phase = 0; phase < 3; phase++)
+        {
+            if (pwmMotorGenerator[motor][phase] == generator)
+            {
+                return PWM_MotorPeriod(pTiming, motor) - pTiming->deadtime;
+            }
+        }
+    }
+    return pTiming->maxDuty;
+}
+
+/**
+* <B> Function: PWM_UpdateWait(volatile uint32_t *) </B>
+*
+* @brief Function waits until the pending data register update of a 
+* generator completes, at most PWM_UPDATE_TIMEOUT_POLLS polls.
+*        
+* @param pRegs PGxCON register of the generator.
+* @return 1 if no update is pending, 0 on timeout.
+*/
+static uint16_t PWM_UpdateWait(volatile uint32_t *pRegs)
+{
+    uint32_t polls = 0;
+    
+    while (PWM_GENERATOR_REG(pRegs, PWM_REG_STAT) & _PG1STAT_UPDATE_MASK)
+    {
+        if (++polls >= PWM_UPDATE_TIMEOUT_POLLS)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
 
 // </editor-fold>
 
@@ -62,23 +396,44 @@
 */
 void InitPWMGenerators(void)
 {
+    PWM_ConfigureGenerators();
+    PWM_EnableGenerators();
+}
+
+/**
+* <B> Function: PWM_ConfigureGenerators()    </B>
+*
+* @brief Function writes the registers common for all PWM modules and the
+* registers of every generator, the generators are left disabled. It does 
+* not depend on the PWM clock and can run while Clock Generator 5 is still
+* switching.
+*        
+* @param none.
+* @return none.
+* 
+* @example
+* <CODE> PWM_ConfigureGenerators();     </CODE>
+*
+*/
+void PWM_ConfigureGenerators(void)
+{
+    uint16_t i;
 
-    PCLKCON      = 0x0000;
-    /* PWM Clock Divider Selection bits
-       0b11 = 1:16 ; 0b10 = 1:8 ;0b01 = 1:4 ; 0b00 = 1:2*/
-    PCLKCONbits.DIVSEL = 0;
-    /* PWM Master Clock Selection bits
-       0b11 = AFPLLO ; 0b10 = FPLLO ; 0b01 = AFVCO/2 ; 0b00 = FOSC */
-    PCLKCONbits.MCLKSEL = 1;
-    /* Lock bit: 0 = Write-protected registers and bits are unlocked   */
-    PCLKCONbits.LOCK = 0;
+    /* PWM Clock Divider Selection bits DIVSEL
+       0b11 = 1:16 ; 0b10 = 1:8 ;0b01 = 1:4 ; 0b00 = 1:2
+       PWM Master Clock Selection bits MCLKSEL
+       0b11 = AFPLLO ; 0b10 = FPLLO ; 0b01 = AFVCO/2 ; 0b00 = FOSC
+       Lock bit LOCK: 0 = Write-protected registers and bits are unlocked */
+    PCLKCON      = SFR_FIELD(PCLKCON, DIVSEL, 0) |
+                   SFR_FIELD(PCLKCON, MCLKSEL, 1) |
+                   SFR_FIELD(PCLKCON, LOCK, 0);
 
     /* Initialize Master Phase Register */
     MPHASE       = 0x0000;
     /* Initialize Master Duty Cycle */
     MDC          = 0x0000;
     /* Initialize Master Period Register */
-    MPER         = LOOPTIME_TCY;
+    MPER         = pwmTiming.loopTimeTcy;
     
     /* Initialize FREQUENCY SCALE REGISTER*/
     FSCL          = 0x0000;
@@ -100,10 +455,6 @@ void InitPWMGenerators(void)
     LOGCONE     = 0x0000;
     /* Initialize LOGIC CONTROL REGISTER 3 */
     LOGCONF     = 0x0000;
-    /* PWM EVENT OUTPUT CONTROL REGISTER A */
-    PWMEVTA     = 0x0000;     
-    /* PWM EVENT OUTPUT CONTROL REGISTER B */
-    PWMEVTB     = 0x0000;
     /* PWM EVENT OUTPUT CONTROL REGISTER C */
     PWMEVTC     = 0x0000;
     /* PWM EVENT OUTPUT CONTROL REGISTER D */
@@ -115,23 +466,21 @@ void InitPWMGenerators(void)
     
     APWMEVTA = 0x0000;
     
-    /* PWM Event Output Enable bit  
+    /* PWM EVENT OUTPUT CONTROL REGISTERS A and B
+       EVTyOEN: PWM Event Output Enable bit
        1 = Event output signal is output on PWMEy pin
-       0 = Event output signal is internal only */
-    PWMEVTAbits.EVTAOEN  = 0;
-    /* EVTyPOL: PWM Event Output Polarity bit
+       0 = Event output signal is internal only
+       EVTyPOL: PWM Event Output Polarity bit
        1 = Event output signal is active-low
-       0 = Event output signal is active-high */
-    PWMEVTAbits.EVTAPOL  = 0;
-    /* EVTySTRD: PWM Event Output Stretch Disable bit
+       0 = Event output signal is active-high
+       EVTySTRD: PWM Event Output Stretch Disable bit
        1 = Event output signal pulse width is not stretched
-       0 = Event output signal is stretched to eight PWM clock cycles minimum */
-    PWMEVTAbits.EVTASTRD = 1; 
-    /* EVTySYNC: PWM Event Output Sync bit
+       0 = Event output signal is stretched to eight PWM clock cycles minimum
+       EVTySYNC: PWM Event Output Sync bit
        1 = Event output signal is synchronized to the system clock
        0 = Event output is not synchronized to the system clock
        Event output signal pulse will be two system clocks when this bit is set and EVTySTRD = 1 */
-    PWMEVTAbits.EVTASYNC = 1;
+    //    EVTySEL[4:0]: PWM Event Selection bits
     //    0b11111 FEP Calibration Error event signal
     //    0b11110 FEP Calibration Done event signal
     //    0b11101 FEP Lock event signal
@@ -151,2376 +500,587 @@ void InitPWMGenerators(void)
     //    0b00010 PCI Sync active output signal
     //    0b00001 PWM Generator output signal(1)
     //    0b00000 Source is selected by the PGTRGSEL[2:0] bits
-    PWMEVTAbits.EVTASEL  = 0b00001;
     /* EVTyPGS[2:0]: PWM Event Source Selection bits
        111-100 = Reserved
        011 = PWM Generator 4
        ...
        000 = PWM Generator 1 */
-    PWMEVTAbits.EVTAPGS  = 4;
-    
-    
-        /* PWM Event Output Enable bit  
-       1 = Event output signal is output on PWMEy pin
-       0 = Event output signal is internal only */
-    PWMEVTBbits.EVTBOEN  = 1;
-    /* EVTyPOL: PWM Event Output Polarity bit
-       1 = Event output signal is active-low
-       0 = Event output signal is active-high */
-    PWMEVTBbits.EVTBPOL  = 0;
-    /* EVTySTRD: PWM Event Output Stretch Disable bit
-       1 = Event output signal pulse width is not stretched
-       0 = Event output signal is stretched to eight PWM clock cycles minimum */
-    PWMEVTBbits.EVTBSTRD = 1; 
-    /* EVTySYNC: PWM Event Output Sync bit
-       1 = Event output signal is synchronized to the system clock
-       0 = Event output is not synchronized to the system clock
-       Event output signal pulse will be two system clocks when this bit is set and EVTySTRD = 1 */
-    PWMEVTBbits.EVTBSYNC = 1;
-    //    0b11111 FEP Calibration Error event signal
-    //    0b11110 FEP Calibration Done event signal
-    //    0b11101 FEP Lock event signal
-    //    0b11100 FEP Lock Lost event signal
-    //    0b11011 FEP Lock Time Out event signal
-    //    0b11010 FEP Runt Pulse event signal
-    //    0b11001-01100 Reserved
-    //    0b01011 DAC Trigger signal
-    //    0b01010 ADC Trigger 2 signal
-    //    0b01001 ADC Trigger 1 signal
-    //    0b01000 STEER signal (available in push-pull output modes only)
-    //    0b00111 PHASE signal (available in center aligned modes only)
-    //    0b00110 PCI Fault2 active output signal
-    //    0b00101 PCI Fault active output signal
-    //    0b00100 PCI current limit active output signal
-    //    0b00011 PCI feed-forward active output signal
-    //    0b00010 PCI Sync active output signal
-    //    0b00001 PWM Generator output signal(1)
-    //    0b00000 Source is selected by the PGTRGSEL[2:0] bits
-    PWMEVTBbits.EVTBSEL  = 0b00111;
-    /* EVTyPGS[2:0]: PWM Event Source Selection bits
-       111-100 = Reserved
-       011 = PWM Generator 4
-       ...
-       000 = PWM Generator 1 */
-    PWMEVTBbits.EVTBPGS  = 4;
-    /* Function call to Initialize individual PWM modules*/
-    InitPWMGenerator5 ();
-    
-    InitAuxPWMGenerator1 ();
-    InitAuxPWMGenerator2 ();
-    InitAuxPWMGenerator3 ();
-    
-    InitPWMGenerator1 ();
-    InitPWMGenerator2 ();
-    InitPWMGenerator3 (); 
-    
-    InitPWMGenerator6 ();
-    InitPWMGenerator7 ();
-    InitPWMGenerator8 ();
-    
-    /* Enable the PWM module after initializing generators*/
-	PG2CONbits.ON = 1;      
-    PG3CONbits.ON = 1;      
-    PG1CONbits.ON = 1;  
-    
-    PG7CONbits.ON = 1;      
-    PG8CONbits.ON = 1;      
-    PG6CONbits.ON = 1; 
-    
-    APG1CONbits.ON = 1; 
-    APG2CONbits.ON = 1; 
-    APG3CONbits.ON = 1; 
-    
-    PG5CONbits.ON = 1;     
-    
+    PWMEVTA     = SFR_FIELD(PWMEVTA, EVTAOEN, 0) |
+                  SFR_FIELD(PWMEVTA, EVTAPOL, 0) |
+                  SFR_FIELD(PWMEVTA, EVTASTRD, 1) |
+                  SFR_FIELD(PWMEVTA, EVTASYNC, 1) |
+                  SFR_FIELD(PWMEVTA, EVTASEL, 0b00001) |
+                  SFR_FIELD(PWMEVTA, EVTAPGS, 4);
+    PWMEVTB     = SFR_FIELD(PWMEVTB, EVTBOEN, 1) |
+                  SFR_FIELD(PWMEVTB, EVTBPOL, 0) |
+                  SFR_FIELD(PWMEVTB, EVTBSTRD, 1) |
+                  SFR_FIELD(PWMEVTB, EVTBSYNC, 1) |
+                  SFR_FIELD(PWMEVTB, EVTBSEL, 0b00111) |
+                  SFR_FIELD(PWMEVTB, EVTBPGS, 4);
+    
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        InitPWMGenerator(&pwmGeneratorConfig[i]);
+    }
 }
 
 /**
-* <B> Function: InitPWMGenerator5()    </B>
+* <B> Function: PWM_EnableGenerators()    </B>
 *
-* @brief Function to configure PWM Module # 5
+* @brief Function enables the generators configured by 
+* PWM_ConfigureGenerators() in table order. Call it once the PWM clock runs.
 *        
 * @param none.
 * @return none.
 * 
 * @example
-* <CODE> InitPWMGenerator5();     </CODE>
+* <CODE> PWM_EnableGenerators();     </CODE>
 *
 */
-void InitPWMGenerator5 (void)
+void PWM_EnableGenerators(void)
 {
-
-    /* Initialize PWM GENERATOR 5 CONTROL REGISTER */
-    PG5CON      = 0x0000;
-    /* PWM Generator 5 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG5CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG5CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    PG5CONbits.MODSEL = 6;
-#else
-    PG5CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG5CONbits.TRGCNT = 0;
-    
-    /* Initialize PWM GENERATOR 5 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG5DC
-       0 = Macro uses the PG5DC register*/
-    PG5CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG5PER
-       0 = Macro uses the PG5PER register */
-    PG5CONbits.MPERSEL = 0;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG5PHASE
-       0 = Macro uses the PG5PHASE register */
-    PG5CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG5CONbits.MSTEN = 1;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG5CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG5CONbits.TRGMOD = 0;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG5CONbits.SOCS = 0;
-    
-    /* Clear PWM GENERATOR 5 STATUS REGISTER*/
-    PG5STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 5 I/O CONTROL REGISTER */
-    PG5IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG5IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM5H and PWM5L Device Pins bit 
-       0 = PWM1H/L signals are mapped to their respective pins */
-    PG5IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM5H Pin bit
-       0 = PWM Generator provides data for the PWM5H pin*/
-    PG5IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM5L Pin bit
-       0 = PWM Generator provides data for the PWM5L pin*/
-    PG5IOCON2bits.OVRENL = 0;
-    /* Data for PWM1H/PWM1L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM5H.
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM5L */
-    PG5IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG5IOCON2bits.OSYNC = 0;
-    /* Data for PWM5H/PWM5L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM5H.
-       If Fault is active, then FLTDAT<0> provides data for PWM5L.*/
-    PG5IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM5H/PWM5L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM5H.
-       If current limit is active, then CLDAT<0> provides data for PWM5L.*/
-    PG5IOCON2bits.CLDAT = 0;
-    /* Data for PWM5H/PWM5L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM5H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM5L.*/
-    PG5IOCON2bits.FFDAT = 0;
-    /* Data for PWM5H/PWM5L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM5H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM5L data. */
-    PG5IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 5 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG5IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG5IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG5IOCON1bits.PMOD = 0;
-    /* PWM5H Output Port Enable bit
-       1 = PWM Generator controls the PWM5H output pin
-       0 = PWM Generator does not control the PWM5H output pin */
-    PG5IOCON1bits.PENH = 1;
-    /* PWM5L Output Port Enable bit
-       1 = PWM Generator controls the PWM5L output pin
-       0 = PWM Generator does not control the PWM5L output pin */
-    PG5IOCON1bits.PENL = 0;
-    /* PWM5H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG5IOCON1bits.POLH = 0;
-    /* PWM5L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG5IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 5 EVENT REGISTER */
-    PG5EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG5EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG5TRIGC Compare Event Enable bit
-       0 = PG5TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG5EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG5TRIGB Compare Event Enable bit
-       0 = PG5TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG5EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG5TRIGA Compare Event Enable bit
-       1 = PG5TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG5EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG5DC register automatically sets the UPDATE bit*/
-    PG5EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG5EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 5 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG5EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG5EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG5EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG5EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG5EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is PG5TRIGC Compare Event Enable bit
-       0 = PG5TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG5EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG5TRIGB Compare Event Enable bit
-       0 = PG5TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG5EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG5TRIGA Compare Event Enable bit
-       0 = PG5TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG5EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG5EVT1bits.ADTR1OFS = 0;
-
-    /* PWM GENERATOR 5 Current Limit PCI REGISTER */
-    PG5CLPCI1    = 0x0000;
-    /* PWM GENERATOR 5 Feed Forward PCI REGISTER  */
-    PG5FFPCI1    = 0x0000;
-    /* PWM GENERATOR 5 Sync PCI REGISTER */
-    PG5SPCI1    = 0x0000;
-    
-    /* Initialize PWM GENERATOR 5 LEADING-EDGE BLANKING REGISTER */
-    PG5LEB      = 0x0000;
-    
-    /* Initialize PWM GENERATOR 5 PHASE REGISTER */
-    PG5PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 5 DUTY CYCLE REGISTER */
-    PG5DC        = LOOPTIME_TCY/3;
-    /* Initialize PWM GENERATOR 5 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG5DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 5 PERIOD REGISTER */
-    PG5PER       = LOOPTIME_TCY;
-    /* Initialize PWM GENERATOR 5 DEAD-TIME REGISTER */
-    PG5DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 5 DEAD-TIME REGISTER */
-    PG5DTbits.DTL = DEADTIME;
-
-    /* Initialize PWM GENERATOR 5 TRIGGER A REGISTER */
-    PG5TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 5 TRIGGER B REGISTER */
-    PG5TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 5 TRIGGER C REGISTER */
-    PG5TRIGC     = 0x0000;   
+    volatile uint32_t *pRegs;
+    uint16_t i;
+
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        pRegs = PWM_GeneratorRegisters(pwmGeneratorConfig[i].generator);
+        PWM_GENERATOR_REG(pRegs, PWM_REG_CON) |= _PG1CON_ON_MASK;
+    }
 }
 
 /**
-* <B> Function: InitPWMGenerator1()    </B>
+* <B> Function: InitPWMGenerator(const PWM_GENERATOR_CONFIG_T *)    </B>
 *
-* @brief Function to configure PWM Module # 1
+* @brief Function configures one PWM generator from its settings. Every 
+* register of the block is written once, the generator is left disabled.
 *        
-* @param none.
+* @param pConfig generator settings.
 * @return none.
 * 
 * @example
-* <CODE> InitPWMGenerator1();     </CODE>
+* <CODE> InitPWMGenerator(&config);     </CODE>
 *
 */
-void InitPWMGenerator1 (void)
+void InitPWMGenerator(const PWM_GENERATOR_CONFIG_T *pConfig)
 {
-
-    /* Initialize PWM GENERATOR 1 CONTROL REGISTER */
-    PG1CON      = 0x0000;
-    /* PWM Generator 1 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG1CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG1CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    PG1CONbits.MODSEL = 6;
-#else
-    PG1CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG1CONbits.TRGCNT = 0;
-    
-    /* Initialize PWM GENERATOR 1 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG1DC
-       0 = Macro uses the PG1DC register*/
-    PG1CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG1PER
-       0 = Macro uses the PG1PER register */
-    PG1CONbits.MPERSEL = 1;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG1PHASE
-       0 = Macro uses the PG1PHASE register */
-    PG1CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG1CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG1CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG1CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG1CONbits.SOCS = 0xF;
-    
-    /* Clear PWM GENERATOR 1 STATUS REGISTER*/
-    PG1STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 1 I/O CONTROL REGISTER */
-    PG1IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG1IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM1H and PWM1L Device Pins bit 
-       0 = PWM1H/L signals are mapped to their respective pins */
-    PG1IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM1H Pin bit
-       0 = PWM Generator provides data for the PWM1H pin*/
-    PG1IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM1L Pin bit
-       0 = PWM Generator provides data for the PWM1L pin*/
-    PG1IOCON2bits.OVRENL = 0;
-    /* Data for PWM1H/PWM1L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM1H.
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM1L */
-    PG1IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG1IOCON2bits.OSYNC = 0;
-    /* Data for PWM1H/PWM1L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM1H.
-       If Fault is active, then FLTDAT<0> provides data for PWM1L.*/
-    PG1IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM1H/PWM1L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM1H.
-       If current limit is active, then CLDAT<0> provides data for PWM1L.*/
-    PG1IOCON2bits.CLDAT = 0;
-    /* Data for PWM1H/PWM1L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM1H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM1L.*/
-    PG1IOCON2bits.FFDAT = 0;
-    /* Data for PWM1H/PWM1L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM1H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM1L data. */
-    PG1IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 1 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG1IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG1IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG1IOCON1bits.PMOD = 0;
-    /* PWM1H Output Port Enable bit
-       1 = PWM Generator controls the PWM1H output pin
-       0 = PWM Generator does not control the PWM1H output pin */
-    PG1IOCON1bits.PENH = 1;
-    /* PWM1L Output Port Enable bit
-       1 = PWM Generator controls the PWM1L output pin
-       0 = PWM Generator does not control the PWM1L output pin */
-    PG1IOCON1bits.PENL = 1;
-    /* PWM1H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG1IOCON1bits.POLH = 0;
-    /* PWM1L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG1IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 1 EVENT REGISTER */
-    PG1EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG1EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG1TRIGC Compare Event Enable bit
-       0 = PG1TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG1EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG1TRIGB Compare Event Enable bit
-       0 = PG1TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG1EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG1TRIGA Compare Event Enable bit
-       1 = PG1TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG1EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG1DC register automatically sets the UPDATE bit*/
-    PG1EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG1EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 1 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG1EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG1EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG1EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG1EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG1EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is PG1TRIGC Compare Event Enable bit
-       0 = PG1TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG1EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG1TRIGB Compare Event Enable bit
-       0 = PG1TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG1EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG1TRIGA Compare Event Enable bit
-       0 = PG1TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG1EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG1EVT1bits.ADTR1OFS = 0;  
-
-    /* PWM GENERATOR 1 Current Limit PCI REGISTER */
-    PG1CLPCI1    = 0x0000;
-    /* PWM GENERATOR 1 Feed Forward PCI REGISTER  */
-    PG1FFPCI1    = 0x0000;
-    /* PWM GENERATOR 1 Sync PCI REGISTER */
-    PG1SPCI1    = 0x0000;
-    
-    PG1EVT1bits.PWMPCI  = 4;
-    PG1SPCI1bits.PPS = 0 ;
-    PG1SPCI2 = 8388608;
-    
-    
-    /* Initialize PWM GENERATOR 1 LEADING-EDGE BLANKING REGISTER */
-    PG1LEB      = 0x0000;
-     
-    /* Initialize PWM GENERATOR 1 PHASE REGISTER */
-    PG1PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 1 DUTY CYCLE REGISTER */
-    PG1DC        = LOOPTIME_TCY>>1;
-    /* Initialize PWM GENERATOR 1 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG1DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 1 PERIOD REGISTER */
-    PG1PER       = 0x0000;
-    /* Initialize PWM GENERATOR 1 DEAD-TIME REGISTER */
-    PG1DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 1 DEAD-TIME REGISTER */
-    PG1DTbits.DTL = DEADTIME;
-
-    /* Initialize PWM GENERATOR 1 TRIGGER A REGISTER */
-    PG1TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 1 TRIGGER B REGISTER */
-    PG1TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 1 TRIGGER C REGISTER */
-    PG1TRIGC     = 0x0000;
-    
-} 
+    volatile uint32_t *pRegs = PWM_GeneratorRegisters(pConfig->generator);
+    
+    /* PWM GENERATOR CONTROL AND STATUS REGISTERS */
+    PWM_GENERATOR_REG(pRegs, PWM_REG_CON) = pConfig->con;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_STAT) = 0x0000;
+    
+    /* PWM GENERATOR I/O CONTROL REGISTERS
+       No swap, no capture, all PCI and debug output data 0 */
+    PWM_GENERATOR_REG(pRegs, PWM_REG_IOCON2) = 0x0000;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_IOCON1) = pConfig->iocon1;
+    
+    /* PWM GENERATOR EVENT REGISTERS */
+    PWM_GENERATOR_REG(pRegs, PWM_REG_EVT1) = pConfig->evt1;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_EVT2) = pConfig->evt2;
+    
+    /* PWM GENERATOR PCI REGISTERS : Sync PCI only */
+    PWM_GENERATOR_REG(pRegs, PWM_REG_CLPCI1) = 0x0000;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_FFPCI1) = 0x0000;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_SPCI1) = pConfig->spci1;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_SPCI2) = pConfig->spci2;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_LEB) = 0x0000;
+    
+    /* PWM GENERATOR PHASE, DUTY CYCLE, PERIOD AND DEAD-TIME REGISTERS */
+    if ((pConfig->con & _PG1CON_MODSEL_MASK) == PWM_FIELD(CON, MODSEL, 6))
+    {
+        /* Dual edge : rising edge as the falling edge, symmetric pulse */
+        PWM_GENERATOR_REG(pRegs, PWM_REG_PHASE) = 
+                PWM_TimingValue(&pwmTiming, pConfig->duty);
+    }
+    else
+    {
+        /* Center aligned : start of cycle delay, interleaves the motors */
+        PWM_GENERATOR_REG(pRegs, PWM_REG_PHASE) = 
+                PWM_GeneratorPhase(&pwmTiming, pConfig->generator);
+    }
+    PWM_GENERATOR_REG(pRegs, PWM_REG_DC) = 
+            PWM_TimingValue(&pwmTiming, pConfig->duty);
+    PWM_GENERATOR_REG(pRegs, PWM_REG_DCA) = 0x0000;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_PER) = 
+            PWM_TimingValue(&pwmTiming, pConfig->period);
+    PWM_GENERATOR_REG(pRegs, PWM_REG_DT) = 
+            PWM_FIELD_VAR(DT, DTH, pwmTiming.deadtime) |
+            PWM_FIELD_VAR(DT, DTL, pwmTiming.deadtime);
+    
+    /* PWM GENERATOR TRIGGER REGISTERS */
+    PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGA) = ADC_SAMPLING_POINT;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGB) = 0x0000;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGC) = 0x0000;
+}
 
 /**
-* <B> Function: InitPWMGenerator2()    </B>
+* <B> Function: PWM_TimingCalculate(PWM_TIMING_T *, uint32_t, float) </B>
 *
-* @brief Function to configure PWM Module # 2
+* @brief Function computes the period, dead time and duty cycle limits of 
+* the PWM generators for a switching frequency and a dead time, with the 
+* same scaling as LOOPTIME_TCY, AUX_PWM_LOOPTIME_TCY and DEADTIME.
 *        
-* @param none.
-* @return none.
+* @param pTiming timing to compute.
+* @param frequencyHz PWM switching frequency in Hertz.
+* @param deadtimeMicrosec dead time in micro seconds.
+* @return 1 if the timing is valid, 0 if a parameter is out of range 
+* (pTiming is not modified).
 * 
 * @example
-* <CODE> InitPWMGenerator2();     </CODE>
+* <CODE> PWM_TimingCalculate(&timing, 20000, 0.75f); </CODE>
 *
 */
-void InitPWMGenerator2 (void)
+uint16_t PWM_TimingCalculate(PWM_TIMING_T *pTiming, uint32_t frequencyHz,
+                             float deadtimeMicrosec)
 {
-
-    /* Initialize PWM GENERATOR 2 CONTROL REGISTER */
-    PG2CON      = 0x0000;
-    /* PWM Generator 2 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG2CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG2CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    PG2CONbits.MODSEL = 6;
-#else
-    PG2CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG2CONbits.TRGCNT = 0;
-    
-    /* Initialize PWM GENERATOR 2 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG2DC
-       0 = Macro uses the PG2DC register*/
-    PG2CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG2PER
-       0 = Macro uses the PG2PER register */
-    PG2CONbits.MPERSEL = 1;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG2PHASE
-       0 = Macro uses the PG2PHASE register */
-    PG2CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG2CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG2CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG2CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG2CONbits.SOCS = 0xF;
-    
-    /* Clear PWM GENERATOR 2 STATUS REGISTER*/
-    PG2STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 2 I/O CONTROL REGISTER */
-    PG2IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG2IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM2H and PWM2L Device Pins bit 
-       0 = PWM2H/L signals are mapped to their respective pins */
-    PG2IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM2H Pin bit
-       0 = PWM Generator provides data for the PWM2H pin*/
-    PG2IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM2L Pin bit
-       0 = PWM Generator provides data for the PWM2L pin*/
-    PG2IOCON2bits.OVRENL = 0;
-    /* Data for PWM2H/PWM2L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM2H.
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM2L */
-    PG2IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG2IOCON2bits.OSYNC = 0;
-    /* Data for PWM2H/PWM2L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM2H.
-       If Fault is active, then FLTDAT<0> provides data for PWM2L.*/
-    PG2IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM2H/PWM2L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM2H.
-       If current limit is active, then CLDAT<0> provides data for PWM2L.*/
-    PG2IOCON2bits.CLDAT = 0;
-    /* Data for PWM2H/PWM2L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM2H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM2L.*/
-    PG2IOCON2bits.FFDAT = 0;
-    /* Data for PWM2H/PWM2L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM2H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM2L data. */
-    PG2IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 2 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG2IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG2IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG2IOCON1bits.PMOD = 0;
-    /* PWM2H Output Port Enable bit
-       1 = PWM Generator controls the PWM2H output pin
-       0 = PWM Generator does not control the PWM2H output pin */
-    PG2IOCON1bits.PENH = 1;
-    /* PWM2L Output Port Enable bit
-       1 = PWM Generator controls the PWM2L output pin
-       0 = PWM Generator does not control the PWM2L output pin */
-    PG2IOCON1bits.PENL = 1;
-    /* PWM2H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG2IOCON1bits.POLH = 0;
-    /* PWM2L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG2IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 2 EVENT REGISTER */
-    PG2EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG2EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG2TRIGC Compare Event Enable bit
-       0 = PG2TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG2EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG2TRIGB Compare Event Enable bit
-       0 = PG2TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG2EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG2TRIGA Compare Event Enable bit
-       1 = PG2TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG2EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG2DC register automatically sets the UPDATE bit*/
-    PG2EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG2EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 2 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG2EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG2EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG2EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG2EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG2EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is PG2TRIGC Compare Event Enable bit
-       0 = PG2TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG2EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG2TRIGB Compare Event Enable bit
-       0 = PG2TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG2EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG2TRIGA Compare Event Enable bit
-       0 = PG2TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG2EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG2EVT1bits.ADTR1OFS = 0;
-    
-    /* PWM GENERATOR 2 Current Limit PCI REGISTER */
-    PG2CLPCI1    = 0x0000;
-    /* PWM GENERATOR 2 Feed Forward PCI REGISTER  */
-    PG2FFPCI1    = 0x0000;
-    /* PWM GENERATOR 2 Sync PCI REGISTER */
-    PG2SPCI1    = 0x0000;
-    
-    /* Initialize PWM GENERATOR 2 LEADING-EDGE BLANKING REGISTER */
-    PG2LEB      = 0x0000;
-    
-    PG2EVT1bits.PWMPCI  = 4;
-    PG2SPCI1bits.PPS = 0 ;
-    PG2SPCI2 = 8388608;
-    
-    /* Initialize PWM GENERATOR 2 PHASE REGISTER */
-    PG2PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 2 DUTY CYCLE REGISTER */
-    PG2DC        = LOOPTIME_TCY>>1;
-    /* Initialize PWM GENERATOR 2 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG2DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 2 PERIOD REGISTER */
-    PG2PER       = 0x0000;
-    /* Initialize PWM GENERATOR 2 DEAD-TIME REGISTER */
-    PG2DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 2 DEAD-TIME REGISTER */
-    PG2DTbits.DTL = DEADTIME;
-
-    /* Initialize PWM GENERATOR 2 TRIGGER A REGISTER */
-    PG2TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 2 TRIGGER B REGISTER */
-    PG2TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 2 TRIGGER C REGISTER */
-    PG2TRIGC     = 0x0000;
-    
+    uint32_t loopTimeTcy, deadtime;
+    
+    if ((frequencyHz < PWMFREQUENCY_MIN_HZ) || 
+        (frequencyHz > PWMFREQUENCY_MAX_HZ) ||
+        (deadtimeMicrosec < DEADTIME_MIN_MICROSEC) || 
+        (deadtimeMicrosec > DEADTIME_MAX_MICROSEC))
+    {
+        return 0;
+    }
+    
+    /* Period in center aligned mode : 1/16 PWM clock resolution, half cycle */
+    loopTimeTcy = ((8UL * PWM_CLOCK_MHZ * 1000000UL) / frequencyHz) - 16;
+    deadtime = (uint32_t)(deadtimeMicrosec * 16 * PWM_CLOCK_MHZ);
+    if (loopTimeTcy <= (2 * deadtime))
+    {
+        return 0;
+    }
+    
+    pTiming->frequencyHz = frequencyHz;
+    pTiming->loopTimeTcy = loopTimeTcy;
+    /* Auxiliary generators : 1/4 PWM clock resolution */
+    pTiming->auxLoopTimeTcy = 
+                        ((2UL * PWM_CLOCK_MHZ * 1000000UL) / frequencyHz) - 16;
+    pTiming->deadtime = deadtime;
+    pTiming->minDuty = deadtime;
+    pTiming->maxDuty = loopTimeTcy - deadtime;
+    pTiming->deadtimeMicrosec = deadtimeMicrosec;
+    
+    return 1;
 }
 
 /**
-* <B> Function: InitPWMGenerator3()    </B>
+* <B> Function: PWM_TimingApply(const PWM_TIMING_T *) </B>
 *
-* @brief Function to configure PWM Module # 3
+* @brief Function applies a new timing to the running PWM generators.
+* 
+* The client generators are switched to client SOC update mode, so that the 
+* new period, dead time, phase and duty cycle values of all ten generators 
+* are transferred by one update request of the master PG5 (MSTEN = 1): every
+* generator switches at its own next start of cycle and no generator runs a 
+* cycle with a mix of old and new values. The function waits for the update
+* to complete (up to two PWM periods) and restores the SOC update mode.
+* Motor duty cycles above the new period of their motor less the dead time
+* are clamped. The waits give up after PWM_UPDATE_TIMEOUT_POLLS polls; if 
+* an earlier update of any generator is still pending nothing is written.
 *        
-* @param none.
-* @return none.
+* @param pTiming timing computed by PWM_TimingCalculate().
+* @return 1 if the timing is applied, 0 if an update did not complete.
 * 
 * @example
-* <CODE> InitPWMGenerator3();     </CODE>
+* <CODE> PWM_TimingApply(&timing); </CODE>
 *
 */
-void InitPWMGenerator3 (void)
+uint16_t PWM_TimingApply(const PWM_TIMING_T *pTiming)
 {
-
-
-    /* Initialize PWM GENERATOR 3 CONTROL REGISTER */
-    PG3CON      = 0x0000;
-    /* PWM Generator 3 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG3CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG3CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    PG3CONbits.MODSEL = 6;
-#else
-    PG3CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG3CONbits.TRGCNT = 0;
+    const PWM_GENERATOR_CONFIG_T *pConfig;
+    volatile uint32_t *pRegs, *pMaster = &PG5CON;
+    uint32_t maxDuty;
+    uint16_t i, updated = 1;
+    
+    /* Data registers are not writable while an update is pending, a client
+       may still have one requested by its own PGxDC write */
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        pRegs = PWM_GeneratorRegisters(pwmGeneratorConfig[i].generator);
+        if (PWM_UpdateWait(pRegs) == 0)
+        {
+            return 0;
+        }
+    }
     
-    /* Initialize PWM GENERATOR 3 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG3DC
-       0 = Macro uses the PG3DC register*/
-    PG3CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG3PER
-       0 = Macro uses the PG3PER register */
-    PG3CONbits.MPERSEL = 1;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG3PHASE
-       0 = Macro uses the PG3PHASE register */
-    PG3CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG3CONbits.MSTEN = 0;
     /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG3CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG3CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG3CONbits.SOCS = 3;
-    
-    /* Clear PWM GENERATOR 3 STATUS REGISTER*/
-    PG3STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 3 I/O CONTROL REGISTER */
-    PG3IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG3IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM3H and PWM3L Device Pins bit 
-       0 = PWM3H/L signals are mapped to their respective pins */
-    PG3IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM3H Pin bit
-       0 = PWM Generator provides data for the PWM3H pin*/
-    PG3IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM3L Pin bit
-       0 = PWM Generator provides data for the PWM3L pin*/
-    PG3IOCON2bits.OVRENL = 0;
-    /* Data for PWM3H/PWM3L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM3H.
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM3L */
-    PG3IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG3IOCON2bits.OSYNC = 0;
-    /* Data for PWM3H/PWM3L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM3H.
-       If Fault is active, then FLTDAT<0> provides data for PWM3L.*/
-    PG3IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM3H/PWM3L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM3H.
-       If current limit is active, then CLDAT<0> provides data for PWM3L.*/
-    PG3IOCON2bits.CLDAT = 0;
-    /* Data for PWM3H/PWM3L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM3H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM3L.*/
-    PG3IOCON2bits.FFDAT = 0;
-    /* Data for PWM3H/PWM3L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM3H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM3L data. */
-    PG3IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 3 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG3IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG3IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG3IOCON1bits.PMOD = 0;
-    /* PWM1H Output Port Enable bit
-       1 = PWM Generator controls the PWM1H output pin
-       0 = PWM Generator does not control the PWM1H output pin */
-    PG3IOCON1bits.PENH = 1;
-    /* PWM1L Output Port Enable bit
-       1 = PWM Generator controls the PWM1L output pin
-       0 = PWM Generator does not control the PWM1L output pin */
-    PG3IOCON1bits.PENL = 1;
-    /* PWM1H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG3IOCON1bits.POLH = 0;
-    /* PWM1L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG3IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 3 EVENT REGISTER */
-    PG3EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG3EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG3TRIGC Compare Event Enable bit
-       0 = PG3TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG3EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG3TRIGB Compare Event Enable bit
-       0 = PG3TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG3EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG3TRIGA Compare Event Enable bit
-       1 = PG3TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG3EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG3DC register automatically sets the UPDATE bit*/
-    PG3EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG3EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 3 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG3EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG3EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG3EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG3EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG3EVT1bits.IEVTSEL = 3;
-
-    /* ADC Trigger 2 Source is PG3TRIGC Compare Event Enable bit
-       0 = PG3TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG3EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG3TRIGB Compare Event Enable bit
-       0 = PG3TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG3EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG3TRIGA Compare Event Enable bit
-       0 = PG3TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG3EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG3EVT1bits.ADTR1OFS = 0;
-
-    /* PWM GENERATOR 3 Current Limit PCI REGISTER */
-    PG3CLPCI1    = 0x0000;
-    /* PWM GENERATOR 3 Feed Forward PCI REGISTER  */
-    PG3FFPCI1    = 0x0000;
-    /* PWM GENERATOR 3 Sync PCI REGISTER */
-    PG3SPCI1    = 0x0000;
-    
-    /* Initialize PWM GENERATOR 3 LEADING-EDGE BLANKING REGISTER */
-    PG3LEB      = 0x0000;
-    
-    PG3EVT1bits.PWMPCI  = 4;
-    PG3SPCI1bits.PPS = 0 ;
-    PG3SPCI2 = 8388608;    
-    
-    /* Initialize PWM GENERATOR 3 PHASE REGISTER */
-    PG3PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 3 DUTY CYCLE REGISTER */
-    PG3DC        = LOOPTIME_TCY>>1;
-    /* Initialize PWM GENERATOR 3 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG3DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 3 PERIOD REGISTER */
-    PG3PER       = 0x0000;
-    /* Initialize PWM GENERATOR 3 DEAD-TIME REGISTER */
-    PG3DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 3 DEAD-TIME REGISTER */
-    PG3DTbits.DTL = DEADTIME;
+       010 = Client SOC update: Update Data registers at start of next PWM 
+             cycle if a master update request is received */
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        pConfig = &pwmGeneratorConfig[i];
+        if ((pConfig->con & _PG1CON_MSTEN_MASK) == 0)
+        {
+            pRegs = PWM_GeneratorRegisters(pConfig->generator);
+            PWM_GENERATOR_REG(pRegs, PWM_REG_CON) = 
+                (PWM_GENERATOR_REG(pRegs, PWM_REG_CON) & 
+                    ~_PG1CON_UPDMOD_MASK) | PWM_FIELD(CON, UPDMOD, 2);
+        }
+    }
+    
+    /* Master is last in the table, its update request is broadcast */
+    MPER = pTiming->loopTimeTcy;
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        pConfig = &pwmGeneratorConfig[i];
+        pRegs = PWM_GeneratorRegisters(pConfig->generator);
+        maxDuty = PWM_GeneratorMaxDuty(pTiming, pConfig->generator);
+        
+        if ((pConfig->con & _PG1CON_MODSEL_MASK) != PWM_FIELD(CON, MODSEL, 6))
+        {
+            PWM_GENERATOR_REG(pRegs, PWM_REG_PHASE) = 
+                    PWM_GeneratorPhase(pTiming, pConfig->generator);
+        }
+        else if (PWM_GENERATOR_REG(pRegs, PWM_REG_PHASE) > maxDuty)
+        {
+            PWM_GENERATOR_REG(pRegs, PWM_REG_PHASE) = maxDuty;
+        }
+        if (pConfig->period != PWM_VALUE_ZERO)
+        {
+            PWM_GENERATOR_REG(pRegs, PWM_REG_PER) = 
+                    PWM_TimingValue(pTiming, pConfig->period);
+        }
+        if (pConfig->duty != PWM_VALUE_MOTOR_DUTY)
+        {
+            PWM_GENERATOR_REG(pRegs, PWM_REG_DC) = 
+                    PWM_TimingValue(pTiming, pConfig->duty);
+        }
+        else if (PWM_GENERATOR_REG(pRegs, PWM_REG_DC) > maxDuty)
+        {
+            PWM_GENERATOR_REG(pRegs, PWM_REG_DC) = maxDuty;
+        }
+        PWM_GENERATOR_REG(pRegs, PWM_REG_DT) = 
+                PWM_FIELD_VAR(DT, DTH, pTiming->deadtime) |
+                PWM_FIELD_VAR(DT, DTL, pTiming->deadtime);
+        if (pConfig->con & _PG1CON_MSTEN_MASK)
+        {
+            pMaster = pRegs;
+        }
+    }
+    PWM_GENERATOR_REG(pMaster, PWM_REG_STAT) |= _PG1STAT_UPDREQ_MASK;
+    
+    /* Master update completes at the master start of cycle; the clients 
+       complete within the following PWM period */
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        pRegs = PWM_GeneratorRegisters(pwmGeneratorConfig[i].generator);
+        if (PWM_UpdateWait(pRegs) == 0)
+        {
+            updated = 0;
+        }
+    }
+    
+    /* 000 = SOC update: Update Data registers at start of next PWM cycle 
+             if UPDATE = 1 */
+    for (i = 0; i < PWM_GENERATOR_COUNT; i++)
+    {
+        pConfig = &pwmGeneratorConfig[i];
+        if ((pConfig->con & _PG1CON_MSTEN_MASK) == 0)
+        {
+            pRegs = PWM_GeneratorRegisters(pConfig->generator);
+            PWM_GENERATOR_REG(pRegs, PWM_REG_CON) &= ~_PG1CON_UPDMOD_MASK;
+        }
+    }
+    
+    /* The registers hold the new timing even if its update is late */
+    pwmTiming = *pTiming;
+    return updated;
+}
 
-    /* Initialize PWM GENERATOR 3 TRIGGER A REGISTER */
-    PG3TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 3 TRIGGER B REGISTER */
-    PG3TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 3 TRIGGER C REGISTER */
-    PG3TRIGC     = 0x0000;
+/**
+* <B> Function: PWM_SetTiming(uint32_t, float) </B>
+*
+* @brief Function changes the PWM switching frequency and dead time at 
+* runtime. pwmTiming holds the new period and duty cycle limits on return.
+*        
+* @param frequencyHz PWM switching frequency in Hertz 
+* (PWMFREQUENCY_MIN_HZ to PWMFREQUENCY_MAX_HZ).
+* @param deadtimeMicrosec dead time in micro seconds 
+* (DEADTIME_MIN_MICROSEC to DEADTIME_MAX_MICROSEC).
+* @return 1 if the timing is applied, 0 if a parameter is out of range or
+* the update did not complete.
+* 
+* @example
+* <CODE> PWM_SetTiming(8000, 1.0f); </CODE>
+*
+*/
+uint16_t PWM_SetTiming(uint32_t frequencyHz, float deadtimeMicrosec)
+{
+    PWM_TIMING_T timing = pwmTiming;
     
+    if (PWM_TimingCalculate(&timing, frequencyHz, deadtimeMicrosec) == 0)
+    {
+        return 0;
+    }
+    return PWM_TimingApply(&timing);
 }
 
 /**
-* <B> Function: InitPWMGenerator6()    </B>
+* <B> Function: PWM_SetInterleave(const uint16_t *) </B>
 *
-* @brief Function to configure PWM Module # 6
+* @brief Function changes the start of cycle offsets of the motors at 
+* runtime. The new offsets are applied by PWM_TimingApply(), all generators
+* switch with one master update. With the dual edge mode of SINGLE_SHUNT
+* PGxPHASE is the rising edge, the offsets are fixed by the sync edges and
+* the function returns 0 without a change.
 *        
-* @param none.
-* @return none.
+* @param pDeg start of cycle of MC1, MC2 and MC3 in degrees of the PWM 
+* cycle (0 to 359).
+* @return 1 if the offsets are applied, 0 if an offset is out of range, 
+* the update did not complete or SINGLE_SHUNT is defined.
 * 
 * @example
-* <CODE> InitPWMGenerator6 ();     </CODE>
+* <CODE> PWM_SetInterleave(offsets); </CODE>
 *
 */
-void InitPWMGenerator6 (void)
+uint16_t PWM_SetInterleave(const uint16_t *pDeg)
 {
-
-    /* Initialize PWM GENERATOR 6 CONTROL REGISTER */
-    PG6CON      = 0x0000;
-    /* PWM Generator 6 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG6CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG6CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
 #ifdef SINGLE_SHUNT
-    PG6CONbits.MODSEL = 6;
+    return 0;
 #else
-    PG6CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG6CONbits.TRGCNT = 0;
-    
-    /* Initialize PWM GENERATOR 6 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG6DC
-       0 = Macro uses the PG6DC register*/
-    PG6CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG6PER
-       0 = Macro uses the PG6PER register */
-    PG6CONbits.MPERSEL = 1;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG6PHASE
-       0 = Macro uses the PG6PHASE register */
-    PG6CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG6CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG6CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG6CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG6CONbits.SOCS = 5;
-    
-    /* Clear PWM GENERATOR 6 STATUS REGISTER*/
-    PG6STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 6 I/O CONTROL REGISTER */
-    PG6IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG6IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM6H and PWM6L Device Pins bit 
-       0 = PWM6H/L signals are mapped to their respective pins */
-    PG6IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM6H Pin bit
-       0 = PWM Generator provides data for the PWM6H pin*/
-    PG6IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM6L Pin bit
-       0 = PWM Generator provides data for the PWM6L pin*/
-    PG6IOCON2bits.OVRENL = 0;
-    /* Data for PWM6H/PWM6L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM6H
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM6L */
-    PG6IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG6IOCON2bits.OSYNC = 0;
-    /* Data for PWM6H/PWM6L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM6H.
-       If Fault is active, then FLTDAT<0> provides data for PWM6L.*/
-    PG6IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM6H/PWM6L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM6H.
-       If current limit is active, then CLDAT<0> provides data for PWM6L.*/
-    PG6IOCON2bits.CLDAT = 0;
-    /* Data for PWM6H/PWM6L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM6H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM6L.*/
-    PG6IOCON2bits.FFDAT = 0;
-    /* Data for PWM6H/PWM6L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM6H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM6L data. */
-    PG6IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 6 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG6IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG6IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG6IOCON1bits.PMOD = 0;
-    /* PWM6H Output Port Enable bit
-       1 = PWM Generator controls the PWM6H output pin
-       0 = PWM Generator does not control the PWM6H output pin */
-    PG6IOCON1bits.PENH = 1;
-    /* PWM6L Output Port Enable bit
-       1 = PWM Generator controls the PWM6L output pin
-       0 = PWM Generator does not control the PWM6L output pin */
-    PG6IOCON1bits.PENL = 1;
-    /* PWM6H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG6IOCON1bits.POLH = 0;
-    /* PWM6L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG6IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 6 EVENT REGISTER */
-    PG6EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG6EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG6TRIGC Compare Event Enable bit
-       0 = PG6TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG6EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG6TRIGB Compare Event Enable bit
-       0 = PG6TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG6EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG6TRIGA Compare Event Enable bit
-       1 = PG6TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG6EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG6DC register automatically sets the UPDATE bit*/
-    PG6EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG6EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 6 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG6EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG6EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG6EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG6EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG6EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is PG6TRIGC Compare Event Enable bit
-       0 = PG6TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG6EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG6TRIGB Compare Event Enable bit
-       0 = PG6TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG6EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG6TRIGA Compare Event Enable bit
-       0 = PG6TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG6EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG6EVT1bits.ADTR1OFS = 0;
-
-    /* PWM GENERATOR 6 Current Limit PCI REGISTER */
-    PG6CLPCI1    = 0x0000;
-    /* PWM GENERATOR 6 Feed Forward PCI REGISTER  */
-    PG6FFPCI1    = 0x0000;
-    /* PWM GENERATOR 6 Sync PCI REGISTER */
-    PG6SPCI1    = 0x0000;
-    
-    /* Initialize PWM GENERATOR 6 LEADING-EDGE BLANKING REGISTER */
-    PG6LEB      = 0x0000;
-    
-    /* Initialize PWM GENERATOR 6 PHASE REGISTER */
-    PG6PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 6 DUTY CYCLE REGISTER */
-    PG6DC        = (LOOPTIME_TCY)>>1;
-    /* Initialize PWM GENERATOR 6 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG6DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 6 PERIOD REGISTER */
-    PG6PER       = LOOPTIME_TCY;
-    /* Initialize PWM GENERATOR 6 DEAD-TIME REGISTER */
-    PG6DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 6 DEAD-TIME REGISTER */
-    PG6DTbits.DTL = DEADTIME;
-
-    /* Initialize PWM GENERATOR 6 TRIGGER A REGISTER */
-    PG6TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 6 TRIGGER B REGISTER */
-    PG6TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 6 TRIGGER C REGISTER */
-    PG6TRIGC     = 0x0000;
-
-}    
+    PWM_TIMING_T timing = pwmTiming;
+    uint16_t motor;
+    
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        if (pDeg[motor] >= 360)
+        {
+            return 0;
+        }
+        timing.interleaveDeg[motor] = pDeg[motor];
+    }
+    return PWM_TimingApply(&timing);
+#endif
+}
 
 /**
-* <B> Function: InitPWMGenerator7()    </B>
+* <B> Function: PWM_MotorDutySet(uint16_t, const uint32_t *) </B>
 *
-* @brief Function to configure PWM Module # 7
+* @brief Function writes the duty cycles of the phase A, B and C generators 
+* of a motor. The write of PGxDC requests the update at the next start of 
+* cycle.
 *        
-* @param none.
+* @param motor PWM_MOTOR_T.
+* @param pDuty PGxDC of phase A, B and C.
 * @return none.
 * 
 * @example
-* <CODE> InitPWMGenerator7 ();     </CODE>
+* <CODE> PWM_MotorDutySet(PWM_MOTOR_MC1, duty); </CODE>
 *
 */
-void InitPWMGenerator7 (void)
+void PWM_MotorDutySet(uint16_t motor, const uint32_t *pDuty)
 {
-
-    /* Initialize PWM GENERATOR 7 CONTROL REGISTER */
-    PG7CON      = 0x0000;
-    /* PWM Generator 7 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG7CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG7CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    PG7CONbits.MODSEL = 6;
-#else
-    PG7CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG7CONbits.TRGCNT = 0;
-    
-    /* Initialize PWM GENERATOR 7 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG7DC
-       0 = Macro uses the PG7DC register*/
-    PG7CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG7PER
-       0 = Macro uses the PG7PER register */
-    PG7CONbits.MPERSEL = 1;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG7PHASE
-       0 = Macro uses the PG7PHASE register */
-    PG7CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG7CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG7CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG7CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG7CONbits.SOCS = 5;
-    
-    /* Clear PWM GENERATOR 7 STATUS REGISTER*/
-    PG7STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 7 I/O CONTROL REGISTER */
-    PG7IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG7IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM7H and PWM7L Device Pins bit 
-       0 = PWM7H/L signals are mapped to their respective pins */
-    PG7IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM7H Pin bit
-       0 = PWM Generator provides data for the PWM7H pin*/
-    PG7IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM7L Pin bit
-       0 = PWM Generator provides data for the PWM7L pin*/
-    PG7IOCON2bits.OVRENL = 0;
-    /* Data for PWM7H/PWM7L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM7H.
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM7L */
-    PG7IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG7IOCON2bits.OSYNC = 0;
-    /* Data for PWM7H/PWM7L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM7H.
-       If Fault is active, then FLTDAT<0> provides data for PWM7L.*/
-    PG7IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM7H/PWM7L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM7H.
-       If current limit is active, then CLDAT<0> provides data for PWM7L.*/
-    PG7IOCON2bits.CLDAT = 0;
-    /* Data for PWM7H/PWM7L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM7H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM7L.*/
-    PG7IOCON2bits.FFDAT = 0;
-    /* Data for PWM7H/PWM7L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM7H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM7L data. */
-    PG7IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 7 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG7IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG7IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG7IOCON1bits.PMOD = 0;
-    /* PWM7H Output Port Enable bit
-       1 = PWM Generator controls the PWM7H output pin
-       0 = PWM Generator does not control the PWM7H output pin */
-    PG7IOCON1bits.PENH = 1;
-    /* PWM7L Output Port Enable bit
-       1 = PWM Generator controls the PWM7L output pin
-       0 = PWM Generator does not control the PWM7L output pin */
-    PG7IOCON1bits.PENL = 1;
-    /* PWM7H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG7IOCON1bits.POLH = 0;
-    /* PWM7L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG7IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 7 EVENT REGISTER */
-    PG7EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG7EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG7TRIGC Compare Event Enable bit
-       0 = PG7TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG7EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG7TRIGB Compare Event Enable bit
-       0 = PG7TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG7EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG7TRIGA Compare Event Enable bit
-       1 = PG7TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG7EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG7DC register automatically sets the UPDATE bit*/
-    PG7EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG7EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 7 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG7EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG7EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG7EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG7EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG7EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is PG7TRIGC Compare Event Enable bit
-       0 = PG7TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG7EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG7TRIGB Compare Event Enable bit
-       0 = PG7TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG7EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG7TRIGA Compare Event Enable bit
-       0 = PG7TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG7EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG7EVT1bits.ADTR1OFS = 0;
-
-    /* PWM GENERATOR 7 Current Limit PCI REGISTER */
-    PG7CLPCI1    = 0x0000;
-    /* PWM GENERATOR 7 Feed Forward PCI REGISTER  */
-    PG7FFPCI1    = 0x0000;
-    /* PWM GENERATOR 7 Sync PCI REGISTER */
-    PG7SPCI1    = 0x0000;
-    
-    /* Initialize PWM GENERATOR 7 LEADING-EDGE BLANKING REGISTER */
-    PG7LEB      = 0x0000;
-    
-    /* Initialize PWM GENERATOR 7 PHASE REGISTER */
-    PG7PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 7 DUTY CYCLE REGISTER */
-    PG7DC        = (LOOPTIME_TCY)>>1;
-    /* Initialize PWM GENERATOR 7 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG7DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 7 PERIOD REGISTER */
-    PG7PER       = LOOPTIME_TCY;
-    /* Initialize PWM GENERATOR 7 DEAD-TIME REGISTER */
-    PG7DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 7 DEAD-TIME REGISTER */
-    PG7DTbits.DTL = DEADTIME;
-
-    /* Initialize PWM GENERATOR 7 TRIGGER A REGISTER */
-    PG7TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 7 TRIGGER B REGISTER */
-    PG7TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 7 TRIGGER C REGISTER */
-    PG7TRIGC     = 0x0000;
+    uint16_t phase;
     
+    for (phase = 0; phase < 3; phase++)
+    {
+        PWM_GENERATOR_REG(PWM_GeneratorRegisters(
+            pwmMotorGenerator[motor][phase]), PWM_REG_DC) = pDuty[phase];
+    }
 }
 
 /**
-* <B> Function: InitPWMGenerator8()    </B>
+* <B> Function: PWM_MotorDutyShiftSet(uint16_t, const uint32_t *, 
+*                                     const uint32_t *) </B>
 *
-* @brief Function to configure PWM Module # 8
+* @brief Function writes the rising edges (PGxPHASE) and falling edges 
+* (PGxDC) of the phase generators of a motor in dual edge center aligned 
+* mode (MODSEL = 6). PGxPHASE is written first, the write of PGxDC requests 
+* the update of both.
 *        
-* @param none.
+* @param motor PWM_MOTOR_T.
+* @param pRise PGxPHASE of phase A, B and C.
+* @param pDuty PGxDC of phase A, B and C.
 * @return none.
 * 
 * @example
-* <CODE> InitPWMGenerator8 ();     </CODE>
+* <CODE> PWM_MotorDutyShiftSet(PWM_MOTOR_MC1, rise, duty); </CODE>
 *
 */
-void InitPWMGenerator8 (void)
+void PWM_MotorDutyShiftSet(uint16_t motor, const uint32_t *pRise, 
+                           const uint32_t *pDuty)
 {
-
-    /* Initialize PWM GENERATOR 8 CONTROL REGISTER */
-    PG8CON      = 0x0000;
-    /* PWM Generator 8 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    PG8CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    PG8CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    PG8CONbits.MODSEL = 6;
-#else
-    PG8CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    PG8CONbits.TRGCNT = 0;
-    
-    /* Initialize PWM GENERATOR 8 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of PG8DC
-       0 = Macro uses the PG8DC register*/
-    PG8CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of PG8PER
-       0 = Macro uses the PG8PER register */
-    PG8CONbits.MPERSEL = 1;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of PG8PHASE
-       0 = Macro uses the PG8PHASE register */
-    PG8CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    PG8CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    PG8CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    PG8CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    PG8CONbits.SOCS = 5;
-    
-    /* Clear PWM GENERATOR 8 STATUS REGISTER*/
-    PG8STAT      = 0x0000;
-    /* Initialize PWM GENERATOR 8 I/O CONTROL REGISTER */
-    PG8IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    PG8IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to PWM8H and PWM8L Device Pins bit 
-       0 = PWM8H/L signals are mapped to their respective pins */
-    PG8IOCON1bits.SWAP = 0;
-    /* User Override Enable for PWM8H Pin bit
-       0 = PWM Generator provides data for the PWM8H pin*/
-    PG8IOCON2bits.OVRENH = 0;
-    /* User Override Enable for PWM8L Pin bit
-       0 = PWM Generator provides data for the PWM8L pin*/
-    PG8IOCON2bits.OVRENL = 0;
-    /* Data for PWM8H/PWM8L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for PWM8H.
-       If OVERENL = 1, then OVRDAT<0> provides data for PWM8L */
-    PG8IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    PG8IOCON2bits.OSYNC = 0;
-    /* Data for PWM8H/PWM8L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for PWM8H.
-       If Fault is active, then FLTDAT<0> provides data for PWM8L.*/
-    PG8IOCON2bits.FLT1DAT = 0;
-    /* Data for PWM8H/PWM8L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for PWM8H.
-       If current limit is active, then CLDAT<0> provides data for PWM8L.*/
-    PG8IOCON2bits.CLDAT = 0;
-    /* Data for PWM8H/PWM8L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for PWM8H.
-       If feed-forward is active, then FFDAT<0> provides data for PWM8L.*/
-    PG8IOCON2bits.FFDAT = 0;
-    /* Data for PWM8H/PWM8L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides PWM8H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides PWM8L data. */
-    PG8IOCON2bits.DBDAT = 0;
-    
-    /* Initialize PWM GENERATOR 8 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    PG8IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    PG8IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    PG8IOCON1bits.PMOD = 0;
-    /* PWM8H Output Port Enable bit
-       1 = PWM Generator controls the PWM8H output pin
-       0 = PWM Generator does not control the PWM8H output pin */
-    PG8IOCON1bits.PENH = 1;
-    /* PWM8L Output Port Enable bit
-       1 = PWM Generator controls the PWM8L output pin
-       0 = PWM Generator does not control the PWM8L output pin */
-    PG8IOCON1bits.PENL = 1;
-    /* PWM8H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG8IOCON1bits.POLH = 0;
-    /* PWM8L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    PG8IOCON1bits.POLL = 0;
-    
-    /* Initialize PWM GENERATOR 8 EVENT REGISTER */
-    PG8EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    PG8EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is PG8TRIGC Compare Event Enable bit
-       0 = PG8TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG8EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is PG8TRIGB Compare Event Enable bit
-       0 = PG8TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    PG8EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is PG8TRIGA Compare Event Enable bit
-       1 = PG8TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    PG8EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the PG8DC register automatically sets the UPDATE bit*/
-    PG8EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    PG8EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize PWM GENERATOR 8 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    PG8EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    PG8EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    PG8EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    PG8EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    PG8EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is PG8TRIGC Compare Event Enable bit
-       0 = PG8TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG8EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is PG8TRIGB Compare Event Enable bit
-       0 = PG8TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG8EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is PG8TRIGA Compare Event Enable bit
-       0 = PG8TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    PG8EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    PG8EVT1bits.ADTR1OFS = 0;
-
-    /* PWM GENERATOR 8 Current Limit PCI REGISTER */
-    PG8CLPCI1    = 0x0000;
-    /* PWM GENERATOR 8 Feed Forward PCI REGISTER  */
-    PG8FFPCI1    = 0x0000;
-    /* PWM GENERATOR 8 Sync PCI REGISTER */
-    PG8SPCI1    = 0x0000;
-    
-    /* Initialize PWM GENERATOR 8 LEADING-EDGE BLANKING REGISTER */
-    PG8LEB      = 0x0000;
-    
-    /* Initialize PWM GENERATOR 8 PHASE REGISTER */
-    PG8PHASE     = MIN_DUTY;
-    /* Initialize PWM GENERATOR 8 DUTY CYCLE REGISTER */
-    PG8DC        = (LOOPTIME_TCY)>>1;
-    /* Initialize PWM GENERATOR 8 DUTY CYCLE ADJUSTMENT REGISTER */
-    PG8DCA       = 0x0000;
-    /* Initialize PWM GENERATOR 8 PERIOD REGISTER */
-    PG8PER       = 0x0000;
-    /* Initialize PWM GENERATOR 8 DEAD-TIME REGISTER */
-    PG8DTbits.DTH = DEADTIME;
-    /* Initialize PWM GENERATOR 8 DEAD-TIME REGISTER */
-    PG8DTbits.DTL = DEADTIME;
-
-    /* Initialize PWM GENERATOR 8 TRIGGER A REGISTER */
-    PG8TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize PWM GENERATOR 8 TRIGGER B REGISTER */
-    PG8TRIGB     = 0x0000;
-    /* Initialize PWM GENERATOR 8 TRIGGER C REGISTER */
-    PG8TRIGC     = 0x0000;
-    
-} 
+    volatile uint32_t *pRegs;
+    uint16_t phase;
+    
+    for (phase = 0; phase < 3; phase++)
+    {
+        pRegs = PWM_GeneratorRegisters(pwmMotorGenerator[motor][phase]);
+        PWM_GENERATOR_REG(pRegs, PWM_REG_PHASE) = pRise[phase];
+        PWM_GENERATOR_REG(pRegs, PWM_REG_DC) = pDuty[phase];
+    }
+}
 
 /**
-* <B> Function: InitAuxPWMGenerator1()    </B>
+* <B> Function: PWM_MotorTriggerSet(uint16_t, uint32_t, uint32_t) </B>
 *
-* @brief Function to configure APWM Module # 1
+* @brief Function writes the ADC trigger compare values of a motor to its 
+* phase B generator, PGxTRIGA for ADC Trigger 1 and PGxTRIGB for ADC 
+* Trigger 2. Write them before the duty cycles, they are updated with them.
 *        
-* @param none.
+* @param motor PWM_MOTOR_T.
+* @param trigA PGxTRIGA.
+* @param trigB PGxTRIGB.
 * @return none.
 * 
 * @example
-* <CODE> InitAuxPWMGenerator1 ();     </CODE>
+* <CODE> PWM_MotorTriggerSet(PWM_MOTOR_MC1, trigger1, trigger2); </CODE>
 *
 */
-void InitAuxPWMGenerator1 (void)
+void PWM_MotorTriggerSet(uint16_t motor, uint32_t trigA, uint32_t trigB)
 {
-
-    /* Initialize APWM GENERATOR 1 CONTROL REGISTER */
-    APG1CON      = 0x0000;
-    /* APWM Generator 1 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring APWM Generator is disabled prior to configuring module */
-    APG1CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    APG1CONbits.CLKSEL = 1;
-    /* APWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    APG1CONbits.MODSEL = 6;
-#else
-    APG1CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    APG1CONbits.TRGCNT = 0;
-    
-    /* Initialize APWM GENERATOR 1 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of APG1DC
-       0 = Macro uses the APG1DC register*/
-    APG1CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of APG1PER
-       0 = Macro uses the APG1PER register */
-    APG1CONbits.MPERSEL = 0;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of APG1PHASE
-       0 = Macro uses the APG1PHASE register */
-    APG1CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    APG1CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    APG1CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    APG1CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    APG1CONbits.SOCS = 0xF;
-    
-    /* Clear APWM GENERATOR 1 STATUS REGISTER*/
-    APG1STAT      = 0x0000;
-    /* Initialize APWM GENERATOR 1 I/O CONTROL REGISTER */
-    APG1IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    APG1IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to APWM1H and APWM1L Device Pins bit 
-       0 = APW1H/L signals are mapped to their respective pins */
-    APG1IOCON1bits.SWAP = 0;
-    /* User Override Enable for APW1H Pin bit
-       0 = PWM Generator provides data for the APW1H pin*/
-    APG1IOCON2bits.OVRENH = 0;
-    /* User Override Enable for APW1L Pin bit
-       0 = PWM Generator provides data for the APW1L pin*/
-    APG1IOCON2bits.OVRENL = 0;
-    /* Data for APW1H/APW1L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for APW1H.
-       If OVERENL = 1, then OVRDAT<0> provides data for APW1L */
-    APG1IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    APG1IOCON2bits.OSYNC = 0;
-    /* Data for APW1H/APW1L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for APW1H.
-       If Fault is active, then FLTDAT<0> provides data for APW1L.*/
-    APG1IOCON2bits.FLT1DAT = 0;
-    /* Data for APW1H/APW1L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for APW1H.
-       If current limit is active, then CLDAT<0> provides data for APW1L.*/
-    APG1IOCON2bits.CLDAT = 0;
-    /* Data for APW1H/APW1L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for APW1H.
-       If feed-forward is active, then FFDAT<0> provides data for APW1L.*/
-    APG1IOCON2bits.FFDAT = 0;
-    /* Data for APW1H/APW1L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides APW1H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides APW1L data. */
-    APG1IOCON2bits.DBDAT = 0;
+    volatile uint32_t *pRegs = 
+        PWM_GeneratorRegisters(pwmMotorGenerator[motor][1]);
     
-    /* Initialize APWM GENERATOR 1 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    APG1IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    APG1IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    APG1IOCON1bits.PMOD = 0;
-    /* APW1H Output Port Enable bit
-       1 = PWM Generator controls the APW1H output pin
-       0 = PWM Generator does not control the APW1H output pin */
-    APG1IOCON1bits.PENH = 1;
-    /* APW1L Output Port Enable bit
-       1 = PWM Generator controls the APW1L output pin
-       0 = APWM Generator does not control the PWM1L output pin */
-    APG1IOCON1bits.PENL = 1;
-    /* APW1H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    APG1IOCON1bits.POLH = 0;
-    /* APW1L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    APG1IOCON1bits.POLL = 0;
-    
-    /* Initialize APWM GENERATOR 1 EVENT REGISTER */
-    APG1EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    APG1EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is APG1TRIGC Compare Event Enable bit
-       0 = APG1TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    APG1EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is APG1TRIGB Compare Event Enable bit
-       0 = APG1TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    APG1EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is APG1TRIGA Compare Event Enable bit
-       1 = APG1TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    APG1EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the APG1DC register automatically sets the UPDATE bit*/
-    APG1EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    APG1EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize APWM GENERATOR 1 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    APG1EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    APG1EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    APG1EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    APG1EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    APG1EVT1bits.IEVTSEL = 3;
-
-        /* ADC Trigger 2 Source is APG1TRIGC Compare Event Enable bit
-       0 = APG1TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG1EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is APG1TRIGB Compare Event Enable bit
-       0 = APG1TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG1EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is APG1TRIGA Compare Event Enable bit
-       0 = APG1TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG1EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    APG1EVT1bits.ADTR1OFS = 0;
-
-    /* APWM GENERATOR 1 Current Limit PCI REGISTER */
-    APG1CLPCI1    = 0x0000;
-    /* APWM GENERATOR 1 Feed Forward PCI REGISTER  */
-    APG1FFPCI1    = 0x0000;
-    /* APWM GENERATOR 1 Sync PCI REGISTER */
-    APG1SPCI1    = 0x0000;
-    
-    /* Initialize APWM GENERATOR 1 LEADING-EDGE BLANKING REGISTER */
-    APG1LEB      = 0x0000;
-    
-    APG1EVT1bits.PWMPCI  = 3;
-    APG1SPCI1bits.PPS = 1 ;
-
-    
-    APG1SPCI2 = 8388608;
-    
-    /* Initialize APWM GENERATOR 1 PHASE REGISTER */
-    APG1PHASE     = MIN_DUTY;
-    /* Initialize APWM GENERATOR 1 DUTY CYCLE REGISTER */
-    APG1DC        = AUX_PWM_LOOPTIME_TCY>>1;
-    /* Initialize APWM GENERATOR 1 DUTY CYCLE ADJUSTMENT REGISTER */
-    APG1DCA       = 0x0000;
-    /* Initialize APWM GENERATOR 1 PERIOD REGISTER */
-    APG1PER       = AUX_PWM_LOOPTIME_TCY;
-    /* Initialize APWM GENERATOR 1 DEAD-TIME REGISTER */
-    APG1DTbits.DTH = DEADTIME;
-    /* Initialize APWM GENERATOR 1 DEAD-TIME REGISTER */
-    APG1DTbits.DTL = DEADTIME;
-
-    /* Initialize APWM GENERATOR 1 TRIGGER A REGISTER */
-    APG1TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize APWM GENERATOR 1 TRIGGER B REGISTER */
-    APG1TRIGB     = 0x0000;
-    /* Initialize APWM GENERATOR 1 TRIGGER C REGISTER */
-    APG1TRIGC     = 0x0000;
-    
-} 
+    PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGA) = trigA;
+    PWM_GENERATOR_REG(pRegs, PWM_REG_TRIGB) = trigB;
+}
 
 /**
-* <B> Function: InitAuxPWMGenerator2()    </B>
+* <B> Function: PWM_MotorCurrentTriggerSet(uint16_t, uint32_t) </B>
 *
-* @brief Function to configure APWM Module # 2
+* @brief Function writes the ADC trigger compare value of the phase current
+* and voltage samples of a motor, PGxTRIGA of its phase A generator. Write 
+* it before the duty cycles, it is updated with them.
 *        
-* @param none.
+* @param motor PWM_MOTOR_T.
+* @param trigA PGxTRIGA.
 * @return none.
 * 
 * @example
-* <CODE> InitAuxPWMGenerator2 ();     </CODE>
+* <CODE> PWM_MotorCurrentTriggerSet(PWM_MOTOR_MC1, trigger); </CODE>
 *
 */
-void InitAuxPWMGenerator2 (void)
+void PWM_MotorCurrentTriggerSet(uint16_t motor, uint32_t trigA)
 {
-
-    /* Initialize APWM GENERATOR 2 CONTROL REGISTER */
-    APG2CON      = 0x0000;
-    /* APWM Generator 2 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    APG2CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    APG2CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    APG2CONbits.MODSEL = 6;
-#else
-    APG2CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = PWM Generator produces 1 PWM cycle after triggered */
-    APG2CONbits.TRGCNT = 0;
-    
-    /* Initialize APWM GENERATOR 2 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of APG2DC
-       0 = Macro uses the APG2DC register*/
-    APG2CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of APG2PER
-       0 = Macro uses the APG2PER register */
-    APG2CONbits.MPERSEL = 0;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of APG2PHASE
-       0 = Macro uses the APG2PHASE register */
-    APG2CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    APG2CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    APG2CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    APG2CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    APG2CONbits.SOCS = 0xF;
-    
-    /* Clear APWM GENERATOR 2 STATUS REGISTER*/
-    APG2STAT      = 0x0000;
-    /* Initialize APWM GENERATOR 2 I/O CONTROL REGISTER */
-    APG2IOCON2    = 0x0000;
-
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the APWM output levels */
-    APG2IOCON2bits.CLMOD = 0;
-    /* Swap APWM Signals to APWM2H and APWM2L Device Pins bit 
-       0 = APWM2H/L signals are mapped to their respective pins */
-    APG2IOCON1bits.SWAP = 0;
-    /* User Override Enable for APWM2H Pin bit
-       0 = PWM Generator provides data for the APWM2H pin*/
-    APG2IOCON2bits.OVRENH = 0;
-    /* User Override Enable for APWM2L Pin bit
-       0 = PWM Generator provides data for the APWM2L pin*/
-    APG2IOCON2bits.OVRENL = 0;
-    /* Data for APWM2H/APWM2L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for APWM2H.
-       If OVERENL = 1, then OVRDAT<0> provides data for APWM2L */
-    APG2IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    APG2IOCON2bits.OSYNC = 0;
-    /* Data for APWM2H/APWM2L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for APWM2H.
-       If Fault is active, then FLTDAT<0> provides data for APWM2L.*/
-    APG2IOCON2bits.FLT1DAT = 0;
-    /* Data for APWM2H/APWM2L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for APWM2H.
-       If current limit is active, then CLDAT<0> provides data for APWM2L.*/
-    APG2IOCON2bits.CLDAT = 0;
-    /* Data for APWM2H/APWM2L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for APWM2H.
-       If feed-forward is active, then FFDAT<0> provides data for APWM2L.*/
-    APG2IOCON2bits.FFDAT = 0;
-    /* Data for APWM2H/APWM2L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides APWM2H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides APWM2L data. */
-    APG2IOCON2bits.DBDAT = 0;
-    
-    /* Initialize APWM GENERATOR 2 I/O CONTROL REGISTER */    
-
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    APG2IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    APG2IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    APG2IOCON1bits.PMOD = 0;
-    /* APWM2H Output Port Enable bit
-       1 = PWM Generator controls the APWM2H output pin
-       0 = PWM Generator does not control the APWM2H output pin */
-    APG2IOCON1bits.PENH = 1;
-    /* APWM2L Output Port Enable bit
-       1 = PWM Generator controls the APWM2L output pin
-       0 = PWM Generator does not control the APWM2L output pin */
-    APG2IOCON1bits.PENL = 1;
-    /* APWM1H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    APG2IOCON1bits.POLH = 0;
-    /* APWM1L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    APG2IOCON1bits.POLL = 0;
-    
-    /* Initialize APWM GENERATOR 2 EVENT REGISTER */
-    APG2EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    APG2EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is APG2TRIGC Compare Event Enable bit
-       0 = APG2TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    APG2EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is APG2TRIGB Compare Event Enable bit
-       0 = APG2TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    APG2EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is APG2TRIGA Compare Event Enable bit
-       1 = APG2TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    APG2EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the APG2DC register automatically sets the UPDATE bit*/
-    APG2EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    APG2EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize APWM GENERATOR 2 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    APG2EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    APG2EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    APG2EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    APG2EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    APG2EVT1bits.IEVTSEL = 3;
-
-    /* ADC Trigger 2 Source is APG2TRIGC Compare Event Enable bit
-       0 = APG2TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG2EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is APG2TRIGB Compare Event Enable bit
-       0 = APG2TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG2EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is APG2TRIGA Compare Event Enable bit
-       0 = APG2TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG2EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    APG2EVT1bits.ADTR1OFS = 0;
-
-    /* APWM GENERATOR 2 Current Limit PCI REGISTER */
-    APG2CLPCI1    = 0x0000;
-    /* APWM GENERATOR 2 Feed Forward PCI REGISTER  */
-    APG2FFPCI1    = 0x0000;
-    /* APWM GENERATOR 2 Sync PCI REGISTER */
-    APG2SPCI1    = 0x0000;
-    
-    /* Initialize APWM GENERATOR 2 LEADING-EDGE BLANKING REGISTER */
-    APG2LEB      = 0x0000;
-    
-    APG2EVT1bits.PWMPCI  = 3;
-    APG2SPCI1bits.PPS = 1 ;
-    
-    APG2SPCI2 = 8388608;
-    
-    /* Initialize APWM GENERATOR 2 PHASE REGISTER */
-    APG2PHASE     = MIN_DUTY;
-    /* Initialize APWM GENERATOR 2 DUTY CYCLE REGISTER */
-    APG2DC        = AUX_PWM_LOOPTIME_TCY>>1;
-    /* Initialize APWM GENERATOR 2 DUTY CYCLE ADJUSTMENT REGISTER */
-    APG2DCA       = 0x0000;
-    /* Initialize APWM GENERATOR 2 PERIOD REGISTER */
-    APG2PER       = AUX_PWM_LOOPTIME_TCY;
-    /* Initialize APWM GENERATOR 2 DEAD-TIME REGISTER */
-    APG2DTbits.DTH = DEADTIME;
-    /* Initialize APWM GENERATOR 2 DEAD-TIME REGISTER */
-    APG2DTbits.DTL = DEADTIME;
-
-    /* Initialize APWM GENERATOR 2 TRIGGER A REGISTER */
-    APG2TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize APWM GENERATOR 2 TRIGGER B REGISTER */
-    APG2TRIGB     = 0x0000;
-    /* Initialize APWM GENERATOR 2 TRIGGER C REGISTER */
-    APG2TRIGC     = 0x0000;
-    
-} 
+    PWM_GENERATOR_REG(PWM_GeneratorRegisters(
+        pwmMotorGenerator[motor][0]), PWM_REG_TRIGA) = trigA;
+}
 
 /**
-* <B> Function: InitAuxPWMGenerator3()    </B>
+* <B> Function: PWM_MotorVoltageTriggerSet(uint16_t, uint16_t) </B>
 *
-* @brief Function to configure APWM Module # 3
+* @brief Function sets the ADC Trigger 1 postscaler of the phase C generator
+* of a motor, which triggers its phase voltage samples on PGxTRIGA once 
+* every factor PWM cycles. The factor is limited to 1 up to 
+* PWM_VOLTAGE_FACTOR_MAX.
 *        
-* @param none.
-* @return none.
+* @param motor PWM_MOTOR_T.
+* @param factor PWM cycles per phase voltage sample.
+* @return factor applied.
 * 
 * @example
-* <CODE> InitAuxPWMGenerator3 ();     </CODE>
+* <CODE> factor = PWM_MotorVoltageTriggerSet(PWM_MOTOR_MC1, 4); </CODE>
 *
 */
-void InitAuxPWMGenerator3 (void)
+uint16_t PWM_MotorVoltageTriggerSet(uint16_t motor, uint16_t factor)
 {
+    volatile uint32_t *pRegs = 
+        PWM_GeneratorRegisters(pwmMotorGenerator[motor][2]);
+    uint32_t evt1 = PWM_GENERATOR_REG(pRegs, PWM_REG_EVT1);
+    
+    if (factor < 1)
+    {
+        factor = 1;
+    }
+    else if (factor > PWM_VOLTAGE_FACTOR_MAX)
+    {
+        factor = PWM_VOLTAGE_FACTOR_MAX;
+    }
+    evt1 &= ~PWM_FIELD(EVT1, ADTR1PS, SFR_FIELD_MAX(PG1EVT1, ADTR1PS));
+    PWM_GENERATOR_REG(pRegs, PWM_REG_EVT1) = 
+        evt1 | PWM_FIELD_VAR(EVT1, ADTR1PS, factor - 1);
+    return factor;
+}
 
-    /* Initialize APWM GENERATOR 3 CONTROL REGISTER */
-    APG3CON      = 0x0000;
-    /* APWM Generator 1 Enable bit : 1 = Is enabled, 0 = Is not enabled */
-    /* Ensuring PWM Generator is disabled prior to configuring module */
-    APG3CONbits.ON = 0;
-    /* Clock Selection bits
-       0b01 = Macro uses Master clock selected by the PCLKCON.MCLKSEL bits*/
-    APG3CONbits.CLKSEL = 1;
-    /* PWM Mode Selection bits
-     * 110 = Dual Edge Center-Aligned PWM mode (interrupt/register update once per cycle)
-       100 = Center-Aligned PWM mode(interrupt/register update once per cycle)*/
-#ifdef SINGLE_SHUNT
-    APG3CONbits.MODSEL = 6;
-#else
-    APG3CONbits.MODSEL = 4;
-#endif 
-    /* Trigger Count Select bits
-       000 = APWM Generator produces 1 PWM cycle after triggered */
-    APG3CONbits.TRGCNT = 0;
-    
-    /* Initialize APWM GENERATOR 3 CONTROL REGISTER */
-    /* Master Duty Cycle Register Select bit
-       1 = Macro uses the MDC register instead of APG3DC
-       0 = Macro uses the APG3DC register*/
-    APG3CONbits.MDCSEL = 0;
-    /* Master Period Register Select bit
-       1 = Macro uses the MPER register instead of APG3PER
-       0 = Macro uses the APG3PER register */
-    APG3CONbits.MPERSEL = 0;
-    /* MPHSEL: Master Phase Register Select bit
-       1 = Macro uses the MPHASE register instead of APG3PHASE
-       0 = Macro uses the APG3PHASE register */
-    APG3CONbits.MPHSEL = 0;
-    /* Master Update Enable bit
-       1 = PWM Generator broadcasts software set/clear of UPDATE status bit and 
-           EOC signal to other PWM Generators
-       0 = PWM Generator does not broadcast UPDATE status bit or EOC signal */
-    APG3CONbits.MSTEN = 0;
-    /* PWM Buffer Update Mode Selection bits 
-       Update Data registers at start of next PWM cycle if UPDATE = 1. */
-    APG3CONbits.UPDMOD = 0;
-    /* PWM Generator Trigger Mode Selection bits
-       0b00 = PWM Generator operates in Single Trigger mode */
-    APG3CONbits.TRGMOD = 1;
-    /* Start of Cycle Selection bits
-       0000 = Local EOC*/
-    APG3CONbits.SOCS = 0xF;
-    
-    /* Clear APWM GENERATOR 3 STATUS REGISTER*/
-    APG3STAT      = 0x0000;
-    /* Initialize APWM GENERATOR 3 I/O CONTROL REGISTER */
-    APG3IOCON2    = 0x0000;
+/**
+* <B> Function: PWM_MotorRegisters(uint16_t, uint16_t) </B>
+*
+* @brief Function returns the register block of a phase generator of a 
+* motor, for callers that write its registers every cycle.
+*        
+* @param motor PWM_MOTOR_T.
+* @param phase 0, 1 or 2 for phase A, B or C.
+* @return PGxCON register, index it with PWM_GENERATOR_REG().
+* 
+* @example
+* <CODE> pRegs = PWM_MotorRegisters(PWM_MOTOR_MC1, 0); </CODE>
+*
+*/
+volatile uint32_t *PWM_MotorRegisters(uint16_t motor, uint16_t phase)
+{
+    return PWM_GeneratorRegisters(pwmMotorGenerator[motor][phase]);
+}
 
-    /* Current Limit Mode Select bit
-       0 = If PCI current limit is active, then the CLDAT<1:0> bits define 
-       the PWM output levels */
-    APG3IOCON2bits.CLMOD = 0;
-    /* Swap PWM Signals to APWM1H and APWM1L Device Pins bit 
-       0 = APWM1H/L signals are mapped to their respective pins */
-    APG3IOCON1bits.SWAP = 0;
-    /* User Override Enable for APWM1H Pin bit
-       0 = PWM Generator provides data for the APWM1H pin*/
-    APG3IOCON2bits.OVRENH = 0;
-    /* User Override Enable for APWM1L Pin bit
-       0 = PWM Generator provides data for the APWM1L pin*/
-    APG3IOCON2bits.OVRENL = 0;
-    /* Data for APWM1H/APWM1L Pins if Override is Enabled bits
-       If OVERENH = 1, then OVRDAT<1> provides data for APWM1H.
-       If OVERENL = 1, then OVRDAT<0> provides data for APWM1L */
-    APG3IOCON2bits.OVRDAT = 0;
-    /* User Output Override Synchronization Control bits
-       00 = User output overrides via the OVRENL/H and OVRDAT<1:0> bits are 
-       synchronized to the local PWM time base (next start of cycle)*/
-    APG3IOCON2bits.OSYNC = 0;
-    /* Data for APWM1H/APWM1L Pins if FLT Event is Active bits
-       If Fault is active, then FLTDAT<1> provides data for APWM1H.
-       If Fault is active, then FLTDAT<0> provides data for APWM1L.*/
-    APG3IOCON2bits.FLT1DAT = 0;
-    /* Data for APWM1H/APWM1L Pins if CLMT Event is Active bits
-       If current limit is active, then CLDAT<1> provides data for APWM1H.
-       If current limit is active, then CLDAT<0> provides data for APWM1L.*/
-    APG3IOCON2bits.CLDAT = 0;
-    /* Data for APWM1H/APWM1L Pins if Feed-Forward Event is Active bits
-       If feed-forward is active, then FFDAT<1> provides data for APWM1H.
-       If feed-forward is active, then FFDAT<0> provides data for APWM1L.*/
-    APG3IOCON2bits.FFDAT = 0;
-    /* Data for APWM1H/APWM1L Pins if Debug Mode is Active and PTFRZ = 1 bits
-       If Debug mode is active and PTFRZ=1,then DBDAT<1> provides APWM1H data.
-       If Debug mode is active and PTFRZ=1,then DBDAT<0> provides APWM1L data. */
-    APG3IOCON2bits.DBDAT = 0;
-    
-    /* Initialize APWM GENERATOR 3 I/O CONTROL REGISTER */    
+/**
+* <B> Function: PWM_MotorPeriod(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the period register value of the generators of a
+* motor, the duty cycle of 100% in center aligned mode.
+*        
+* @param pTiming PWM timing.
+* @param motor PWM_MOTOR_T.
+* @return PGxPER or MPER in register counts of the motor.
+* 
+* @example
+* <CODE> period = PWM_MotorPeriod(&pwmTiming, PWM_MOTOR_MC2); </CODE>
+*
+*/
+uint32_t PWM_MotorPeriod(const PWM_TIMING_T *pTiming, uint16_t motor)
+{
+    return (pwmMotorGenerator[motor][0] >= PWM_GENERATOR_APG1) ? 
+                pTiming->auxLoopTimeTcy : pTiming->loopTimeTcy;
+}
 
-    /* Time Base Capture Source Selection bits
-       000 = No hardware source selected for time base capture ? software only*/
-    APG3IOCON1bits.CAPSRC = 0;
-    /* Dead-Time Compensation Select bit 
-       0 = Dead-time compensation is controlled by PCI Sync logic */
-    APG3IOCON1bits.DTCMPSEL = 0;
-    /* PWM Generator Output Mode Selection bits
-       00 = PWM Generator outputs operate in Complementary mode*/
-    APG3IOCON1bits.PMOD = 0;
-    /* APWM1H Output Port Enable bit
-       1 = PWM Generator controls the APWM1H output pin
-       0 = PWM Generator does not control the APWM1H output pin */
-    APG3IOCON1bits.PENH = 1;
-    /* APWM1L Output Port Enable bit
-       1 = PWM Generator controls the APWM1L output pin
-       0 = PWM Generator does not control the APWM1L output pin */
-    APG3IOCON1bits.PENL = 1;
-    /* APWM1H Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    APG3IOCON1bits.POLH = 0;
-    /* APWM1L Output Polarity bit
-       1 = Output pin is active-low
-       0 = Output pin is active-high*/
-    APG3IOCON1bits.POLL = 0;
-    
-    /* Initialize APWM GENERATOR 3 EVENT REGISTER */
-    APG3EVT1      = 0x0000;
-    /* ADC Trigger 1 Post-scaler Selection bits
-       00000 = 1:1 */
-    APG3EVT1bits.ADTR1PS = 0;
-    /* ADC Trigger 1 Source is APG3TRIGC Compare Event Enable bit
-       0 = APG3TRIGC register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    APG3EVT1bits.ADTR1EN3  = 0;
-    /* ADC Trigger 1 Source is APG3TRIGB Compare Event Enable bit
-       0 = APG3TRIGB register compare event is disabled as trigger source for 
-           ADC Trigger 1 */
-    APG3EVT1bits.ADTR1EN2 = 0;    
-    /* ADC Trigger 1 Source is APG3TRIGA Compare Event Enable bit
-       1 = APG3TRIGA register compare event is enabled as trigger source for 
-           ADC Trigger 1 */
-    APG3EVT1bits.ADTR1EN1 = 1;
-    /* Update Trigger Select bits
-       01 = A write of the APG3DC register automatically sets the UPDATE bit*/
-    APG3EVT1bits.UPDTRG = 1;
-    /* PWM Generator Trigger Output Selection bits
-       000 = EOC event is the PWM Generator trigger*/
-    APG3EVT1bits.PGTRGSEL = 0;
-    
-    /* Initialize APWM GENERATOR 3 EVENT REGISTER */
-    /* FLTIEN: PCI Fault Interrupt Enable bit
-       1 = Fault interrupt is enabled */
-    APG3EVT1bits.FLT1IEN = 1;
-    /* PCI Current Limit Interrupt Enable bit
-       0 = Current limit interrupt is disabled */
-    APG3EVT1bits.CLIEN = 0;
-    /* PCI Feed-Forward Interrupt Enable bit
-       0 = Feed-forward interrupt is disabled */
-    APG3EVT1bits.FFIEN = 0;
-    /* PCI Sync Interrupt Enable bit
-       0 = Sync interrupt is disabled */
-    APG3EVT1bits.SIEN = 0;
-    /* Interrupt Event Selection bits
-       00 = Interrupts CPU at EOC
-       01 = Interrupts CPU at TRIGA compare event
-       10 = Interrupts CPU at ADC Trigger 1 event
-       11 = Time base interrupts are disabled */
-    APG3EVT1bits.IEVTSEL = 3;
+/**
+* <B> Function: PWM_MotorTicksPerCount(uint16_t) </B>
+*
+* @brief Function returns the time resolution of the phase, duty cycle and
+* trigger registers of the generators of a motor.
+*        
+* @param motor PWM_MOTOR_T.
+* @return ticks of 1/16 PWM clock per register count.
+* 
+* @example
+* <CODE> scale = PWM_MotorTicksPerCount(PWM_MOTOR_MC2); </CODE>
+*
+*/
+uint16_t PWM_MotorTicksPerCount(uint16_t motor)
+{
+    return (pwmMotorGenerator[motor][0] >= PWM_GENERATOR_APG1) ? 
+                PWM_AUX_TICKS_PER_COUNT : PWM_TICKS_PER_COUNT;
+}
 
-        /* ADC Trigger 2 Source is APG3TRIGC Compare Event Enable bit
-       0 = APG3TRIGC register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG3EVT2bits.ADTR2EN3 = 0;
-    /* ADC Trigger 2 Source is APG3TRIGB Compare Event Enable bit
-       0 = APG3TRIGB register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG3EVT2bits.ADTR2EN2 = 0;
-    /* ADC Trigger 2 Source is APG3TRIGA Compare Event Enable bit
-       0 = APG3TRIGA register compare event is disabled as 
-           trigger source for ADC Trigger 2 */
-    APG3EVT2bits.ADTR2EN1 = 0;
-    /* ADC Trigger 1 Offset Selection bits
-       00000 = No offset */
-    APG3EVT1bits.ADTR1OFS = 0;
-    
-    /* APWM GENERATOR 3 Current Limit PCI REGISTER */
-    APG3CLPCI1    = 0x0000;
-    /* APWM GENERATOR 3 Feed Forward PCI REGISTER  */
-    APG3FFPCI1    = 0x0000;
-    /* APWM GENERATOR 3 Sync PCI REGISTER */
-    APG3SPCI1    = 0x0000;
-    
-    /* Initialize APWM GENERATOR 3 LEADING-EDGE BLANKING REGISTER */
-    APG3LEB      = 0x0000;
-    
-    APG3EVT1bits.PWMPCI  = 3;
-    APG3SPCI1bits.PPS = 1 ;
-    
-    APG3SPCI2 = 8388608;
-    
-    /* Initialize APWM GENERATOR 3 PHASE REGISTER */
-    APG3PHASE     = MIN_DUTY;
-    /* Initialize APWM GENERATOR 3 DUTY CYCLE REGISTER */
-    APG3DC        = AUX_PWM_LOOPTIME_TCY>>1;
-    /* Initialize APWM GENERATOR 3 DUTY CYCLE ADJUSTMENT REGISTER */
-    APG3DCA       = 0x0000;
-    /* Initialize APWM GENERATOR 3 PERIOD REGISTER */
-    APG3PER       = AUX_PWM_LOOPTIME_TCY;
-    /* Initialize APWM GENERATOR 3 DEAD-TIME REGISTER */
-    APG3DTbits.DTH = DEADTIME;
-    /* Initialize APWM GENERATOR 3 DEAD-TIME REGISTER */
-    APG3DTbits.DTL = DEADTIME;
+/**
+* <B> Function: PWM_MotorSocOffset(const PWM_TIMING_T *, uint16_t) </B>
+*
+* @brief Function returns the start of cycle of the generators of a motor 
+* after the start of cycle of the master PG5: its sync edge delayed by 
+* PGxPHASE in center aligned mode. In dual edge mode PGxPHASE is the rising
+* edge and adds no delay.
+*        
+* @param pTiming PWM timing.
+* @param motor PWM_MOTOR_T.
+* @return offset in ticks of 1/16 PWM clock, less than the PWM cycle.
+* 
+* @example
+* <CODE> offset = PWM_MotorSocOffset(&pwmTiming, PWM_MOTOR_MC1); </CODE>
+*
+*/
+uint32_t PWM_MotorSocOffset(const PWM_TIMING_T *pTiming, uint16_t motor)
+{
+    uint32_t period = 2 * (pTiming->loopTimeTcy + PWM_TICKS_PER_CLOCK);
+    uint32_t offset = PWM_MotorSyncEdge(pTiming, motor);
+    uint16_t scale = PWM_MotorTicksPerCount(motor);
+    
+    if (PWM_MOTOR_MODSEL != 6)
+    {
+        /* PGxPHASE resolution of the motor */
+        offset += (PWM_MotorSocDelay(pTiming, motor) / scale) * scale;
+    }
+    return (offset >= period) ? (offset - period) : offset;
+}
 
-    /* Initialize APWM GENERATOR 3 TRIGGER A REGISTER */
-    APG3TRIGA     = ADC_SAMPLING_POINT;
-    /* Initialize APWM GENERATOR 3 TRIGGER B REGISTER */
-    APG3TRIGB     = 0x0000;
-    /* Initialize APWM GENERATOR 3 TRIGGER C REGISTER */
-    APG3TRIGC     = 0x0000;
-    
-} 
 // </editor-fold>
\ No newline at end of file
@@ -87,26 +87,179 @@
 
 #define MIN_DUTY            (uint32_t)(DEADTIME)
 #define MAX_DUTY            LOOPTIME_TCY - (uint32_t)(DEADTIME)
-// </editor-fold>      
+        
+/* PWM switching frequency range accepted at runtime by PWM_SetTiming().
+   The limits keep PGxPER within 20 bits and the duty cycle range positive */
+#define PWMFREQUENCY_MIN_HZ                 4000
+#define PWMFREQUENCY_MAX_HZ                 40000
+/* Polls of PGxSTAT.UPDATE before PWM_TimingApply() gives up. A poll takes
+   at least one 200 MHz instruction cycle, the bound lasts two PWM periods 
+   at PWMFREQUENCY_MIN_HZ or longer */
+#define PWM_UPDATE_TIMEOUT_POLLS            (2UL*200000000UL/PWMFREQUENCY_MIN_HZ)
+/* Dead time range accepted at runtime, PGxDT.DTH/DTL are 14-bit registers */
+#define DEADTIME_MIN_MICROSEC               0.0f
+#define DEADTIME_MAX_MICROSEC               2.5f
 
-// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+/* Start of cycle of the motors in degrees of the PWM cycle (interleaving).
+   The switching of the three bridges is spread over the cycle, which lowers
+   the RMS ripple current of the shared DC link. The offsets are relative,
+   all motors run from the same start of cycle with 0/0/0 */
+#define PWM_INTERLEAVE_MC1_DEG              120
+#define PWM_INTERLEAVE_MC2_DEG              240
+#define PWM_INTERLEAVE_MC3_DEG              0
+
+/* Time resolution of the generator registers in ticks of 1/16 PWM clock:
+   PGx registers count 1/16 PWM clock, APGx registers 1/4 PWM clock */
+#define PWM_TICKS_PER_CLOCK                 16
+#define PWM_TICKS_PER_COUNT                 1
+#define PWM_AUX_TICKS_PER_COUNT             4
+
+/* Largest decimation of the phase voltage samples in PWM cycles, the
+   ADC Trigger 1 postscaler PGxEVT1.ADTR1PS counts up to 32 triggers */
+#define PWM_VOLTAGE_FACTOR_MAX              32
+
+/* Number of PWM generators configured by InitPWMGenerators() */
+#define PWM_GENERATOR_COUNT                 10
         
-void InitPWMGenerators(void);  
-void InitPWMGenerator1 (void);
-void InitPWMGenerator2 (void);
-void InitPWMGenerator3 (void);
+/* Register offsets in a PWM generator block, PGxCON to PGxCAP are 
+   consecutive 32-bit registers */
+#define PWM_REG_CON         0
+#define PWM_REG_STAT        1
+#define PWM_REG_IOCON1      2
+#define PWM_REG_IOCON2      3
+#define PWM_REG_EVT1        4
+#define PWM_REG_EVT2        5
+#define PWM_REG_FPCI1       6
+#define PWM_REG_FPCI2       7
+#define PWM_REG_CLPCI1      8
+#define PWM_REG_CLPCI2      9
+#define PWM_REG_FFPCI1      10
+#define PWM_REG_FFPCI2      11
+#define PWM_REG_SPCI1       12
+#define PWM_REG_SPCI2       13
+#define PWM_REG_LEB         14
+#define PWM_REG_PHASE       15
+#define PWM_REG_DC          16
+#define PWM_REG_DCA         17
+#define PWM_REG_PER         18
+#define PWM_REG_TRIGA       19
+#define PWM_REG_TRIGB       20
+#define PWM_REG_TRIGC       21
+#define PWM_REG_DT          22
+#define PWM_REG_CAP         23
+
+#ifndef PWM_GENERATOR_REG
+#define PWM_GENERATOR_REG(pBase, reg)   (pBase)[reg]
+#endif
+// </editor-fold>      
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef enum
+{
+    PWM_GENERATOR_PG1 = 0,
+    PWM_GENERATOR_PG2,
+    PWM_GENERATOR_PG3,
+    PWM_GENERATOR_PG4,
+    PWM_GENERATOR_PG5,
+    PWM_GENERATOR_PG6,
+    PWM_GENERATOR_PG7,
+    PWM_GENERATOR_PG8,
+    PWM_GENERATOR_APG1,
+    PWM_GENERATOR_APG2,
+    PWM_GENERATOR_APG3
+} PWM_GENERATOR_T;
 
-void InitPWMGenerator5 (void);
+/* Motors and their phase generators, in the order of ADC_MOTOR_T */
+typedef enum
+{
+    PWM_MOTOR_MC1 = 0,      /* PG1-PG3 */
+    PWM_MOTOR_MC2,          /* APG1-APG3 */
+    PWM_MOTOR_MC3,          /* PG6-PG8 */
+    PWM_MOTOR_COUNT
+} PWM_MOTOR_T;
 
-void InitPWMGenerator6 (void);
-void InitPWMGenerator7 (void);
-void InitPWMGenerator8 (void);
+/* Source of the period and duty cycle of a generator, taken from pwmTiming */
+typedef enum
+{
+    PWM_VALUE_ZERO = 0,
+    PWM_VALUE_LOOPTIME,             /* loopTimeTcy */
+    PWM_VALUE_LOOPTIME_HALF,        /* loopTimeTcy/2 */
+    PWM_VALUE_LOOPTIME_THIRD,       /* loopTimeTcy/3 */
+    PWM_VALUE_AUX_LOOPTIME,         /* auxLoopTimeTcy */
+    PWM_VALUE_AUX_LOOPTIME_HALF,    /* auxLoopTimeTcy/2 */
+    PWM_VALUE_MOTOR_DUTY            /* loopTimeTcy/2 at initialization, then 
+                                       written by the control loop */
+} PWM_VALUE_T;
+
+/* Per generator settings, every other bit is common to all generators. The
+   register words are composed at compile time by PWM_GENERATOR_CONFIG() */
+typedef struct
+{
+    uint8_t
+        generator,          /* PWM_GENERATOR_T */
+        period,             /* PWM_VALUE_T of PGxPER */
+        duty;               /* PWM_VALUE_T of PGxDC */
+    
+    uint32_t
+        con,                /* PGxCON, ON = 0 */
+        iocon1,             /* PGxIOCON1 */
+        evt1,               /* PGxEVT1 */
+        spci1,              /* PGxSPCI1 */
+        spci2,              /* PGxSPCI2 */
+        evt2;               /* PGxEVT2 */
+    
+} PWM_GENERATOR_CONFIG_T;
+
+typedef struct
+{
+    uint32_t
+        frequencyHz,        /* PWM switching frequency in Hertz */
+        loopTimeTcy,        /* MPER, PG5PER, PG6PER-PG8PER */
+        auxLoopTimeTcy,     /* APG1PER-APG3PER */
+        deadtime,           /* PGxDT.DTH and PGxDT.DTL */
+        minDuty,            /* Duty cycle limits of the motor generators */
+        maxDuty;
+    
+    float
+        deadtimeMicrosec;   /* Dead time in micro seconds */
+    
+    uint16_t
+        interleaveDeg[PWM_MOTOR_COUNT]; /* Start of cycle of the motors, 
+                                           degrees of the PWM cycle */
+    
+} PWM_TIMING_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="VARIABLES ">
+
+/* Timing applied to the PWM generators, updated by PWM_SetTiming() */
+extern PWM_TIMING_T pwmTiming;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+        
+void InitPWMGenerators(void);
+void PWM_ConfigureGenerators(void);
+void PWM_EnableGenerators(void);
+void InitPWMGenerator(const PWM_GENERATOR_CONFIG_T *);
 
-void InitAuxPWMGenerator1 (void);
-void InitAuxPWMGenerator2 (void);
-void InitAuxPWMGenerator3 (void);
+uint16_t PWM_TimingCalculate(PWM_TIMING_T *, uint32_t, float);
+uint16_t PWM_TimingApply(const PWM_TIMING_T *);
+uint16_t PWM_SetTiming(uint32_t, float);
+uint16_t PWM_SetInterleave(const uint16_t *);
 
-void InitPWMGenerators(void);   
+void PWM_MotorDutySet(uint16_t, const uint32_t *);
+void PWM_MotorDutyShiftSet(uint16_t, const uint32_t *, const uint32_t *);
+void PWM_MotorTriggerSet(uint16_t, uint32_t, uint32_t);
+void PWM_MotorCurrentTriggerSet(uint16_t, uint32_t);
+uint16_t PWM_MotorVoltageTriggerSet(uint16_t, uint16_t);
+volatile uint32_t *PWM_MotorRegisters(uint16_t, uint16_t);
+uint32_t PWM_MotorPeriod(const PWM_TIMING_T *, uint16_t);
+uint16_t PWM_MotorTicksPerCount(uint16_t);
+uint32_t PWM_MotorSocOffset(const PWM_TIMING_T *, uint16_t);
 
 // </editor-fold>
         
@@ -0,0 +1,317 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file pwm_trigger.c
+ *
+ * @brief This module schedules the ADC trigger of the phase current samples
+ * of the three motors every PWM cycle.
+ *
+ * The phase currents of a motor are sampled in the first half of its cycle
+ * (PGxTRIGA of the phase A generator), while all low side switches are on:
+ * from the start of cycle to its first switching edge. Every edge of the
+ * three bridges disturbs the current amplifiers from the edge to the end
+ * of the dead time plus a settling time. PWM_TriggerSchedule() maps the
+ * edges of the commanded duty cycles of all motors onto the cycle of each
+ * motor, using the start of cycle offsets of the synchronization chain, and
+ * places the sample in the middle of the longest gap between them.
+ *
+ * The duty cycles of the motors take effect at their own start of cycle,
+ * the scheduler assumes that the neighbour cycles run with the duty cycles
+ * written in the same control period.
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: PWM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "pwm_trigger.h"
+#include "pwm.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+/* Noise zone of an edge in the cycle of a motor */
+typedef struct
+{
+    uint32_t
+        start,
+        end;
+
+} PWM_TRIGGER_ZONE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: PWM_TriggerZones(const PWM_TRIGGER_T *, uint16_t,
+*                                PWM_TRIGGER_ZONE_T *) </B>
+*
+* @brief Function collects the noise zones of the edges of all motors in the
+* cycle of one motor, sorted by start.
+*
+* @param pTrigger trigger scheduler.
+* @param motor motor whose cycle the zones are mapped onto.
+* @param pZones zones, PWM_TRIGGER_ZONE_COUNT entries.
+* @return number of zones.
+*/
+static uint16_t PWM_TriggerZones(const PWM_TRIGGER_T *pTrigger, uint16_t motor,
+                                 PWM_TRIGGER_ZONE_T *pZones)
+{
+    PWM_TRIGGER_ZONE_T zone;
+    uint32_t period = pTrigger->period, length;
+    uint16_t other, i, j, count = 0;
+
+    for (other = 0; other < PWM_MOTOR_COUNT; other++)
+    {
+        length = pTrigger->deadtime[other] + pTrigger->settle;
+        for (i = 0; i < pTrigger->edgeCount[other]; i++)
+        {
+            /* Edge times and offsets are less than the period */
+            zone.start = pTrigger->socOffset[other] +
+                         pTrigger->edge[other][i] + period -
+                         pTrigger->socOffset[motor];
+            while (zone.start >= period)
+            {
+                zone.start -= period;
+            }
+            zone.end = zone.start + length;
+            if (zone.end > period)
+            {
+                pZones[count].start = 0;
+                pZones[count].end = zone.end - period;
+                count++;
+                zone.end = period;
+            }
+            pZones[count++] = zone;
+        }
+    }
+
+    /* Insertion sort on start */
+    for (i = 1; i < count; i++)
+    {
+        zone = pZones[i];
+        for (j = i; (j > 0) && (pZones[j-1].start > zone.start); j--)
+        {
+            pZones[j] = pZones[j-1];
+        }
+        pZones[j] = zone;
+    }
+    return count;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: PWM_TriggerInit(PWM_TRIGGER_T *, const PWM_TIMING_T *) </B>
+*
+* @brief Function initializes the trigger scheduler for a PWM timing, with
+* 50% duty cycle on every phase. Call it again after PWM_SetTiming().
+*
+* @param pTrigger trigger scheduler.
+* @param pTiming PWM timing, normally pwmTiming.
+* @return none.
+*
+* @example
+* <CODE> PWM_TriggerInit(&pwmTrigger, &pwmTiming); </CODE>
+*
+*/
+void PWM_TriggerInit(PWM_TRIGGER_T *pTrigger, const PWM_TIMING_T *pTiming)
+{
+    uint32_t duty[3];
+    uint16_t motor, phase;
+
+    pTrigger->half = pTiming->loopTimeTcy + PWM_TICKS_PER_CLOCK;
+    pTrigger->period = 2 * pTrigger->half;
+    pTrigger->settle = PWM_TRIGGER_TICKS(PWM_TRIGGER_SETTLE_MICROSEC);
+    pTrigger->sample = PWM_TRIGGER_TICKS(PWM_TRIGGER_SAMPLE_MICROSEC);
+    pTrigger->misses = 0;
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        pTrigger->scale[motor] = PWM_MotorTicksPerCount(motor);
+        pTrigger->socOffset[motor] = PWM_MotorSocOffset(pTiming, motor);
+        pTrigger->deadtime[motor] =
+                            pTiming->deadtime * pTrigger->scale[motor];
+        pTrigger->trigger[motor] = ADC_SAMPLING_POINT;
+        pTrigger->margin[motor] = 0;
+        for (phase = 0; phase < 3; phase++)
+        {
+            duty[phase] = pTrigger->half / (2 * pTrigger->scale[motor]);
+        }
+        PWM_TriggerDutySet(pTrigger, motor, duty, duty);
+    }
+}
+
+/**
+* <B> Function: PWM_TriggerDutySet(PWM_TRIGGER_T *, uint16_t,
+*                                  const uint32_t *, const uint32_t *) </B>
+*
+* @brief Function records the duty cycles commanded to the generators of a
+* motor for the next cycle.
+*
+* @param pTrigger trigger scheduler.
+* @param motor PWM_MOTOR_T.
+* @param pRise PGxPHASE of phase A, B and C in dual edge mode, else PGxDC.
+* @param pDuty PGxDC of phase A, B and C.
+* @return none.
+*
+* @example
+* <CODE> PWM_TriggerDutySet(&pwmTrigger, PWM_MOTOR_MC1, duty, duty); </CODE>
+*
+*/
+void PWM_TriggerDutySet(PWM_TRIGGER_T *pTrigger, uint16_t motor,
+                        const uint32_t *pRise, const uint32_t *pDuty)
+{
+    uint32_t half = pTrigger->half, rise, fall;
+    uint32_t *pEdge = pTrigger->edge[motor];
+    uint16_t phase, count = 0;
+
+    pTrigger->firstEdge[motor] = half;
+    for (phase = 0; phase < 3; phase++)
+    {
+        rise = pRise[phase] * pTrigger->scale[motor];
+        fall = pDuty[phase] * pTrigger->scale[motor];
+        /* A phase switches only with a pulse shorter than the cycle */
+        if ((rise == 0) || (rise >= half) || (fall == 0) || (fall >= half))
+        {
+            continue;
+        }
+        pEdge[count++] = half - rise;
+        pEdge[count++] = half + fall;
+        if ((half - rise) < pTrigger->firstEdge[motor])
+        {
+            pTrigger->firstEdge[motor] = half - rise;
+        }
+    }
+    pTrigger->edgeCount[motor] = count;
+}
+
+/**
+* <B> Function: PWM_TriggerSchedule(PWM_TRIGGER_T *) </B>
+*
+* @brief Function places the phase current sample of every motor in the
+* longest gap between the noise zones of all bridges that lies before the
+* first edge of the motor. The sample is centered in the gap; without a gap
+* as long as the sampling time it starts at the start of cycle and misses
+* is incremented. Call it once the duty cycles of all motors are recorded.
+*
+* @param pTrigger trigger scheduler.
+* @return none.
+*
+* @example
+* <CODE> PWM_TriggerSchedule(&pwmTrigger); </CODE>
+*
+*/
+void PWM_TriggerSchedule(PWM_TRIGGER_T *pTrigger)
+{
+    PWM_TRIGGER_ZONE_T zones[PWM_TRIGGER_ZONE_COUNT];
+    uint32_t end, cursor, gapStart, gap, bestStart, best, time;
+    uint16_t motor, i, count;
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        count = PWM_TriggerZones(pTrigger, motor, zones);
+        end = pTrigger->firstEdge[motor];
+
+        /* Longest gap of [0, first edge] not covered by a zone */
+        cursor = 0;
+        bestStart = 0;
+        best = 0;
+        for (i = 0; (i <= count) && (cursor < end); i++)
+        {
+            gapStart = cursor;
+            if (i < count)
+            {
+                gap = ((zones[i].start < end) ? zones[i].start : end);
+                if (zones[i].end > cursor)
+                {
+                    cursor = zones[i].end;
+                }
+            }
+            else
+            {
+                gap = end;
+            }
+            gap = (gap > gapStart) ? (gap - gapStart) : 0;
+            if (gap > best)
+            {
+                best = gap;
+                bestStart = gapStart;
+            }
+        }
+
+        if (best >= pTrigger->sample)
+        {
+            pTrigger->margin[motor] = (best - pTrigger->sample) >> 1;
+            time = bestStart + pTrigger->margin[motor];
+        }
+        else
+        {
+            pTrigger->margin[motor] = 0;
+            time = 0;
+            pTrigger->misses++;
+        }
+        pTrigger->trigger[motor] = time / pTrigger->scale[motor];
+    }
+}
+
+/**
+* <B> Function: PWM_TriggerUpdate(const PWM_TRIGGER_T *) </B>
+*
+* @brief Function writes the scheduled triggers to the phase A generators.
+* Call it before the duty cycles are written, the triggers are updated
+* with them. With SINGLE_SHUNT the bus current triggers of the phase B
+* generators are placed by SingleShunt_PwmUpdate().
+*
+* @param pTrigger trigger scheduler.
+* @return none.
+*
+* @example
+* <CODE> PWM_TriggerUpdate(&pwmTrigger); </CODE>
+*
+*/
+void PWM_TriggerUpdate(const PWM_TRIGGER_T *pTrigger)
+{
+    uint16_t motor;
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        PWM_MotorCurrentTriggerSet(motor, pTrigger->trigger[motor]);
+    }
+}
+
+// </editor-fold>
@@ -0,0 +1,115 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file pwm_trigger.h
+ *
+ * @brief This header file lists the functions and definitions of the ADC
+ * trigger scheduler, which places the phase current sample of every motor
+ * in the quietest part of its PWM cycle.
+ *
+ * Component: PWM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __PWM_TRIGGER_H
+#define __PWM_TRIGGER_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "pwm.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Time in ticks of 1/16 PWM clock */
+#define PWM_TRIGGER_TICKS(microsec) \
+                    (uint32_t)((microsec)*PWM_TICKS_PER_CLOCK*PWM_CLOCK_MHZ)
+
+/* Ringing of the current amplifiers after the dead time of an edge */
+#define PWM_TRIGGER_SETTLE_MICROSEC     0.5f
+/* Sampling time of the phase current channels */
+#define PWM_TRIGGER_SAMPLE_MICROSEC     0.25f
+
+/* Switching edges per motor : PWMxL falling and PWMxH falling per phase */
+#define PWM_TRIGGER_EDGE_COUNT          6
+/* Noise zones of all edges, a zone that wraps the cycle end is split */
+#define PWM_TRIGGER_ZONE_COUNT          \
+                    (2*PWM_MOTOR_COUNT*PWM_TRIGGER_EDGE_COUNT)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    uint32_t
+        period,             /* PWM cycle, all times in ticks of 1/16 PWM
+                               clock */
+        half,               /* Half PWM cycle */
+        settle,             /* Noise zone after the dead time of an edge */
+        sample,             /* Sampling time */
+        socOffset[PWM_MOTOR_COUNT], /* Start of cycle after the PG5 SOC */
+        deadtime[PWM_MOTOR_COUNT],
+        edge[PWM_MOTOR_COUNT][PWM_TRIGGER_EDGE_COUNT],  /* Edges of the
+                               commanded duty cycles after the motor SOC */
+        firstEdge[PWM_MOTOR_COUNT], /* First edge of the cycle, end of the
+                               sampling window */
+        trigger[PWM_MOTOR_COUNT],   /* PGxTRIGA of the phase A generator */
+        margin[PWM_MOTOR_COUNT];    /* Sample to the nearest noise zone */
+
+    uint16_t
+        scale[PWM_MOTOR_COUNT],     /* Ticks per register count */
+        edgeCount[PWM_MOTOR_COUNT],
+        misses;             /* Samples that did not fit in a quiet gap */
+
+} PWM_TRIGGER_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void PWM_TriggerInit(PWM_TRIGGER_T *, const PWM_TIMING_T *);
+void PWM_TriggerDutySet(PWM_TRIGGER_T *, uint16_t, const uint32_t *,
+                        const uint32_t *);
+void PWM_TriggerSchedule(PWM_TRIGGER_T *);
+void PWM_TriggerUpdate(const PWM_TRIGGER_T *);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __PWM_TRIGGER_H
@@ -0,0 +1,96 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file sfr_field.h
+ *
+ * @brief This header file defines the macros that compose a register value
+ * from its bit fields, using the _<REG>_<FIELD>_POSITION and _MASK 
+ * definitions of the device header.
+ * 
+ * A register is configured with one write of the composed value instead of
+ * one read-modify-write per bit field:
+ *
+ *     U1CON = SFR_FIELD(U1CON, TXEN, 1) | SFR_FIELD(U1CON, RXEN, 1);
+ *
+ * SFR_FIELD() takes a constant value and fails to compile if the value does
+ * not fit the field. SFR_FIELD_VAR() takes a value known at runtime and 
+ * truncates it to the field width.
+ *
+ * Component: HAL
+ * 
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __SFR_FIELD_H
+#define __SFR_FIELD_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <xc.h>
+#include <stdint.h>
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Largest value of a field */
+#define SFR_FIELD_MAX(reg, field)                                              \
+    SFR_FIELD_MAX_(_##reg##_##field##_POSITION, _##reg##_##field##_MASK)
+
+/* Field value known at runtime, truncated to the field width */
+#define SFR_FIELD_VAR(reg, field, value)                                       \
+    SFR_FIELD_VAR_(_##reg##_##field##_POSITION, _##reg##_##field##_MASK,      \
+                   value)
+
+/* Constant field value, fails to compile if value does not fit the field */
+#define SFR_FIELD(reg, field, value)                                           \
+    SFR_FIELD_(_##reg##_##field##_POSITION, _##reg##_##field##_MASK, value,   \
+               #reg "." #field " value does not fit the field")
+
+/* Register names are macros themselves, so the field definitions are pasted
+ * above before any of the helpers below expand their arguments. */
+#define SFR_FIELD_MAX_(position, mask)                                         \
+    ((uint32_t)(mask) >> (position))
+#define SFR_FIELD_VAR_(position, mask, value)                                  \
+    (((uint32_t)(value) << (position)) & (uint32_t)(mask))
+#define SFR_FIELD_(position, mask, value, message)                             \
+    ((uint32_t)(SFR_FIELD_VAR_(position, mask, value) + 0 * sizeof(struct {    \
+        _Static_assert((uint32_t)(value) <= SFR_FIELD_MAX_(position, mask),    \
+                       message);                                               \
+        int check; })))
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __SFR_FIELD_H
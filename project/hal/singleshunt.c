@@ -0,0 +1,363 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file singleshunt.c
+ *
+ * @brief This module reconstructs the phase currents of a motor from two
+ * samples of the DC bus current per PWM cycle.
+ *
+ * The phase generators run in dual edge center aligned mode (MODSEL = 6):
+ * in the first half of the cycle (up count) a phase turns on rise counts
+ * before the center, in the second half it turns off duty counts after it.
+ * Ordering the phases by duty cycle into max, mid and min, the first half
+ * passes through two active vectors:
+ *  - only max on : the bus current is +I(max), sampled as Ibus1
+ *  - max and mid on : the bus current is -I(min), sampled as Ibus2
+ * and I(mid) = -I(max) - I(min). SingleShunt_DutyShift() moves the rising
+ * edges so that both vectors last at least tcrit and moves the falling
+ * edges the other way, so the on time of every phase is unchanged.
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: SINGLE SHUNT
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "singleshunt.h"
+#include "pwm.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Phase of the sector order table */
+#define SINGLE_SHUNT_MAX    0
+#define SINGLE_SHUNT_MID    1
+#define SINGLE_SHUNT_MIN    2
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+/* Phases A = 0, B = 1, C = 2 with the largest, middle and smallest duty
+   cycle in each sector */
+static const uint8_t singleShuntOrder[7][3] =
+{
+    {0, 1, 2},      /* unused */
+    {0, 1, 2},      /* Sector 1 : A >= B >= C */
+    {1, 0, 2},      /* Sector 2 : B >= A >= C */
+    {1, 2, 0},      /* Sector 3 : B >= C >= A */
+    {2, 1, 0},      /* Sector 4 : C >= B >= A */
+    {2, 0, 1},      /* Sector 5 : C >= A >= B */
+    {0, 2, 1}       /* Sector 6 : A >= C >= B */
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: SingleShunt_Sector(const uint32_t *) </B>
+*
+* @brief Function returns the sector of a set of duty cycles.
+*
+* @param pDuty duty cycles of phase A, B and C.
+* @return sector 1-6.
+*/
+static uint16_t SingleShunt_Sector(const uint32_t *pDuty)
+{
+    if (pDuty[0] >= pDuty[1])
+    {
+        if (pDuty[1] >= pDuty[2])
+        {
+            return 1;
+        }
+        return (pDuty[0] >= pDuty[2]) ? 6 : 5;
+    }
+    if (pDuty[0] >= pDuty[2])
+    {
+        return 2;
+    }
+    return (pDuty[1] >= pDuty[2]) ? 3 : 4;
+}
+
+/**
+* <B> Function: SingleShunt_ShiftEarlier(SINGLE_SHUNT_PARM_T *, uint16_t,
+*                                        uint32_t) </B>
+*
+* @brief Function moves the rising edge of a phase earlier and its falling
+* edge earlier by the same amount, as far as the half period allows.
+*
+* @param pParm single shunt parameters.
+* @param phase phase to shift.
+* @param shift counts to shift.
+* @return counts that could not be shifted.
+*/
+static uint32_t SingleShunt_ShiftEarlier(SINGLE_SHUNT_PARM_T *pParm,
+                                         uint16_t phase, uint32_t shift)
+{
+    uint32_t limit = pParm->period - pParm->rise[phase];
+
+    if (limit > pParm->duty[phase])
+    {
+        limit = pParm->duty[phase];
+    }
+    if (shift > limit)
+    {
+        shift = limit;
+    }
+    pParm->rise[phase] += shift;
+    pParm->duty[phase] -= shift;
+    return shift;
+}
+
+/**
+* <B> Function: SingleShunt_ShiftLater(SINGLE_SHUNT_PARM_T *, uint16_t,
+*                                      uint32_t) </B>
+*
+* @brief Function moves the rising edge of a phase later and its falling
+* edge later by the same amount, as far as the half period allows.
+*
+* @param pParm single shunt parameters.
+* @param phase phase to shift.
+* @param shift counts to shift.
+* @return counts that could be shifted.
+*/
+static uint32_t SingleShunt_ShiftLater(SINGLE_SHUNT_PARM_T *pParm,
+                                       uint16_t phase, uint32_t shift)
+{
+    uint32_t limit = pParm->period - pParm->duty[phase];
+
+    if (limit > pParm->rise[phase])
+    {
+        limit = pParm->rise[phase];
+    }
+    if (shift > limit)
+    {
+        shift = limit;
+    }
+    pParm->rise[phase] -= shift;
+    pParm->duty[phase] += shift;
+    return shift;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: SingleShunt_InitializeParameters(SINGLE_SHUNT_PARM_T *,
+*                                      uint32_t, uint32_t, uint32_t) </B>
+*
+* @brief Function initializes the single shunt parameters of a motor.
+*
+* @param pParm single shunt parameters.
+* @param period half PWM period (PGxPER, MPER) in counts of the generators.
+* @param tcrit shortest sampling window in counts, at least tDelaySample
+*        plus the ADC sampling time.
+* @param tDelaySample delay of the triggers after the switching edges in
+*        counts, at least the dead time plus the settling of the current
+*        amplifier.
+* @return none.
+*
+* @example
+* <CODE> SingleShunt_InitializeParameters(&singleShunt, LOOPTIME_TCY,
+*                                         tcrit, tDelay); </CODE>
+*
+*/
+void SingleShunt_InitializeParameters(SINGLE_SHUNT_PARM_T *pParm,
+                    uint32_t period, uint32_t tcrit, uint32_t tDelaySample)
+{
+    uint16_t phase;
+
+    pParm->period = period;
+    pParm->tcrit = tcrit;
+    pParm->tDelaySample = tDelaySample;
+    for (phase = 0; phase < SINGLE_SHUNT_PHASE_COUNT; phase++)
+    {
+        pParm->rise[phase] = period >> 1;
+        pParm->duty[phase] = period >> 1;
+    }
+    pParm->trigger1 = 0;
+    pParm->trigger2 = 0;
+    pParm->sector = 1;
+    pParm->valid = 0;
+    pParm->shifts = 0;
+    pParm->Ibus1 = 0;
+    pParm->Ibus2 = 0;
+    pParm->Ia = 0;
+    pParm->Ib = 0;
+    pParm->Ic = 0;
+}
+
+/**
+* <B> Function: SingleShunt_DutyShift(SINGLE_SHUNT_PARM_T *,
+*                                     const uint32_t *) </B>
+*
+* @brief Function computes the edges and the bus current triggers of the
+* next PWM cycle from the duty cycles of the center aligned modulation. The
+* minimum phase turns on later and the maximum phase earlier until both
+* sampling windows last tcrit; the falling edges move the other way.
+* valid is cleared when the half period does not leave room for both
+* windows, the current reconstruction then holds the last currents.
+* Call it after SingleShunt_PhaseCurrentReconstruction() of the cycle,
+* which uses the sector of the duty cycles the samples were taken with.
+*
+* @param pParm single shunt parameters.
+* @param pDuty on time of phase A, B and C per half period (PGxDC of the
+*        center aligned mode), at most period.
+* @return none.
+*
+* @example
+* <CODE> SingleShunt_DutyShift(&singleShunt, duty); </CODE>
+*
+*/
+void SingleShunt_DutyShift(SINGLE_SHUNT_PARM_T *pParm, const uint32_t *pDuty)
+{
+    const uint8_t *pOrder;
+    uint16_t phase, max, mid, min;
+    int32_t window;
+    uint32_t shift;
+
+    for (phase = 0; phase < SINGLE_SHUNT_PHASE_COUNT; phase++)
+    {
+        pParm->rise[phase] = pDuty[phase];
+        pParm->duty[phase] = pDuty[phase];
+    }
+    pParm->sector = SingleShunt_Sector(pDuty);
+    pOrder = singleShuntOrder[pParm->sector];
+    max = pOrder[SINGLE_SHUNT_MAX];
+    mid = pOrder[SINGLE_SHUNT_MID];
+    min = pOrder[SINGLE_SHUNT_MIN];
+
+    /* Second window (max and mid on) : turn the min phase on later, the
+       mid phase earlier for what is left */
+    window = (int32_t)pParm->rise[mid] - (int32_t)pParm->rise[min];
+    if (window < (int32_t)pParm->tcrit)
+    {
+        shift = (uint32_t)((int32_t)pParm->tcrit - window);
+        shift -= SingleShunt_ShiftLater(pParm, min, shift);
+        SingleShunt_ShiftEarlier(pParm, mid, shift);
+        pParm->shifts++;
+    }
+
+    /* First window (max on) : turn the max phase on earlier, the mid phase
+       later for what is left. The mid phase may have moved past the max
+       phase above, the window is then negative */
+    window = (int32_t)pParm->rise[max] - (int32_t)pParm->rise[mid];
+    if (window < (int32_t)pParm->tcrit)
+    {
+        shift = (uint32_t)((int32_t)pParm->tcrit - window);
+        shift -= SingleShunt_ShiftEarlier(pParm, max, shift);
+        SingleShunt_ShiftLater(pParm, mid, shift);
+        pParm->shifts++;
+    }
+
+    pParm->valid =
+        (pParm->rise[max] >= pParm->rise[mid] + pParm->tcrit) &&
+        (pParm->rise[mid] >= pParm->rise[min] + pParm->tcrit);
+
+    /* Sample after the edge that opens each window */
+    pParm->trigger1 = pParm->period - pParm->rise[max] + pParm->tDelaySample;
+    pParm->trigger2 = pParm->period - pParm->rise[mid] + pParm->tDelaySample;
+}
+
+/**
+* <B> Function: SingleShunt_PhaseCurrentReconstruction(SINGLE_SHUNT_PARM_T *)
+* </B>
+*
+* @brief Function reconstructs the phase currents from the bus current
+* samples Ibus1 and Ibus2 of the cycle, using the sector of its duty cycles.
+* The currents are held when the sampling windows were too short.
+*
+* @param pParm single shunt parameters.
+* @return none.
+*
+* @example
+* <CODE> SingleShunt_PhaseCurrentReconstruction(&singleShunt); </CODE>
+*
+*/
+void SingleShunt_PhaseCurrentReconstruction(SINGLE_SHUNT_PARM_T *pParm)
+{
+    const uint8_t *pOrder = singleShuntOrder[pParm->sector];
+    SINGLE_SHUNT_CURRENT_T current[SINGLE_SHUNT_PHASE_COUNT];
+#ifdef MEASURE_FIXED_POINT
+    int32_t value;
+#endif
+
+    if (pParm->valid == 0)
+    {
+        return;
+    }
+
+#ifdef MEASURE_FIXED_POINT
+    current[pOrder[SINGLE_SHUNT_MAX]] = pParm->Ibus1;
+    value = -(int32_t)pParm->Ibus2;
+    current[pOrder[SINGLE_SHUNT_MIN]] =
+        (int16_t)((value > INT16_MAX) ? INT16_MAX : value);
+    value = (int32_t)pParm->Ibus2 - pParm->Ibus1;
+    current[pOrder[SINGLE_SHUNT_MID]] =
+        (int16_t)((value > INT16_MAX) ? INT16_MAX :
+                  ((value < INT16_MIN) ? INT16_MIN : value));
+#else
+    current[pOrder[SINGLE_SHUNT_MAX]] = pParm->Ibus1;
+    current[pOrder[SINGLE_SHUNT_MIN]] = -pParm->Ibus2;
+    current[pOrder[SINGLE_SHUNT_MID]] = pParm->Ibus2 - pParm->Ibus1;
+#endif
+
+    pParm->Ia = current[0];
+    pParm->Ib = current[1];
+    pParm->Ic = current[2];
+}
+
+/**
+* <B> Function: SingleShunt_PwmUpdate(const SINGLE_SHUNT_PARM_T *, uint16_t)
+* </B>
+*
+* @brief Function writes the bus current triggers and the edges computed by
+* SingleShunt_DutyShift() to the generators of a motor.
+*
+* @param pParm single shunt parameters.
+* @param motor PWM_MOTOR_T.
+* @return none.
+*
+* @example
+* <CODE> SingleShunt_PwmUpdate(&singleShunt, PWM_MOTOR_MC1); </CODE>
+*
+*/
+void SingleShunt_PwmUpdate(const SINGLE_SHUNT_PARM_T *pParm, uint16_t motor)
+{
+    PWM_MotorTriggerSet(motor, pParm->trigger1, pParm->trigger2);
+    PWM_MotorDutyShiftSet(motor, pParm->rise, pParm->duty);
+}
+
+// </editor-fold>
@@ -0,0 +1,110 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file singleshunt.h
+ *
+ * @brief This header file lists the functions and definitions of the single
+ * shunt phase current reconstruction.
+ *
+ * Component: SINGLE SHUNT
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __SINGLESHUNT_H
+#define __SINGLESHUNT_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Phases of a motor, index of the duty cycle arrays */
+#define SINGLE_SHUNT_PHASE_COUNT    3
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+/* Current representation of measure.h (MCAPP_CURRENT_T) */
+#ifdef MEASURE_FIXED_POINT
+typedef int16_t SINGLE_SHUNT_CURRENT_T;     /* Q15 of MC1_PEAK_CURRENT */
+#else
+typedef float SINGLE_SHUNT_CURRENT_T;       /* Amperes */
+#endif
+
+typedef struct
+{
+    SINGLE_SHUNT_CURRENT_T
+        Ibus1,          /* Bus current during the first active vector */
+        Ibus2,          /* Bus current during the second active vector */
+        Ia,             /* Reconstructed phase currents */
+        Ib,
+        Ic;
+
+    uint32_t
+        period,         /* Half PWM period in counts of the generators */
+        tcrit,          /* Shortest active vector the bus current can be
+                           sampled in: dead time, settling and sampling */
+        tDelaySample,   /* Delay of the trigger after the switching edge:
+                           dead time and settling */
+        rise[SINGLE_SHUNT_PHASE_COUNT], /* PGxPHASE, first half on time */
+        duty[SINGLE_SHUNT_PHASE_COUNT], /* PGxDC, second half on time */
+        trigger1,       /* PGxTRIGA, sample of Ibus1 */
+        trigger2;       /* PGxTRIGB, sample of Ibus2 */
+
+    uint16_t
+        sector,         /* Space vector sector 1-6 of the duty cycles */
+        valid,          /* Both sampling windows are at least tcrit */
+        shifts;         /* Duty cycle sets that needed a shift */
+
+} SINGLE_SHUNT_PARM_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void SingleShunt_InitializeParameters(SINGLE_SHUNT_PARM_T *, uint32_t,
+                                      uint32_t, uint32_t);
+void SingleShunt_DutyShift(SINGLE_SHUNT_PARM_T *, const uint32_t *);
+void SingleShunt_PhaseCurrentReconstruction(SINGLE_SHUNT_PARM_T *);
+void SingleShunt_PwmUpdate(const SINGLE_SHUNT_PARM_T *, uint16_t);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __SINGLESHUNT_H
@@ -0,0 +1,446 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file svpwm.c
+ *
+ * @brief This module computes the duty cycles of the phase generators of a
+ * motor from an alpha/beta voltage command, in fixed point.
+ *
+ * Space vector modulation by min-max injection: the inverse Clarke
+ * transform gives the phase voltages, half of the sum of the largest and
+ * smallest phase voltage is subtracted from all three (the common mode
+ * that centers the active vectors in the cycle), and each phase voltage
+ * maps linearly onto the duty cycle, VBUS/2 to 100%. The result is the
+ * same as sector based SVPWM without sector decoding or divisions.
+ *
+ * Voltage commands and VBUS share one Q15 scale, for example the full scale
+ * of the VBUS measurement. VBUS changes slowly; SVPWM_VbusSet() computes the
+ * duty cycle gain with the only division of the module and SVPWM_Update()
+ * runs every cycle with multiplications, shifts and compares only.
+ *
+ * The discontinuous modes (SVPWM_ClampSet()) inject instead the common mode
+ * that holds the largest or the smallest phase at the DC link rail: that
+ * phase does not switch for the cycle, one third of the switching events
+ * less. The line voltages, and so the fundamental, are those of continuous
+ * modulation; the switch between the two at the magnitude thresholds only
+ * moves the common mode. DPWM0 to DPWM3 differ in which phase is clamped:
+ * DPWM1 clamps the phase of largest magnitude, DPWM3 the other extreme,
+ * DPWM0 and DPWM2 decide on the line voltages, the phase voltages 30
+ * degrees ahead or behind, so that the clamping follows a leading or
+ * lagging phase current.
+ *
+ * Definitions in this file are for dsPIC33AK512MC510
+ *
+ * Component: SVPWM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "svpwm.h"
+#include "pwm.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: SVPWM_ClampLimits(SVPWM_T *) </B>
+*
+* @brief Function computes the squared magnitudes of the clamping
+* thresholds for the DC link voltage.
+*
+* @param pSvpwm modulator.
+* @return none.
+*/
+static void SVPWM_ClampLimits(SVPWM_T *pSvpwm)
+{
+    int32_t limit;
+
+    limit = ((int32_t)pSvpwm->vbus * pSvpwm->clampOnIndex) >> 15;
+    pSvpwm->clampOnSquare = limit * limit;
+    limit = ((int32_t)pSvpwm->vbus * pSvpwm->clampOffIndex) >> 15;
+    pSvpwm->clampOffSquare = limit * limit;
+}
+
+/**
+* <B> Function: SVPWM_Sqrt(uint32_t) </B>
+*
+* @brief Function returns the integer square root.
+*
+* @param value radicand.
+* @return floor(sqrt(value)).
+*/
+static uint32_t SVPWM_Sqrt(uint32_t value)
+{
+    uint32_t root = 0, bit = 1UL << 30;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/**
+* <B> Function: SVPWM_MaxPlusMin(int32_t, int32_t, int32_t) </B>
+*
+* @brief Function returns the sum of the largest and the smallest of three
+* values. For a three phase set it is positive when the largest phase has
+* the larger magnitude.
+*
+* @param a, b, c values.
+* @return max + min.
+*/
+static int32_t SVPWM_MaxPlusMin(int32_t a, int32_t b, int32_t c)
+{
+    int32_t max = (a > b) ? a : b;
+    int32_t min = (a > b) ? b : a;
+
+    if (c > max)
+    {
+        max = c;
+    }
+    else if (c < min)
+    {
+        min = c;
+    }
+    return max + min;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: SVPWM_Init(SVPWM_T *, uint16_t, const PWM_TIMING_T *,
+*                          SVPWM_MODE_T) </B>
+*
+* @brief Function initializes the modulator of a motor for a PWM timing.
+* The duty cycles start at 50%; call SVPWM_VbusSet() before the first
+* update, and SVPWM_Init() again after PWM_SetTiming().
+*
+* @param pSvpwm modulator.
+* @param motor PWM_MOTOR_T.
+* @param pTiming PWM timing, normally pwmTiming.
+* @param mode SVPWM_MODE_T.
+* @return none.
+*
+* @example
+* <CODE> SVPWM_Init(&svpwm, PWM_MOTOR_MC1, &pwmTiming, SVPWM_LINEAR); </CODE>
+*
+*/
+void SVPWM_Init(SVPWM_T *pSvpwm, uint16_t motor, const PWM_TIMING_T *pTiming,
+                SVPWM_MODE_T mode)
+{
+    uint32_t period = PWM_MotorPeriod(pTiming, motor);
+    uint16_t phase;
+
+    for (phase = 0; phase < 3; phase++)
+    {
+        pSvpwm->pRegs[phase] = PWM_MotorRegisters(motor, phase);
+        pSvpwm->duty[phase] = period >> 1;
+    }
+    pSvpwm->center = period >> 1;
+    pSvpwm->minDuty = pTiming->deadtime;
+    pSvpwm->maxDuty = period - pTiming->deadtime;
+    pSvpwm->clampLow = 0;
+    /* Beyond the period by one PWM clock, the output does not toggle */
+    pSvpwm->clampHigh = period + 
+                        PWM_TICKS_PER_CLOCK / PWM_MotorTicksPerCount(motor);
+    pSvpwm->mode = mode;
+    pSvpwm->limited = 0;
+    pSvpwm->valpha = 0;
+    pSvpwm->vbeta = 0;
+    pSvpwm->gain = 0;
+    pSvpwm->limitSquare = 0;
+    pSvpwm->vbus = 0;
+    SVPWM_ClampSet(pSvpwm, SVPWM_CONTINUOUS, SVPWM_DPWM_ON_INDEX,
+                   SVPWM_DPWM_OFF_INDEX);
+}
+
+/**
+* <B> Function: SVPWM_VbusSet(SVPWM_T *, int16_t) </B>
+*
+* @brief Function sets the DC link voltage the voltage commands are
+* modulated with. Zero and negative values stop the modulation at 50%.
+*
+* @param pSvpwm modulator.
+* @param vbus DC link voltage, Q15 of the voltage commands.
+* @return none.
+*
+* @example
+* <CODE> SVPWM_VbusSet(&svpwm, vbus); </CODE>
+*
+*/
+void SVPWM_VbusSet(SVPWM_T *pSvpwm, int16_t vbus)
+{
+    int32_t limit;
+
+    if (vbus <= 0)
+    {
+        vbus = 0;
+        pSvpwm->gain = 0;
+    }
+    else
+    {
+        /* center = period/2 is VBUS/2 */
+        pSvpwm->gain = (int32_t)(((uint64_t)pSvpwm->center <<
+                                 (SVPWM_GAIN_SHIFT + 1)) / (uint32_t)vbus);
+    }
+    pSvpwm->vbus = vbus;
+    limit = ((int32_t)vbus * SVPWM_INV_SQRT3) >> 15;
+    pSvpwm->limitSquare = limit * limit;
+    SVPWM_ClampLimits(pSvpwm);
+}
+
+/**
+* <B> Function: SVPWM_ClampSet(SVPWM_T *, SVPWM_CLAMP_T, uint16_t,
+*                              uint16_t) </B>
+*
+* @brief Function selects continuous or discontinuous modulation. A
+* discontinuous mode clamps once the voltage command exceeds onIndex of
+* VBUS and modulates continuously again below offIndex; below about 0.39
+* VBUS the clamping adds more current ripple than it saves switching.
+* Pass onIndex 0 to clamp at all magnitudes.
+*
+* @param pSvpwm modulator.
+* @param clamp SVPWM_CLAMP_T.
+* @param onIndex magnitude to clamp from, Q15 fraction of VBUS.
+* @param offIndex magnitude to stop clamping at, not above onIndex.
+* @return none.
+*
+* @example
+* <CODE> SVPWM_ClampSet(&svpwm, SVPWM_DPWM2, SVPWM_DPWM_ON_INDEX,
+*                       SVPWM_DPWM_OFF_INDEX); </CODE>
+*
+*/
+void SVPWM_ClampSet(SVPWM_T *pSvpwm, SVPWM_CLAMP_T clamp, uint16_t onIndex,
+                    uint16_t offIndex)
+{
+    pSvpwm->clamp = clamp;
+    pSvpwm->clampOnIndex = onIndex;
+    pSvpwm->clampOffIndex = (offIndex < onIndex) ? offIndex : onIndex;
+    pSvpwm->clamping = 0;
+    SVPWM_ClampLimits(pSvpwm);
+}
+
+/**
+* <B> Function: SVPWM_Calculate(SVPWM_T *, int16_t, int16_t) </B>
+*
+* @brief Function computes the duty cycles of a voltage command into
+* pSvpwm->duty, clamped to the duty cycle limits, without writing them. In
+* linear mode a command beyond VBUS/sqrt(3) is scaled back to it; with
+* overmodulation a command beyond the hexagon is scaled back to its edge.
+* Both keep the angle and increment limited; the command after the limit is
+* kept in pSvpwm->valpha and pSvpwm->vbeta. While a discontinuous mode
+* clamps, the clamped phase gets clampLow or clampHigh, the other two stay
+* within the duty cycle limits.
+*
+* @param pSvpwm modulator.
+* @param valpha alpha voltage command, Q15.
+* @param vbeta beta voltage command, Q15.
+* @return none.
+*
+* @example
+* <CODE> SVPWM_Calculate(&svpwm, valpha, vbeta); </CODE>
+*
+*/
+void SVPWM_Calculate(SVPWM_T *pSvpwm, int16_t valpha, int16_t vbeta)
+{
+    int32_t va, vb, vc, vmax, vmin, half, beta, scale, duty, rail;
+    uint32_t magnitude;
+    int32_t v[3];
+    uint16_t phase, high;
+
+    magnitude = (uint32_t)((int32_t)valpha * valpha) + 
+                (uint32_t)((int32_t)vbeta * vbeta);
+    if (pSvpwm->mode == SVPWM_LINEAR)
+    {
+        if (magnitude > (uint32_t)pSvpwm->limitSquare)
+        {
+            /* Slow path : scale to the circle */
+            scale = (int32_t)(((int64_t)SVPWM_Sqrt(
+                        (uint32_t)pSvpwm->limitSquare) << 15) /
+                        (int32_t)SVPWM_Sqrt(magnitude));
+            valpha = (int16_t)(((int32_t)valpha * scale) >> 15);
+            vbeta = (int16_t)(((int32_t)vbeta * scale) >> 15);
+            pSvpwm->limited++;
+        }
+    }
+    if (pSvpwm->clamp != SVPWM_CONTINUOUS)
+    {
+        if (magnitude >= (uint32_t)pSvpwm->clampOnSquare)
+        {
+            pSvpwm->clamping = 1;
+        }
+        else if (magnitude < (uint32_t)pSvpwm->clampOffSquare)
+        {
+            pSvpwm->clamping = 0;
+        }
+    }
+
+    /* Inverse Clarke */
+    half = -((int32_t)valpha >> 1);
+    beta = ((int32_t)vbeta * SVPWM_SQRT3_BY_2) >> 15;
+    va = valpha;
+    vb = half + beta;
+    vc = half - beta;
+
+    vmax = (va > vb) ? va : vb;
+    vmin = (va > vb) ? vb : va;
+    if (vc > vmax)
+    {
+        vmax = vc;
+    }
+    else if (vc < vmin)
+    {
+        vmin = vc;
+    }
+
+    if ((pSvpwm->mode != SVPWM_LINEAR) && ((vmax - vmin) > pSvpwm->vbus))
+    {
+        /* Slow path : scale to the hexagon, the line voltages span VBUS */
+        scale = (vmax != vmin) ?
+                (((int32_t)pSvpwm->vbus << 15) / (vmax - vmin)) : 0;
+        va = (va * scale) >> 15;
+        vb = (vb * scale) >> 15;
+        vc = (vc * scale) >> 15;
+        vmax = (vmax * scale) >> 15;
+        vmin = (vmin * scale) >> 15;
+        pSvpwm->limited++;
+        /* Clarke of the scaled phase voltages */
+        valpha = (int16_t)va;
+        vbeta = (int16_t)(((vb - vc) * SVPWM_INV_SQRT3) >> 15);
+    }
+    pSvpwm->valpha = valpha;
+    pSvpwm->vbeta = vbeta;
+
+    if ((pSvpwm->clamp == SVPWM_CONTINUOUS) || (pSvpwm->clamping == 0) ||
+        (pSvpwm->gain == 0))
+    {
+        /* Min-max injection */
+        half = (vmax + vmin) >> 1;
+        rail = INT32_MAX;
+    }
+    else
+    {
+        switch (pSvpwm->clamp)
+        {
+            case SVPWM_DPWM0:
+                /* Phase voltages 30 degrees ahead */
+                high = (SVPWM_MaxPlusMin(va - vb, vb - vc, vc - va) >= 0);
+                break;
+            case SVPWM_DPWM2:
+                /* Phase voltages 30 degrees behind */
+                high = (SVPWM_MaxPlusMin(va - vc, vb - va, vc - vb) >= 0);
+                break;
+            case SVPWM_DPWM3:
+                high = ((vmax + vmin) < 0);
+                break;
+            default:
+                high = ((vmax + vmin) >= 0);
+                break;
+        }
+        /* Common mode that puts the largest phase at +VBUS/2 or the 
+           smallest at -VBUS/2 */
+        rail = pSvpwm->vbus >> 1;
+        half = high ? (vmax - rail) : (vmin + rail);
+    }
+    v[0] = va - half;
+    v[1] = vb - half;
+    v[2] = vc - half;
+
+    for (phase = 0; phase < 3; phase++)
+    {
+        if (v[phase] >= rail)
+        {
+            pSvpwm->duty[phase] = pSvpwm->clampHigh;
+        }
+        else if (v[phase] <= -rail)
+        {
+            pSvpwm->duty[phase] = pSvpwm->clampLow;
+        }
+        else
+        {
+            duty = (int32_t)pSvpwm->center +
+                   ((v[phase] * pSvpwm->gain) >> SVPWM_GAIN_SHIFT);
+            if (duty < (int32_t)pSvpwm->minDuty)
+            {
+                duty = (int32_t)pSvpwm->minDuty;
+            }
+            else if (duty > (int32_t)pSvpwm->maxDuty)
+            {
+                duty = (int32_t)pSvpwm->maxDuty;
+            }
+            pSvpwm->duty[phase] = (uint32_t)duty;
+        }
+    }
+}
+
+/**
+* <B> Function: SVPWM_Update(SVPWM_T *, int16_t, int16_t) </B>
+*
+* @brief Function computes the duty cycles of a voltage command and writes
+* them to PGxDC of the phase generators of the motor. The write of PGxDC
+* requests the update at the next start of cycle. With SINGLE_SHUNT pass
+* pSvpwm->duty of SVPWM_Calculate() to SingleShunt_DutyShift() instead.
+*
+* @param pSvpwm modulator.
+* @param valpha alpha voltage command, Q15.
+* @param vbeta beta voltage command, Q15.
+* @return none.
+*
+* @example
+* <CODE> SVPWM_Update(&svpwm, valpha, vbeta); </CODE>
+*
+*/
+void SVPWM_Update(SVPWM_T *pSvpwm, int16_t valpha, int16_t vbeta)
+{
+    SVPWM_Calculate(pSvpwm, valpha, vbeta);
+    PWM_GENERATOR_REG(pSvpwm->pRegs[0], PWM_REG_DC) = pSvpwm->duty[0];
+    PWM_GENERATOR_REG(pSvpwm->pRegs[1], PWM_REG_DC) = pSvpwm->duty[1];
+    PWM_GENERATOR_REG(pSvpwm->pRegs[2], PWM_REG_DC) = pSvpwm->duty[2];
+}
+
+// </editor-fold>
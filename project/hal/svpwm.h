@@ -0,0 +1,146 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file svpwm.h
+ *
+ * @brief This header file lists the functions and definitions of the space
+ * vector modulator of a motor.
+ *
+ * Component: SVPWM
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __SVPWM_H
+#define __SVPWM_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "pwm.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* sqrt(3)/2 and 1/sqrt(3) in Q15 */
+#define SVPWM_SQRT3_BY_2        28378
+#define SVPWM_INV_SQRT3         18919
+
+/* Fraction bits of the duty cycle gain. The product of a phase voltage
+   (at most VBUS/2) and the gain then stays within 32 bits for the period
+   registers of PWMFREQUENCY_MIN_HZ and above (below 2^20) */
+#define SVPWM_GAIN_SHIFT        12
+
+/* Voltage command magnitude, Q15 fraction of VBUS, above which the
+   discontinuous modes clamp and below which they return to continuous
+   modulation. DPWM has less distortion than SVPWM for the same switching
+   losses above about 0.39 VBUS */
+#define SVPWM_DPWM_ON_INDEX     13107
+#define SVPWM_DPWM_OFF_INDEX    11796
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef enum
+{
+    SVPWM_LINEAR = 0,       /* Vector limited to the circle inscribed in the
+                               hexagon, VBUS/sqrt(3) : sinusoidal output */
+    SVPWM_OVERMODULATION    /* Vector limited to the hexagon at constant
+                               angle, up to 15% more fundamental voltage */
+} SVPWM_MODE_T;
+
+typedef enum
+{
+    SVPWM_CONTINUOUS = 0,   /* Min-max injection, all phases switch */
+    SVPWM_DPWM0,            /* 60 degree clamping, 30 degrees ahead of the 
+                               phase voltage peak */
+    SVPWM_DPWM1,            /* 60 degree clamping, centered on the peak */
+    SVPWM_DPWM2,            /* 60 degree clamping, 30 degrees after the peak :
+                               lagging phase current, motoring */
+    SVPWM_DPWM3             /* Two 30 degree clampings on both sides of the 
+                               peak */
+} SVPWM_CLAMP_T;
+
+typedef struct
+{
+    volatile uint32_t
+        *pRegs[3];          /* Phase A, B and C generators */
+
+    int32_t
+        gain,               /* Duty counts per Q15 volt, Q SVPWM_GAIN_SHIFT */
+        limitSquare,        /* Square of the linear limit, Q30 */
+        clampOnSquare,      /* Square of the magnitudes that switch between */
+        clampOffSquare;     /* continuous and discontinuous modulation */
+
+    uint32_t
+        center,             /* 50% duty cycle */
+        minDuty,            /* Duty cycle limits, dead time from both ends */
+        maxDuty,
+        duty[3],            /* Last duty cycles of phase A, B and C */
+        clampLow,           /* Duty cycles of a clamped phase, no switching */
+        clampHigh;          /* by default, minDuty and maxDuty to keep the
+                               pulses of the current measurement */
+
+    int16_t
+        vbus,               /* DC link voltage, Q15 of the voltage commands */
+        valpha,             /* Last voltage command after the limit, Q15 */
+        vbeta;
+
+    uint16_t
+        mode,               /* SVPWM_MODE_T */
+        clamp,              /* SVPWM_CLAMP_T */
+        clampOnIndex,       /* Clamping thresholds, Q15 fraction of VBUS */
+        clampOffIndex,
+        clamping,           /* Discontinuous modulation active */
+        limited;            /* Voltage commands beyond the limit */
+
+} SVPWM_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void SVPWM_Init(SVPWM_T *, uint16_t, const PWM_TIMING_T *, SVPWM_MODE_T);
+void SVPWM_VbusSet(SVPWM_T *, int16_t);
+void SVPWM_ClampSet(SVPWM_T *, SVPWM_CLAMP_T, uint16_t, uint16_t);
+void SVPWM_Calculate(SVPWM_T *, int16_t, int16_t);
+void SVPWM_Update(SVPWM_T *, int16_t, int16_t);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __SVPWM_H
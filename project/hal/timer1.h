@@ -72,6 +72,10 @@
 #define TIMER1_CLOCK_SCALED     (TIMER1_CLOCK/(TIMER1_CLOCK_PRESCALER*1000.0*1000.0))
         
 #define TIMER1_PERIOD_COUNT  	(uint32_t)((TIMER1_CLOCK_SCALED * TIMER1_PERIOD_uSec)-1)          
+/* Clock of Timer1 counting the 8 MHz FRC, TIMER1_InputClockFrcSet(). Its 
+   rate does not change when the system clock switches */
+#define TIMER1_FRC_CLOCK        8000000UL
+#define TIMER1_TECS_FRC         3
         
 // </editor-fold>    
         
@@ -190,6 +194,18 @@ inline static void TIMER1_InputClockSet(void)
     }
     
 }
+/**
+ * Selects the FRC as the Timer1 clock, TCS = 1 and TECS = 3.
+ * @example
+ * <code>
+ * TIMER1_InputClockFrcSet();
+ * </code>
+ */
+inline static void TIMER1_InputClockFrcSet(void)
+{
+    T1CONbits.TECS = TIMER1_TECS_FRC;
+    T1CONbits.TCS = 1;
+}
 /**
  * Sets the TImer1 Period.
  * @param period  provide desired period
@@ -0,0 +1,488 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file trig.c
+ *
+ * @brief This module computes sine, cosine and arc tangent for the control
+ * from lookup tables with linear interpolation, in Q15 and in floating 
+ * point.
+ *
+ * The tables are generated by the compiler : the entries are constant
+ * expressions of a Taylor series of the sine (error below 1e-9 over a 
+ * quarter turn) and of the Abramowitz and Stegun 4.4.49 series of the arc
+ * tangent (error below 2e-8 over [0, 1]). 
+ *
+ * The sine table covers a quarter turn; the other quadrants are read 
+ * forwards or backwards with the sign of the quadrant, and the combined 
+ * TRIG_SinCosQ15() and TRIG_SinCos() share the index and the fraction of
+ * both. The arc tangent is reduced to the octant [0, 45] degrees with one 
+ * division. Q15 angles are 65536 per turn, the angle of the electrical 
+ * position of foc.c; float angles are radians.
+ *
+ * Component: TRIG
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+#include "trig.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Angle bits interpolated between two points of the Q15 sine table */
+#define TRIG_FRACTION_BITS      (14 - TRIG_TABLE_BITS)
+
+/* sin(x) over [0, pi/2], Taylor series to x^13 */
+#define TRIG_SIN_SERIES(x, x2)                                                 \
+    ((x)*(1.0 - (x2)/6.0*(1.0 - (x2)/20.0*(1.0 - (x2)/42.0*(1.0 -             \
+        (x2)/72.0*(1.0 - (x2)/110.0*(1.0 - (x2)/156.0)))))))
+#define TRIG_SIN_POINT(i)                                                      \
+    TRIG_SIN_SERIES((i)*(1.5707963267948966/TRIG_TABLE_SIZE),                 \
+                    (i)*(1.5707963267948966/TRIG_TABLE_SIZE)*                 \
+                    (i)*(1.5707963267948966/TRIG_TABLE_SIZE))
+
+/* atan(z) over [0, 1], Abramowitz and Stegun 4.4.49 */
+#define TRIG_ATAN_SERIES(z, z2)                                                \
+    ((z)*(1.0 + (z2)*(-0.3333314528 + (z2)*(0.1999355085 + (z2)*(            \
+        -0.1420889944 + (z2)*(0.1065626393 + (z2)*(-0.0752896400 + (z2)*(     \
+        0.0429096138 + (z2)*(-0.0161657367 + (z2)*0.0028662257)))))))))
+#define TRIG_ATAN_POINT(i)                                                     \
+    TRIG_ATAN_SERIES((i)*(1.0/TRIG_TABLE_SIZE),                               \
+                     (i)*(1.0/TRIG_TABLE_SIZE)*(i)*(1.0/TRIG_TABLE_SIZE))
+
+/* Entries of the tables : sine in Q15, arc tangent in 4 * 65536 counts per
+   turn (32768 at 45 degrees) for the rounding of the interpolation */
+#define TRIG_SIN_Q15(i)     (int16_t)(TRIG_SIN_POINT(i)*32767.0 + 0.5)
+#define TRIG_SIN_FLOAT(i)   (float)TRIG_SIN_POINT(i)
+#define TRIG_ATAN_Q15(i)                                                       \
+    (uint16_t)(TRIG_ATAN_POINT(i)*(4.0*65536.0/6.283185307179586) + 0.5)
+#define TRIG_ATAN_FLOAT(i)  (float)TRIG_ATAN_POINT(i)
+
+/* 256 entries TRIG_ENTRY(i) to TRIG_ENTRY(i + 255) */
+#define TRIG_TABLE_8(entry, i)                                                 \
+    entry(i), entry((i) + 1), entry((i) + 2), entry((i) + 3),                  \
+    entry((i) + 4), entry((i) + 5), entry((i) + 6), entry((i) + 7)
+#define TRIG_TABLE_64(entry, i)                                                \
+    TRIG_TABLE_8(entry, i), TRIG_TABLE_8(entry, (i) + 8),                      \
+    TRIG_TABLE_8(entry, (i) + 16), TRIG_TABLE_8(entry, (i) + 24),              \
+    TRIG_TABLE_8(entry, (i) + 32), TRIG_TABLE_8(entry, (i) + 40),              \
+    TRIG_TABLE_8(entry, (i) + 48), TRIG_TABLE_8(entry, (i) + 56)
+#define TRIG_TABLE_256(entry)                                                  \
+    TRIG_TABLE_64(entry, 0), TRIG_TABLE_64(entry, 64),                         \
+    TRIG_TABLE_64(entry, 128), TRIG_TABLE_64(entry, 192)
+
+/* Table index per radian of the float sine */
+#define TRIG_INDEX_PER_RAD      (2.0f*TRIG_TABLE_SIZE/TRIG_PI)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+/* One point more for the interpolation of the last interval */
+static const int16_t trigSineTable[TRIG_TABLE_SIZE + 1] =
+{
+    TRIG_TABLE_256(TRIG_SIN_Q15), TRIG_SIN_Q15(TRIG_TABLE_SIZE)
+};
+
+static const float trigSineTableFloat[TRIG_TABLE_SIZE + 1] =
+{
+    TRIG_TABLE_256(TRIG_SIN_FLOAT), TRIG_SIN_FLOAT(TRIG_TABLE_SIZE)
+};
+
+static const uint16_t trigAtanTable[TRIG_TABLE_SIZE + 1] =
+{
+    TRIG_TABLE_256(TRIG_ATAN_Q15), TRIG_ATAN_Q15(TRIG_TABLE_SIZE)
+};
+
+static const float trigAtanTableFloat[TRIG_TABLE_SIZE + 1] =
+{
+    TRIG_TABLE_256(TRIG_ATAN_FLOAT), TRIG_ATAN_FLOAT(TRIG_TABLE_SIZE)
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: TRIG_RiseQ15(uint16_t, int32_t) </B>
+*
+* @brief Function interpolates the sine table forwards : the sine of the 
+* angle in the first quadrant.
+*
+* @param index table index, 0 to TRIG_TABLE_SIZE - 1.
+* @param fraction angle bits below the index.
+* @return Q15.
+*
+*/
+static inline int16_t TRIG_RiseQ15(uint16_t index, int32_t fraction)
+{
+    const int16_t *pPoint = &trigSineTable[index];
+
+    return (int16_t)(pPoint[0] + (((pPoint[1] - pPoint[0]) * fraction + 
+                    (1 << (TRIG_FRACTION_BITS - 1))) >> TRIG_FRACTION_BITS));
+}
+
+/**
+* <B> Function: TRIG_FallQ15(uint16_t, int32_t) </B>
+*
+* @brief Function interpolates the sine table backwards : the cosine of
+* the angle in the first quadrant.
+*
+* @param index table index, 0 to TRIG_TABLE_SIZE - 1.
+* @param fraction angle bits below the index.
+* @return Q15.
+*
+*/
+static inline int16_t TRIG_FallQ15(uint16_t index, int32_t fraction)
+{
+    const int16_t *pPoint = &trigSineTable[TRIG_TABLE_SIZE - index];
+
+    return (int16_t)(pPoint[0] + (((pPoint[-1] - pPoint[0]) * fraction + 
+                    (1 << (TRIG_FRACTION_BITS - 1))) >> TRIG_FRACTION_BITS));
+}
+
+/**
+* <B> Function: TRIG_Index(float, float *) </B>
+*
+* @brief Function converts an angle to the sine table : the table index 
+* with the quadrant above it and the fraction between two points.
+*
+* @param angle radians, below 2^22 in magnitude.
+* @param pFraction fraction, 0 to 1.
+* @return index, 4*TRIG_TABLE_SIZE per turn, modulo 2^32.
+*
+*/
+static inline uint32_t TRIG_Index(float angle, float *pFraction)
+{
+    float position = angle * TRIG_INDEX_PER_RAD;
+    int32_t index = (int32_t)position;
+
+    if ((float)index > position)
+    {
+        index--;
+    }
+    *pFraction = position - (float)index;
+    return (uint32_t)index;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: TRIG_SinQ15(uint16_t) </B>
+*
+* @brief Function computes the sine of an angle.
+*
+* @param angle angle, 65536 per turn.
+* @return sine, Q15.
+*
+* @example
+* <CODE> sin = TRIG_SinQ15(angle); </CODE>
+*
+*/
+int16_t TRIG_SinQ15(uint16_t angle)
+{
+    uint16_t index = (angle >> TRIG_FRACTION_BITS) & (TRIG_TABLE_SIZE - 1);
+    int32_t fraction = angle & ((1 << TRIG_FRACTION_BITS) - 1);
+    int16_t value;
+
+    if (angle & TRIG_ANGLE_QUARTER)
+    {
+        value = TRIG_FallQ15(index, fraction);
+    }
+    else
+    {
+        value = TRIG_RiseQ15(index, fraction);
+    }
+    return (angle & TRIG_ANGLE_HALF) ? -value : value;
+}
+
+/**
+* <B> Function: TRIG_CosQ15(uint16_t) </B>
+*
+* @brief Function computes the cosine of an angle.
+*
+* @param angle angle, 65536 per turn.
+* @return cosine, Q15.
+*
+* @example
+* <CODE> cos = TRIG_CosQ15(angle); </CODE>
+*
+*/
+int16_t TRIG_CosQ15(uint16_t angle)
+{
+    return TRIG_SinQ15((uint16_t)(angle + TRIG_ANGLE_QUARTER));
+}
+
+/**
+* <B> Function: TRIG_SinCosQ15(uint16_t, int16_t *, int16_t *) </B>
+*
+* @brief Function computes sine and cosine of an angle.
+*
+* @param angle angle, 65536 per turn.
+* @param pSin sine, Q15.
+* @param pCos cosine, Q15.
+* @return none.
+*
+* @example
+* <CODE> TRIG_SinCosQ15(angle, &sin, &cos); </CODE>
+*
+*/
+void TRIG_SinCosQ15(uint16_t angle, int16_t *pSin, int16_t *pCos)
+{
+    uint16_t index = (angle >> TRIG_FRACTION_BITS) & (TRIG_TABLE_SIZE - 1);
+    int32_t fraction = angle & ((1 << TRIG_FRACTION_BITS) - 1);
+    int16_t rise = TRIG_RiseQ15(index, fraction);
+    int16_t fall = TRIG_FallQ15(index, fraction);
+
+    switch (angle >> 14)
+    {
+        case 0:
+            *pSin = rise;
+            *pCos = fall;
+            break;
+        case 1:
+            *pSin = fall;
+            *pCos = -rise;
+            break;
+        case 2:
+            *pSin = -rise;
+            *pCos = -fall;
+            break;
+        default:
+            *pSin = -fall;
+            *pCos = rise;
+            break;
+    }
+}
+
+/**
+* <B> Function: TRIG_Atan2Q15(int16_t, int16_t) </B>
+*
+* @brief Function computes the angle of a vector, atan2(y, x).
+*
+* @param y Q15.
+* @param x Q15.
+* @return angle, 65536 per turn, 0 for the zero vector.
+*
+* @example
+* <CODE> angle = TRIG_Atan2Q15(ebeta, ealpha); </CODE>
+*
+*/
+uint16_t TRIG_Atan2Q15(int16_t y, int16_t x)
+{
+    uint32_t absY = (y < 0) ? -(int32_t)y : y;
+    uint32_t absX = (x < 0) ? -(int32_t)x : x;
+    uint32_t ratio, index, fraction, octant;
+    int32_t angle;
+
+    if ((absX | absY) == 0)
+    {
+        return 0;
+    }
+
+    /* Ratio of the smaller to the larger magnitude below 1, 16 bits */
+    if (absY > absX)
+    {
+        ratio = ((absX << 16) - absX) / absY;
+    }
+    else
+    {
+        ratio = ((absY << 16) - absY) / absX;
+    }
+    index = ratio >> (16 - TRIG_TABLE_BITS);
+    fraction = ratio & ((1 << (16 - TRIG_TABLE_BITS)) - 1);
+    octant = trigAtanTable[index] + 
+                ((((int32_t)trigAtanTable[index + 1] - trigAtanTable[index]) *
+                  (int32_t)fraction + (1 << (15 - TRIG_TABLE_BITS))) >> 
+                 (16 - TRIG_TABLE_BITS));
+    angle = (int32_t)((octant + 2) >> 2);
+
+    if (absY > absX)
+    {
+        angle = TRIG_ANGLE_QUARTER - angle;
+    }
+    if (x < 0)
+    {
+        angle = TRIG_ANGLE_HALF - angle;
+    }
+    return (uint16_t)((y < 0) ? -angle : angle);
+}
+
+/**
+* <B> Function: TRIG_Sin(float) </B>
+*
+* @brief Function computes the sine of an angle.
+*
+* @param angle radians, below 2^22 in magnitude.
+* @return sine.
+*
+* @example
+* <CODE> sin = TRIG_Sin(angle); </CODE>
+*
+*/
+float TRIG_Sin(float angle)
+{
+    float fraction, value;
+    uint32_t index = TRIG_Index(angle, &fraction);
+    const float *pPoint;
+
+    if (index & TRIG_TABLE_SIZE)
+    {
+        pPoint = &trigSineTableFloat[TRIG_TABLE_SIZE - 
+                                     (index & (TRIG_TABLE_SIZE - 1))];
+        value = pPoint[0] + (pPoint[-1] - pPoint[0]) * fraction;
+    }
+    else
+    {
+        pPoint = &trigSineTableFloat[index & (TRIG_TABLE_SIZE - 1)];
+        value = pPoint[0] + (pPoint[1] - pPoint[0]) * fraction;
+    }
+    return (index & (2 * TRIG_TABLE_SIZE)) ? -value : value;
+}
+
+/**
+* <B> Function: TRIG_Cos(float) </B>
+*
+* @brief Function computes the cosine of an angle.
+*
+* @param angle radians, below 2^22 in magnitude.
+* @return cosine.
+*
+* @example
+* <CODE> cos = TRIG_Cos(angle); </CODE>
+*
+*/
+float TRIG_Cos(float angle)
+{
+    return TRIG_Sin(angle + 0.5f * TRIG_PI);
+}
+
+/**
+* <B> Function: TRIG_SinCos(float, float *, float *) </B>
+*
+* @brief Function computes sine and cosine of an angle.
+*
+* @param angle radians, below 2^22 in magnitude.
+* @param pSin sine.
+* @param pCos cosine.
+* @return none.
+*
+* @example
+* <CODE> TRIG_SinCos(angle, &sin, &cos); </CODE>
+*
+*/
+void TRIG_SinCos(float angle, float *pSin, float *pCos)
+{
+    float fraction, rise, fall;
+    uint32_t index = TRIG_Index(angle, &fraction);
+    const float *pRise = &trigSineTableFloat[index & (TRIG_TABLE_SIZE - 1)];
+    const float *pFall = &trigSineTableFloat[TRIG_TABLE_SIZE - 
+                                             (index & (TRIG_TABLE_SIZE - 1))];
+
+    rise = pRise[0] + (pRise[1] - pRise[0]) * fraction;
+    fall = pFall[0] + (pFall[-1] - pFall[0]) * fraction;
+    switch ((index >> TRIG_TABLE_BITS) & 3)
+    {
+        case 0:
+            *pSin = rise;
+            *pCos = fall;
+            break;
+        case 1:
+            *pSin = fall;
+            *pCos = -rise;
+            break;
+        case 2:
+            *pSin = -rise;
+            *pCos = -fall;
+            break;
+        default:
+            *pSin = -fall;
+            *pCos = rise;
+            break;
+    }
+}
+
+/**
+* <B> Function: TRIG_Atan2(float, float) </B>
+*
+* @brief Function computes the angle of a vector, atan2(y, x).
+*
+* @param y any unit.
+* @param x same unit as y.
+* @return angle, radians from -pi to pi, 0 for the zero vector.
+*
+* @example
+* <CODE> angle = TRIG_Atan2(ebeta, ealpha); </CODE>
+*
+*/
+float TRIG_Atan2(float y, float x)
+{
+    float absY = (y < 0.0f) ? -y : y;
+    float absX = (x < 0.0f) ? -x : x;
+    float ratio, position, angle;
+    uint16_t index;
+
+    if (absY > absX)
+    {
+        ratio = absX / absY;
+    }
+    else if (absX > 0.0f)
+    {
+        ratio = absY / absX;
+    }
+    else
+    {
+        return 0.0f;
+    }
+    position = ratio * TRIG_TABLE_SIZE;
+    index = (uint16_t)position;
+    if (index >= TRIG_TABLE_SIZE)
+    {
+        index = TRIG_TABLE_SIZE - 1;
+    }
+    angle = trigAtanTableFloat[index] + (trigAtanTableFloat[index + 1] - 
+                trigAtanTableFloat[index]) * (position - (float)index);
+
+    if (absY > absX)
+    {
+        angle = 0.5f * TRIG_PI - angle;
+    }
+    if (x < 0.0f)
+    {
+        angle = TRIG_PI - angle;
+    }
+    return (y < 0.0f) ? -angle : angle;
+}
+
+// </editor-fold>
@@ -0,0 +1,84 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file trig.h
+ *
+ * @brief This header file lists the functions and definitions of the sine,
+ * cosine and arc tangent of the control.
+ *
+ * Component: TRIG
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __TRIG_H
+#define __TRIG_H
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Intervals of the tables, a quarter turn for the sine and [0, 1] for the
+   arc tangent. The tables are generated with 256 intervals */
+#define TRIG_TABLE_BITS         8
+#define TRIG_TABLE_SIZE         (1 << TRIG_TABLE_BITS)
+
+/* Angles of the Q15 functions, 65536 per turn */
+#define TRIG_ANGLE_QUARTER      0x4000
+#define TRIG_ANGLE_HALF         0x8000
+
+#define TRIG_PI                 3.14159265358979f
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int16_t TRIG_SinQ15(uint16_t);
+int16_t TRIG_CosQ15(uint16_t);
+void TRIG_SinCosQ15(uint16_t, int16_t *, int16_t *);
+uint16_t TRIG_Atan2Q15(int16_t, int16_t);
+
+float TRIG_Sin(float);
+float TRIG_Cos(float);
+void TRIG_SinCos(float, float *, float *);
+float TRIG_Atan2(float, float);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __TRIG_H
@@ -0,0 +1,185 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file avg_bench.c
+ *
+ * @brief Host benchmark of the moving average filter modes of measure.c
+ * (MCAPP_MeasureAvg). For each mode it reports the cost per sample, the
+ * delay of the output after an input step and the noise left on the output.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "measure.h"
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Filter length 2^AVG_BENCH_SCALER samples */
+#define AVG_BENCH_SCALER        4
+#define AVG_BENCH_LENGTH        (1 << AVG_BENCH_SCALER)
+
+/* Input step and white noise amplitude, Q15 */
+#define AVG_BENCH_STEP          16384
+#define AVG_BENCH_NOISE         4096
+
+#define AVG_BENCH_SAMPLES       65536
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    const char *pName;
+    uint16_t mode;
+
+} AVG_BENCH_MODE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+static const AVG_BENCH_MODE_T avgBenchMode[] =
+{
+    {"block",       MEASURE_AVG_BLOCK},
+    {"sliding",     MEASURE_AVG_SLIDING},
+    {"recursive",   MEASURE_AVG_RECURSIVE},
+};
+
+static uint32_t avgBenchSeed = 0x2545F491;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static int16_t AVG_BENCH_Noise(void)
+{
+    avgBenchSeed ^= avgBenchSeed << 13;
+    avgBenchSeed ^= avgBenchSeed >> 17;
+    avgBenchSeed ^= avgBenchSeed << 5;
+    return (int16_t)((int32_t)(avgBenchSeed % (2*AVG_BENCH_NOISE + 1)) -
+                     AVG_BENCH_NOISE);
+}
+
+static void AVG_BENCH_Run(const AVG_BENCH_MODE_T *pMode,
+                          const int16_t *pNoise)
+{
+    MCAPP_MEASURE_AVG_T filter;
+    int16_t buffer[AVG_BENCH_LENGTH];
+    BENCH_STAT_T stat;
+    uint32_t i, k, delay50 = 0, delay90 = 0, updates = 0;
+    double sumSquare = 0;
+    int16_t avg, previous;
+    uint64_t start;
+
+    /* Step response from zero, delay counted in samples after the step */
+    MCAPP_MeasureAvgInitMode(&filter, AVG_BENCH_SCALER, pMode->mode, buffer);
+    previous = 0;
+    for (i = 1; i <= 8*AVG_BENCH_LENGTH; i++)
+    {
+        filter.input = AVG_BENCH_STEP;
+        avg = MCAPP_MeasureAvg(&filter);
+        if (avg != previous)
+        {
+            updates++;
+        }
+        previous = avg;
+        if ((delay50 == 0) && (avg >= AVG_BENCH_STEP/2))
+        {
+            delay50 = i;
+        }
+        if ((delay90 == 0) && (avg >= AVG_BENCH_STEP*9/10))
+        {
+            delay90 = i;
+        }
+    }
+
+    /* Output noise at zero mean input, after the filter settled */
+    MCAPP_MeasureAvgInitMode(&filter, AVG_BENCH_SCALER, pMode->mode, buffer);
+    BENCH_StatInit(&stat, BENCH_BATCH_CALLS);
+    for (i = 0; i < AVG_BENCH_SAMPLES; i += BENCH_BATCH_CALLS)
+    {
+        double batchSquare = 0;
+
+        start = BENCH_Count();
+        for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+        {
+            filter.input = pNoise[k];
+            avg = MCAPP_MeasureAvg(&filter);
+            batchSquare += (double)avg*avg;
+        }
+        BENCH_StatAdd(&stat, BENCH_Count() - start);
+        if (i >= 8*AVG_BENCH_LENGTH)
+        {
+            sumSquare += batchSquare;
+        }
+    }
+
+    BENCH_StatReport(stdout, pMode->pName, &stat);
+    printf("%-32s %8u 50%% %8u 90%% [samples] %4u output steps\n", "",
+           (unsigned)delay50, (unsigned)delay90, (unsigned)updates);
+    printf("%-32s %8.4f noise rms / input rms\n", "",
+           sqrt(sumSquare / (AVG_BENCH_SAMPLES - 8*AVG_BENCH_LENGTH)) /
+           (AVG_BENCH_NOISE / sqrt(3.0)));
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(void)
+{
+    static int16_t noise[AVG_BENCH_SAMPLES];
+    uint32_t i;
+
+    for (i = 0; i < AVG_BENCH_SAMPLES; i++)
+    {
+        noise[i] = AVG_BENCH_Noise();
+    }
+
+    printf("Moving average, %d samples\n", AVG_BENCH_LENGTH);
+    for (i = 0; i < sizeof(avgBenchMode)/sizeof(avgBenchMode[0]); i++)
+    {
+        AVG_BENCH_Run(&avgBenchMode[i], noise);
+    }
+    return 0;
+}
+
+// </editor-fold>
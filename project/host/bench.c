@@ -0,0 +1,196 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file bench.c
+ *
+ * @brief Host benchmark helpers, see bench.h.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: BENCH_Count() </B>
+*
+* @brief Function reads the benchmark counter.
+*
+* @param none.
+* @return time stamp counter, or monotonic time in ns without one.
+*
+* @example
+* <CODE> start = BENCH_Count(); </CODE>
+*
+*/
+uint64_t BENCH_Count(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec*1000000000ULL + (uint64_t)now.tv_nsec;
+#endif
+}
+
+/**
+* <B> Function: BENCH_CountUnit() </B>
+*
+* @brief Function returns the unit of BENCH_Count().
+*
+* @param none.
+* @return unit name.
+*
+* @example
+* <CODE> printf("[%s]\n", BENCH_CountUnit()); </CODE>
+*
+*/
+const char *BENCH_CountUnit(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return "TSC";
+#else
+    return "ns";
+#endif
+}
+
+/**
+* <B> Function: BENCH_WallSeconds() </B>
+*
+* @brief Function reads the monotonic wall clock.
+*
+* @param none.
+* @return time in seconds.
+*
+* @example
+* <CODE> wall = BENCH_WallSeconds(); </CODE>
+*
+*/
+double BENCH_WallSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + 1e-9 * now.tv_nsec;
+}
+
+/**
+* <B> Function: BENCH_StatInit(BENCH_STAT_T *, uint32_t) </B>
+*
+* @brief Function clears the statistics of a kernel.
+*
+* @param pStat statistics.
+* @param calls calls per timed batch.
+* @return none.
+*
+* @example
+* <CODE> BENCH_StatInit(&stat, BENCH_BATCH_CALLS); </CODE>
+*
+*/
+void BENCH_StatInit(BENCH_STAT_T *pStat, uint32_t calls)
+{
+    pStat->total = 0;
+    pStat->best = UINT64_MAX;
+    pStat->worst = 0;
+    pStat->batches = 0;
+    pStat->calls = calls;
+}
+
+/**
+* <B> Function: BENCH_StatAdd(BENCH_STAT_T *, uint64_t) </B>
+*
+* @brief Function adds the cost of one batch.
+*
+* @param pStat statistics.
+* @param count BENCH_Count() difference over the batch.
+* @return none.
+*
+* @example
+* <CODE> BENCH_StatAdd(&stat, BENCH_Count() - start); </CODE>
+*
+*/
+void BENCH_StatAdd(BENCH_STAT_T *pStat, uint64_t count)
+{
+    pStat->total += count;
+    pStat->batches++;
+    if (count < pStat->best)
+    {
+        pStat->best = count;
+    }
+    if (count > pStat->worst)
+    {
+        pStat->worst = count;
+    }
+}
+
+/**
+* <B> Function: BENCH_StatReport(FILE *, const char *, const BENCH_STAT_T *)
+* </B>
+*
+* @brief Function prints the mean, best and worst cost of one call.
+*
+* @param pFile output.
+* @param pName kernel name.
+* @param pStat statistics.
+* @return none.
+*
+* @example
+* <CODE> BENCH_StatReport(stdout, "SVPWM", &stat); </CODE>
+*
+*/
+void BENCH_StatReport(FILE *pFile, const char *pName, const BENCH_STAT_T *pStat)
+{
+    double calls = (double)pStat->calls;
+
+    if (pStat->batches == 0)
+    {
+        return;
+    }
+    fprintf(pFile, "%-32s %8.1f mean %8.1f best %8.1f worst [%s/call]\n",
+            pName, (double)pStat->total / (calls * pStat->batches),
+            (double)pStat->best / calls, (double)pStat->worst / calls,
+            BENCH_CountUnit());
+}
+
+// </editor-fold>
@@ -0,0 +1,97 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file bench.h
+ *
+ * @brief This header file lists the functions and definitions of the host
+ * benchmark helpers. A kernel is timed in batches of calls; the cost of
+ * one call is reported as the mean, best and worst batch average.
+ *
+ * Costs are counted with the x86 time stamp counter where available and in
+ * nanoseconds otherwise. They compare variants of a kernel on the host and
+ * are not dsPIC33A cycle counts.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Calls of a kernel timed together */
+#define BENCH_BATCH_CALLS       64
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    uint64_t
+        total,              /* Cost of all batches */
+        best,               /* Cost of the cheapest batch */
+        worst;              /* Cost of the most expensive batch */
+
+    uint32_t
+        batches,            /* Batches timed */
+        calls;              /* Calls per batch */
+
+} BENCH_STAT_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+uint64_t BENCH_Count(void);
+const char *BENCH_CountUnit(void);
+double BENCH_WallSeconds(void);
+
+void BENCH_StatInit(BENCH_STAT_T *, uint32_t);
+void BENCH_StatAdd(BENCH_STAT_T *, uint64_t);
+void BENCH_StatReport(FILE *, const char *, const BENCH_STAT_T *);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __BENCH_H
@@ -0,0 +1,466 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file foc_bench.c
+ *
+ * @brief Host benchmark of the current control of foc.c. The three motors
+ * run closed loop on a resistive-inductive load model: every PWM period the
+ * bench writes the phase current samples of each motor to its ADC data
+ * registers, captures them with ADC_FrameCapture(), runs MCAPP_FocService()
+ * and applies the duty cycles written to the PWM generators to the load.
+ * It reports the cost of one service call per motor, mean and worst case,
+ * the cost of the three motors per PWM period, the current error of each
+ * motor at the end of the run and the error of the decimated phase voltage
+ * samples. The worst case is also given without
+ * the slowest 0.1% of the calls, which the host operating system delays.
+ *
+ * Usage: foc_bench [-n periods]
+ *        -n  PWM periods to run, default 20000
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "adc.h"
+#include "pwm.h"
+#include "foc.h"
+#include "fast_loop.h"
+#include "measure.h"
+#include "host_sfr.h"
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+#define FOC_BENCH_PERIODS       20000
+
+/* Load : full scale of the voltages (VBUS measurement) and currents */
+#define FOC_BENCH_VOLT_FS       ((double)MC1_PEAK_VOLTAGE)
+#define FOC_BENCH_AMP_FS        ((double)MC1_PEAK_CURRENT)
+#define FOC_BENCH_R             0.5         /* Ohm */
+#define FOC_BENCH_L             0.0005      /* H */
+#define FOC_BENCH_VBUS_COUNT    2000        /* 39 V */
+
+/* Current references, Q15 of MC1_PEAK_CURRENT, and electrical frequency */
+#define FOC_BENCH_ID_REF        (-1000)
+#define FOC_BENCH_IQ_REF        9830
+#define FOC_BENCH_HZ            50.0
+
+/* Periods at the end of the run the current error is averaged over */
+#define FOC_BENCH_SETTLED       1000
+
+/* Share of the calls above the reported worst case, host scheduling noise */
+#define FOC_BENCH_OUTLIERS      0.001
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    double
+        ia,                 /* Phase currents, A */
+        ib,
+        ic,
+        va,                 /* Phase voltages of the last period, V */
+        vb,
+        vc;
+
+} FOC_BENCH_LOAD_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+static MCAPP_FOC_T focBench[PWM_MOTOR_COUNT];
+static MCAPP_MEASURE_T measureBench[PWM_MOTOR_COUNT];
+static FOC_BENCH_LOAD_T loadBench[PWM_MOTOR_COUNT];
+static MCAPP_FAST_LOOP_T fastLoopBench;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: FOC_BENCH_AdcCount(double) </B>
+*
+* @brief Returns the 12 bit ADC result of a phase current.
+*/
+static uint32_t FOC_BENCH_AdcCount(double current)
+{
+    long count = HALF_ADC_COUNT - lround(current / FOC_BENCH_AMP_FS * 2048.0);
+
+    return (uint32_t)((count < 0) ? 0 : (count > 4095) ? 4095 : count);
+}
+
+/**
+* <B> Function: FOC_BENCH_VoltCount(double) </B>
+*
+* @brief Returns the 12 bit ADC result of a phase voltage, in the scale of
+* the VBUS measurement.
+*/
+static uint32_t FOC_BENCH_VoltCount(double voltage)
+{
+    long count = lround(voltage / FOC_BENCH_VOLT_FS * 4096.0);
+
+    return (uint32_t)((count < 0) ? 0 : (count > 4095) ? 4095 : count);
+}
+
+/**
+* <B> Function: FOC_BENCH_Compare(const void *, const void *) </B>
+*/
+static int FOC_BENCH_Compare(const void *pA, const void *pB)
+{
+    uint32_t a = *(const uint32_t *)pA, b = *(const uint32_t *)pB;
+
+    return (a > b) - (a < b);
+}
+
+/**
+* <B> Function: FOC_BENCH_Percentile(uint32_t *, uint32_t) </B>
+*
+* @brief Returns the cost the calls exceed with FOC_BENCH_OUTLIERS
+* probability. Sorts the costs.
+*/
+static uint32_t FOC_BENCH_Percentile(uint32_t *pCost, uint32_t count)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    qsort(pCost, count, sizeof(uint32_t), FOC_BENCH_Compare);
+    return pCost[(uint32_t)((count - 1) * (1.0 - FOC_BENCH_OUTLIERS))];
+}
+
+/**
+* <B> Function: FOC_BENCH_Sample(uint16_t) </B>
+*
+* @brief Writes the phase currents, VBUS and the phase voltages of a motor
+* to its ADC data registers, the currents in the format of MC1_ADCBUF_IA. 
+* An accumulating current channel gets the sum of its conversions of the 
+* same current.
+*/
+static void FOC_BENCH_Sample(uint16_t motor)
+{
+    *ADC_ChannelData(motor, ADC_SIGNAL_IA) = 
+        FOC_BENCH_AdcCount(loadBench[motor].ia) * 
+        ADC_ChannelSamples(motor, ADC_SIGNAL_IA);
+    *ADC_ChannelData(motor, ADC_SIGNAL_IB) = 
+        FOC_BENCH_AdcCount(loadBench[motor].ib) * 
+        ADC_ChannelSamples(motor, ADC_SIGNAL_IB);
+    *ADC_ChannelData(motor, ADC_SIGNAL_VBUS) = FOC_BENCH_VBUS_COUNT;
+    *ADC_ChannelData(motor, ADC_SIGNAL_VA) = 
+        FOC_BENCH_VoltCount(loadBench[motor].va);
+    *ADC_ChannelData(motor, ADC_SIGNAL_VB) = 
+        FOC_BENCH_VoltCount(loadBench[motor].vb);
+    *ADC_ChannelData(motor, ADC_SIGNAL_VC) = 
+        FOC_BENCH_VoltCount(loadBench[motor].vc);
+}
+
+/**
+* <B> Function: FOC_BENCH_Load(uint16_t) </B>
+*
+* @brief Applies the duty cycles of the phase generators of a motor to its
+* load for one PWM period. The phase voltages are the averages of the
+* cycle, the star point follows their mean.
+*/
+static void FOC_BENCH_Load(uint16_t motor)
+{
+    FOC_BENCH_LOAD_T *pLoad = &loadBench[motor];
+    double period, vbus, v[3], mean, decay, gain;
+    double *pCurrent[3] = {&pLoad->ia, &pLoad->ib, &pLoad->ic};
+    uint16_t phase;
+
+    period = PWM_MotorPeriod(&pwmTiming, motor);
+    vbus = FOC_BENCH_VBUS_COUNT * 8.0 / 32768.0 * FOC_BENCH_VOLT_FS;
+    for (phase = 0; phase < 3; phase++)
+    {
+        v[phase] = fmin(PWM_GENERATOR_REG(PWM_MotorRegisters(motor, phase),
+                                          PWM_REG_DC), period) / period * vbus;
+    }
+    pLoad->va = v[0];
+    pLoad->vb = v[1];
+    pLoad->vc = v[2];
+    mean = (v[0] + v[1] + v[2]) / 3.0;
+    decay = exp(-FOC_BENCH_R / FOC_BENCH_L / (PWMFREQUENCY_HZ));
+    gain = (1.0 - decay) / FOC_BENCH_R;
+    for (phase = 0; phase < 3; phase++)
+    {
+        *pCurrent[phase] = *pCurrent[phase] * decay +
+                           (v[phase] - mean) * gain;
+    }
+}
+
+/**
+* <B> Function: FOC_BENCH_FastLoop(uint32_t) </B>
+*
+* @brief Runs the three motors from one interrupt with the scheduler of
+* fast_loop.c and reports its cost per PWM period, the order of the motors
+* and their deadlines.
+*/
+static void FOC_BENCH_FastLoop(uint32_t periods)
+{
+    static const char *pMotorName[] = {"MC1", "MC2", "MC3"};
+    BENCH_STAT_T service;
+    uint32_t *pCost, timed = 0, n;
+    uint64_t start, cost;
+    uint16_t motor, i;
+
+    pCost = malloc(periods * sizeof(uint32_t));
+    if (pCost == NULL)
+    {
+        perror("foc_bench");
+        return;
+    }
+    BENCH_StatInit(&service, 1);
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        MCAPP_MeasureCurrentInit(&measureBench[motor]);
+        MCAPP_MeasurePhaseVoltInit(&measureBench[motor], 
+            PWM_MotorVoltageTriggerSet(motor, MEASURE_PHASEVOLT_FACTOR));
+        MCAPP_FocInit(&focBench[motor], motor, &pwmTiming);
+        focBench[motor].speed = (int16_t)lround(65536.0 * FOC_BENCH_HZ /
+                                                PWMFREQUENCY_HZ);
+        memset(&loadBench[motor], 0, sizeof(FOC_BENCH_LOAD_T));
+    }
+    MCAPP_FastLoopInit(&fastLoopBench, focBench, measureBench, &pwmTiming);
+
+    for (n = 0; n < periods; n++)
+    {
+        for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+        {
+            FOC_BENCH_Sample(motor);
+        }
+        start = BENCH_Count();
+        MCAPP_FastLoopService(&fastLoopBench);
+        cost = BENCH_Count() - start;
+        if (focBench[fastLoopBench.last].enable)
+        {
+            BENCH_StatAdd(&service, cost);
+            pCost[timed++] = (uint32_t)cost;
+        }
+        for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+        {
+            if (focBench[motor].enable)
+            {
+                focBench[motor].idRef = FOC_BENCH_ID_REF;
+                focBench[motor].iqRef = FOC_BENCH_IQ_REF;
+            }
+            FOC_BENCH_Load(motor);
+        }
+    }
+
+    BENCH_StatReport(stdout, "MCAPP_FastLoopService", &service);
+    printf("%-32s %8u worst of %.1f%% of the calls [%s/call]\n", "",
+           (unsigned)FOC_BENCH_Percentile(pCost, timed),
+           100.0 * (1.0 - FOC_BENCH_OUTLIERS), BENCH_CountUnit());
+    printf("%-32s", "order, deadline after interrupt");
+    for (i = 0; i < PWM_MOTOR_COUNT; i++)
+    {
+        motor = fastLoopBench.order[i];
+        printf(" %s %.2f us", pMotorName[motor],
+               fastLoopBench.deadline[motor] * 1e6 / TIMER1_CLOCK);
+    }
+    printf("\n");
+    printf("%-32s %8lu dropped schedules %8u samples without a quiet gap\n",
+           "current triggers", (unsigned long)fastLoopBench.reorders,
+           (unsigned)fastLoopBench.trigger.misses);
+    free(pCost);
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    static const char *pMotorName[] = {"MC1", "MC2", "MC3"};
+    BENCH_STAT_T service[PWM_MOTOR_COUNT], period;
+    double errorD[PWM_MOTOR_COUNT], errorQ[PWM_MOTOR_COUNT], seconds;
+    double errorV = 0.0;
+    const MCAPP_MEASURE_PHASEVOLT_T *pPhaseVolt;
+    uint32_t *pCost[PWM_MOTOR_COUNT + 1], timed[PWM_MOTOR_COUNT + 1];
+    uint32_t voltSamples = 0;
+    uint16_t updates;
+    uint32_t periods = FOC_BENCH_PERIODS, n, settled = 0, accesses = 0, sfr;
+    uint64_t start, cost, total;
+    char name[48];
+    uint16_t motor;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((strcmp(argv[arg], "-n") == 0) && (arg + 1 < argc))
+        {
+            periods = (uint32_t)atol(argv[++arg]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: foc_bench [-n periods]\n");
+            return 2;
+        }
+    }
+    if (periods < 2 * FOC_BENCH_SETTLED)
+    {
+        periods = 2 * FOC_BENCH_SETTLED;
+    }
+    for (motor = 0; motor <= PWM_MOTOR_COUNT; motor++)
+    {
+        pCost[motor] = malloc(periods * sizeof(uint32_t));
+        if (pCost[motor] == NULL)
+        {
+            perror("foc_bench");
+            return 1;
+        }
+        timed[motor] = 0;
+    }
+
+    HOST_SfrReset();
+    InitPWMGenerators();
+    ADC_FrameInit();
+    BENCH_StatInit(&period, 1);
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        MCAPP_MeasureCurrentInit(&measureBench[motor]);
+        MCAPP_MeasurePhaseVoltInit(&measureBench[motor], 
+            PWM_MotorVoltageTriggerSet(motor, MEASURE_PHASEVOLT_FACTOR));
+        MCAPP_FocInit(&focBench[motor], motor, &pwmTiming);
+        focBench[motor].speed = (int16_t)lround(65536.0 * FOC_BENCH_HZ /
+                                                PWMFREQUENCY_HZ);
+        BENCH_StatInit(&service[motor], 1);
+        errorD[motor] = 0.0;
+        errorQ[motor] = 0.0;
+    }
+
+    seconds = BENCH_WallSeconds();
+    for (n = 0; n < periods; n++)
+    {
+        total = 0;
+        for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+        {
+            FOC_BENCH_Sample(motor);
+            ADC_FrameCapture();
+            pPhaseVolt = &measureBench[motor].measurePhaseVolt;
+            updates = pPhaseVolt->updates;
+            sfr = HOST_SfrTotalAccessCount();
+            start = BENCH_Count();
+            MCAPP_FocService(&focBench[motor], &measureBench[motor]);
+            cost = BENCH_Count() - start;
+            total += cost;
+            /* Phase voltage sample against the voltages written to the ADC */
+            if (pPhaseVolt->updates != updates)
+            {
+                errorV += fabs(pPhaseVolt->Va * FOC_BENCH_VOLT_FS / 32768.0 - 
+                               loadBench[motor].va) +
+                          fabs(pPhaseVolt->Vb * FOC_BENCH_VOLT_FS / 32768.0 - 
+                               loadBench[motor].vb) +
+                          fabs(pPhaseVolt->Vc * FOC_BENCH_VOLT_FS / 32768.0 - 
+                               loadBench[motor].vc);
+                voltSamples++;
+            }
+            /* Timed once the control runs */
+            if (focBench[motor].enable)
+            {
+                accesses += HOST_SfrTotalAccessCount() - sfr;
+                BENCH_StatAdd(&service[motor], cost);
+                pCost[motor][timed[motor]++] = (uint32_t)cost;
+                focBench[motor].idRef = FOC_BENCH_ID_REF;
+                focBench[motor].iqRef = FOC_BENCH_IQ_REF;
+            }
+            FOC_BENCH_Load(motor);
+        }
+        if (focBench[PWM_MOTOR_COUNT - 1].enable)
+        {
+            BENCH_StatAdd(&period, total);
+            pCost[PWM_MOTOR_COUNT][timed[PWM_MOTOR_COUNT]++] = (uint32_t)total;
+        }
+        if (n >= periods - FOC_BENCH_SETTLED)
+        {
+            for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+            {
+                errorD[motor] += fabs((double)focBench[motor].id -
+                                      FOC_BENCH_ID_REF);
+                errorQ[motor] += fabs((double)focBench[motor].iq -
+                                      FOC_BENCH_IQ_REF);
+            }
+            settled++;
+        }
+    }
+    seconds = BENCH_WallSeconds() - seconds;
+
+    printf("FOC current control, %u PWM periods at %u Hz, id %d iq %d "
+           "(Q15), %.0f Hz\n", (unsigned)periods, (unsigned)PWMFREQUENCY_HZ,
+           FOC_BENCH_ID_REF, FOC_BENCH_IQ_REF, FOC_BENCH_HZ);
+    for (motor = 0; motor <= PWM_MOTOR_COUNT; motor++)
+    {
+        if (motor < PWM_MOTOR_COUNT)
+        {
+            snprintf(name, sizeof(name), "MCAPP_FocService %s",
+                     pMotorName[motor]);
+            BENCH_StatReport(stdout, name, &service[motor]);
+        }
+        else
+        {
+            BENCH_StatReport(stdout, "three motors per PWM period", &period);
+        }
+        printf("%-32s %8u worst of %.1f%% of the calls [%s/call]\n", "",
+               (unsigned)FOC_BENCH_Percentile(pCost[motor], timed[motor]),
+               100.0 * (1.0 - FOC_BENCH_OUTLIERS), BENCH_CountUnit());
+        free(pCost[motor]);
+    }
+    printf("%-32s %8.2f us per PWM period of %.2f us\n",
+           "host wall time, with load model", seconds * 1e6 / periods,
+           1e6 / PWMFREQUENCY_HZ);
+    printf("%-32s %8.1f per call\n", "register accesses",
+           (double)accesses / (timed[0] + timed[1] + timed[2]));
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        printf("%-32s %8.1f id %8.1f iq [Q15, mean of the last %u periods]\n",
+               (motor == 0) ? "current error" : "", errorD[motor] / settled,
+               errorQ[motor] / settled, (unsigned)settled);
+    }
+    printf("%-32s %8.3f V mean, %.3f samples per PWM period and motor\n",
+           "phase voltage error", 
+           (voltSamples > 0) ? errorV / (3.0 * voltSamples) : 0.0,
+           (double)voltSamples / ((double)periods * PWM_MOTOR_COUNT));
+
+    /* Same control from one interrupt per PWM period */
+    FOC_BENCH_FastLoop(periods);
+    return 0;
+}
+
+// </editor-fold>
@@ -0,0 +1,149 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file host_main.c
+ *
+ * @brief Host entry point. Runs the start-up sequence of main() against the
+ * host register model and reports the model time and register traffic.
+ *
+ * Usage: pmsm_host [-d]
+ *        -d  dump every non-zero register after initialization
+ *
+ * Built with BOOT_PROFILE (make profile), the start-up sequence is also 
+ * timed by the boot profiler and its UART1 report is printed to stdout.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <xc.h>
+
+#include "board_service.h"
+#include "boot_profile.h"
+#include "host_sfr.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static void HOST_ReportStage(const char *pName, uint64_t startTicks,
+                             uint32_t startAccesses)
+{
+    uint64_t ticks = HOST_SfrTicks() - startTicks;
+
+    printf("%-24s %10.2f us %8u accesses\n", pName,
+           (double)ticks * 1e6 / HOST_TICK_FREQUENCY_HZ,
+           (unsigned)(HOST_SfrTotalAccessCount() - startAccesses));
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    uint64_t ticks;
+    uint32_t accesses;
+    bool dump = (argc > 1) && (strcmp(argv[1], "-d") == 0);
+
+    HOST_SfrReset();
+    BOOT_PROFILE_START();
+
+    ticks = HOST_SfrTicks();
+    accesses = HOST_SfrTotalAccessCount();
+    BOOT_PROFILE_BEGIN("CLOCK_BringUpStart");
+    CLOCK_BringUpStart();
+    BOOT_PROFILE_END();
+    HOST_ReportStage("CLOCK_BringUpStart", ticks, accesses);
+
+    ticks = HOST_SfrTicks();
+    accesses = HOST_SfrTotalAccessCount();
+    BOOT_PROFILE_BEGIN("SetupGPIOPorts");
+    SetupGPIOPorts();
+    BOOT_PROFILE_END();
+    HOST_ReportStage("SetupGPIOPorts", ticks, accesses);
+
+    ticks = HOST_SfrTicks();
+    accesses = HOST_SfrTotalAccessCount();
+    BOOT_PROFILE_BEGIN("HAL_ConfigurePeripherals");
+    HAL_ConfigurePeripherals();
+    BOOT_PROFILE_END();
+    HOST_ReportStage("HAL_ConfigurePeripherals", ticks, accesses);
+
+    ticks = HOST_SfrTicks();
+    accesses = HOST_SfrTotalAccessCount();
+    BOOT_PROFILE_BEGIN("CLOCK_BringUpTask");
+    while (CLOCK_BringUpBusy())
+    {
+        CLOCK_BringUpTask();
+    }
+    BOOT_PROFILE_END();
+    HOST_ReportStage("CLOCK_BringUpTask", ticks, accesses);
+
+    if (clockBringUp.state == CLOCK_STATE_READY)
+    {
+        ticks = HOST_SfrTicks();
+        accesses = HOST_SfrTotalAccessCount();
+        BOOT_PROFILE_BEGIN("HAL_EnablePeripherals");
+        if (HAL_EnablePeripherals() == false)
+        {
+            printf("ADC cores not ready, ready mask 0x%X\n",
+                   (unsigned)adcCoreStatus.readyMask);
+        }
+        BOOT_PROFILE_END();
+        HOST_ReportStage("HAL_EnablePeripherals", ticks, accesses);
+    }
+    else
+    {
+        printf("Clock bring-up timed out in state %u, running on FRC\n",
+               (unsigned)clockBringUp.faultState);
+    }
+
+    HOST_ReportStage("Total", 0, 0);
+
+#ifdef BOOT_PROFILE
+    HOST_SfrUartOutput(stdout);
+    BOOT_PROFILE_REPORT();
+    HOST_SfrUartOutput(NULL);
+#endif
+
+    if (dump)
+    {
+        HOST_SfrDump(stdout);
+    }
+    return 0;
+}
+
+// </editor-fold>
@@ -0,0 +1,569 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file host_sfr.c
+ *
+ * @brief This module implements the host register model: a memory backed
+ * register file and the hardware side effects the HAL relies on.
+ *
+ * Register writes are detected lazily: the register touched by the previous
+ * access is compared against its shadow copy on the next access, so a bit
+ * that is set by the HAL starts its latency timer at the access that set it.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <xc.h>
+
+#include "host_sfr.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+/* Hardware reaction to a bit set by software */
+typedef enum
+{
+    HOST_EVENT_SELF_CLEAR,      /* Request bit clears when the latency elapses */
+    HOST_EVENT_READY,           /* Ready bit sets while the enable bit is set */
+    HOST_EVENT_REQUEST          /* Request bit reads as 0 and sets a status
+                                   bit that clears when the latency elapses */
+} HOST_EVENT_TYPE_T;
+
+typedef struct
+{
+    HOST_SFR_INDEX_T sfr;
+    uint32_t triggerMask;       /* Bit written by software */
+    uint32_t responseMask;      /* Bit changed by the hardware */
+    HOST_EVENT_TYPE_T type;
+    uint32_t latency;
+    bool pending;
+    uint64_t deadline;
+} HOST_EVENT_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+#define HOST_SFR_NAME(name)     #name,
+
+static const char *hostSfrNames[HOST_SFR_COUNT] =
+{
+    HOST_SFR_LIST(HOST_SFR_NAME)
+};
+
+static volatile uint32_t hostSfr[HOST_SFR_COUNT];
+static uint32_t hostSfrShadow[HOST_SFR_COUNT];
+static uint32_t hostSfrAccessCount[HOST_SFR_COUNT];
+static volatile HOST_IRQ_T hostIrq[HOST_IRQ_COUNT];
+
+static int32_t hostLastSfr;
+static uint64_t hostTicks;
+static uint64_t hostTimer1Ticks;
+static FILE *hostUartOutput;
+
+uint32_t HOST_FPDMDAC;
+
+/* Bit masks of the model events, taken from the host bit field layouts.
+   PLLxCON and CLKxCON share the same layout. */
+#define HOST_CLKCON_OSWEN       (1UL << 8)
+#define HOST_CLKCON_DIVSWEN     (1UL << 9)
+#define HOST_CLKCON_FOUTSWEN    (1UL << 10)
+#define HOST_CLKCON_PLLSWEN     (1UL << 11)
+#define HOST_CLKCON_NOSC_MASK   (0xFUL << 0)
+#define HOST_CLKCON_COSC_POS    4
+#define HOST_CLKCON_COSC_MASK   (0xFUL << HOST_CLKCON_COSC_POS)
+#define HOST_CLKCON_ON          (1UL << 15)
+#define HOST_CLKCON_CLKRDY      (1UL << 31)
+#define HOST_ADCON_ON           (1UL << 15)
+#define HOST_ADCON_ADRDY        (1UL << 31)
+#define HOST_PGSTAT_UPDREQ      (1UL << 3)
+#define HOST_PGSTAT_UPDATE      (1UL << 4)
+#define HOST_TCON_TCKPS_POS     4
+#define HOST_TCON_TCKPS_MASK    (3UL << HOST_TCON_TCKPS_POS)
+#define HOST_TCON_ON            (1UL << 15)
+#define HOST_TCON_TCS           (1UL << 1)
+#define HOST_TCON_TECS_POS      8
+#define HOST_TCON_TECS_MASK     (3UL << HOST_TCON_TECS_POS)
+#define HOST_TCON_TECS_FRC      3
+#define HOST_UCON_TXEN          (1UL << 5)
+#define HOST_UCON_ON            (1UL << 15)
+#define HOST_UTXB_TXB_MASK      0xFFUL
+
+#define HOST_SWITCH(reg, bit)                                                  \
+    { HOST_SFR_##reg, HOST_CLKCON_##bit, HOST_CLKCON_##bit,                    \
+      HOST_EVENT_SELF_CLEAR, HOST_CLK_SWITCH_TICKS, false, 0 }
+#define HOST_CLK_SWITCH(n)                                                     \
+    HOST_SWITCH(CLK##n##CON, OSWEN), HOST_SWITCH(CLK##n##CON, DIVSWEN)
+#define HOST_ADC_READY(n)                                                      \
+    { HOST_SFR_AD##n##CON, HOST_ADCON_ON, HOST_ADCON_ADRDY,                    \
+      HOST_EVENT_READY, HOST_ADC_READY_TICKS, false, 0 }
+#define HOST_PWM_UPDATE(pg)                                                    \
+    { HOST_SFR_##pg##STAT, HOST_PGSTAT_UPDREQ, HOST_PGSTAT_UPDATE,             \
+      HOST_EVENT_REQUEST, HOST_PWM_UPDATE_TICKS, false, 0 }
+
+static HOST_EVENT_T hostEvents[] =
+{
+    { HOST_SFR_PLL1CON, HOST_CLKCON_ON, HOST_CLKCON_CLKRDY,
+      HOST_EVENT_READY, HOST_PLL_LOCK_TICKS, false, 0 },
+    HOST_SWITCH(PLL1CON, OSWEN),
+    HOST_SWITCH(PLL1CON, PLLSWEN),
+    HOST_SWITCH(PLL1CON, FOUTSWEN),
+    HOST_SWITCH(PLL1CON, DIVSWEN),
+    HOST_CLK_SWITCH(1),  HOST_CLK_SWITCH(2),  HOST_CLK_SWITCH(3),
+    HOST_CLK_SWITCH(4),  HOST_CLK_SWITCH(5),  HOST_CLK_SWITCH(6),
+    HOST_CLK_SWITCH(7),  HOST_CLK_SWITCH(8),  HOST_CLK_SWITCH(9),
+    HOST_CLK_SWITCH(10), HOST_CLK_SWITCH(11), HOST_CLK_SWITCH(12),
+    HOST_ADC_READY(1),
+    HOST_ADC_READY(2),
+    HOST_ADC_READY(3),
+    HOST_PWM_UPDATE(PG1),  HOST_PWM_UPDATE(PG2),  HOST_PWM_UPDATE(PG3),
+    HOST_PWM_UPDATE(PG4),  HOST_PWM_UPDATE(PG5),  HOST_PWM_UPDATE(PG6),
+    HOST_PWM_UPDATE(PG7),  HOST_PWM_UPDATE(PG8),  HOST_PWM_UPDATE(APG1),
+    HOST_PWM_UPDATE(APG2), HOST_PWM_UPDATE(APG3),
+};
+
+#define HOST_EVENT_COUNT    (sizeof(hostEvents)/sizeof(hostEvents[0]))
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: HOST_SfrCommit() </B>
+*
+* @brief Detects the bits changed by the previous register access and starts
+* the latency of every event triggered by them.
+*
+* @param none.
+* @return none.
+*/
+static void HOST_SfrCommit(void)
+{
+    uint32_t value, rising, falling;
+    uint16_t i;
+
+    if (hostLastSfr < 0)
+    {
+        return;
+    }
+
+    value = hostSfr[hostLastSfr];
+    rising = value & ~hostSfrShadow[hostLastSfr];
+    falling = ~value & hostSfrShadow[hostLastSfr];
+
+    for (i = 0; i < HOST_EVENT_COUNT; i++)
+    {
+        HOST_EVENT_T *pEvent = &hostEvents[i];
+
+        if (pEvent->sfr != (HOST_SFR_INDEX_T)hostLastSfr)
+        {
+            continue;
+        }
+        if (rising & pEvent->triggerMask)
+        {
+            pEvent->pending = true;
+            pEvent->deadline = hostTicks + pEvent->latency;
+            if (pEvent->type == HOST_EVENT_REQUEST)
+            {
+                value = (value & ~pEvent->triggerMask) | pEvent->responseMask;
+            }
+        }
+        else if ((falling & pEvent->triggerMask) &&
+                 (pEvent->type == HOST_EVENT_READY))
+        {
+            pEvent->pending = false;
+            value &= ~pEvent->responseMask;
+        }
+    }
+    /* The HAL never reads U1TXB, every access is a transmitted character */
+    if ((hostLastSfr == HOST_SFR_U1TXB) && (hostUartOutput != NULL) &&
+        ((hostSfr[HOST_SFR_U1CON] & (HOST_UCON_ON | HOST_UCON_TXEN)) ==
+            (HOST_UCON_ON | HOST_UCON_TXEN)))
+    {
+        fputc((int)(value & HOST_UTXB_TXB_MASK), hostUartOutput);
+    }
+    hostSfr[hostLastSfr] = value;
+    hostSfrShadow[hostLastSfr] = value;
+    hostLastSfr = -1;
+}
+
+/**
+* <B> Function: HOST_SfrStep(uint64_t) </B>
+*
+* @brief Advances the model time and completes the events whose latency
+* has elapsed.
+*
+* @param ticks model time to advance.
+* @return none.
+*/
+static void HOST_SfrStep(uint64_t ticks)
+{
+    uint32_t prescaler;
+    uint64_t counts;
+    uint16_t i;
+
+    hostTicks += ticks;
+
+    for (i = 0; i < HOST_EVENT_COUNT; i++)
+    {
+        HOST_EVENT_T *pEvent = &hostEvents[i];
+
+        if ((pEvent->pending == false) || (hostTicks < pEvent->deadline))
+        {
+            continue;
+        }
+        pEvent->pending = false;
+        if (pEvent->type != HOST_EVENT_READY)
+        {
+            hostSfr[pEvent->sfr] &= ~pEvent->responseMask;
+            /* A completed oscillator switch makes the new source current */
+            if (pEvent->responseMask == HOST_CLKCON_OSWEN)
+            {
+                hostSfr[pEvent->sfr] = (hostSfr[pEvent->sfr] & 
+                        ~HOST_CLKCON_COSC_MASK) | 
+                    ((hostSfr[pEvent->sfr] & HOST_CLKCON_NOSC_MASK) << 
+                        HOST_CLKCON_COSC_POS);
+            }
+        }
+        else
+        {
+            hostSfr[pEvent->sfr] |= pEvent->responseMask;
+        }
+        hostSfrShadow[pEvent->sfr] = hostSfr[pEvent->sfr];
+    }
+
+    /* Timer1 counts the peripheral clock through the TCKPS pre-scaler and
+       resets on a PR1 period match. The peripheral clock is derived from 
+       FRC until CLK1 has switched to PLL1 FOUT. With TCS = 1, TECS = 3 it 
+       counts the 8 MHz FRC, two counts per HOST_FRC_CLOCK_DIVIDER ticks; 
+       the other external sources are not modeled and do not count */
+    if ((hostSfr[HOST_SFR_T1CON] & HOST_TCON_ON) &&
+        (((hostSfr[HOST_SFR_T1CON] & HOST_TCON_TCS) == 0) ||
+         (((hostSfr[HOST_SFR_T1CON] & HOST_TCON_TECS_MASK) >> 
+            HOST_TCON_TECS_POS) == HOST_TCON_TECS_FRC)))
+    {
+        static const uint32_t prescalers[4] = {1, 8, 64, 256};
+
+        prescaler = prescalers[(hostSfr[HOST_SFR_T1CON] & HOST_TCON_TCKPS_MASK)
+                                    >> HOST_TCON_TCKPS_POS];
+        if (hostSfr[HOST_SFR_T1CON] & HOST_TCON_TCS)
+        {
+            prescaler *= HOST_FRC_CLOCK_DIVIDER;
+            ticks *= 2;
+        }
+        else if (((hostSfr[HOST_SFR_CLK1CON] & HOST_CLKCON_COSC_MASK) >> 
+                    HOST_CLKCON_COSC_POS) != HOST_CLK1_COSC_PLL1)
+        {
+            prescaler *= HOST_FRC_CLOCK_DIVIDER;
+        }
+        hostTimer1Ticks += ticks;
+        counts = hostTimer1Ticks / prescaler;
+        hostTimer1Ticks -= counts * prescaler;
+
+        counts += hostSfr[HOST_SFR_TMR1];
+        if (hostSfr[HOST_SFR_PR1] != 0)
+        {
+            counts %= ((uint64_t)hostSfr[HOST_SFR_PR1] + 1);
+        }
+        hostSfr[HOST_SFR_TMR1] = (uint32_t)counts;
+        hostSfrShadow[HOST_SFR_TMR1] = (uint32_t)counts;
+    }
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: HOST_SfrReset() </B>
+*
+* @brief Function puts every register of the model in its reset state and
+* restarts the model time.
+*
+* @param none.
+* @return none.
+*
+* @example
+* <CODE> HOST_SfrReset(); </CODE>
+*
+*/
+void HOST_SfrReset(void)
+{
+    uint16_t i;
+
+    memset((void *)hostSfr, 0, sizeof(hostSfr));
+    memset(hostSfrShadow, 0, sizeof(hostSfrShadow));
+    memset(hostSfrAccessCount, 0, sizeof(hostSfrAccessCount));
+    memset((void *)hostIrq, 0, sizeof(hostIrq));
+
+    for (i = 0; i < HOST_EVENT_COUNT; i++)
+    {
+        hostEvents[i].pending = false;
+    }
+    hostLastSfr = -1;
+    hostTicks = 0;
+    hostTimer1Ticks = 0;
+    hostUartOutput = NULL;
+
+    /* Device comes out of reset running on FRC */
+    hostSfr[HOST_SFR_OSCCTRL] = 1;
+    hostSfrShadow[HOST_SFR_OSCCTRL] = 1;
+}
+
+/**
+* <B> Function: HOST_SfrAccess(HOST_SFR_INDEX_T) </B>
+*
+* @brief Function returns the storage of a register. Every register access
+* in the HAL resolves to this function through xc.h.
+*
+* @param index register index.
+* @return pointer to the register storage.
+*
+* @example
+* <CODE> *HOST_SfrAccess(HOST_SFR_PG1CON) = 0; </CODE>
+*
+*/
+volatile uint32_t *HOST_SfrAccess(HOST_SFR_INDEX_T index)
+{
+    HOST_SfrCommit();
+    HOST_SfrStep(HOST_SFR_ACCESS_TICKS);
+
+    hostSfrAccessCount[index]++;
+    hostLastSfr = index;
+
+    return &hostSfr[index];
+}
+
+/**
+* <B> Function: HOST_IrqAccess(HOST_IRQ_INDEX_T) </B>
+*
+* @brief Function returns the flag, enable and priority bits of an interrupt.
+*
+* @param index interrupt index.
+* @return pointer to the interrupt bits.
+*
+* @example
+* <CODE> HOST_IrqAccess(HOST_IRQ_T1)->IF = 0; </CODE>
+*
+*/
+volatile HOST_IRQ_T *HOST_IrqAccess(HOST_IRQ_INDEX_T index)
+{
+    HOST_SfrCommit();
+    HOST_SfrStep(HOST_SFR_ACCESS_TICKS);
+
+    return &hostIrq[index];
+}
+
+/**
+* <B> Function: HOST_SfrOffset(volatile uint32_t *, uint16_t) </B>
+*
+* @brief Function returns the storage of the register at an offset from 
+* another register, for HAL code that addresses a register block through a
+* base pointer. The access is modeled like HOST_SfrAccess().
+*
+* @param pBase storage of the first register of the block.
+* @param offset register offset in the block.
+* @return pointer to the register storage.
+*
+* @example
+* <CODE> *HOST_SfrOffset(&PG1CON, 4) = 0; </CODE>
+*
+*/
+volatile uint32_t *HOST_SfrOffset(volatile uint32_t *pBase, uint16_t offset)
+{
+    return HOST_SfrAccess((HOST_SFR_INDEX_T)((pBase - hostSfr) + offset));
+}
+
+/**
+* <B> Function: HOST_SfrPeek(HOST_SFR_INDEX_T) </B>
+*
+* @brief Function reads a register without side effects on the model time
+* or the access counters.
+*
+* @param index register index.
+* @return register value.
+*
+* @example
+* <CODE> value = HOST_SfrPeek(HOST_SFR_PG1CON); </CODE>
+*
+*/
+uint32_t HOST_SfrPeek(HOST_SFR_INDEX_T index)
+{
+    HOST_SfrCommit();
+    return hostSfr[index];
+}
+
+/**
+* <B> Function: HOST_SfrPoke(HOST_SFR_INDEX_T, uint32_t) </B>
+*
+* @brief Function writes a register on behalf of the hardware, e.g. an ADC
+* result, without triggering model events.
+*
+* @param index register index.
+* @param value register value.
+* @return none.
+*
+* @example
+* <CODE> HOST_SfrPoke(HOST_SFR_AD1CH0DATA, 2048); </CODE>
+*
+*/
+void HOST_SfrPoke(HOST_SFR_INDEX_T index, uint32_t value)
+{
+    HOST_SfrCommit();
+    hostSfr[index] = value;
+    hostSfrShadow[index] = value;
+}
+
+/**
+* <B> Function: HOST_SfrName(HOST_SFR_INDEX_T) </B>
+*
+* @brief Function returns the device header name of a register.
+*
+* @param index register index.
+* @return register name.
+*/
+const char *HOST_SfrName(HOST_SFR_INDEX_T index)
+{
+    return hostSfrNames[index];
+}
+
+/**
+* <B> Function: HOST_SfrAccessCount(HOST_SFR_INDEX_T) </B>
+*
+* @brief Function returns the number of accesses made to a register since
+* the last HOST_SfrReset().
+*
+* @param index register index.
+* @return access count.
+*/
+uint32_t HOST_SfrAccessCount(HOST_SFR_INDEX_T index)
+{
+    return hostSfrAccessCount[index];
+}
+
+/**
+* <B> Function: HOST_SfrTotalAccessCount() </B>
+*
+* @brief Function returns the number of register accesses made since the
+* last HOST_SfrReset().
+*
+* @param none.
+* @return access count.
+*/
+uint32_t HOST_SfrTotalAccessCount(void)
+{
+    uint32_t total = 0;
+    uint16_t i;
+
+    for (i = 0; i < HOST_SFR_COUNT; i++)
+    {
+        total += hostSfrAccessCount[i];
+    }
+    return total;
+}
+
+/**
+* <B> Function: HOST_SfrTicks() </B>
+*
+* @brief Function returns the model time in ticks (HOST_TICK_FREQUENCY_HZ).
+*
+* @param none.
+* @return model time.
+*/
+uint64_t HOST_SfrTicks(void)
+{
+    return hostTicks;
+}
+
+/**
+* <B> Function: HOST_SfrAdvance(uint64_t) </B>
+*
+* @brief Function lets model time elapse without register accesses, e.g. for
+* software delays.
+*
+* @param ticks model time to advance.
+* @return none.
+*/
+void HOST_SfrAdvance(uint64_t ticks)
+{
+    HOST_SfrCommit();
+    HOST_SfrStep(ticks);
+}
+
+/**
+* <B> Function: HOST_SfrDump(FILE *) </B>
+*
+* @brief Function prints every non-zero register of the model.
+*
+* @param pFile output stream.
+* @return none.
+*/
+void HOST_SfrDump(FILE *pFile)
+{
+    uint16_t i;
+
+    HOST_SfrCommit();
+    for (i = 0; i < HOST_SFR_COUNT; i++)
+    {
+        if (hostSfr[i] != 0)
+        {
+            fprintf(pFile, "%-16s 0x%08X\n", hostSfrNames[i], hostSfr[i]);
+        }
+    }
+}
+
+/**
+* <B> Function: HOST_SfrUartOutput(FILE *) </B>
+*
+* @brief Function selects the stream that receives the characters written to
+* U1TXB while UART1 is enabled for transmission. HOST_SfrReset() discards
+* them again.
+*
+* @param pFile output stream, NULL to discard.
+* @return none.
+*
+* @example
+* <CODE> HOST_SfrUartOutput(stdout); </CODE>
+*
+*/
+void HOST_SfrUartOutput(FILE *pFile)
+{
+    HOST_SfrCommit();
+    hostUartOutput = pFile;
+}
+
+// </editor-fold>
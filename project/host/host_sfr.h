@@ -0,0 +1,664 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file host_sfr.h
+ *
+ * @brief This header file lists the functions and definitions of the host
+ * register model. The model backs every special function register used by
+ * the HAL with a memory location so that the HAL sources build and run with
+ * gcc on a Linux host.
+ *
+ * Every access to a register through xc.h passes through HOST_SfrAccess(),
+ * which advances the model time by HOST_SFR_ACCESS_TICKS and applies the
+ * hardware side effects that the HAL busy-waits on (self-clearing switch
+ * request bits, module ready bits, free-running timer).
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __HOST_SFR_H
+#define __HOST_SFR_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* One model tick is one peripheral clock cycle (FCY/2 = 100 MHz, 10ns) */
+#define HOST_TICK_FREQUENCY_HZ          100000000UL
+/* Model time consumed by each register access */
+#define HOST_SFR_ACCESS_TICKS           1
+/* Latency of PLL1 lock after PLL1CON.ON is set (50us) */
+#define HOST_PLL_LOCK_TICKS             5000
+/* Latency of an oscillator or divider switch request (OSWEN/DIVSWEN..) */
+#define HOST_CLK_SWITCH_TICKS           200
+/* ADC core warm-up time from ADxCON.ON to ADxCON.ADRDY (10us) */
+#define HOST_ADC_READY_TICKS            1000
+/* Peripheral clock ratio of PLL1 FOUT/2 (100 MHz) to FRC/2 (4 MHz). Timer1
+   counts this much slower until CLK1 has switched to PLL1 FOUT */
+#define HOST_FRC_CLOCK_DIVIDER          25
+/* CLK1CON.COSC of the PLL1 FOUT clock source */
+#define HOST_CLK1_COSC_PLL1             5
+/* PWM data register update from PGxSTAT.UPDREQ to the next start of cycle,
+   modeled as one 16 kHz PWM period (62.5us) */
+#define HOST_PWM_UPDATE_TICKS           6250
+        
+/* Register list of the host model. Order has no hardware meaning. */
+#define HOST_SFR_LIST(X) \
+    X(PCLKCON) \
+    X(FSCL) \
+    X(FSMINPER) \
+    X(MPHASE) \
+    X(MDC) \
+    X(MPER) \
+    X(LFSR) \
+    X(CMBTRIG) \
+    X(LOGCONA) \
+    X(LOGCONB) \
+    X(LOGCONC) \
+    X(LOGCOND) \
+    X(LOGCONE) \
+    X(LOGCONF) \
+    X(PWMEVTA) \
+    X(PWMEVTB) \
+    X(PWMEVTC) \
+    X(PWMEVTD) \
+    X(PWMEVTE) \
+    X(PWMEVTF) \
+    X(APWMEVTA) \
+    X(PG1CON) \
+    X(PG1STAT) \
+    X(PG1IOCON1) \
+    X(PG1IOCON2) \
+    X(PG1EVT1) \
+    X(PG1EVT2) \
+    X(PG1FPCI1) \
+    X(PG1FPCI2) \
+    X(PG1CLPCI1) \
+    X(PG1CLPCI2) \
+    X(PG1FFPCI1) \
+    X(PG1FFPCI2) \
+    X(PG1SPCI1) \
+    X(PG1SPCI2) \
+    X(PG1LEB) \
+    X(PG1PHASE) \
+    X(PG1DC) \
+    X(PG1DCA) \
+    X(PG1PER) \
+    X(PG1TRIGA) \
+    X(PG1TRIGB) \
+    X(PG1TRIGC) \
+    X(PG1DT) \
+    X(PG1CAP) \
+    X(PG2CON) \
+    X(PG2STAT) \
+    X(PG2IOCON1) \
+    X(PG2IOCON2) \
+    X(PG2EVT1) \
+    X(PG2EVT2) \
+    X(PG2FPCI1) \
+    X(PG2FPCI2) \
+    X(PG2CLPCI1) \
+    X(PG2CLPCI2) \
+    X(PG2FFPCI1) \
+    X(PG2FFPCI2) \
+    X(PG2SPCI1) \
+    X(PG2SPCI2) \
+    X(PG2LEB) \
+    X(PG2PHASE) \
+    X(PG2DC) \
+    X(PG2DCA) \
+    X(PG2PER) \
+    X(PG2TRIGA) \
+    X(PG2TRIGB) \
+    X(PG2TRIGC) \
+    X(PG2DT) \
+    X(PG2CAP) \
+    X(PG3CON) \
+    X(PG3STAT) \
+    X(PG3IOCON1) \
+    X(PG3IOCON2) \
+    X(PG3EVT1) \
+    X(PG3EVT2) \
+    X(PG3FPCI1) \
+    X(PG3FPCI2) \
+    X(PG3CLPCI1) \
+    X(PG3CLPCI2) \
+    X(PG3FFPCI1) \
+    X(PG3FFPCI2) \
+    X(PG3SPCI1) \
+    X(PG3SPCI2) \
+    X(PG3LEB) \
+    X(PG3PHASE) \
+    X(PG3DC) \
+    X(PG3DCA) \
+    X(PG3PER) \
+    X(PG3TRIGA) \
+    X(PG3TRIGB) \
+    X(PG3TRIGC) \
+    X(PG3DT) \
+    X(PG3CAP) \
+    X(PG4CON) \
+    X(PG4STAT) \
+    X(PG4IOCON1) \
+    X(PG4IOCON2) \
+    X(PG4EVT1) \
+    X(PG4EVT2) \
+    X(PG4FPCI1) \
+    X(PG4FPCI2) \
+    X(PG4CLPCI1) \
+    X(PG4CLPCI2) \
+    X(PG4FFPCI1) \
+    X(PG4FFPCI2) \
+    X(PG4SPCI1) \
+    X(PG4SPCI2) \
+    X(PG4LEB) \
+    X(PG4PHASE) \
+    X(PG4DC) \
+    X(PG4DCA) \
+    X(PG4PER) \
+    X(PG4TRIGA) \
+    X(PG4TRIGB) \
+    X(PG4TRIGC) \
+    X(PG4DT) \
+    X(PG4CAP) \
+    X(PG5CON) \
+    X(PG5STAT) \
+    X(PG5IOCON1) \
+    X(PG5IOCON2) \
+    X(PG5EVT1) \
+    X(PG5EVT2) \
+    X(PG5FPCI1) \
+    X(PG5FPCI2) \
+    X(PG5CLPCI1) \
+    X(PG5CLPCI2) \
+    X(PG5FFPCI1) \
+    X(PG5FFPCI2) \
+    X(PG5SPCI1) \
+    X(PG5SPCI2) \
+    X(PG5LEB) \
+    X(PG5PHASE) \
+    X(PG5DC) \
+    X(PG5DCA) \
+    X(PG5PER) \
+    X(PG5TRIGA) \
+    X(PG5TRIGB) \
+    X(PG5TRIGC) \
+    X(PG5DT) \
+    X(PG5CAP) \
+    X(PG6CON) \
+    X(PG6STAT) \
+    X(PG6IOCON1) \
+    X(PG6IOCON2) \
+    X(PG6EVT1) \
+    X(PG6EVT2) \
+    X(PG6FPCI1) \
+    X(PG6FPCI2) \
+    X(PG6CLPCI1) \
+    X(PG6CLPCI2) \
+    X(PG6FFPCI1) \
+    X(PG6FFPCI2) \
+    X(PG6SPCI1) \
+    X(PG6SPCI2) \
+    X(PG6LEB) \
+    X(PG6PHASE) \
+    X(PG6DC) \
+    X(PG6DCA) \
+    X(PG6PER) \
+    X(PG6TRIGA) \
+    X(PG6TRIGB) \
+    X(PG6TRIGC) \
+    X(PG6DT) \
+    X(PG6CAP) \
+    X(PG7CON) \
+    X(PG7STAT) \
+    X(PG7IOCON1) \
+    X(PG7IOCON2) \
+    X(PG7EVT1) \
+    X(PG7EVT2) \
+    X(PG7FPCI1) \
+    X(PG7FPCI2) \
+    X(PG7CLPCI1) \
+    X(PG7CLPCI2) \
+    X(PG7FFPCI1) \
+    X(PG7FFPCI2) \
+    X(PG7SPCI1) \
+    X(PG7SPCI2) \
+    X(PG7LEB) \
+    X(PG7PHASE) \
+    X(PG7DC) \
+    X(PG7DCA) \
+    X(PG7PER) \
+    X(PG7TRIGA) \
+    X(PG7TRIGB) \
+    X(PG7TRIGC) \
+    X(PG7DT) \
+    X(PG7CAP) \
+    X(PG8CON) \
+    X(PG8STAT) \
+    X(PG8IOCON1) \
+    X(PG8IOCON2) \
+    X(PG8EVT1) \
+    X(PG8EVT2) \
+    X(PG8FPCI1) \
+    X(PG8FPCI2) \
+    X(PG8CLPCI1) \
+    X(PG8CLPCI2) \
+    X(PG8FFPCI1) \
+    X(PG8FFPCI2) \
+    X(PG8SPCI1) \
+    X(PG8SPCI2) \
+    X(PG8LEB) \
+    X(PG8PHASE) \
+    X(PG8DC) \
+    X(PG8DCA) \
+    X(PG8PER) \
+    X(PG8TRIGA) \
+    X(PG8TRIGB) \
+    X(PG8TRIGC) \
+    X(PG8DT) \
+    X(PG8CAP) \
+    X(APG1CON) \
+    X(APG1STAT) \
+    X(APG1IOCON1) \
+    X(APG1IOCON2) \
+    X(APG1EVT1) \
+    X(APG1EVT2) \
+    X(APG1FPCI1) \
+    X(APG1FPCI2) \
+    X(APG1CLPCI1) \
+    X(APG1CLPCI2) \
+    X(APG1FFPCI1) \
+    X(APG1FFPCI2) \
+    X(APG1SPCI1) \
+    X(APG1SPCI2) \
+    X(APG1LEB) \
+    X(APG1PHASE) \
+    X(APG1DC) \
+    X(APG1DCA) \
+    X(APG1PER) \
+    X(APG1TRIGA) \
+    X(APG1TRIGB) \
+    X(APG1TRIGC) \
+    X(APG1DT) \
+    X(APG1CAP) \
+    X(APG2CON) \
+    X(APG2STAT) \
+    X(APG2IOCON1) \
+    X(APG2IOCON2) \
+    X(APG2EVT1) \
+    X(APG2EVT2) \
+    X(APG2FPCI1) \
+    X(APG2FPCI2) \
+    X(APG2CLPCI1) \
+    X(APG2CLPCI2) \
+    X(APG2FFPCI1) \
+    X(APG2FFPCI2) \
+    X(APG2SPCI1) \
+    X(APG2SPCI2) \
+    X(APG2LEB) \
+    X(APG2PHASE) \
+    X(APG2DC) \
+    X(APG2DCA) \
+    X(APG2PER) \
+    X(APG2TRIGA) \
+    X(APG2TRIGB) \
+    X(APG2TRIGC) \
+    X(APG2DT) \
+    X(APG2CAP) \
+    X(APG3CON) \
+    X(APG3STAT) \
+    X(APG3IOCON1) \
+    X(APG3IOCON2) \
+    X(APG3EVT1) \
+    X(APG3EVT2) \
+    X(APG3FPCI1) \
+    X(APG3FPCI2) \
+    X(APG3CLPCI1) \
+    X(APG3CLPCI2) \
+    X(APG3FFPCI1) \
+    X(APG3FFPCI2) \
+    X(APG3SPCI1) \
+    X(APG3SPCI2) \
+    X(APG3LEB) \
+    X(APG3PHASE) \
+    X(APG3DC) \
+    X(APG3DCA) \
+    X(APG3PER) \
+    X(APG3TRIGA) \
+    X(APG3TRIGB) \
+    X(APG3TRIGC) \
+    X(APG3DT) \
+    X(APG3CAP) \
+    X(OSCCTRL) \
+    X(OSCCFG) \
+    X(PLL1CON) \
+    X(PLL1DIV) \
+    X(VCO1DIV) \
+    X(PLL2CON) \
+    X(PLL2DIV) \
+    X(VCO2DIV) \
+    X(CLK1CON) \
+    X(CLK1DIV) \
+    X(CLK2CON) \
+    X(CLK2DIV) \
+    X(CLK3CON) \
+    X(CLK3DIV) \
+    X(CLK4CON) \
+    X(CLK4DIV) \
+    X(CLK5CON) \
+    X(CLK5DIV) \
+    X(CLK6CON) \
+    X(CLK6DIV) \
+    X(CLK7CON) \
+    X(CLK7DIV) \
+    X(CLK8CON) \
+    X(CLK8DIV) \
+    X(CLK9CON) \
+    X(CLK9DIV) \
+    X(CLK10CON) \
+    X(CLK10DIV) \
+    X(CLK11CON) \
+    X(CLK11DIV) \
+    X(CLK12CON) \
+    X(CLK12DIV) \
+    X(AD1CON) \
+    X(AD1CH0CON1) \
+    X(AD1CH0CON2) \
+    X(AD1CH0DATA) \
+    X(AD1CH1CON1) \
+    X(AD1CH1CON2) \
+    X(AD1CH1DATA) \
+    X(AD1CH2CON1) \
+    X(AD1CH2CON2) \
+    X(AD1CH2DATA) \
+    X(AD1CH3CON1) \
+    X(AD1CH3CON2) \
+    X(AD1CH3DATA) \
+    X(AD1CH4CON1) \
+    X(AD1CH4CON2) \
+    X(AD1CH4DATA) \
+    X(AD1CH5CON1) \
+    X(AD1CH5CON2) \
+    X(AD1CH5DATA) \
+    X(AD1CH6CON1) \
+    X(AD1CH6CON2) \
+    X(AD1CH6DATA) \
+    X(AD1CH7CON1) \
+    X(AD1CH7CON2) \
+    X(AD1CH7DATA) \
+    X(AD2CON) \
+    X(AD2CH0CON1) \
+    X(AD2CH0CON2) \
+    X(AD2CH0DATA) \
+    X(AD2CH1CON1) \
+    X(AD2CH1CON2) \
+    X(AD2CH1DATA) \
+    X(AD2CH2CON1) \
+    X(AD2CH2CON2) \
+    X(AD2CH2DATA) \
+    X(AD2CH3CON1) \
+    X(AD2CH3CON2) \
+    X(AD2CH3DATA) \
+    X(AD2CH4CON1) \
+    X(AD2CH4CON2) \
+    X(AD2CH4DATA) \
+    X(AD2CH5CON1) \
+    X(AD2CH5CON2) \
+    X(AD2CH5DATA) \
+    X(AD2CH6CON1) \
+    X(AD2CH6CON2) \
+    X(AD2CH6DATA) \
+    X(AD2CH7CON1) \
+    X(AD2CH7CON2) \
+    X(AD2CH7DATA) \
+    X(AD3CON) \
+    X(AD3CH0CON1) \
+    X(AD3CH0CON2) \
+    X(AD3CH0DATA) \
+    X(AD3CH1CON1) \
+    X(AD3CH1CON2) \
+    X(AD3CH1DATA) \
+    X(AD3CH2CON1) \
+    X(AD3CH2CON2) \
+    X(AD3CH2DATA) \
+    X(AD3CH3CON1) \
+    X(AD3CH3CON2) \
+    X(AD3CH3DATA) \
+    X(AD3CH4CON1) \
+    X(AD3CH4CON2) \
+    X(AD3CH4DATA) \
+    X(AD3CH5CON1) \
+    X(AD3CH5CON2) \
+    X(AD3CH5DATA) \
+    X(AD3CH6CON1) \
+    X(AD3CH6CON2) \
+    X(AD3CH6DATA) \
+    X(AD3CH7CON1) \
+    X(AD3CH7CON2) \
+    X(AD3CH7DATA) \
+    X(DACCTRL1) \
+    X(DACCTRL2) \
+    X(DAC1CON) \
+    X(DAC1DAT) \
+    X(DAC1CMP) \
+    X(DAC1SLPCON) \
+    X(DAC1SLPDAT) \
+    X(DAC2CON) \
+    X(DAC2DAT) \
+    X(DAC2CMP) \
+    X(DAC2SLPCON) \
+    X(DAC2SLPDAT) \
+    X(DAC3CON) \
+    X(DAC3DAT) \
+    X(DAC3CMP) \
+    X(DAC3SLPCON) \
+    X(DAC3SLPDAT) \
+    X(U1CON) \
+    X(U1STAT) \
+    X(U1BRG) \
+    X(U1RXB) \
+    X(U1TXB) \
+    X(U1PA) \
+    X(U1PB) \
+    X(U1CHK) \
+    X(U1SCCON) \
+    X(U1UIR) \
+    X(T1CON) \
+    X(TMR1) \
+    X(PR1) \
+    X(ANSELA) \
+    X(TRISA) \
+    X(PORTA) \
+    X(LATA) \
+    X(ANSELB) \
+    X(TRISB) \
+    X(PORTB) \
+    X(LATB) \
+    X(ANSELC) \
+    X(TRISC) \
+    X(PORTC) \
+    X(LATC) \
+    X(ANSELD) \
+    X(TRISD) \
+    X(PORTD) \
+    X(LATD) \
+    X(ANSELE) \
+    X(TRISE) \
+    X(PORTE) \
+    X(LATE) \
+    X(ANSELF) \
+    X(TRISF) \
+    X(PORTF) \
+    X(LATF) \
+    X(ANSELG) \
+    X(TRISG) \
+    X(PORTG) \
+    X(LATG) \
+    X(RPOR0) \
+    X(RPOR1) \
+    X(RPOR2) \
+    X(RPOR3) \
+    X(RPOR4) \
+    X(RPOR5) \
+    X(RPOR6) \
+    X(RPOR7) \
+    X(RPOR8) \
+    X(RPOR9) \
+    X(RPOR10) \
+    X(RPOR11) \
+    X(RPOR12) \
+    X(RPOR13) \
+    X(RPOR14) \
+    X(RPOR15) \
+    X(RPOR16) \
+    X(RPOR17) \
+    X(RPOR18) \
+    X(RPOR19) \
+    X(RPOR20) \
+    X(RPOR21) \
+    X(RPOR22) \
+    X(RPOR23) \
+    X(RPOR24) \
+    X(RPOR25) \
+    X(RPOR26) \
+    X(RPOR27) \
+    X(RPOR28) \
+    X(RPOR29) \
+    X(RPOR30) \
+    X(RPOR31)
+
+#define HOST_IRQ_LIST(X) \
+    X(AD1CH0) \
+    X(AD1CH1) \
+    X(AD1CH2) \
+    X(AD1CH3) \
+    X(AD1CH4) \
+    X(AD1CH5) \
+    X(AD1CH6) \
+    X(AD1CH7) \
+    X(AD2CH0) \
+    X(AD2CH1) \
+    X(AD2CH2) \
+    X(AD2CH3) \
+    X(AD2CH4) \
+    X(AD2CH5) \
+    X(AD2CH6) \
+    X(AD2CH7) \
+    X(AD3CH0) \
+    X(AD3CH1) \
+    X(AD3CH2) \
+    X(AD3CH3) \
+    X(AD3CH4) \
+    X(AD3CH5) \
+    X(AD3CH6) \
+    X(AD3CH7) \
+    X(T1) \
+    X(U1TX) \
+    X(U1RX) \
+    X(U1E) \
+    X(PWM1) \
+    X(PWM2) \
+    X(PWM3) \
+    X(PWM4) \
+    X(PWM5) \
+    X(PWM6) \
+    X(PWM7) \
+    X(PWM8) \
+    X(DMA0) \
+    X(DMA1) \
+    X(DMA2) \
+    X(DMA3) \
+    X(DMA4) \
+    X(DMA5)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+#define HOST_SFR_ENUM(name)     HOST_SFR_##name,
+#define HOST_IRQ_ENUM(name)     HOST_IRQ_##name,
+
+typedef enum
+{
+    HOST_SFR_LIST(HOST_SFR_ENUM)
+    HOST_SFR_COUNT
+} HOST_SFR_INDEX_T;
+
+typedef enum
+{
+    HOST_IRQ_LIST(HOST_IRQ_ENUM)
+    HOST_IRQ_COUNT
+} HOST_IRQ_INDEX_T;
+
+/* Interrupt flag, enable and priority of one interrupt source */
+typedef struct
+{
+    uint8_t IF:1;
+    uint8_t IE:1;
+    uint8_t IP:3;
+} HOST_IRQ_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void HOST_SfrReset(void);
+volatile uint32_t *HOST_SfrAccess(HOST_SFR_INDEX_T);
+volatile HOST_IRQ_T *HOST_IrqAccess(HOST_IRQ_INDEX_T);
+volatile uint32_t *HOST_SfrOffset(volatile uint32_t *, uint16_t);
+
+uint32_t HOST_SfrPeek(HOST_SFR_INDEX_T);
+void HOST_SfrPoke(HOST_SFR_INDEX_T, uint32_t);
+const char *HOST_SfrName(HOST_SFR_INDEX_T);
+uint32_t HOST_SfrAccessCount(HOST_SFR_INDEX_T);
+uint32_t HOST_SfrTotalAccessCount(void);
+
+uint64_t HOST_SfrTicks(void);
+void HOST_SfrAdvance(uint64_t);
+
+void HOST_SfrDump(FILE *);
+void HOST_SfrUartOutput(FILE *);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __HOST_SFR_H
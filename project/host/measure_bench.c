@@ -0,0 +1,490 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file measure_bench.c
+ *
+ * @brief Current measurement benchmark. Calibrates the offsets from
+ * synthetic ADC samples, then times MCAPP_MeasureCurrentOffset() and
+ * MCAPP_MeasureCurrentCalibrate() and compares the calibrated currents with
+ * a double precision reference computed from the same samples.
+ *
+ * The tool is built twice: measure_bench with the float path and
+ * measure_bench_q15 with MEASURE_FIXED_POINT (make bench runs both).
+ *
+ * Usage: measure_bench [-n samples]
+ *        -n  number of test samples, default 100000
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "measure.h"
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Sensor offset and noise of the synthetic samples, in Q15 counts. The ADC
+   results are 12 bit left aligned to Q15 (MC1_ADCBUF_IA), one LSB is 16 */
+#define MEASURE_BENCH_OFFSET_IA     (-1200)
+#define MEASURE_BENCH_OFFSET_IB     (+800)
+#define MEASURE_BENCH_OFFSET_IBUS   (+304)
+#define MEASURE_BENCH_NOISE_LSB     3
+
+/* Test currents span the full scale, the samples beyond it after the
+   offset correction are reported separately */
+#define MEASURE_BENCH_SAMPLES       100000
+
+/* Samples per sum of an accumulating ADC channel, ADC_ACCUMULATE_256 */
+#define MEASURE_BENCH_BLOCK         256
+
+/* Offset drift over the tracking run in Q15 counts, and zero current
+   windows in the run */
+#define MEASURE_BENCH_DRIFT_IA      (+160)
+#define MEASURE_BENCH_DRIFT_IBUS    (-96)
+#define MEASURE_BENCH_TRACK_WINDOWS 200000
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        Ia,
+        Ib,
+        Ibus;
+
+} MEASURE_BENCH_SAMPLE_T;
+
+typedef struct
+{
+    double
+        maxError,           /* Largest error in Amperes */
+        sumSquare;          /* Sum of the squared errors */
+
+    uint32_t
+        count;
+
+} MEASURE_BENCH_ERROR_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+static uint32_t measureBenchSeed = 0x2545F491;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static uint32_t MEASURE_BENCH_Random(void)
+{
+    measureBenchSeed ^= measureBenchSeed << 13;
+    measureBenchSeed ^= measureBenchSeed >> 17;
+    measureBenchSeed ^= measureBenchSeed << 5;
+    return measureBenchSeed;
+}
+
+/* ADC result of a current in Q15 of MC1_PEAK_CURRENT with offset and noise,
+   quantized to the 12 bit ADC resolution */
+static int16_t MEASURE_BENCH_Sample(int32_t current, int32_t offset)
+{
+    int32_t noise = (int32_t)(MEASURE_BENCH_Random() %
+                        (2*MEASURE_BENCH_NOISE_LSB + 1)) -
+                    MEASURE_BENCH_NOISE_LSB;
+    int32_t sample = ((current + offset) & ~0xF) + 16*noise;
+
+    if (sample > INT16_MAX)
+    {
+        sample = INT16_MAX & ~0xF;
+    }
+    else if (sample < INT16_MIN)
+    {
+        sample = INT16_MIN;
+    }
+    return (int16_t)sample;
+}
+
+static void MEASURE_BENCH_ErrorAdd(MEASURE_BENCH_ERROR_T *pError,
+                                   double value, double reference)
+{
+    double error = fabs(value - reference);
+
+    if (error > pError->maxError)
+    {
+        pError->maxError = error;
+    }
+    pError->sumSquare += error*error;
+    pError->count++;
+}
+
+static void MEASURE_BENCH_ErrorReport(const char *pName,
+                                      const MEASURE_BENCH_ERROR_T *pError)
+{
+    if (pError->count == 0)
+    {
+        printf("%-32s %10s\n", pName, "-");
+        return;
+    }
+    printf("%-32s %10.6f max %10.6f rms [A] %8u samples\n", pName,
+           pError->maxError, sqrt(pError->sumSquare / pError->count),
+           (unsigned)pError->count);
+}
+
+/* Calibration of MEASURE_MOTOR_COUNT motors, once through one
+   MCAPP_MEASURE_T per motor and once through MCAPP_MEASURE_MOTORS_T. The
+   motors use the offsets of pCalibrated and consecutive samples. Returns the
+   number of currents that differ between the two */
+static uint32_t MEASURE_BENCH_Motors(const MEASURE_BENCH_SAMPLE_T *pSamples,
+                                     uint32_t sampleCount,
+                                     const MCAPP_MEASURE_CURRENT_T *pCalibrated)
+{
+    static MCAPP_MEASURE_T measure[MEASURE_MOTOR_COUNT];
+    static MCAPP_MEASURE_MOTORS_T motors;
+    BENCH_STAT_T singleStat, motorsStat;
+    uint32_t batchCalls = BENCH_BATCH_CALLS / MEASURE_MOTOR_COUNT;
+    uint32_t frames = sampleCount / MEASURE_MOTOR_COUNT, mismatch = 0;
+    uint32_t i, k, motor;
+    uint64_t start;
+    const MEASURE_BENCH_SAMPLE_T *pFrame;
+
+    MCAPP_MeasureMotorsInit(&motors);
+    for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+    {
+        MCAPP_MeasureCurrentInit(&measure[motor]);
+        measure[motor].measureCurrent.offsetIa = pCalibrated->offsetIa;
+        measure[motor].measureCurrent.offsetIb = pCalibrated->offsetIb;
+        measure[motor].measureCurrent.offsetIbus = pCalibrated->offsetIbus;
+        motors.offsetIa[motor] = pCalibrated->offsetIa;
+        motors.offsetIb[motor] = pCalibrated->offsetIb;
+        motors.offsetIbus[motor] = pCalibrated->offsetIbus;
+    }
+
+    frames -= frames % batchCalls;
+    BENCH_StatInit(&singleStat, batchCalls);
+    BENCH_StatInit(&motorsStat, batchCalls);
+    for (i = 0; i < frames; i += batchCalls)
+    {
+        start = BENCH_Count();
+        for (k = i; k < i + batchCalls; k++)
+        {
+            pFrame = &pSamples[k*MEASURE_MOTOR_COUNT];
+            for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+            {
+                measure[motor].measureCurrent.Ia = pFrame[motor].Ia;
+                measure[motor].measureCurrent.Ib = pFrame[motor].Ib;
+                measure[motor].measureCurrent.Ibus = pFrame[motor].Ibus;
+                MCAPP_MeasureCurrentCalibrate(&measure[motor], NULL);
+            }
+        }
+        BENCH_StatAdd(&singleStat, BENCH_Count() - start);
+
+        start = BENCH_Count();
+        for (k = i; k < i + batchCalls; k++)
+        {
+            pFrame = &pSamples[k*MEASURE_MOTOR_COUNT];
+            for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+            {
+                motors.Ia[motor] = pFrame[motor].Ia;
+                motors.Ib[motor] = pFrame[motor].Ib;
+                motors.Ibus[motor] = pFrame[motor].Ibus;
+            }
+            MCAPP_MeasureMotorsCalibrate(&motors, NULL);
+        }
+        BENCH_StatAdd(&motorsStat, BENCH_Count() - start);
+
+        /* The last frame of the batch is left in both */
+        for (motor = 0; motor < MEASURE_MOTOR_COUNT; motor++)
+        {
+            const MCAPP_MEASURE_CURRENT_T *pCurrent = 
+                &measure[motor].measureCurrent;
+
+            mismatch += (pCurrent->Ia_actual != motors.Ia_actual[motor]) +
+                        (pCurrent->Ib_actual != motors.Ib_actual[motor]) +
+                        (pCurrent->Ic_actual != motors.Ic_actual[motor]) +
+                        (pCurrent->Ibus != motors.Ibus[motor]);
+        }
+    }
+
+    printf("%u motors per frame\n", MEASURE_MOTOR_COUNT);
+    BENCH_StatReport(stdout, "MCAPP_MeasureCurrentCalibrate x3", &singleStat);
+    BENCH_StatReport(stdout, "MCAPP_MeasureMotorsCalibrate", &motorsStat);
+    printf("%-32s %10u\n", "Mismatching currents", (unsigned)mismatch);
+    return mismatch;
+}
+
+/* Offset tracking while the sensor offsets drift linearly over the run.
+   Every window samples zero phase and bus current. Reports the offset error
+   of the tracked and of the frozen offsets at the end of the run */
+static void MEASURE_BENCH_Track(const MCAPP_MEASURE_T *pCalibrated)
+{
+    static MCAPP_MEASURE_T measure;
+    MCAPP_MEASURE_CURRENT_T *pCurrent = &measure.measureCurrent;
+    BENCH_STAT_T trackStat;
+    uint32_t i, k;
+    uint64_t start;
+    int32_t driftIa = 0, driftIbus = 0;
+
+    measure = *pCalibrated;
+    MCAPP_MeasureCurrentTrackInit(&measure, MEASURE_TRACK_SHIFT,
+                                  MEASURE_TRACK_SLEW_MAX);
+    BENCH_StatInit(&trackStat, BENCH_BATCH_CALLS);
+    for (i = 0; i < MEASURE_BENCH_TRACK_WINDOWS; i += BENCH_BATCH_CALLS)
+    {
+        MEASURE_BENCH_SAMPLE_T batch[BENCH_BATCH_CALLS];
+
+        for (k = 0; k < BENCH_BATCH_CALLS; k++)
+        {
+            driftIa = (int32_t)((int64_t)MEASURE_BENCH_DRIFT_IA * (i + k) /
+                                MEASURE_BENCH_TRACK_WINDOWS);
+            driftIbus = (int32_t)((int64_t)MEASURE_BENCH_DRIFT_IBUS * (i + k) /
+                                  MEASURE_BENCH_TRACK_WINDOWS);
+            batch[k].Ia = MEASURE_BENCH_Sample(driftIa,
+                                               MEASURE_BENCH_OFFSET_IA);
+            batch[k].Ib = MEASURE_BENCH_Sample(0, MEASURE_BENCH_OFFSET_IB);
+            batch[k].Ibus = MEASURE_BENCH_Sample(driftIbus,
+                                                 MEASURE_BENCH_OFFSET_IBUS);
+        }
+        start = BENCH_Count();
+        for (k = 0; k < BENCH_BATCH_CALLS; k++)
+        {
+            pCurrent->Ia = batch[k].Ia;
+            pCurrent->Ib = batch[k].Ib;
+            pCurrent->Ibus = batch[k].Ibus;
+            MCAPP_MeasureCurrentTrack(&measure,
+                                      MEASURE_TRACK_PHASE | MEASURE_TRACK_BUS);
+        }
+        BENCH_StatAdd(&trackStat, BENCH_Count() - start);
+    }
+
+    printf("Offset tracking, drift Ia %+d Ibus %+d over %u windows, "
+           "time constant 2^%u, slew %d\n", MEASURE_BENCH_DRIFT_IA,
+           MEASURE_BENCH_DRIFT_IBUS, MEASURE_BENCH_TRACK_WINDOWS,
+           MEASURE_TRACK_SHIFT, MEASURE_TRACK_SLEW_MAX);
+    BENCH_StatReport(stdout, "MCAPP_MeasureCurrentTrack", &trackStat);
+    printf("%-32s %+10.6f tracked %+10.6f frozen [A]\n", "Ia offset error",
+           (pCurrent->offsetIa - (MEASURE_BENCH_OFFSET_IA + driftIa)) *
+               ADC_CURRENT_SCALE,
+           (pCalibrated->measureCurrent.offsetIa -
+               (MEASURE_BENCH_OFFSET_IA + driftIa)) * ADC_CURRENT_SCALE);
+    printf("%-32s %+10.6f tracked %+10.6f frozen [A]\n", "Ibus offset error",
+           (pCurrent->offsetIbus - (MEASURE_BENCH_OFFSET_IBUS + driftIbus)) *
+               ADC_CURRENT_SCALE,
+           (pCalibrated->measureCurrent.offsetIbus -
+               (MEASURE_BENCH_OFFSET_IBUS + driftIbus)) * ADC_CURRENT_SCALE);
+    printf("%-32s %10d [Q15]\n", "Largest drift",
+           MCAPP_MeasureCurrentDrift(&measure));
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    static MCAPP_MEASURE_T measure, accumulated;
+    MCAPP_MEASURE_CURRENT_T *pCurrent = &measure.measureCurrent;
+    MEASURE_BENCH_SAMPLE_T *pSamples;
+    int32_t blockIa = 0, blockIb = 0, blockIbus = 0;
+    MEASURE_BENCH_ERROR_T errorIa, errorIc, errorRange;
+    BENCH_STAT_T offsetStat, calibrateStat;
+    double sumIa = 0, sumIb = 0, offsetIa, offsetIb, referenceIa, referenceIb;
+    uint32_t sampleCount = MEASURE_BENCH_SAMPLES, i, k;
+    uint64_t start;
+    int32_t range = 32768;
+    uint32_t mismatch;
+
+    if ((argc == 3) && (strcmp(argv[1], "-n") == 0))
+    {
+        sampleCount = (uint32_t)atol(argv[2]);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "usage: measure_bench [-n samples]\n");
+        return 2;
+    }
+    sampleCount -= sampleCount % BENCH_BATCH_CALLS;
+    if (sampleCount == 0)
+    {
+        sampleCount = BENCH_BATCH_CALLS;
+    }
+    pSamples = malloc(sampleCount * sizeof(MEASURE_BENCH_SAMPLE_T));
+    if (pSamples == NULL)
+    {
+        return 1;
+    }
+
+#ifdef MEASURE_FIXED_POINT
+    printf("Current measurement, Q15 path (MEASURE_FIXED_POINT)\n");
+#else
+    printf("Current measurement, float path\n");
+#endif
+
+    /* Offset calibration at zero current, the reference is the exact mean
+       of the same samples */
+    BENCH_StatInit(&offsetStat, BENCH_BATCH_CALLS);
+    MCAPP_MeasureCurrentInit(&measure);
+    MCAPP_MeasureCurrentInit(&accumulated);
+    for (i = 0; i < OFFSET_COUNT_MAX; i += BENCH_BATCH_CALLS)
+    {
+        MEASURE_BENCH_SAMPLE_T batch[BENCH_BATCH_CALLS];
+
+        for (k = 0; k < BENCH_BATCH_CALLS; k++)
+        {
+            batch[k].Ia = MEASURE_BENCH_Sample(0, MEASURE_BENCH_OFFSET_IA);
+            batch[k].Ib = MEASURE_BENCH_Sample(0, MEASURE_BENCH_OFFSET_IB);
+            batch[k].Ibus = MEASURE_BENCH_Sample(0, MEASURE_BENCH_OFFSET_IBUS);
+            sumIa += batch[k].Ia;
+            sumIb += batch[k].Ib;
+            blockIa += batch[k].Ia;
+            blockIb += batch[k].Ib;
+            blockIbus += batch[k].Ibus;
+        }
+        start = BENCH_Count();
+        for (k = 0; k < BENCH_BATCH_CALLS; k++)
+        {
+            pCurrent->Ia = batch[k].Ia;
+            pCurrent->Ib = batch[k].Ib;
+            pCurrent->Ibus = batch[k].Ibus;
+            MCAPP_MeasureCurrentOffset(&measure);
+        }
+        BENCH_StatAdd(&offsetStat, BENCH_Count() - start);
+
+        /* Same samples summed in blocks as by an accumulating ADC channel */
+        if (((i + BENCH_BATCH_CALLS) % MEASURE_BENCH_BLOCK) == 0)
+        {
+            MCAPP_MeasureCurrentOffsetSum(&accumulated, blockIa, blockIb,
+                                          blockIbus, MEASURE_BENCH_BLOCK);
+            blockIa = 0;
+            blockIb = 0;
+            blockIbus = 0;
+        }
+    }
+    offsetIa = sumIa / OFFSET_COUNT_MAX;
+    offsetIb = sumIb / OFFSET_COUNT_MAX;
+    printf("Offsets Ia %d (%.2f) Ib %d (%.2f) [Q15], status %d\n",
+           pCurrent->offsetIa, offsetIa, pCurrent->offsetIb, offsetIb,
+           MCAPP_MeasureCurrentOffsetStatus(&measure));
+    printf("Offsets from %d sums of %d samples %s, status %d\n",
+           OFFSET_COUNT_MAX / MEASURE_BENCH_BLOCK, MEASURE_BENCH_BLOCK,
+           ((accumulated.measureCurrent.offsetIa == pCurrent->offsetIa) &&
+            (accumulated.measureCurrent.offsetIb == pCurrent->offsetIb) &&
+            (accumulated.measureCurrent.offsetIbus == pCurrent->offsetIbus)) ?
+               "match" : "differ",
+           MCAPP_MeasureCurrentOffsetStatus(&accumulated));
+
+    /* Test currents over the full scale */
+    for (i = 0; i < sampleCount; i++)
+    {
+        pSamples[i].Ia = MEASURE_BENCH_Sample(
+            (int32_t)(MEASURE_BENCH_Random() % (2*range)) - range,
+            MEASURE_BENCH_OFFSET_IA);
+        pSamples[i].Ib = MEASURE_BENCH_Sample(
+            (int32_t)(MEASURE_BENCH_Random() % (2*range)) - range,
+            MEASURE_BENCH_OFFSET_IB);
+        pSamples[i].Ibus = MEASURE_BENCH_Sample(
+            (int32_t)(MEASURE_BENCH_Random() % (2*range)) - range,
+            MEASURE_BENCH_OFFSET_IBUS);
+    }
+
+    BENCH_StatInit(&calibrateStat, BENCH_BATCH_CALLS);
+    for (i = 0; i < sampleCount; i += BENCH_BATCH_CALLS)
+    {
+        start = BENCH_Count();
+        for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+        {
+            pCurrent->Ia = pSamples[k].Ia;
+            pCurrent->Ib = pSamples[k].Ib;
+            pCurrent->Ibus = pSamples[k].Ibus;
+            MCAPP_MeasureCurrentCalibrate(&measure, NULL);
+        }
+        BENCH_StatAdd(&calibrateStat, BENCH_Count() - start);
+    }
+
+    /* Numerical error of the calibrated currents against the offset
+       corrected samples in double precision. Samples whose offset corrected
+       value or Ic falls outside the Q15 range are counted apart, there the
+       reference is limited to the full scale */
+    memset(&errorIa, 0, sizeof(errorIa));
+    memset(&errorIc, 0, sizeof(errorIc));
+    memset(&errorRange, 0, sizeof(errorRange));
+    for (i = 0; i < sampleCount; i++)
+    {
+        double Ic;
+        int32_t correctedIa, correctedIb;
+
+        pCurrent->Ia = pSamples[i].Ia;
+        pCurrent->Ib = pSamples[i].Ib;
+        pCurrent->Ibus = pSamples[i].Ibus;
+        MCAPP_MeasureCurrentCalibrate(&measure, NULL);
+
+        referenceIa = (pSamples[i].Ia - offsetIa) * ADC_CURRENT_SCALE;
+        referenceIb = (pSamples[i].Ib - offsetIb) * ADC_CURRENT_SCALE;
+        Ic = -referenceIa - referenceIb;
+        correctedIa = (int32_t)pSamples[i].Ia - pCurrent->offsetIa;
+        correctedIb = (int32_t)pSamples[i].Ib - pCurrent->offsetIb;
+        if ((correctedIa != (int16_t)correctedIa) ||
+            (correctedIb != (int16_t)correctedIb) ||
+            (-correctedIa - correctedIb != (int16_t)(-correctedIa - correctedIb)))
+        {
+            MEASURE_BENCH_ErrorAdd(&errorRange,
+                MCAPP_CURRENT_TO_AMPERE(pCurrent->Ic_actual),
+                fmax(fmin(Ic, MC1_PEAK_CURRENT), -MC1_PEAK_CURRENT));
+            continue;
+        }
+        MEASURE_BENCH_ErrorAdd(&errorIa,
+            MCAPP_CURRENT_TO_AMPERE(pCurrent->Ia_actual), referenceIa);
+        MEASURE_BENCH_ErrorAdd(&errorIc,
+            MCAPP_CURRENT_TO_AMPERE(pCurrent->Ic_actual), Ic);
+    }
+
+    BENCH_StatReport(stdout, "MCAPP_MeasureCurrentOffset", &offsetStat);
+    BENCH_StatReport(stdout, "MCAPP_MeasureCurrentCalibrate", &calibrateStat);
+    MEASURE_BENCH_ErrorReport("Ia error", &errorIa);
+    MEASURE_BENCH_ErrorReport("Ic error", &errorIc);
+    MEASURE_BENCH_ErrorReport("Ic error beyond full scale", &errorRange);
+
+    mismatch = MEASURE_BENCH_Motors(pSamples, sampleCount, pCurrent);
+    MEASURE_BENCH_Track(&measure);
+
+    free(pSamples);
+    return (mismatch == 0) ? 0 : 1;
+}
+
+// </editor-fold>
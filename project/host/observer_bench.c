@@ -0,0 +1,336 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file observer_bench.c
+ *
+ * @brief Sensorless observer test harness. Replays a trace of current 
+ * samples and voltage commands through MCAPP_ObserverUpdate() as the
+ * current control calls it, and reports the cost per call and, when the 
+ * trace has the angle of a position sensor, the errors of the estimated 
+ * angle and speed.
+ *
+ * With -g it writes a trace of a permanent magnet motor model instead : a
+ * dq current control with the true angle, the delay of the PWM update and 
+ * 12 bit current samples, over a speed profile that accelerates, reverses 
+ * and holds in both directions.
+ *
+ * Trace format, one control cycle per line, Q15 of MC1_PEAK_CURRENT and
+ * MC1_PEAK_VOLTAGE :
+ *   # observer trace pwm_hz <Hz> r <Ohm> l <H> volt_fs <V> amp_fs <A>
+ *   <ialpha> <ibeta> <valpha> <vbeta> <angle>
+ * valpha and vbeta are the command calculated from the samples of the 
+ * line, angle is 65536 per turn or -1 without position sensor. Lines 
+ * starting with # are comments.
+ *
+ * Usage: observer_bench [-g] <trace file>
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "pwm.h"
+#include "measure.h"
+#include "observer.h"
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* Motor model of the generated trace */
+#define OBSERVER_BENCH_R        0.5         /* Ohm */
+#define OBSERVER_BENCH_L        0.0005      /* H */
+#define OBSERVER_BENCH_FLUX     0.0159      /* V s, 10 V at 100 Hz */
+#define OBSERVER_BENCH_VBUS     39.0        /* V */
+#define OBSERVER_BENCH_IQ       3.0         /* A */
+#define OBSERVER_BENCH_BANDWIDTH 1000.0     /* Hz of the current control */
+
+/* Speed profile, electrical Hz at the end of each segment and seconds */
+#define OBSERVER_BENCH_SEGMENTS 5
+
+/* The errors are reported above this speed, after the settling time */
+#define OBSERVER_BENCH_MIN_HZ   20.0
+#define OBSERVER_BENCH_SETTLE   0.1
+
+#define OBSERVER_BENCH_PI       3.14159265358979
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: OBSERVER_BENCH_Q15(double, double) </B>
+*
+* @brief Returns a value in Q15 of a full scale, saturated.
+*/
+static long OBSERVER_BENCH_Q15(double value, double fullScale)
+{
+    long q15 = lround(value / fullScale * 32768.0);
+
+    return (q15 > 32767) ? 32767 : (q15 < -32768) ? -32768 : q15;
+}
+
+/**
+* <B> Function: OBSERVER_BENCH_Generate(const char *) </B>
+*
+* @brief Writes the trace of the motor model.
+*/
+static int OBSERVER_BENCH_Generate(const char *pPath)
+{
+    static const double profile[OBSERVER_BENCH_SEGMENTS][2] =
+    {
+        {100.0, 0.4}, {100.0, 0.3}, {-100.0, 0.8}, {-100.0, 0.3}, 
+        {-40.0, 0.2}
+    };
+    double ts = 1.0 / PWMFREQUENCY_HZ, decay, wc, kp, ki, vmax;
+    double hz = 0.0, angle = 0.0, ialpha = 0.0, ibeta = 0.0;
+    double id, iq, ed, eq, vd, vq, intD = 0.0, intQ = 0.0, vmag, mid;
+    double valpha = 0.0, vbeta = 0.0, pendingAlpha = 0.0, pendingBeta = 0.0;
+    double sampleAlpha, sampleBeta, c, s, start = 0.0, time;
+    uint32_t cycles = 0, n, segment;
+    FILE *pFile = fopen(pPath, "w");
+
+    if (pFile == NULL)
+    {
+        perror(pPath);
+        return 1;
+    }
+    decay = exp(-OBSERVER_BENCH_R / OBSERVER_BENCH_L * ts);
+    wc = 2.0 * OBSERVER_BENCH_PI * OBSERVER_BENCH_BANDWIDTH;
+    kp = OBSERVER_BENCH_L * wc;
+    ki = OBSERVER_BENCH_R * wc * ts;
+    vmax = OBSERVER_BENCH_VBUS / sqrt(3.0);
+
+    fprintf(pFile, "# observer trace pwm_hz %u r %g l %g volt_fs %g "
+            "amp_fs %g\n", (unsigned)PWMFREQUENCY_HZ, OBSERVER_BENCH_R,
+            OBSERVER_BENCH_L, (double)MC1_PEAK_VOLTAGE, 
+            (double)MC1_PEAK_CURRENT);
+    fprintf(pFile, "# motor model, flux %g Vs, VBUS %g V, iq %g A\n",
+            OBSERVER_BENCH_FLUX, OBSERVER_BENCH_VBUS, OBSERVER_BENCH_IQ);
+    for (segment = 0; segment < OBSERVER_BENCH_SEGMENTS; segment++)
+    {
+        double from = hz, to = profile[segment][0];
+
+        n = (uint32_t)lround(profile[segment][1] * PWMFREQUENCY_HZ);
+        for (; n > 0; n--, cycles++)
+        {
+            /* 12 bit current samples */
+            sampleAlpha = 16.0 * lround(OBSERVER_BENCH_Q15(ialpha, 
+                                        MC1_PEAK_CURRENT) / 16.0);
+            sampleBeta = 16.0 * lround(OBSERVER_BENCH_Q15(ibeta, 
+                                       MC1_PEAK_CURRENT) / 16.0);
+
+            /* Current control with the true angle */
+            c = cos(angle);
+            s = sin(angle);
+            id = (sampleAlpha * c + sampleBeta * s) * 
+                    MC1_PEAK_CURRENT / 32768.0;
+            iq = (sampleBeta * c - sampleAlpha * s) * 
+                    MC1_PEAK_CURRENT / 32768.0;
+            intD += ki * (0.0 - id);
+            intQ += ki * (OBSERVER_BENCH_IQ - iq);
+            vd = intD + kp * (0.0 - id);
+            vq = intQ + kp * (OBSERVER_BENCH_IQ - iq) + 
+                    2.0 * OBSERVER_BENCH_PI * hz * OBSERVER_BENCH_FLUX;
+            vmag = hypot(vd, vq);
+            if (vmag > vmax)
+            {
+                vd *= vmax / vmag;
+                vq *= vmax / vmag;
+            }
+            valpha = vd * c - vq * s;
+            vbeta = vd * s + vq * c;
+
+            fprintf(pFile, "%ld %ld %ld %ld %ld\n", (long)sampleAlpha,
+                    (long)sampleBeta, 
+                    OBSERVER_BENCH_Q15(valpha, MC1_PEAK_VOLTAGE),
+                    OBSERVER_BENCH_Q15(vbeta, MC1_PEAK_VOLTAGE),
+                    (long)(lround(angle / (2.0 * OBSERVER_BENCH_PI) * 
+                                  65536.0) & 0xFFFF));
+
+            /* Next sample : the command of the previous cycle is applied,
+               the back EMF at the middle of the cycle */
+            time = (cycles - start + 1) * ts;
+            hz = from + (to - from) * time / profile[segment][1];
+            mid = angle + OBSERVER_BENCH_PI * hz * ts;
+            ed = -2.0 * OBSERVER_BENCH_PI * hz * OBSERVER_BENCH_FLUX * 
+                    sin(mid);
+            eq = 2.0 * OBSERVER_BENCH_PI * hz * OBSERVER_BENCH_FLUX * 
+                    cos(mid);
+            ialpha = ialpha * decay + (pendingAlpha - ed) * 
+                        (1.0 - decay) / OBSERVER_BENCH_R;
+            ibeta = ibeta * decay + (pendingBeta - eq) * 
+                        (1.0 - decay) / OBSERVER_BENCH_R;
+            angle = fmod(angle + 2.0 * OBSERVER_BENCH_PI * hz * ts, 
+                         2.0 * OBSERVER_BENCH_PI);
+            pendingAlpha = valpha;
+            pendingBeta = vbeta;
+        }
+        start = cycles;
+        hz = to;
+    }
+    fclose(pFile);
+    printf("Observer trace %s, %u cycles of the motor model\n", pPath,
+           (unsigned)cycles);
+    return 0;
+}
+
+/**
+* <B> Function: OBSERVER_BENCH_Replay(const char *) </B>
+*
+* @brief Runs the observer over a trace and reports cost and errors.
+*/
+static int OBSERVER_BENCH_Replay(const char *pPath)
+{
+    MCAPP_OBSERVER_T observer;
+    BENCH_STAT_T update;
+    char line[256];
+    unsigned hz = 0;
+    double r = 0.0, l = 0.0, voltFs = 0.0, ampFs = 0.0;
+    double error, refHz, sumAngle = 0.0, maxAngle = 0.0, sumSpeed = 0.0;
+    double maxSpeed = 0.0;
+    long sample[5], lastAngle = -1;
+    int16_t valpha = 0, vbeta = 0;
+    uint32_t cycles = 0, counted = 0, settle = 0;
+    uint64_t start;
+    FILE *pFile = fopen(pPath, "r");
+
+    if (pFile == NULL)
+    {
+        perror(pPath);
+        return 1;
+    }
+    BENCH_StatInit(&update, 1);
+    while (fgets(line, sizeof(line), pFile) != NULL)
+    {
+        if (line[0] == '#')
+        {
+            if (sscanf(line, "# observer trace pwm_hz %u r %lf l %lf "
+                       "volt_fs %lf amp_fs %lf", &hz, &r, &l, &voltFs,
+                       &ampFs) == 5)
+            {
+                if ((fabs(voltFs - MC1_PEAK_VOLTAGE) > 1e-3) || 
+                    (fabs(ampFs - MC1_PEAK_CURRENT) > 1e-3))
+                {
+                    fprintf(stderr, "%s: full scale %g V %g A, the build "
+                            "has %g V %g A\n", pPath, voltFs, ampFs,
+                            (double)MC1_PEAK_VOLTAGE, 
+                            (double)MC1_PEAK_CURRENT);
+                    fclose(pFile);
+                    return 1;
+                }
+                MCAPP_ObserverInit(&observer, (float)r, (float)l, hz);
+                settle = (uint32_t)(OBSERVER_BENCH_SETTLE * hz);
+            }
+            continue;
+        }
+        if (hz == 0)
+        {
+            fprintf(stderr, "%s: no trace header\n", pPath);
+            fclose(pFile);
+            return 1;
+        }
+        if (sscanf(line, "%ld %ld %ld %ld %ld", &sample[0], &sample[1], 
+                   &sample[2], &sample[3], &sample[4]) != 5)
+        {
+            continue;
+        }
+
+        /* As MCAPP_FocUpdate() : the command of the previous cycle */
+        start = BENCH_Count();
+        MCAPP_ObserverUpdate(&observer, (int16_t)sample[0], 
+                             (int16_t)sample[1], valpha, vbeta);
+        BENCH_StatAdd(&update, BENCH_Count() - start);
+        valpha = (int16_t)sample[2];
+        vbeta = (int16_t)sample[3];
+        cycles++;
+
+        if ((sample[4] >= 0) && (lastAngle >= 0))
+        {
+            refHz = (int16_t)(sample[4] - lastAngle) * (double)hz / 65536.0;
+            if ((fabs(refHz) >= OBSERVER_BENCH_MIN_HZ) && (cycles > settle))
+            {
+                error = (int16_t)(observer.angle - sample[4]) * 
+                            360.0 / 65536.0;
+                sumAngle += error * error;
+                maxAngle = fmax(maxAngle, fabs(error));
+                error = observer.speed * (double)hz / 65536.0 - refHz;
+                sumSpeed += error * error;
+                maxSpeed = fmax(maxSpeed, fabs(error));
+                counted++;
+            }
+        }
+        lastAngle = sample[4];
+    }
+    fclose(pFile);
+
+    printf("Observer replay %s, %u cycles at %u Hz, Rs %g Ohm, Ls %g H\n",
+           pPath, (unsigned)cycles, hz, r, l);
+    BENCH_StatReport(stdout, "MCAPP_ObserverUpdate", &update);
+    if (counted > 0)
+    {
+        printf("%-32s %8.2f rms %8.2f max [electrical degrees, %u cycles "
+               "above %.0f Hz]\n", "angle error", sqrt(sumAngle / counted),
+               maxAngle, (unsigned)counted, OBSERVER_BENCH_MIN_HZ);
+        printf("%-32s %8.2f rms %8.2f max [Hz]\n", "speed error", 
+               sqrt(sumSpeed / counted), maxSpeed);
+    }
+    else
+    {
+        printf("%-32s no position sensor in the trace\n", "angle error");
+    }
+    return 0;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    if ((argc == 3) && (strcmp(argv[1], "-g") == 0))
+    {
+        return OBSERVER_BENCH_Generate(argv[2]);
+    }
+    if (argc == 2)
+    {
+        return OBSERVER_BENCH_Replay(argv[1]);
+    }
+    fprintf(stderr, "usage: observer_bench [-g] <trace file>\n");
+    return 2;
+}
+
+// </editor-fold>
@@ -0,0 +1,591 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file pwm_sim.c
+ *
+ * @brief This module implements the PWM time base simulator.
+ *
+ * Model of a PWM generator as configured by pwm.c:
+ *  - Center-aligned modes (MODSEL = 4..6): the time base counts up and down,
+ *    half a cycle is PER + 1 PWM clock. PWMxH is active while the counter is
+ *    above PER + 1 - DC, i.e. a pulse of 2*DC centered in the cycle. PHASE
+ *    delays a triggered start of cycle. In dual edge mode (MODSEL = 6) 
+ *    PHASE is the active time of the first half (up count) instead, DC that
+ *    of the second half.
+ *  - Edge-aligned modes (MODSEL = 0..3): one cycle is PER + 1 PWM clock, 
+ *    PWMxH is active from PHASE to DC.
+ *  - Complementary outputs: DTH delays the PWMxH rising edge and DTL delays
+ *    the PWMxL rising edge.
+ *  - TRIGA/B/C compare during the first half (up count) of the cycle.
+ *  - Start of cycle: local EOC (SOCS = 0), trigger output of PGn (SOCS = n,
+ *    PGTRGSEL of PGn selects EOC or TRIGA/B/C) and PCI Sync from the PWM 
+ *    output selected by PWMPCI. TRGMOD = 1 re-starts a running cycle, 
+ *    TRGMOD = 0 runs TRGCNT + 1 cycles per trigger.
+ *  - Register values are latched at every start of cycle.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <xc.h>
+
+#include "host_sfr.h"
+#include "pwm_sim.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* PGx and APGx register blocks are consecutive in the host register model */
+#define PWMSIM_SFR_STRIDE   (HOST_SFR_PG2CON - HOST_SFR_PG1CON)
+#define PWMSIM_SFR(gen, reg)                                                   \
+    (HOST_SFR_INDEX_T)(HOST_SFR_PG1##reg + (gen)*PWMSIM_SFR_STRIDE)
+
+_Static_assert(HOST_SFR_APG1CON == HOST_SFR_PG1CON + 
+               PWMSIM_PG_COUNT*PWMSIM_SFR_STRIDE, "APGx block order");
+
+#define PWMSIM_PCI_NONE     -1
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+static const char *pwmSimGeneratorNames[PWMSIM_GENERATOR_COUNT] =
+{
+    "PG1", "PG2", "PG3", "PG4", "PG5", "PG6", "PG7", "PG8",
+    "APG1", "APG2", "APG3"
+};
+
+static const char *pwmSimEventNames[] =
+{
+    "EOC", "H_FALL", "L_FALL", "H_RISE", "L_RISE",
+    "TRIGA", "TRIGB", "TRIGC", "ADC_TRIG1", "ADC_TRIG2", "SOC"
+};
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static uint32_t PWMSIM_Read(HOST_SFR_INDEX_T index, void *pBits)
+{
+    uint32_t value = HOST_SfrPeek(index);
+
+    if (pBits != NULL)
+    {
+        memcpy(pBits, &value, sizeof(value));
+    }
+    return value;
+}
+
+static void PWMSIM_AddEvent(PWMSIM_GENERATOR_T *pGen, uint32_t offset,
+                            PWMSIM_EVENT_TYPE_T type)
+{
+    uint8_t i;
+
+    if ((offset > pGen->period) || 
+        (pGen->eventCount >= PWMSIM_CYCLE_EVENTS_MAX))
+    {
+        return;
+    }
+
+    /* Insertion sort on offset, then on event type */
+    i = pGen->eventCount++;
+    while ((i > 0) && 
+           ((pGen->events[i-1].offset > offset) ||
+            ((pGen->events[i-1].offset == offset) && 
+             (pGen->events[i-1].type > type))))
+    {
+        pGen->events[i] = pGen->events[i-1];
+        i--;
+    }
+    pGen->events[i].offset = offset;
+    pGen->events[i].type = type;
+}
+
+/**
+* <B> Function: PWMSIM_Latch(PWMSIM_T *, uint8_t) </B>
+*
+* @brief Reads the generator registers and builds the event list of one PWM
+* cycle.
+*/
+static void PWMSIM_Latch(PWMSIM_T *pSim, uint8_t gen)
+{
+    PWMSIM_GENERATOR_T *pGen = &pSim->generator[gen];
+    HOST_PGCON_BITS_T con;
+    HOST_PGIOCON1_BITS_T iocon1;
+    HOST_PGEVT1_BITS_T evt1;
+    HOST_PGEVT2_BITS_T evt2;
+    HOST_PGSPCI1_BITS_T spci1;
+    HOST_PGDT_BITS_T dt;
+    uint32_t scale, per, dc, phase, half, rise, fall, trig[3];
+    uint8_t i;
+
+    PWMSIM_Read(PWMSIM_SFR(gen, CON), &con);
+    PWMSIM_Read(PWMSIM_SFR(gen, IOCON1), &iocon1);
+    PWMSIM_Read(PWMSIM_SFR(gen, EVT1), &evt1);
+    PWMSIM_Read(PWMSIM_SFR(gen, EVT2), &evt2);
+    PWMSIM_Read(PWMSIM_SFR(gen, SPCI1), &spci1);
+    PWMSIM_Read(PWMSIM_SFR(gen, DT), &dt);
+
+    scale = (gen < PWMSIM_PG_COUNT) ? 
+                PWMSIM_PG_TICKS_PER_COUNT : PWMSIM_APG_TICKS_PER_COUNT;
+    per = con.MPERSEL ? 
+            PWMSIM_Read(HOST_SFR_MPER, NULL) : 
+            PWMSIM_Read(PWMSIM_SFR(gen, PER), NULL);
+    dc = con.MDCSEL ? 
+            PWMSIM_Read(HOST_SFR_MDC, NULL) : 
+            PWMSIM_Read(PWMSIM_SFR(gen, DC), NULL);
+    phase = con.MPHSEL ? 
+            PWMSIM_Read(HOST_SFR_MPHASE, NULL) : 
+            PWMSIM_Read(PWMSIM_SFR(gen, PHASE), NULL);
+    trig[0] = PWMSIM_Read(PWMSIM_SFR(gen, TRIGA), NULL) * scale;
+    trig[1] = PWMSIM_Read(PWMSIM_SFR(gen, TRIGB), NULL) * scale;
+    trig[2] = PWMSIM_Read(PWMSIM_SFR(gen, TRIGC), NULL) * scale;
+    per *= scale;
+    dc *= scale;
+    phase *= scale;
+
+    pGen->enabled = con.ON;
+    pGen->socs = (con.SOCS == 0xF) ? 0xF : con.SOCS;
+    pGen->trgmod = con.TRGMOD;
+    pGen->trgcnt = con.TRGCNT;
+    pGen->pgtrgsel = evt1.PGTRGSEL;
+    pGen->adcTrig1PostScale = evt1.ADTR1PS;
+    pGen->pciPolarity = spci1.PPS;
+    /* PWMPCI selects the PWM output used as PCI source. As wired in this 
+       example, PWMPCI = n selects PG(n+1) for PGx and PG(n+2) for APGx */
+    if (evt1.PWMPCI == 0)
+    {
+        pGen->pciSource = PWMSIM_PCI_NONE;
+    }
+    else
+    {
+        pGen->pciSource = (gen < PWMSIM_PG_COUNT) ? 
+                            evt1.PWMPCI : (evt1.PWMPCI + 1);
+    }
+
+    pGen->eventCount = 0;
+    if (con.MODSEL >= 4)
+    {
+        half = per + PWMSIM_TICKS_PER_CLOCK;
+        pGen->period = 2 * half;
+        pGen->phase = phase;
+        rise = (dc < half) ? (half - dc) : 0;
+        fall = (dc < half) ? (half + dc) : pGen->period;
+        if (con.MODSEL == 6)
+        {
+            pGen->phase = 0;
+            rise = (phase < half) ? (half - phase) : 0;
+        }
+    }
+    else
+    {
+        pGen->period = per + PWMSIM_TICKS_PER_CLOCK;
+        pGen->phase = 0;
+        rise = phase;
+        fall = (dc < pGen->period) ? dc : pGen->period;
+    }
+
+    /* Levels at the start of cycle, edges inside the cycle */
+    pGen->idleH = (rise == 0) && (fall > 0);
+    pGen->idleL = !pGen->idleH;
+    if ((rise > 0) && (fall > rise))
+    {
+        PWMSIM_AddEvent(pGen, rise, PWMSIM_EVENT_L_FALL);
+        if (rise + dt.DTH*scale < fall)
+        {
+            PWMSIM_AddEvent(pGen, rise + dt.DTH*scale, PWMSIM_EVENT_H_RISE);
+            PWMSIM_AddEvent(pGen, fall, PWMSIM_EVENT_H_FALL);
+        }
+        if (fall + dt.DTL*scale < pGen->period)
+        {
+            PWMSIM_AddEvent(pGen, fall + dt.DTL*scale, PWMSIM_EVENT_L_RISE);
+        }
+    }
+    if (iocon1.PENH == 0)
+    {
+        pGen->idleH = false;
+    }
+    if (iocon1.PENL == 0)
+    {
+        pGen->idleL = false;
+    }
+    for (i = 0; i < pGen->eventCount; i++)
+    {
+        if (((iocon1.PENH == 0) && 
+             ((pGen->events[i].type == PWMSIM_EVENT_H_RISE) ||
+              (pGen->events[i].type == PWMSIM_EVENT_H_FALL))) ||
+            ((iocon1.PENL == 0) && 
+             ((pGen->events[i].type == PWMSIM_EVENT_L_RISE) ||
+              (pGen->events[i].type == PWMSIM_EVENT_L_FALL))))
+        {
+            memmove(&pGen->events[i], &pGen->events[i+1],
+                    (pGen->eventCount - i - 1)*sizeof(pGen->events[0]));
+            pGen->eventCount--;
+            i--;
+        }
+    }
+
+    PWMSIM_AddEvent(pGen, trig[0], PWMSIM_EVENT_TRIGA);
+    PWMSIM_AddEvent(pGen, trig[1], PWMSIM_EVENT_TRIGB);
+    PWMSIM_AddEvent(pGen, trig[2], PWMSIM_EVENT_TRIGC);
+    if (evt1.ADTR1EN1) PWMSIM_AddEvent(pGen, trig[0], PWMSIM_EVENT_ADC_TRIG1);
+    if (evt1.ADTR1EN2) PWMSIM_AddEvent(pGen, trig[1], PWMSIM_EVENT_ADC_TRIG1);
+    if (evt1.ADTR1EN3) PWMSIM_AddEvent(pGen, trig[2], PWMSIM_EVENT_ADC_TRIG1);
+    if (evt2.ADTR2EN1) PWMSIM_AddEvent(pGen, trig[0], PWMSIM_EVENT_ADC_TRIG2);
+    if (evt2.ADTR2EN2) PWMSIM_AddEvent(pGen, trig[1], PWMSIM_EVENT_ADC_TRIG2);
+    if (evt2.ADTR2EN3) PWMSIM_AddEvent(pGen, trig[2], PWMSIM_EVENT_ADC_TRIG2);
+    PWMSIM_AddEvent(pGen, pGen->period, PWMSIM_EVENT_EOC);
+}
+
+static void PWMSIM_Emit(PWMSIM_T *pSim, uint8_t gen, uint64_t time,
+                        PWMSIM_EVENT_TYPE_T type)
+{
+    PWMSIM_EVENT_T event;
+
+    pSim->eventCount++;
+    if (pSim->callback != NULL)
+    {
+        event.time = time;
+        event.generator = gen;
+        event.type = type;
+        pSim->callback(&event, pSim->pContext);
+    }
+}
+
+/**
+* <B> Function: PWMSIM_Trigger(PWMSIM_T *, uint8_t, uint64_t) </B>
+*
+* @brief Applies a start of cycle trigger to a generator.
+*/
+static void PWMSIM_Trigger(PWMSIM_T *pSim, uint8_t gen, uint64_t time)
+{
+    PWMSIM_GENERATOR_T *pGen = &pSim->generator[gen];
+    uint64_t socTime = time + pGen->phase;
+
+    if ((pGen->enabled == false) || 
+        ((pGen->running == true) && (pGen->trgmod == 0)))
+    {
+        return;
+    }
+    if ((pGen->socPending == false) || (socTime < pGen->socTime))
+    {
+        pGen->socPending = true;
+        pGen->socTime = socTime;
+    }
+}
+
+/**
+* <B> Function: PWMSIM_Output(PWMSIM_T *, uint8_t, uint64_t, type) </B>
+*
+* @brief Changes a PWM output, emits the edge and forwards it to the
+* generators that use this output as PCI Sync source.
+*/
+static void PWMSIM_Output(PWMSIM_T *pSim, uint8_t gen, uint64_t time,
+                          PWMSIM_EVENT_TYPE_T type)
+{
+    PWMSIM_GENERATOR_T *pGen = &pSim->generator[gen];
+    uint8_t i;
+
+    switch (type)
+    {
+        case PWMSIM_EVENT_H_RISE: pGen->outH = true;  break;
+        case PWMSIM_EVENT_H_FALL: pGen->outH = false; break;
+        case PWMSIM_EVENT_L_RISE: pGen->outL = true;  break;
+        default:                  pGen->outL = false; break;
+    }
+    PWMSIM_Emit(pSim, gen, time, type);
+
+    if ((type != PWMSIM_EVENT_H_RISE) && (type != PWMSIM_EVENT_H_FALL))
+    {
+        return;
+    }
+    for (i = 0; i < PWMSIM_GENERATOR_COUNT; i++)
+    {
+        PWMSIM_GENERATOR_T *pListener = &pSim->generator[i];
+
+        if ((pListener->pciSource == gen) &&
+            ((type == PWMSIM_EVENT_H_RISE) == (pListener->pciPolarity == 0)))
+        {
+            PWMSIM_Trigger(pSim, i, time);
+        }
+    }
+}
+
+static void PWMSIM_TriggerOutput(PWMSIM_T *pSim, uint8_t gen, uint64_t time)
+{
+    uint8_t i;
+
+    for (i = 0; i < PWMSIM_PG_COUNT; i++)
+    {
+        if (pSim->generator[i].socs == gen + 1)
+        {
+            PWMSIM_Trigger(pSim, i, time);
+        }
+    }
+}
+
+/**
+* <B> Function: PWMSIM_StartCycle(PWMSIM_T *, uint8_t, uint64_t) </B>
+*
+* @brief Starts a PWM cycle: latches the registers and forces the output
+* levels of the start of cycle.
+*/
+static void PWMSIM_StartCycle(PWMSIM_T *pSim, uint8_t gen, uint64_t time)
+{
+    PWMSIM_GENERATOR_T *pGen = &pSim->generator[gen];
+
+    PWMSIM_Latch(pSim, gen);
+    pGen->socPending = false;
+    if (pGen->enabled == false)
+    {
+        pGen->running = false;
+        return;
+    }
+    pGen->running = true;
+    pGen->cycleStart = time;
+    pGen->nextEvent = 0;
+    PWMSIM_Emit(pSim, gen, time, PWMSIM_EVENT_SOC);
+
+    if (pGen->outL && !pGen->idleL)
+    {
+        PWMSIM_Output(pSim, gen, time, PWMSIM_EVENT_L_FALL);
+    }
+    if (pGen->outH != pGen->idleH)
+    {
+        PWMSIM_Output(pSim, gen, time, 
+            pGen->idleH ? PWMSIM_EVENT_H_RISE : PWMSIM_EVENT_H_FALL);
+    }
+    if (!pGen->outL && pGen->idleL)
+    {
+        PWMSIM_Output(pSim, gen, time, PWMSIM_EVENT_L_RISE);
+    }
+}
+
+/**
+* <B> Function: PWMSIM_CycleEvent(PWMSIM_T *, uint8_t, uint64_t) </B>
+*
+* @brief Processes the next event of the current cycle of a generator.
+*/
+static void PWMSIM_CycleEvent(PWMSIM_T *pSim, uint8_t gen, uint64_t time)
+{
+    PWMSIM_GENERATOR_T *pGen = &pSim->generator[gen];
+    PWMSIM_EVENT_TYPE_T type = pGen->events[pGen->nextEvent++].type;
+
+    switch (type)
+    {
+        case PWMSIM_EVENT_EOC:
+            pGen->running = false;
+            PWMSIM_Emit(pSim, gen, time, type);
+            if (pGen->pgtrgsel == 0)
+            {
+                PWMSIM_TriggerOutput(pSim, gen, time);
+            }
+            if (pGen->socs == 0)
+            {
+                PWMSIM_StartCycle(pSim, gen, time);
+            }
+            else if ((pGen->trgmod == 0) && (pGen->cyclesLeft > 0))
+            {
+                pGen->cyclesLeft--;
+                PWMSIM_StartCycle(pSim, gen, time);
+            }
+            break;
+
+        case PWMSIM_EVENT_H_RISE:
+        case PWMSIM_EVENT_H_FALL:
+        case PWMSIM_EVENT_L_RISE:
+        case PWMSIM_EVENT_L_FALL:
+            PWMSIM_Output(pSim, gen, time, type);
+            break;
+
+        case PWMSIM_EVENT_TRIGA:
+        case PWMSIM_EVENT_TRIGB:
+        case PWMSIM_EVENT_TRIGC:
+            PWMSIM_Emit(pSim, gen, time, type);
+            if (pGen->pgtrgsel == (type - PWMSIM_EVENT_TRIGA + 1))
+            {
+                PWMSIM_TriggerOutput(pSim, gen, time);
+            }
+            break;
+
+        case PWMSIM_EVENT_ADC_TRIG1:
+            if (pGen->adcTrig1Count++ >= pGen->adcTrig1PostScale)
+            {
+                pGen->adcTrig1Count = 0;
+                PWMSIM_Emit(pSim, gen, time, type);
+            }
+            break;
+
+        default:
+            PWMSIM_Emit(pSim, gen, time, type);
+            break;
+    }
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+/**
+* <B> Function: PWMSIM_Init(PWMSIM_T *, PWMSIM_CALLBACK_T, void *) </B>
+*
+* @brief Function initializes the simulator from the current PWM register
+* state of the host register model. Generators with a local EOC start of 
+* cycle start at time 0, the others wait for their trigger.
+*
+* @param pSim simulator state.
+* @param callback function called for every event, may be NULL.
+* @param pContext argument passed to the callback.
+* @return none.
+*
+* @example
+* <CODE> InitPWMGenerators(); PWMSIM_Init(&sim, NULL, NULL); </CODE>
+*
+*/
+void PWMSIM_Init(PWMSIM_T *pSim, PWMSIM_CALLBACK_T callback, void *pContext)
+{
+    uint8_t gen;
+
+    memset(pSim, 0, sizeof(*pSim));
+    pSim->callback = callback;
+    pSim->pContext = pContext;
+
+    for (gen = 0; gen < PWMSIM_GENERATOR_COUNT; gen++)
+    {
+        PWMSIM_Latch(pSim, gen);
+    }
+    for (gen = 0; gen < PWMSIM_GENERATOR_COUNT; gen++)
+    {
+        if (pSim->generator[gen].enabled && (pSim->generator[gen].socs == 0))
+        {
+            PWMSIM_StartCycle(pSim, gen, 0);
+        }
+    }
+}
+
+/**
+* <B> Function: PWMSIM_Run(PWMSIM_T *, uint64_t) </B>
+*
+* @brief Function advances the simulation, processing every event in time 
+* order. Simultaneous events of a generator are processed in the order of
+* PWMSIM_EVENT_TYPE_T, across generators in generator order.
+*
+* @param pSim simulator state.
+* @param duration time to simulate in simulator ticks.
+* @return none.
+*
+* @example
+* <CODE> PWMSIM_Run(&sim, PWMSIM_TICKS_PER_SEC); </CODE>
+*
+*/
+void PWMSIM_Run(PWMSIM_T *pSim, uint64_t duration)
+{
+    uint64_t end = pSim->time + duration;
+
+    while (1)
+    {
+        uint64_t nextTime = UINT64_MAX, time;
+        PWMSIM_EVENT_TYPE_T nextType = PWMSIM_EVENT_SOC;
+        int8_t next = -1;
+        bool soc = false;
+        uint8_t gen;
+
+        for (gen = 0; gen < PWMSIM_GENERATOR_COUNT; gen++)
+        {
+            PWMSIM_GENERATOR_T *pGen = &pSim->generator[gen];
+
+            if (pGen->running && (pGen->nextEvent < pGen->eventCount))
+            {
+                time = pGen->cycleStart + pGen->events[pGen->nextEvent].offset;
+                if ((time < nextTime) || 
+                    ((time == nextTime) && 
+                     (pGen->events[pGen->nextEvent].type < nextType)))
+                {
+                    nextTime = time;
+                    nextType = pGen->events[pGen->nextEvent].type;
+                    next = gen;
+                    soc = false;
+                }
+            }
+            if (pGen->socPending && (pGen->socTime < nextTime))
+            {
+                nextTime = pGen->socTime;
+                nextType = PWMSIM_EVENT_SOC;
+                next = gen;
+                soc = true;
+            }
+        }
+
+        if ((next < 0) || (nextTime > end))
+        {
+            break;
+        }
+        pSim->time = nextTime;
+        if (soc)
+        {
+            PWMSIM_GENERATOR_T *pGen = &pSim->generator[next];
+
+            pGen->cyclesLeft = pGen->trgcnt;
+            PWMSIM_StartCycle(pSim, next, nextTime);
+        }
+        else
+        {
+            PWMSIM_CycleEvent(pSim, next, nextTime);
+        }
+    }
+    pSim->time = end;
+}
+
+/**
+* <B> Function: PWMSIM_GeneratorName(uint8_t) </B>
+*
+* @brief Function returns the name of a generator index.
+*/
+const char *PWMSIM_GeneratorName(uint8_t gen)
+{
+    return (gen < PWMSIM_GENERATOR_COUNT) ? pwmSimGeneratorNames[gen] : "?";
+}
+
+/**
+* <B> Function: PWMSIM_EventName(PWMSIM_EVENT_TYPE_T) </B>
+*
+* @brief Function returns the name of an event type.
+*/
+const char *PWMSIM_EventName(PWMSIM_EVENT_TYPE_T type)
+{
+    return pwmSimEventNames[type];
+}
+
+// </editor-fold>
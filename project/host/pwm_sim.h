@@ -0,0 +1,170 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file pwm_sim.h
+ *
+ * @brief This header file lists the functions and definitions of the PWM 
+ * time base simulator. The simulator takes the PG1-PG8 and APG1-APG3 register 
+ * state from the host register model (as left by InitPWMGenerators()) and 
+ * produces the edge timeline of every generator: PWMxH/L edges including 
+ * dead time, TRIGA/B/C compares, ADC Trigger 1/2 and SOC/EOC, with the SOC 
+ * propagation through SOCS/PGTRGSEL and the PCI Sync inputs.
+ *
+ * Time is counted in PWMSIM ticks, 1/16 of a PWM clock period 
+ * (PWM_CLOCK_MHZ x 16), the resolution of the PGx time base registers. 
+ * The simulator is event driven, the cost is per event and not per tick.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef __PWM_SIM_H
+#define __PWM_SIM_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "pwm.h"
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="expanded" desc="DEFINITIONS/CONSTANTS ">
+
+/* Simulator time resolution */
+#define PWMSIM_TICKS_PER_CLOCK      16
+#define PWMSIM_TICKS_PER_SEC        ((uint64_t)PWM_CLOCK_MHZ*1000000UL*PWMSIM_TICKS_PER_CLOCK)
+        
+/* PG1-PG8 followed by APG1-APG3 */
+#define PWMSIM_PG_COUNT             8
+#define PWMSIM_APG_COUNT            3
+#define PWMSIM_GENERATOR_COUNT      (PWMSIM_PG_COUNT + PWMSIM_APG_COUNT)
+        
+/* Register units of the time base registers, in simulator ticks.
+   PGx registers have 1/16 PWM clock resolution and APGx registers 1/4 PWM 
+   clock, see LOOPTIME_TCY and AUX_PWM_LOOPTIME_TCY in pwm.h */
+#define PWMSIM_PG_TICKS_PER_COUNT   1
+#define PWMSIM_APG_TICKS_PER_COUNT  4
+
+/* Maximum number of events of one generator in one PWM cycle */
+#define PWMSIM_CYCLE_EVENTS_MAX     12
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="TYPE DEFINITIONS ">
+
+typedef enum
+{
+    PWMSIM_EVENT_EOC = 0,       /* End of cycle */
+    PWMSIM_EVENT_H_FALL,
+    PWMSIM_EVENT_L_FALL,
+    PWMSIM_EVENT_H_RISE,
+    PWMSIM_EVENT_L_RISE,
+    PWMSIM_EVENT_TRIGA,         /* PGxTRIGA compare */
+    PWMSIM_EVENT_TRIGB,         /* PGxTRIGB compare */
+    PWMSIM_EVENT_TRIGC,         /* PGxTRIGC compare */
+    PWMSIM_EVENT_ADC_TRIG1,     /* ADC Trigger 1 output */
+    PWMSIM_EVENT_ADC_TRIG2,     /* ADC Trigger 2 output */
+    PWMSIM_EVENT_SOC            /* Start of cycle */
+} PWMSIM_EVENT_TYPE_T;
+
+typedef struct
+{
+    uint64_t time;              /* Event time in simulator ticks */
+    uint8_t generator;          /* 0-7 : PG1-PG8, 8-10 : APG1-APG3 */
+    PWMSIM_EVENT_TYPE_T type;
+} PWMSIM_EVENT_T;
+
+typedef void (*PWMSIM_CALLBACK_T)(const PWMSIM_EVENT_T *, void *);
+
+typedef struct
+{
+    uint32_t offset;
+    PWMSIM_EVENT_TYPE_T type;
+} PWMSIM_CYCLE_EVENT_T;
+
+typedef struct
+{
+    /* Configuration latched from the registers at every start of cycle */
+    bool enabled;
+    uint8_t socs;               /* SOC source, 0 = local EOC, 1-8 = PGn */
+    uint8_t trgmod;             /* 1 = re-triggerable */
+    uint8_t trgcnt;             /* cycles per trigger in single trigger mode*/
+    uint8_t pgtrgsel;           /* trigger output: 0 EOC, 1-3 TRIGA-C */
+    int8_t pciSource;           /* PCI Sync source generator, -1 = none */
+    uint8_t pciPolarity;        /* 0 = rising edge, 1 = falling edge */
+    uint32_t phase;
+    uint8_t adcTrig1PostScale;
+    uint8_t eventCount;
+    PWMSIM_CYCLE_EVENT_T events[PWMSIM_CYCLE_EVENTS_MAX];
+    uint32_t period;
+    bool idleH;                 /* Output levels at start of cycle */
+    bool idleL;
+    
+    /* Time base state */
+    bool running;
+    uint64_t cycleStart;
+    uint8_t nextEvent;
+    uint8_t cyclesLeft;
+    bool socPending;
+    uint64_t socTime;
+    uint8_t adcTrig1Count;
+    bool outH;
+    bool outL;
+} PWMSIM_GENERATOR_T;
+
+typedef struct
+{
+    uint64_t time;
+    PWMSIM_GENERATOR_T generator[PWMSIM_GENERATOR_COUNT];
+    PWMSIM_CALLBACK_T callback;
+    void *pContext;
+    uint64_t eventCount;
+} PWMSIM_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+void PWMSIM_Init(PWMSIM_T *, PWMSIM_CALLBACK_T, void *);
+void PWMSIM_Run(PWMSIM_T *, uint64_t);
+const char *PWMSIM_GeneratorName(uint8_t);
+const char *PWMSIM_EventName(PWMSIM_EVENT_TYPE_T);
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of __PWM_SIM_H
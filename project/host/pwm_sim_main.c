@@ -0,0 +1,492 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file pwm_sim_main.c
+ *
+ * @brief PWM time base simulator tool. Runs InitPWMGenerators() on the host
+ * register model, simulates the PWM generators and reports the start of 
+ * cycle offsets between the bridges, the ADC trigger placement and the 
+ * switching noise margin of every ADC trigger.
+ *
+ * Usage: pwm_sim [-f Hz] [-d us] [-t ms] [-w ms] [-c file.csv] [-v file.vcd]
+ *                [-i deg,deg,deg] [-s m]
+ *        -f  PWM frequency applied with PWM_SetTiming() after initialization
+ *        -d  dead time applied with PWM_SetTiming(), default DEADTIME_MICROSEC
+ *        -t  simulated time, default 1000 ms
+ *        -w  length of the trace window at the end of the run, default 1 ms
+ *        -c  write the events of the trace window as CSV
+ *        -v  write the outputs of the trace window as VCD
+ *        -i  start of cycle offsets of MC1, MC2 and MC3 in degrees, applied
+ *            with PWM_SetInterleave()
+ *        -s  drive the motors with sinusoidal duty cycles of modulation
+ *            index m (0..1) at different angles and place their phase
+ *            current triggers with the trigger scheduler (pwm_trigger.c)
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include <xc.h>
+
+#include "pwm.h"
+#include "pwm_trigger.h"
+#include "host_sfr.h"
+#include "pwm_sim.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+#define PWMSIM_MASTER           4       /* PG5 */
+#define PWMSIM_TICKS_TO_US(t)   ((double)(t) * 1e6 / PWMSIM_TICKS_PER_SEC)
+#define PWMSIM_PI               3.14159265358979
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    uint64_t windowStart;
+    PWMSIM_EVENT_T *pEvents;
+    size_t count;
+    size_t size;
+    FILE *pCsv;
+    FILE *pVcd;
+    uint64_t vcdTime;
+    bool adcLevel[PWMSIM_GENERATOR_COUNT];
+} PWMSIM_TRACE_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+static char PWMSIM_VcdId(uint8_t gen, uint8_t signal)
+{
+    return (char)('!' + gen*3 + signal);
+}
+
+static void PWMSIM_VcdHeader(FILE *pVcd)
+{
+    uint8_t gen;
+
+    fprintf(pVcd, "$timescale 1 fs $end\n$scope module pwm $end\n");
+    for (gen = 0; gen < PWMSIM_GENERATOR_COUNT; gen++)
+    {
+        const char *pName = PWMSIM_GeneratorName(gen);
+
+        fprintf(pVcd, "$var wire 1 %c %sH $end\n", PWMSIM_VcdId(gen, 0), pName);
+        fprintf(pVcd, "$var wire 1 %c %sL $end\n", PWMSIM_VcdId(gen, 1), pName);
+        fprintf(pVcd, "$var wire 1 %c %sADC $end\n", PWMSIM_VcdId(gen, 2), pName);
+    }
+    fprintf(pVcd, "$upscope $end\n$enddefinitions $end\n");
+}
+
+static void PWMSIM_VcdWrite(PWMSIM_TRACE_T *pTrace, const PWMSIM_EVENT_T *pEvent)
+{
+    /* 1 tick = 1/16 PWM clock = 156250 fs at 400 MHz */
+    uint64_t fs = pEvent->time * (1000000000000000ULL / PWMSIM_TICKS_PER_SEC);
+    char id;
+    int level;
+
+    switch (pEvent->type)
+    {
+        case PWMSIM_EVENT_H_RISE: id = PWMSIM_VcdId(pEvent->generator, 0); level = 1; break;
+        case PWMSIM_EVENT_H_FALL: id = PWMSIM_VcdId(pEvent->generator, 0); level = 0; break;
+        case PWMSIM_EVENT_L_RISE: id = PWMSIM_VcdId(pEvent->generator, 1); level = 1; break;
+        case PWMSIM_EVENT_L_FALL: id = PWMSIM_VcdId(pEvent->generator, 1); level = 0; break;
+        case PWMSIM_EVENT_ADC_TRIG1:
+            /* ADC triggers toggle the ADC signal */
+            id = PWMSIM_VcdId(pEvent->generator, 2);
+            pTrace->adcLevel[pEvent->generator] = !pTrace->adcLevel[pEvent->generator];
+            level = pTrace->adcLevel[pEvent->generator];
+            break;
+        default:
+            return;
+    }
+    if ((pTrace->vcdTime == UINT64_MAX) || (fs != pTrace->vcdTime))
+    {
+        fprintf(pTrace->pVcd, "#%llu\n", (unsigned long long)fs);
+        pTrace->vcdTime = fs;
+    }
+    fprintf(pTrace->pVcd, "%d%c\n", level, id);
+}
+
+static void PWMSIM_Record(const PWMSIM_EVENT_T *pEvent, void *pContext)
+{
+    PWMSIM_TRACE_T *pTrace = pContext;
+
+    if (pEvent->time < pTrace->windowStart)
+    {
+        return;
+    }
+    if (pTrace->count == pTrace->size)
+    {
+        pTrace->size = pTrace->size ? 2*pTrace->size : 4096;
+        pTrace->pEvents = realloc(pTrace->pEvents, 
+                                  pTrace->size*sizeof(PWMSIM_EVENT_T));
+        if (pTrace->pEvents == NULL)
+        {
+            perror("pwm_sim");
+            exit(1);
+        }
+    }
+    pTrace->pEvents[pTrace->count++] = *pEvent;
+
+    if (pTrace->pCsv != NULL)
+    {
+        fprintf(pTrace->pCsv, "%llu,%.5f,%s,%s\n", 
+                (unsigned long long)pEvent->time, 
+                PWMSIM_TICKS_TO_US(pEvent->time),
+                PWMSIM_GeneratorName(pEvent->generator), 
+                PWMSIM_EventName(pEvent->type));
+    }
+    if (pTrace->pVcd != NULL)
+    {
+        PWMSIM_VcdWrite(pTrace, pEvent);
+    }
+}
+
+static bool PWMSIM_IsEdge(PWMSIM_EVENT_TYPE_T type)
+{
+    return (type >= PWMSIM_EVENT_H_FALL) && (type <= PWMSIM_EVENT_L_RISE);
+}
+
+/**
+* <B> Function: PWMSIM_Report(PWMSIM_T *, PWMSIM_TRACE_T *) </B>
+*
+* @brief Reports, for the last full cycle of the trace window, the start of
+* cycle offset of every running generator relative to the master PG5 and the
+* distance of every ADC trigger to the nearest switching edge of another
+* generator.
+*/
+static void PWMSIM_Report(PWMSIM_T *pSim, PWMSIM_TRACE_T *pTrace)
+{
+    uint64_t lastSoc[PWMSIM_GENERATOR_COUNT] = {0};
+    uint64_t prevSoc[PWMSIM_GENERATOR_COUNT] = {0};
+    uint64_t masterPeriod, masterSoc, cycleStart;
+    bool seen[PWMSIM_GENERATOR_COUNT] = {false};
+    size_t i, j;
+    uint8_t gen;
+
+    /* The last two SOCs of every generator */
+    for (i = 0; i < pTrace->count; i++)
+    {
+        const PWMSIM_EVENT_T *pEvent = &pTrace->pEvents[i];
+
+        if (pEvent->type == PWMSIM_EVENT_SOC)
+        {
+            prevSoc[pEvent->generator] = lastSoc[pEvent->generator];
+            lastSoc[pEvent->generator] = pEvent->time;
+            seen[pEvent->generator] = true;
+        }
+    }
+    if (!seen[PWMSIM_MASTER] || (prevSoc[PWMSIM_MASTER] == 0))
+    {
+        printf("PG5 is not running, nothing to report\n");
+        return;
+    }
+    masterSoc = prevSoc[PWMSIM_MASTER];
+    masterPeriod = lastSoc[PWMSIM_MASTER] - prevSoc[PWMSIM_MASTER];
+
+    printf("\nGenerator    period[us]   SOC offset to PG5 [us]  [deg]\n");
+    for (gen = 0; gen < PWMSIM_GENERATOR_COUNT; gen++)
+    {
+        uint64_t offset;
+
+        if (!seen[gen] || (prevSoc[gen] == 0))
+        {
+            continue;
+        }
+        offset = (prevSoc[gen] >= masterSoc) ? 
+                    (prevSoc[gen] - masterSoc) % masterPeriod : 
+                    (masterPeriod - (masterSoc - prevSoc[gen]) % masterPeriod) 
+                        % masterPeriod;
+        printf("%-10s %12.3f %24.3f %6.1f\n", PWMSIM_GeneratorName(gen),
+               PWMSIM_TICKS_TO_US(lastSoc[gen] - prevSoc[gen]),
+               PWMSIM_TICKS_TO_US(offset), 
+               360.0 * (double)offset / (double)masterPeriod);
+    }
+
+    /* ADC triggers of the last full master cycle */
+    printf("\nADC trigger  at [us] from own SOC  nearest edge of another "
+           "generator [us]\n");
+    for (i = 0; i < pTrace->count; i++)
+    {
+        const PWMSIM_EVENT_T *pEvent = &pTrace->pEvents[i];
+        uint64_t nearest = UINT64_MAX;
+        uint8_t nearestGen = 0;
+
+        if ((pEvent->type != PWMSIM_EVENT_ADC_TRIG1) || 
+            (pEvent->time < masterSoc) || 
+            (pEvent->time >= masterSoc + masterPeriod))
+        {
+            continue;
+        }
+        cycleStart = 0;
+        for (j = 0; j < pTrace->count; j++)
+        {
+            const PWMSIM_EVENT_T *pOther = &pTrace->pEvents[j];
+            uint64_t distance;
+
+            if ((pOther->generator == pEvent->generator) ||
+                !PWMSIM_IsEdge(pOther->type))
+            {
+                if ((pOther->generator == pEvent->generator) && 
+                    (pOther->type == PWMSIM_EVENT_SOC) && 
+                    (pOther->time <= pEvent->time))
+                {
+                    cycleStart = pOther->time;
+                }
+                continue;
+            }
+            distance = (pOther->time > pEvent->time) ? 
+                        (pOther->time - pEvent->time) : 
+                        (pEvent->time - pOther->time);
+            if (distance < nearest)
+            {
+                nearest = distance;
+                nearestGen = pOther->generator;
+            }
+        }
+        printf("%-10s %12.3f %24.3f (%s)\n", 
+               PWMSIM_GeneratorName(pEvent->generator),
+               PWMSIM_TICKS_TO_US(pEvent->time - cycleStart),
+               PWMSIM_TICKS_TO_US(nearest), PWMSIM_GeneratorName(nearestGen));
+    }
+}
+
+/**
+* <B> Function: PWMSIM_Schedule(double) </B>
+*
+* @brief Writes sinusoidal duty cycles of modulation index m to the motors, 
+* 120 electrical degrees apart from motor to motor, places the phase current
+* triggers with the trigger scheduler and reports them.
+*/
+static void PWMSIM_Schedule(double index)
+{
+    static PWM_TRIGGER_T trigger;
+    uint32_t duty[3], half;
+    double angle;
+    uint16_t motor, phase;
+
+    PWM_TriggerInit(&trigger, &pwmTiming);
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        half = trigger.half / trigger.scale[motor];
+        angle = 2.0 * PWMSIM_PI * (0.1 + motor / 3.0);
+        for (phase = 0; phase < 3; phase++)
+        {
+            duty[phase] = (uint32_t)(0.5 * half * 
+                (1.0 + index * sin(angle - phase * 2.0 * PWMSIM_PI / 3.0)));
+        }
+        PWM_MotorDutySet(motor, duty);
+        PWM_TriggerDutySet(&trigger, motor, duty, duty);
+    }
+    PWM_TriggerSchedule(&trigger);
+    PWM_TriggerUpdate(&trigger);
+
+    printf("\nMotor  SOC offset [us]  scheduled trigger [us]  margin [us]  "
+           "(index %.2f)\n", index);
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        printf("MC%u %18.3f %23.3f %12.3f\n", motor + 1,
+               PWMSIM_TICKS_TO_US(trigger.socOffset[motor]),
+               PWMSIM_TICKS_TO_US(trigger.trigger[motor] * 
+                                  trigger.scale[motor]),
+               PWMSIM_TICKS_TO_US(trigger.margin[motor]));
+    }
+    printf("Samples without quiet gap: %u\n", trigger.misses);
+}
+
+static double PWMSIM_WallSeconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + 1e-9 * now.tv_nsec;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    static PWMSIM_T sim;
+    PWMSIM_TRACE_T trace;
+    double runMs = 1000.0, windowMs = 1.0, wall;
+    uint32_t frequencyHz = 0;
+    float deadtimeMicrosec = DEADTIME_MICROSEC;
+    const char *pCsvName = NULL, *pVcdName = NULL;
+    uint64_t duration, window;
+    double index = -1.0;
+    uint16_t interleave[PWM_MOTOR_COUNT];
+    bool interleaveSet = false;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+        {
+            frequencyHz = (uint32_t)atol(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-d") == 0) && (i + 1 < argc))
+        {
+            deadtimeMicrosec = (float)atof(argv[++i]);
+            if (frequencyHz == 0)
+            {
+                frequencyHz = PWMFREQUENCY_HZ;
+            }
+        }
+        else if ((strcmp(argv[i], "-t") == 0) && (i + 1 < argc))
+        {
+            runMs = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-w") == 0) && (i + 1 < argc))
+        {
+            windowMs = atof(argv[++i]);
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            pCsvName = argv[++i];
+        }
+        else if ((strcmp(argv[i], "-v") == 0) && (i + 1 < argc))
+        {
+            pVcdName = argv[++i];
+        }
+        else if ((strcmp(argv[i], "-i") == 0) && (i + 1 < argc))
+        {
+            unsigned deg[PWM_MOTOR_COUNT];
+
+            if (sscanf(argv[++i], "%u,%u,%u", &deg[0], &deg[1], &deg[2]) 
+                    != PWM_MOTOR_COUNT)
+            {
+                fprintf(stderr, "pwm_sim: -i expects deg,deg,deg\n");
+                return 2;
+            }
+            interleave[0] = (uint16_t)deg[0];
+            interleave[1] = (uint16_t)deg[1];
+            interleave[2] = (uint16_t)deg[2];
+            interleaveSet = true;
+        }
+        else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            index = atof(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: pwm_sim [-f Hz] [-d us] [-t ms] [-w ms] "
+                    "[-c file.csv] [-v file.vcd] [-i deg,deg,deg] [-s m]\n");
+            return 2;
+        }
+    }
+    if (windowMs > runMs)
+    {
+        windowMs = runMs;
+    }
+    duration = (uint64_t)(runMs * 1e-3 * PWMSIM_TICKS_PER_SEC);
+    window = (uint64_t)(windowMs * 1e-3 * PWMSIM_TICKS_PER_SEC);
+
+    memset(&trace, 0, sizeof(trace));
+    trace.windowStart = duration - window;
+    trace.vcdTime = UINT64_MAX;
+    if (pCsvName != NULL)
+    {
+        trace.pCsv = fopen(pCsvName, "w");
+        if (trace.pCsv == NULL)
+        {
+            perror(pCsvName);
+            return 1;
+        }
+        fprintf(trace.pCsv, "tick,time_us,generator,event\n");
+    }
+    if (pVcdName != NULL)
+    {
+        trace.pVcd = fopen(pVcdName, "w");
+        if (trace.pVcd == NULL)
+        {
+            perror(pVcdName);
+            return 1;
+        }
+        PWMSIM_VcdHeader(trace.pVcd);
+    }
+
+    HOST_SfrReset();
+    InitPWMGenerators();
+    if ((frequencyHz != 0) && 
+        (PWM_SetTiming(frequencyHz, deadtimeMicrosec) == 0))
+    {
+        fprintf(stderr, "pwm_sim: timing %u Hz / %.3f us is out of range\n",
+                (unsigned)frequencyHz, deadtimeMicrosec);
+        return 1;
+    }
+    if (interleaveSet && (PWM_SetInterleave(interleave) == 0))
+    {
+        fprintf(stderr, "pwm_sim: interleave offsets are 0 to 359 deg\n");
+        return 1;
+    }
+    if (index >= 0.0)
+    {
+        PWMSIM_Schedule(index);
+    }
+    PWMSIM_Init(&sim, PWMSIM_Record, &trace);
+
+    wall = PWMSIM_WallSeconds();
+    PWMSIM_Run(&sim, duration);
+    wall = PWMSIM_WallSeconds() - wall;
+
+    printf("Simulated %.1f ms, %llu events in %.3f s wall time "
+           "(%.1f x real time, %.1f Mevents/s)\n", runMs, 
+           (unsigned long long)sim.eventCount, wall, 
+           (runMs * 1e-3) / wall, sim.eventCount / wall * 1e-6);
+    PWMSIM_Report(&sim, &trace);
+
+    if (trace.pCsv != NULL)
+    {
+        fclose(trace.pCsv);
+    }
+    if (trace.pVcd != NULL)
+    {
+        fclose(trace.pVcd);
+    }
+    free(trace.pEvents);
+    return 0;
+}
+
+// </editor-fold>
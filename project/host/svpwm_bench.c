@@ -0,0 +1,333 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file svpwm_bench.c
+ *
+ * @brief Space vector modulator benchmark. Times SVPWM_Calculate() and
+ * SVPWM_Update() on voltage commands of all angles, from zero to beyond the
+ * hexagon, and compares the duty cycles with a double precision reference
+ * of the same modulation, in linear and in overmodulation mode, and in the
+ * discontinuous modes DPWM0 to DPWM3. For those it also counts the phases
+ * that switch per cycle.
+ *
+ * Usage: svpwm_bench [-n samples]
+ *        -n  number of test commands, default 65536
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "pwm.h"
+#include "svpwm.h"
+#include "host_sfr.h"
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+/* DC link voltage, Q15 of the voltage commands */
+#define SVPWM_BENCH_VBUS        20000
+/* Largest command magnitude, relative to the hexagon corner VBUS*2/3 */
+#define SVPWM_BENCH_RANGE       1.1
+#define SVPWM_BENCH_SAMPLES     65536
+
+#define SVPWM_BENCH_PI          3.14159265358979
+
+/* Duty cycle error of a clamping decision taken differently at a sector
+   boundary by the reference, not counted as error */
+#define SVPWM_BENCH_BOUNDARY    1000.0
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    int16_t
+        valpha,
+        vbeta;
+
+} SVPWM_BENCH_COMMAND_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: SVPWM_BENCH_MaxPlusMin(double, double, double) </B>
+*/
+static double SVPWM_BENCH_MaxPlusMin(double a, double b, double c)
+{
+    return fmax(a, fmax(b, c)) + fmin(a, fmin(b, c));
+}
+
+/**
+* <B> Function: SVPWM_BENCH_Reference(const SVPWM_T *, double, double,
+*                                     double *) </B>
+*
+* @brief Min-max injection SVPWM, or the clamping of the discontinuous mode
+* while the modulator clamps, with the limits of the modulator, in double
+* precision.
+*/
+static void SVPWM_BENCH_Reference(const SVPWM_T *pSvpwm, double valpha,
+                                  double vbeta, double *pDuty)
+{
+    double vbus = pSvpwm->vbus, v[3], vmax, vmin, scale, limit, offset;
+    uint16_t phase, high;
+
+    limit = vbus / sqrt(3.0);
+    if ((pSvpwm->mode == SVPWM_LINEAR) && (hypot(valpha, vbeta) > limit))
+    {
+        scale = limit / hypot(valpha, vbeta);
+        valpha *= scale;
+        vbeta *= scale;
+    }
+    v[0] = valpha;
+    v[1] = -0.5 * valpha + 0.5 * sqrt(3.0) * vbeta;
+    v[2] = -0.5 * valpha - 0.5 * sqrt(3.0) * vbeta;
+    vmax = fmax(v[0], fmax(v[1], v[2]));
+    vmin = fmin(v[0], fmin(v[1], v[2]));
+    if ((pSvpwm->mode != SVPWM_LINEAR) && ((vmax - vmin) > vbus))
+    {
+        scale = vbus / (vmax - vmin);
+        for (phase = 0; phase < 3; phase++)
+        {
+            v[phase] *= scale;
+        }
+        vmax *= scale;
+        vmin *= scale;
+    }
+    offset = 0.5 * (vmax + vmin);
+    if ((pSvpwm->clamp != SVPWM_CONTINUOUS) && pSvpwm->clamping)
+    {
+        switch (pSvpwm->clamp)
+        {
+            case SVPWM_DPWM0:
+                high = (SVPWM_BENCH_MaxPlusMin(v[0] - v[1], v[1] - v[2],
+                                               v[2] - v[0]) >= 0.0);
+                break;
+            case SVPWM_DPWM2:
+                high = (SVPWM_BENCH_MaxPlusMin(v[0] - v[2], v[1] - v[0],
+                                               v[2] - v[1]) >= 0.0);
+                break;
+            case SVPWM_DPWM3:
+                high = ((vmax + vmin) < 0.0);
+                break;
+            default:
+                high = ((vmax + vmin) >= 0.0);
+                break;
+        }
+        offset = high ? (vmax - 0.5 * vbus) : (vmin + 0.5 * vbus);
+    }
+    for (phase = 0; phase < 3; phase++)
+    {
+        if ((pSvpwm->clamp != SVPWM_CONTINUOUS) && pSvpwm->clamping &&
+            (fabs(v[phase] - offset) >= 0.5 * vbus))
+        {
+            pDuty[phase] = (v[phase] > offset) ? pSvpwm->clampHigh :
+                                                 pSvpwm->clampLow;
+            continue;
+        }
+        pDuty[phase] = pSvpwm->center +
+            (v[phase] - offset) * 2.0 * pSvpwm->center / vbus;
+        pDuty[phase] = fmin(fmax(pDuty[phase], pSvpwm->minDuty),
+                            pSvpwm->maxDuty);
+    }
+}
+
+/**
+* <B> Function: SVPWM_BENCH_Run(SVPWM_MODE_T, SVPWM_CLAMP_T,
+*                               const SVPWM_BENCH_COMMAND_T *, uint32_t) </B>
+*
+* @brief Times the modulator in one mode and reports its duty cycle error.
+*/
+static void SVPWM_BENCH_Run(SVPWM_MODE_T mode, SVPWM_CLAMP_T clamp,
+                            const SVPWM_BENCH_COMMAND_T *pCommand,
+                            uint32_t samples)
+{
+    static const char *pModeName[] = {"linear", "overmodulation"};
+    static const char *pClampName[] = {"SVPWM", "DPWM0", "DPWM1", "DPWM2",
+                                       "DPWM3"};
+    SVPWM_T svpwm;
+    BENCH_STAT_T calculate, update, reference;
+    double duty[3], error, errorMax = 0.0, sumSquare = 0.0, sink = 0.0;
+    char name[48];
+    uint64_t start;
+    uint32_t i, k, limited, switching = 0, boundary = 0, counted = 0;
+    uint16_t phase;
+
+    SVPWM_Init(&svpwm, PWM_MOTOR_MC1, &pwmTiming, mode);
+    SVPWM_VbusSet(&svpwm, SVPWM_BENCH_VBUS);
+    SVPWM_ClampSet(&svpwm, clamp, SVPWM_DPWM_ON_INDEX, SVPWM_DPWM_OFF_INDEX);
+
+    /* Accuracy */
+    for (i = 0; i < samples; i++)
+    {
+        SVPWM_Calculate(&svpwm, pCommand[i].valpha, pCommand[i].vbeta);
+        SVPWM_BENCH_Reference(&svpwm, pCommand[i].valpha, pCommand[i].vbeta,
+                              duty);
+        for (phase = 0; phase < 3; phase++)
+        {
+            if ((svpwm.duty[phase] != svpwm.clampLow) &&
+                (svpwm.duty[phase] != svpwm.clampHigh))
+            {
+                switching++;
+            }
+            error = fabs((double)svpwm.duty[phase] - duty[phase]);
+            if (error > SVPWM_BENCH_BOUNDARY)
+            {
+                boundary++;
+                continue;
+            }
+            errorMax = fmax(errorMax, error);
+            sumSquare += error * error;
+            counted++;
+        }
+    }
+    limited = svpwm.limited;
+
+    /* Cost */
+    BENCH_StatInit(&calculate, BENCH_BATCH_CALLS);
+    BENCH_StatInit(&update, BENCH_BATCH_CALLS);
+    BENCH_StatInit(&reference, BENCH_BATCH_CALLS);
+    for (i = 0; i + BENCH_BATCH_CALLS <= samples; i += BENCH_BATCH_CALLS)
+    {
+        start = BENCH_Count();
+        for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+        {
+            SVPWM_Calculate(&svpwm, pCommand[k].valpha, pCommand[k].vbeta);
+        }
+        BENCH_StatAdd(&calculate, BENCH_Count() - start);
+
+        start = BENCH_Count();
+        for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+        {
+            SVPWM_Update(&svpwm, pCommand[k].valpha, pCommand[k].vbeta);
+        }
+        BENCH_StatAdd(&update, BENCH_Count() - start);
+
+        start = BENCH_Count();
+        for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+        {
+            SVPWM_BENCH_Reference(&svpwm, pCommand[k].valpha,
+                                  pCommand[k].vbeta, duty);
+            sink += duty[0];
+        }
+        BENCH_StatAdd(&reference, BENCH_Count() - start);
+    }
+
+    printf("\n%s, %s mode, VBUS %d, %u commands up to %.2f x VBUS*2/3 "
+           "(%u limited)\n", pClampName[clamp], pModeName[mode],
+           SVPWM_BENCH_VBUS, (unsigned)samples, SVPWM_BENCH_RANGE,
+           (unsigned)limited);
+    snprintf(name, sizeof(name), "SVPWM_Calculate (Q15)");
+    BENCH_StatReport(stdout, name, &calculate);
+    snprintf(name, sizeof(name), "SVPWM_Update (Q15, PGxDC)");
+    BENCH_StatReport(stdout, name, &update);
+    snprintf(name, sizeof(name), "reference (double)");
+    BENCH_StatReport(stdout, name, &reference);
+    printf("%-32s %8.2f max %8.3f rms [counts of %u, %.1f per LSB]%s\n",
+           "duty error", errorMax, sqrt(sumSquare / (3.0 * samples)),
+           (unsigned)(2 * svpwm.center),
+           2.0 * svpwm.center / SVPWM_BENCH_VBUS, (sink < 0.0) ? " " : "");
+    printf("%-32s %8.3f per cycle, %u clamping decisions at sector "
+           "boundaries\n", "switching phases", (double)switching / samples,
+           (unsigned)(boundary));
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    SVPWM_BENCH_COMMAND_T *pCommand;
+    uint32_t samples = SVPWM_BENCH_SAMPLES, i, seed = 0x2545F491;
+    double angle, magnitude;
+    int arg, clamp;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((strcmp(argv[arg], "-n") == 0) && (arg + 1 < argc))
+        {
+            samples = (uint32_t)atol(argv[++arg]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: svpwm_bench [-n samples]\n");
+            return 2;
+        }
+    }
+    if (samples < BENCH_BATCH_CALLS)
+    {
+        samples = BENCH_BATCH_CALLS;
+    }
+
+    pCommand = malloc(samples * sizeof(SVPWM_BENCH_COMMAND_T));
+    if (pCommand == NULL)
+    {
+        perror("svpwm_bench");
+        return 1;
+    }
+    for (i = 0; i < samples; i++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        angle = 2.0 * SVPWM_BENCH_PI * (seed & 0xFFFF) / 65536.0;
+        magnitude = SVPWM_BENCH_RANGE * SVPWM_BENCH_VBUS * 2.0 / 3.0 *
+                    (seed >> 16) / 65536.0;
+        pCommand[i].valpha = (int16_t)lround(magnitude * cos(angle));
+        pCommand[i].vbeta = (int16_t)lround(magnitude * sin(angle));
+    }
+
+    HOST_SfrReset();
+    InitPWMGenerators();
+    SVPWM_BENCH_Run(SVPWM_LINEAR, SVPWM_CONTINUOUS, pCommand, samples);
+    SVPWM_BENCH_Run(SVPWM_OVERMODULATION, SVPWM_CONTINUOUS, pCommand,
+                    samples);
+    for (clamp = SVPWM_DPWM0; clamp <= SVPWM_DPWM3; clamp++)
+    {
+        SVPWM_BENCH_Run(SVPWM_LINEAR, (SVPWM_CLAMP_T)clamp, pCommand,
+                        samples);
+    }
+
+    free(pCommand);
+    return 0;
+}
+
+// </editor-fold>
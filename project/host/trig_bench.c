@@ -0,0 +1,311 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file trig_bench.c
+ *
+ * @brief Trigonometry benchmark. Times the sine, cosine and arc tangent 
+ * kernels of trig.c, Q15 and float, and the libm functions they replace, 
+ * sinf(), cosf() and atan2f(), on angles and vectors of all quadrants, and
+ * reports the largest error of each kernel against libm in double.
+ *
+ * Usage: trig_bench [-n samples]
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "trig.h"
+#include "bench.h"
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="DEFINITIONS ">
+
+#define TRIG_BENCH_SAMPLES      65536
+
+/* Range of the float angles, radians : a few turns on both sides */
+#define TRIG_BENCH_RANGE        (8.0 * M_PI)
+
+#define TRIG_BENCH_ANGLE_RAD    (2.0 * M_PI / 65536.0)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="TYPE DEFINITIONS ">
+
+typedef struct
+{
+    uint16_t
+        angle;              /* 65536 per turn */
+
+    int16_t
+        y,                  /* Vector of the arc tangent, Q15 */
+        x;
+
+    float
+        radians,            /* Float angle */
+        yFloat,             /* Float vector */
+        xFloat;
+
+} TRIG_BENCH_INPUT_T;
+
+typedef enum
+{
+    TRIG_BENCH_SINCOS_Q15 = 0,
+    TRIG_BENCH_SIN_Q15,
+    TRIG_BENCH_ATAN2_Q15,
+    TRIG_BENCH_SINCOS,
+    TRIG_BENCH_ATAN2,
+    TRIG_BENCH_LIBM_SINCOS,
+    TRIG_BENCH_LIBM_ATAN2,
+    TRIG_BENCH_KERNELS
+} TRIG_BENCH_KERNEL_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="VARIABLES ">
+
+static volatile float trigBenchSink;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: TRIG_BENCH_AngleError(double, double) </B>
+*
+* @brief Returns the magnitude of the difference of two angles, radians,
+* modulo one turn.
+*/
+static double TRIG_BENCH_AngleError(double angle, double reference)
+{
+    return fabs(remainder(angle - reference, 2.0 * M_PI));
+}
+
+/**
+* <B> Function: TRIG_BENCH_Time(TRIG_BENCH_KERNEL_T, 
+*                               const TRIG_BENCH_INPUT_T *, uint32_t,
+*                               BENCH_STAT_T *) </B>
+*
+* @brief Times a kernel in batches of BENCH_BATCH_CALLS calls.
+*/
+static void TRIG_BENCH_Time(TRIG_BENCH_KERNEL_T kernel,
+                            const TRIG_BENCH_INPUT_T *pInput, 
+                            uint32_t samples, BENCH_STAT_T *pStat)
+{
+    uint64_t start;
+    uint32_t i, k, sum = 0;
+    int16_t sinQ15, cosQ15;
+    float sinFloat, cosFloat, sumFloat = 0.0f;
+
+    BENCH_StatInit(pStat, BENCH_BATCH_CALLS);
+    for (i = 0; i + BENCH_BATCH_CALLS <= samples; i += BENCH_BATCH_CALLS)
+    {
+        start = BENCH_Count();
+        switch (kernel)
+        {
+            case TRIG_BENCH_SINCOS_Q15:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    TRIG_SinCosQ15(pInput[k].angle, &sinQ15, &cosQ15);
+                    sum += sinQ15 + cosQ15;
+                }
+                break;
+            case TRIG_BENCH_SIN_Q15:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    sum += TRIG_SinQ15(pInput[k].angle);
+                }
+                break;
+            case TRIG_BENCH_ATAN2_Q15:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    sum += TRIG_Atan2Q15(pInput[k].y, pInput[k].x);
+                }
+                break;
+            case TRIG_BENCH_SINCOS:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    TRIG_SinCos(pInput[k].radians, &sinFloat, &cosFloat);
+                    sumFloat += sinFloat + cosFloat;
+                }
+                break;
+            case TRIG_BENCH_ATAN2:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    sumFloat += TRIG_Atan2(pInput[k].yFloat, 
+                                           pInput[k].xFloat);
+                }
+                break;
+            case TRIG_BENCH_LIBM_SINCOS:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    sumFloat += sinf(pInput[k].radians) + 
+                                cosf(pInput[k].radians);
+                }
+                break;
+            default:
+                for (k = i; k < i + BENCH_BATCH_CALLS; k++)
+                {
+                    sumFloat += atan2f(pInput[k].yFloat, pInput[k].xFloat);
+                }
+                break;
+        }
+        BENCH_StatAdd(pStat, BENCH_Count() - start);
+    }
+    trigBenchSink = sumFloat + (float)sum;
+}
+
+// </editor-fold>
+
+// <editor-fold defaultstate="expanded" desc="INTERFACE FUNCTIONS ">
+
+int main(int argc, char *argv[])
+{
+    static const char *pKernelName[TRIG_BENCH_KERNELS] =
+    {
+        "TRIG_SinCosQ15", "TRIG_SinQ15", "TRIG_Atan2Q15", "TRIG_SinCos",
+        "TRIG_Atan2", "sinf + cosf (libm)", "atan2f (libm)"
+    };
+    BENCH_STAT_T stat[TRIG_BENCH_KERNELS];
+    TRIG_BENCH_INPUT_T *pInput;
+    double sinError = 0.0, sinQ15Error = 0.0, atanError = 0.0;
+    double atanQ15Error = 0.0, libmSinError = 0.0, libmAtanError = 0.0;
+    double angle, reference;
+    uint32_t samples = TRIG_BENCH_SAMPLES, i, seed = 0x2545F491;
+    int16_t sinQ15, cosQ15;
+    float sinFloat, cosFloat;
+    int arg, kernel;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((strcmp(argv[arg], "-n") == 0) && (arg + 1 < argc))
+        {
+            samples = (uint32_t)atol(argv[++arg]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: trig_bench [-n samples]\n");
+            return 2;
+        }
+    }
+    if (samples < BENCH_BATCH_CALLS)
+    {
+        samples = BENCH_BATCH_CALLS;
+    }
+
+    pInput = malloc(samples * sizeof(TRIG_BENCH_INPUT_T));
+    if (pInput == NULL)
+    {
+        perror("trig_bench");
+        return 1;
+    }
+    for (i = 0; i < samples; i++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        pInput[i].angle = (uint16_t)(seed & 0xFFFF);
+        pInput[i].y = (int16_t)(seed >> 16);
+        pInput[i].x = (int16_t)(seed & 0xFFFF);
+        pInput[i].radians = (float)(TRIG_BENCH_RANGE * 
+                                    ((double)seed / 2147483648.0 - 1.0));
+        pInput[i].yFloat = pInput[i].y / 32768.0f;
+        pInput[i].xFloat = pInput[i].x / 32768.0f;
+    }
+
+    /* Accuracy against libm in double */
+    for (i = 0; i < samples; i++)
+    {
+        angle = pInput[i].angle * TRIG_BENCH_ANGLE_RAD;
+        TRIG_SinCosQ15(pInput[i].angle, &sinQ15, &cosQ15);
+        sinQ15Error = fmax(sinQ15Error, fabs(sinQ15 - 32767.0 * sin(angle)));
+        sinQ15Error = fmax(sinQ15Error, fabs(cosQ15 - 32767.0 * cos(angle)));
+        if ((sinQ15 != TRIG_SinQ15(pInput[i].angle)) ||
+            (cosQ15 != TRIG_CosQ15(pInput[i].angle)))
+        {
+            fprintf(stderr, "trig_bench: TRIG_SinCosQ15() differs from "
+                    "TRIG_SinQ15()/TRIG_CosQ15() at %u\n", 
+                    (unsigned)pInput[i].angle);
+            return 1;
+        }
+
+        TRIG_SinCos(pInput[i].radians, &sinFloat, &cosFloat);
+        sinError = fmax(sinError, fabs(sinFloat - sin(pInput[i].radians)));
+        sinError = fmax(sinError, fabs(cosFloat - cos(pInput[i].radians)));
+        libmSinError = fmax(libmSinError, 
+                            fabs(sinf(pInput[i].radians) - 
+                                 sin(pInput[i].radians)));
+
+        if ((pInput[i].y != 0) || (pInput[i].x != 0))
+        {
+            reference = atan2(pInput[i].y, pInput[i].x);
+            atanQ15Error = fmax(atanQ15Error, TRIG_BENCH_AngleError(
+                TRIG_Atan2Q15(pInput[i].y, pInput[i].x) * 
+                TRIG_BENCH_ANGLE_RAD, reference));
+            atanError = fmax(atanError, TRIG_BENCH_AngleError(
+                TRIG_Atan2(pInput[i].yFloat, pInput[i].xFloat), reference));
+            libmAtanError = fmax(libmAtanError, TRIG_BENCH_AngleError(
+                atan2f(pInput[i].yFloat, pInput[i].xFloat), reference));
+        }
+    }
+
+    /* Cost */
+    for (kernel = 0; kernel < TRIG_BENCH_KERNELS; kernel++)
+    {
+        TRIG_BENCH_Time((TRIG_BENCH_KERNEL_T)kernel, pInput, samples, 
+                        &stat[kernel]);
+    }
+
+    printf("Trigonometry, %u samples, tables of %u intervals\n", 
+           (unsigned)samples, (unsigned)TRIG_TABLE_SIZE);
+    for (kernel = 0; kernel < TRIG_BENCH_KERNELS; kernel++)
+    {
+        BENCH_StatReport(stdout, pKernelName[kernel], &stat[kernel]);
+    }
+    printf("%-32s %8.3f max [Q15 LSB]\n", "TRIG_SinCosQ15 error",
+           sinQ15Error);
+    printf("%-32s %8.3f max [LSB of 65536 per turn]\n", 
+           "TRIG_Atan2Q15 error", atanQ15Error / TRIG_BENCH_ANGLE_RAD);
+    printf("%-32s %8.2e max, libm %.2e\n", "TRIG_SinCos error", sinError, 
+           libmSinError);
+    printf("%-32s %8.2e max, libm %.2e [rad]\n", "TRIG_Atan2 error", 
+           atanError, libmAtanError);
+
+    free(pInput);
+    return 0;
+}
+
+// </editor-fold>
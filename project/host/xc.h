@@ -0,0 +1,5156 @@
+// <editor-fold defaultstate="collapsed" desc="Description/Instruction ">
+/**
+ * @file xc.h
+ *
+ * @brief Host replacement of the XC-DSC device header for dsPIC33AK512MC510.
+ * 
+ * Register and bit field names match the device header so the HAL sources
+ * compile unchanged with gcc. Each register maps onto the host register 
+ * model (host_sfr.c); bit field positions follow the register layouts used
+ * by the model and are only meaningful on the host.
+ *
+ * Component: HOST
+ *
+ */
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="Disclaimer ">
+
+/*
+ [2025] Microchip Technology Inc. and its subsidiaries.
+
+    Subject to your compliance with these terms, you may use Microchip 
+    software and any derivatives exclusively with Microchip products. 
+    You are responsible for complying with 3rd party license terms  
+    applicable to your use of 3rd party software (including open source  
+    software) that may accompany Microchip software. SOFTWARE IS ?AS IS.? 
+    NO WARRANTIES, WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS 
+    SOFTWARE, INCLUDING ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT,  
+    MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE. IN NO EVENT 
+    WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE, 
+    INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY 
+    KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF 
+    MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE 
+    FORESEEABLE. TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP?S 
+    TOTAL LIABILITY ON ALL CLAIMS RELATED TO THE SOFTWARE WILL NOT 
+    EXCEED AMOUNT OF FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR 
+    THIS SOFTWARE.
+*/
+
+// </editor-fold>
+
+#ifndef _HOST_XC_H
+#define _HOST_XC_H
+
+// <editor-fold defaultstate="collapsed" desc="HEADER FILES ">
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host_sfr.h"
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatability
+    extern "C" {
+#endif
+
+// <editor-fold defaultstate="collapsed" desc="DEVICE/COMPILER ">
+
+#define __dsPIC33AK512MC510__       1
+#define __HOST_BUILD__              1
+
+/* Interrupt attributes have no meaning on the host */
+#define __interrupt__
+#define interrupt
+#define no_auto_psv
+#define auto_psv
+
+#define Nop()                       do { } while (0)
+#define ClrWdt()                    do { } while (0)
+
+/* DAC calibration word (FPDMDAC) is read from a host copy of the flash row */
+extern uint32_t HOST_FPDMDAC;
+#define FPDMDAC_ADDRESS             (&HOST_FPDMDAC)
+
+/* PWM generator register blocks are addressed from their PGxCON register */
+#define PWM_GENERATOR_REG(pBase, reg)   (*HOST_SfrOffset((pBase), (reg)))
+/* Clock generator registers are addressed from their CLKxCON register */
+#define CLOCK_GENERATOR_REG(pBase, reg) (*HOST_SfrOffset((pBase), (reg)))
+
+#define HOST_SFR(name)              (*HOST_SfrAccess(HOST_SFR_##name))
+#define HOST_SFRBITS(type, name)    (*(volatile type *)HOST_SfrAccess(HOST_SFR_##name))
+#define HOST_IRQ(name)              (*HOST_IrqAccess(HOST_IRQ_##name))
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="BIT FIELD TYPES ">
+
+typedef struct
+{
+    uint32_t MODSEL:3;
+    uint32_t CLKSEL:2;
+    uint32_t :2;
+    uint32_t HREN:1;
+    uint32_t TRGCNT:3;
+    uint32_t :4;
+    uint32_t ON:1;
+    uint32_t SOCS:4;
+    uint32_t :2;
+    uint32_t TRGMOD:2;
+    uint32_t UPDMOD:3;
+    uint32_t MSTEN:1;
+    uint32_t :1;
+    uint32_t MPHSEL:1;
+    uint32_t MPERSEL:1;
+    uint32_t MDCSEL:1;
+} HOST_PGCON_BITS_T;
+
+typedef struct
+{
+    uint32_t TRIG:1;
+    uint32_t CAHALF:1;
+    uint32_t STEER:1;
+    uint32_t UPDREQ:1;
+    uint32_t UPDATE:1;
+    uint32_t CAP:1;
+    uint32_t TRCLR:1;
+    uint32_t TRSET:1;
+    uint32_t FFACT:1;
+    uint32_t CLACT:1;
+    uint32_t FLTACT:1;
+    uint32_t SACT:1;
+    uint32_t FFEVT:1;
+    uint32_t CLEVT:1;
+    uint32_t FLTEVT:1;
+    uint32_t SEVT:1;
+} HOST_PGSTAT_BITS_T;
+
+typedef struct
+{
+    uint32_t POLL:1;
+    uint32_t POLH:1;
+    uint32_t PENL:1;
+    uint32_t PENH:1;
+    uint32_t PMOD:2;
+    uint32_t :2;
+    uint32_t DTCMPSEL:1;
+    uint32_t :3;
+    uint32_t CAPSRC:3;
+    uint32_t :1;
+    uint32_t SWAP:1;
+} HOST_PGIOCON1_BITS_T;
+
+typedef struct
+{
+    uint32_t DBDAT:2;
+    uint32_t FFDAT:2;
+    uint32_t CLDAT:2;
+    uint32_t FLT1DAT:2;
+    uint32_t OSYNC:2;
+    uint32_t OVRDAT:2;
+    uint32_t OVRENL:1;
+    uint32_t OVRENH:1;
+    uint32_t :1;
+    uint32_t CLMOD:1;
+} HOST_PGIOCON2_BITS_T;
+
+typedef struct
+{
+    uint32_t PGTRGSEL:3;
+    uint32_t UPDTRG:2;
+    uint32_t PWMPCI:3;
+    uint32_t ADTR1EN1:1;
+    uint32_t ADTR1EN2:1;
+    uint32_t ADTR1EN3:1;
+    uint32_t ADTR1PS:5;
+    uint32_t ADTR1OFS:5;
+    uint32_t :3;
+    uint32_t IEVTSEL:2;
+    uint32_t :2;
+    uint32_t SIEN:1;
+    uint32_t FFIEN:1;
+    uint32_t CLIEN:1;
+    uint32_t FLT1IEN:1;
+} HOST_PGEVT1_BITS_T;
+
+typedef struct
+{
+    uint32_t :5;
+    uint32_t ADTR2EN1:1;
+    uint32_t ADTR2EN2:1;
+    uint32_t ADTR2EN3:1;
+    uint32_t :23;
+    uint32_t FLT2IEN:1;
+} HOST_PGEVT2_BITS_T;
+
+typedef struct
+{
+    uint32_t PSS:5;
+    uint32_t PPS:1;
+    uint32_t SWTERM:1;
+    uint32_t PSYNC:1;
+    uint32_t :4;
+    uint32_t TERM:3;
+    uint32_t AQPS:1;
+    uint32_t AQSS:3;
+    uint32_t :4;
+    uint32_t TSYNCDIS:1;
+    uint32_t ACP:3;
+    uint32_t SWPCI:1;
+    uint32_t SWPCIM:2;
+} HOST_PGSPCI1_BITS_T;
+
+typedef struct
+{
+    uint32_t DTL:16;
+    uint32_t DTH:16;
+} HOST_PGDT_BITS_T;
+
+typedef struct
+{
+    uint32_t MCLKSEL:2;
+    uint32_t :2;
+    uint32_t DIVSEL:2;
+    uint32_t :2;
+    uint32_t LOCK:1;
+    uint32_t :5;
+    uint32_t HRERR:1;
+    uint32_t HRRDY:1;
+} HOST_PCLKCON_BITS_T;
+
+typedef struct
+{
+    uint32_t EVTAPGS:3;
+    uint32_t :1;
+    uint32_t EVTASEL:5;
+    uint32_t :3;
+    uint32_t EVTASYNC:1;
+    uint32_t EVTASTRD:1;
+    uint32_t EVTAPOL:1;
+    uint32_t EVTAOEN:1;
+} HOST_PWMEVTA_BITS_T;
+
+typedef struct
+{
+    uint32_t EVTBPGS:3;
+    uint32_t :1;
+    uint32_t EVTBSEL:5;
+    uint32_t :3;
+    uint32_t EVTBSYNC:1;
+    uint32_t EVTBSTRD:1;
+    uint32_t EVTBPOL:1;
+    uint32_t EVTBOEN:1;
+} HOST_PWMEVTB_BITS_T;
+
+typedef struct
+{
+    uint32_t EVTCPGS:3;
+    uint32_t :1;
+    uint32_t EVTCSEL:5;
+    uint32_t :3;
+    uint32_t EVTCSYNC:1;
+    uint32_t EVTCSTRD:1;
+    uint32_t EVTCPOL:1;
+    uint32_t EVTCOEN:1;
+} HOST_PWMEVTC_BITS_T;
+
+typedef struct
+{
+    uint32_t EVTDPGS:3;
+    uint32_t :1;
+    uint32_t EVTDSEL:5;
+    uint32_t :3;
+    uint32_t EVTDSYNC:1;
+    uint32_t EVTDSTRD:1;
+    uint32_t EVTDPOL:1;
+    uint32_t EVTDOEN:1;
+} HOST_PWMEVTD_BITS_T;
+
+typedef struct
+{
+    uint32_t EVTEPGS:3;
+    uint32_t :1;
+    uint32_t EVTESEL:5;
+    uint32_t :3;
+    uint32_t EVTESYNC:1;
+    uint32_t EVTESTRD:1;
+    uint32_t EVTEPOL:1;
+    uint32_t EVTEOEN:1;
+} HOST_PWMEVTE_BITS_T;
+
+typedef struct
+{
+    uint32_t EVTFPGS:3;
+    uint32_t :1;
+    uint32_t EVTFSEL:5;
+    uint32_t :3;
+    uint32_t EVTFSYNC:1;
+    uint32_t EVTFSTRD:1;
+    uint32_t EVTFPOL:1;
+    uint32_t EVTFOEN:1;
+} HOST_PWMEVTF_BITS_T;
+
+typedef struct
+{
+    uint32_t FRCEN:1;
+    uint32_t BFRCEN:1;
+    uint32_t POSCEN:1;
+    uint32_t LPRCEN:1;
+    uint32_t :2;
+    uint32_t PLL1EN:1;
+    uint32_t PLL2EN:1;
+} HOST_OSCCTRL_BITS_T;
+
+typedef struct
+{
+    uint32_t POSCMD:2;
+    uint32_t :3;
+    uint32_t POSCIOFNC:1;
+} HOST_OSCCFG_BITS_T;
+
+typedef struct
+{
+    uint32_t NOSC:4;
+    uint32_t COSC:4;
+    uint32_t OSWEN:1;
+    uint32_t DIVSWEN:1;
+    uint32_t FOUTSWEN:1;
+    uint32_t PLLSWEN:1;
+    uint32_t OE:1;
+    uint32_t SIDL:1;
+    uint32_t :1;
+    uint32_t ON:1;
+    uint32_t BOSC:4;
+    uint32_t FSCMEN:1;
+    uint32_t :10;
+    uint32_t CLKRDY:1;
+} HOST_PLLCON_BITS_T;
+
+typedef struct
+{
+    uint32_t POSTDIV2:3;
+    uint32_t :1;
+    uint32_t POSTDIV1:3;
+    uint32_t :1;
+    uint32_t PLLFBDIV:12;
+    uint32_t :4;
+    uint32_t PLLPRE:4;
+} HOST_PLLDIV_BITS_T;
+
+typedef struct
+{
+    uint32_t NOSC:4;
+    uint32_t COSC:4;
+    uint32_t OSWEN:1;
+    uint32_t DIVSWEN:1;
+    uint32_t :2;
+    uint32_t OE:1;
+    uint32_t SIDL:1;
+    uint32_t :1;
+    uint32_t ON:1;
+    uint32_t BOSC:4;
+    uint32_t FSCMEN:1;
+    uint32_t :10;
+    uint32_t CLKRDY:1;
+} HOST_CLKCON_BITS_T;
+
+typedef struct
+{
+    uint32_t FRACDIV:9;
+    uint32_t :7;
+    uint32_t INTDIV:16;
+} HOST_CLKDIV_BITS_T;
+
+typedef struct
+{
+    uint32_t :15;
+    uint32_t ON:1;
+    uint32_t :15;
+    uint32_t ADRDY:1;
+} HOST_ADCON_BITS_T;
+
+typedef struct
+{
+    uint32_t PINSEL:6;
+    uint32_t :2;
+    uint32_t NINSEL:2;
+    uint32_t FRAC:1;
+    uint32_t DIFF:1;
+    uint32_t SAMC:10;
+    uint32_t :2;
+    uint32_t TRG1SRC:5;
+} HOST_ADCHCON1_BITS_T;
+
+typedef struct
+{
+    uint32_t MODE:2;
+    uint32_t :6;
+    uint32_t ACCNUM:2;
+} HOST_ADCHCON2_BITS_T;
+
+typedef struct
+{
+    uint32_t DNLADJ:8;
+    uint32_t NEGINLADJ:8;
+    uint32_t POSINLADJ:8;
+    uint32_t FCLKDIV:3;
+    uint32_t :2;
+    uint32_t SIDL:1;
+    uint32_t :1;
+    uint32_t ON:1;
+} HOST_DACCTRL1_BITS_T;
+
+typedef struct
+{
+    uint32_t TMODTIME:10;
+    uint32_t :6;
+    uint32_t SSTIME:10;
+} HOST_DACCTRL2_BITS_T;
+
+typedef struct
+{
+    uint32_t TMCB:10;
+    uint32_t :2;
+    uint32_t DACOEN:1;
+    uint32_t IRQM:2;
+    uint32_t DACEN:1;
+} HOST_DACCON_BITS_T;
+
+typedef struct
+{
+    uint32_t INNSEL:3;
+    uint32_t :1;
+    uint32_t INPSEL:3;
+    uint32_t :1;
+    uint32_t HYSSEL:2;
+    uint32_t HYSPOL:1;
+    uint32_t CMPPOL:1;
+    uint32_t CMPSTAT:1;
+    uint32_t CBE:1;
+    uint32_t FLTREN:1;
+} HOST_DACCMP_BITS_T;
+
+typedef struct
+{
+    uint32_t DACDAT:16;
+    uint32_t DACLOW:16;
+} HOST_DACDAT_BITS_T;
+
+typedef struct
+{
+    uint32_t SLPSTRT:4;
+    uint32_t SLPSTOPB:4;
+    uint32_t SLPSTOPA:4;
+    uint32_t HCFSEL:4;
+    uint32_t PSE:1;
+    uint32_t TWME:1;
+    uint32_t HME:1;
+    uint32_t SLOPEN:1;
+} HOST_DACSLPCON_BITS_T;
+
+typedef struct
+{
+    uint32_t MODE:4;
+    uint32_t RXEN:1;
+    uint32_t TXEN:1;
+    uint32_t ABDEN:1;
+    uint32_t BRGS:1;
+    uint32_t SENDB:1;
+    uint32_t BRKOVR:1;
+    uint32_t RXBIMD:1;
+    uint32_t WUE:1;
+    uint32_t :1;
+    uint32_t SIDL:1;
+    uint32_t :1;
+    uint32_t ON:1;
+    uint32_t FLO:2;
+    uint32_t TXPOL:1;
+    uint32_t C0EN:1;
+    uint32_t STP:2;
+    uint32_t RXPOL:1;
+    uint32_t RUNOVF:1;
+    uint32_t HALFDPLX:1;
+    uint32_t CLKSEL:2;
+    uint32_t :1;
+    uint32_t ACTIVE:1;
+    uint32_t SLPEN:1;
+} HOST_UCON_BITS_T;
+
+typedef struct
+{
+    uint32_t RXFOIF:1;
+    uint32_t RXBKIF:1;
+    uint32_t FERIF:1;
+    uint32_t CERIF:1;
+    uint32_t ABDOVIF:1;
+    uint32_t PERIF:1;
+    uint32_t TXCIF:1;
+    uint32_t TRMT:1;
+    uint32_t RXFOIE:1;
+    uint32_t RXBKIE:1;
+    uint32_t FERIE:1;
+    uint32_t CERIE:1;
+    uint32_t ABDOVIE:1;
+    uint32_t PERIE:1;
+    uint32_t TXCIE:1;
+    uint32_t TXMTIE:1;
+    uint32_t RXBF:1;
+    uint32_t RXBE:1;
+    uint32_t :1;
+    uint32_t XON:1;
+    uint32_t RCIDL:1;
+    uint32_t TXBF:1;
+    uint32_t TXBE:1;
+    uint32_t STPMD:1;
+    uint32_t TXWRE:1;
+    uint32_t RXWM:3;
+    uint32_t TXWM:3;
+} HOST_USTAT_BITS_T;
+
+typedef struct
+{
+    uint32_t RXB:8;
+} HOST_URXB_BITS_T;
+
+typedef struct
+{
+    uint32_t TXB:8;
+    uint32_t :7;
+    uint32_t LAST:1;
+} HOST_UTXB_BITS_T;
+
+typedef struct
+{
+    uint32_t :2;
+    uint32_t ABDIE:1;
+    uint32_t :3;
+    uint32_t ABDIF:1;
+    uint32_t WUIF:1;
+} HOST_UUIR_BITS_T;
+
+typedef struct
+{
+    uint32_t :1;
+    uint32_t TCS:1;
+    uint32_t TSYNC:1;
+    uint32_t :1;
+    uint32_t TCKPS:2;
+    uint32_t :1;
+    uint32_t TGATE:1;
+    uint32_t TECS:2;
+    uint32_t PRWIP:1;
+    uint32_t TMWIP:1;
+    uint32_t TMWDIS:1;
+    uint32_t SIDL:1;
+    uint32_t :1;
+    uint32_t ON:1;
+} HOST_TCON_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISA0:1;
+    uint32_t TRISA1:1;
+    uint32_t TRISA2:1;
+    uint32_t TRISA3:1;
+    uint32_t TRISA4:1;
+    uint32_t TRISA5:1;
+    uint32_t TRISA6:1;
+    uint32_t TRISA7:1;
+    uint32_t TRISA8:1;
+    uint32_t TRISA9:1;
+    uint32_t TRISA10:1;
+    uint32_t TRISA11:1;
+    uint32_t TRISA12:1;
+    uint32_t TRISA13:1;
+    uint32_t TRISA14:1;
+    uint32_t TRISA15:1;
+} HOST_TRISA_BITS_T;
+
+typedef struct
+{
+    uint32_t LATA0:1;
+    uint32_t LATA1:1;
+    uint32_t LATA2:1;
+    uint32_t LATA3:1;
+    uint32_t LATA4:1;
+    uint32_t LATA5:1;
+    uint32_t LATA6:1;
+    uint32_t LATA7:1;
+    uint32_t LATA8:1;
+    uint32_t LATA9:1;
+    uint32_t LATA10:1;
+    uint32_t LATA11:1;
+    uint32_t LATA12:1;
+    uint32_t LATA13:1;
+    uint32_t LATA14:1;
+    uint32_t LATA15:1;
+} HOST_LATA_BITS_T;
+
+typedef struct
+{
+    uint32_t RA0:1;
+    uint32_t RA1:1;
+    uint32_t RA2:1;
+    uint32_t RA3:1;
+    uint32_t RA4:1;
+    uint32_t RA5:1;
+    uint32_t RA6:1;
+    uint32_t RA7:1;
+    uint32_t RA8:1;
+    uint32_t RA9:1;
+    uint32_t RA10:1;
+    uint32_t RA11:1;
+    uint32_t RA12:1;
+    uint32_t RA13:1;
+    uint32_t RA14:1;
+    uint32_t RA15:1;
+} HOST_PORTA_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELA0:1;
+    uint32_t ANSELA1:1;
+    uint32_t ANSELA2:1;
+    uint32_t ANSELA3:1;
+    uint32_t ANSELA4:1;
+    uint32_t ANSELA5:1;
+    uint32_t ANSELA6:1;
+    uint32_t ANSELA7:1;
+    uint32_t ANSELA8:1;
+    uint32_t ANSELA9:1;
+    uint32_t ANSELA10:1;
+    uint32_t ANSELA11:1;
+    uint32_t ANSELA12:1;
+    uint32_t ANSELA13:1;
+    uint32_t ANSELA14:1;
+    uint32_t ANSELA15:1;
+} HOST_ANSELA_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISB0:1;
+    uint32_t TRISB1:1;
+    uint32_t TRISB2:1;
+    uint32_t TRISB3:1;
+    uint32_t TRISB4:1;
+    uint32_t TRISB5:1;
+    uint32_t TRISB6:1;
+    uint32_t TRISB7:1;
+    uint32_t TRISB8:1;
+    uint32_t TRISB9:1;
+    uint32_t TRISB10:1;
+    uint32_t TRISB11:1;
+    uint32_t TRISB12:1;
+    uint32_t TRISB13:1;
+    uint32_t TRISB14:1;
+    uint32_t TRISB15:1;
+} HOST_TRISB_BITS_T;
+
+typedef struct
+{
+    uint32_t LATB0:1;
+    uint32_t LATB1:1;
+    uint32_t LATB2:1;
+    uint32_t LATB3:1;
+    uint32_t LATB4:1;
+    uint32_t LATB5:1;
+    uint32_t LATB6:1;
+    uint32_t LATB7:1;
+    uint32_t LATB8:1;
+    uint32_t LATB9:1;
+    uint32_t LATB10:1;
+    uint32_t LATB11:1;
+    uint32_t LATB12:1;
+    uint32_t LATB13:1;
+    uint32_t LATB14:1;
+    uint32_t LATB15:1;
+} HOST_LATB_BITS_T;
+
+typedef struct
+{
+    uint32_t RB0:1;
+    uint32_t RB1:1;
+    uint32_t RB2:1;
+    uint32_t RB3:1;
+    uint32_t RB4:1;
+    uint32_t RB5:1;
+    uint32_t RB6:1;
+    uint32_t RB7:1;
+    uint32_t RB8:1;
+    uint32_t RB9:1;
+    uint32_t RB10:1;
+    uint32_t RB11:1;
+    uint32_t RB12:1;
+    uint32_t RB13:1;
+    uint32_t RB14:1;
+    uint32_t RB15:1;
+} HOST_PORTB_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELB0:1;
+    uint32_t ANSELB1:1;
+    uint32_t ANSELB2:1;
+    uint32_t ANSELB3:1;
+    uint32_t ANSELB4:1;
+    uint32_t ANSELB5:1;
+    uint32_t ANSELB6:1;
+    uint32_t ANSELB7:1;
+    uint32_t ANSELB8:1;
+    uint32_t ANSELB9:1;
+    uint32_t ANSELB10:1;
+    uint32_t ANSELB11:1;
+    uint32_t ANSELB12:1;
+    uint32_t ANSELB13:1;
+    uint32_t ANSELB14:1;
+    uint32_t ANSELB15:1;
+} HOST_ANSELB_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISC0:1;
+    uint32_t TRISC1:1;
+    uint32_t TRISC2:1;
+    uint32_t TRISC3:1;
+    uint32_t TRISC4:1;
+    uint32_t TRISC5:1;
+    uint32_t TRISC6:1;
+    uint32_t TRISC7:1;
+    uint32_t TRISC8:1;
+    uint32_t TRISC9:1;
+    uint32_t TRISC10:1;
+    uint32_t TRISC11:1;
+    uint32_t TRISC12:1;
+    uint32_t TRISC13:1;
+    uint32_t TRISC14:1;
+    uint32_t TRISC15:1;
+} HOST_TRISC_BITS_T;
+
+typedef struct
+{
+    uint32_t LATC0:1;
+    uint32_t LATC1:1;
+    uint32_t LATC2:1;
+    uint32_t LATC3:1;
+    uint32_t LATC4:1;
+    uint32_t LATC5:1;
+    uint32_t LATC6:1;
+    uint32_t LATC7:1;
+    uint32_t LATC8:1;
+    uint32_t LATC9:1;
+    uint32_t LATC10:1;
+    uint32_t LATC11:1;
+    uint32_t LATC12:1;
+    uint32_t LATC13:1;
+    uint32_t LATC14:1;
+    uint32_t LATC15:1;
+} HOST_LATC_BITS_T;
+
+typedef struct
+{
+    uint32_t RC0:1;
+    uint32_t RC1:1;
+    uint32_t RC2:1;
+    uint32_t RC3:1;
+    uint32_t RC4:1;
+    uint32_t RC5:1;
+    uint32_t RC6:1;
+    uint32_t RC7:1;
+    uint32_t RC8:1;
+    uint32_t RC9:1;
+    uint32_t RC10:1;
+    uint32_t RC11:1;
+    uint32_t RC12:1;
+    uint32_t RC13:1;
+    uint32_t RC14:1;
+    uint32_t RC15:1;
+} HOST_PORTC_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELC0:1;
+    uint32_t ANSELC1:1;
+    uint32_t ANSELC2:1;
+    uint32_t ANSELC3:1;
+    uint32_t ANSELC4:1;
+    uint32_t ANSELC5:1;
+    uint32_t ANSELC6:1;
+    uint32_t ANSELC7:1;
+    uint32_t ANSELC8:1;
+    uint32_t ANSELC9:1;
+    uint32_t ANSELC10:1;
+    uint32_t ANSELC11:1;
+    uint32_t ANSELC12:1;
+    uint32_t ANSELC13:1;
+    uint32_t ANSELC14:1;
+    uint32_t ANSELC15:1;
+} HOST_ANSELC_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISD0:1;
+    uint32_t TRISD1:1;
+    uint32_t TRISD2:1;
+    uint32_t TRISD3:1;
+    uint32_t TRISD4:1;
+    uint32_t TRISD5:1;
+    uint32_t TRISD6:1;
+    uint32_t TRISD7:1;
+    uint32_t TRISD8:1;
+    uint32_t TRISD9:1;
+    uint32_t TRISD10:1;
+    uint32_t TRISD11:1;
+    uint32_t TRISD12:1;
+    uint32_t TRISD13:1;
+    uint32_t TRISD14:1;
+    uint32_t TRISD15:1;
+} HOST_TRISD_BITS_T;
+
+typedef struct
+{
+    uint32_t LATD0:1;
+    uint32_t LATD1:1;
+    uint32_t LATD2:1;
+    uint32_t LATD3:1;
+    uint32_t LATD4:1;
+    uint32_t LATD5:1;
+    uint32_t LATD6:1;
+    uint32_t LATD7:1;
+    uint32_t LATD8:1;
+    uint32_t LATD9:1;
+    uint32_t LATD10:1;
+    uint32_t LATD11:1;
+    uint32_t LATD12:1;
+    uint32_t LATD13:1;
+    uint32_t LATD14:1;
+    uint32_t LATD15:1;
+} HOST_LATD_BITS_T;
+
+typedef struct
+{
+    uint32_t RD0:1;
+    uint32_t RD1:1;
+    uint32_t RD2:1;
+    uint32_t RD3:1;
+    uint32_t RD4:1;
+    uint32_t RD5:1;
+    uint32_t RD6:1;
+    uint32_t RD7:1;
+    uint32_t RD8:1;
+    uint32_t RD9:1;
+    uint32_t RD10:1;
+    uint32_t RD11:1;
+    uint32_t RD12:1;
+    uint32_t RD13:1;
+    uint32_t RD14:1;
+    uint32_t RD15:1;
+} HOST_PORTD_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELD0:1;
+    uint32_t ANSELD1:1;
+    uint32_t ANSELD2:1;
+    uint32_t ANSELD3:1;
+    uint32_t ANSELD4:1;
+    uint32_t ANSELD5:1;
+    uint32_t ANSELD6:1;
+    uint32_t ANSELD7:1;
+    uint32_t ANSELD8:1;
+    uint32_t ANSELD9:1;
+    uint32_t ANSELD10:1;
+    uint32_t ANSELD11:1;
+    uint32_t ANSELD12:1;
+    uint32_t ANSELD13:1;
+    uint32_t ANSELD14:1;
+    uint32_t ANSELD15:1;
+} HOST_ANSELD_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISE0:1;
+    uint32_t TRISE1:1;
+    uint32_t TRISE2:1;
+    uint32_t TRISE3:1;
+    uint32_t TRISE4:1;
+    uint32_t TRISE5:1;
+    uint32_t TRISE6:1;
+    uint32_t TRISE7:1;
+    uint32_t TRISE8:1;
+    uint32_t TRISE9:1;
+    uint32_t TRISE10:1;
+    uint32_t TRISE11:1;
+    uint32_t TRISE12:1;
+    uint32_t TRISE13:1;
+    uint32_t TRISE14:1;
+    uint32_t TRISE15:1;
+} HOST_TRISE_BITS_T;
+
+typedef struct
+{
+    uint32_t LATE0:1;
+    uint32_t LATE1:1;
+    uint32_t LATE2:1;
+    uint32_t LATE3:1;
+    uint32_t LATE4:1;
+    uint32_t LATE5:1;
+    uint32_t LATE6:1;
+    uint32_t LATE7:1;
+    uint32_t LATE8:1;
+    uint32_t LATE9:1;
+    uint32_t LATE10:1;
+    uint32_t LATE11:1;
+    uint32_t LATE12:1;
+    uint32_t LATE13:1;
+    uint32_t LATE14:1;
+    uint32_t LATE15:1;
+} HOST_LATE_BITS_T;
+
+typedef struct
+{
+    uint32_t RE0:1;
+    uint32_t RE1:1;
+    uint32_t RE2:1;
+    uint32_t RE3:1;
+    uint32_t RE4:1;
+    uint32_t RE5:1;
+    uint32_t RE6:1;
+    uint32_t RE7:1;
+    uint32_t RE8:1;
+    uint32_t RE9:1;
+    uint32_t RE10:1;
+    uint32_t RE11:1;
+    uint32_t RE12:1;
+    uint32_t RE13:1;
+    uint32_t RE14:1;
+    uint32_t RE15:1;
+} HOST_PORTE_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELE0:1;
+    uint32_t ANSELE1:1;
+    uint32_t ANSELE2:1;
+    uint32_t ANSELE3:1;
+    uint32_t ANSELE4:1;
+    uint32_t ANSELE5:1;
+    uint32_t ANSELE6:1;
+    uint32_t ANSELE7:1;
+    uint32_t ANSELE8:1;
+    uint32_t ANSELE9:1;
+    uint32_t ANSELE10:1;
+    uint32_t ANSELE11:1;
+    uint32_t ANSELE12:1;
+    uint32_t ANSELE13:1;
+    uint32_t ANSELE14:1;
+    uint32_t ANSELE15:1;
+} HOST_ANSELE_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISF0:1;
+    uint32_t TRISF1:1;
+    uint32_t TRISF2:1;
+    uint32_t TRISF3:1;
+    uint32_t TRISF4:1;
+    uint32_t TRISF5:1;
+    uint32_t TRISF6:1;
+    uint32_t TRISF7:1;
+    uint32_t TRISF8:1;
+    uint32_t TRISF9:1;
+    uint32_t TRISF10:1;
+    uint32_t TRISF11:1;
+    uint32_t TRISF12:1;
+    uint32_t TRISF13:1;
+    uint32_t TRISF14:1;
+    uint32_t TRISF15:1;
+} HOST_TRISF_BITS_T;
+
+typedef struct
+{
+    uint32_t LATF0:1;
+    uint32_t LATF1:1;
+    uint32_t LATF2:1;
+    uint32_t LATF3:1;
+    uint32_t LATF4:1;
+    uint32_t LATF5:1;
+    uint32_t LATF6:1;
+    uint32_t LATF7:1;
+    uint32_t LATF8:1;
+    uint32_t LATF9:1;
+    uint32_t LATF10:1;
+    uint32_t LATF11:1;
+    uint32_t LATF12:1;
+    uint32_t LATF13:1;
+    uint32_t LATF14:1;
+    uint32_t LATF15:1;
+} HOST_LATF_BITS_T;
+
+typedef struct
+{
+    uint32_t RF0:1;
+    uint32_t RF1:1;
+    uint32_t RF2:1;
+    uint32_t RF3:1;
+    uint32_t RF4:1;
+    uint32_t RF5:1;
+    uint32_t RF6:1;
+    uint32_t RF7:1;
+    uint32_t RF8:1;
+    uint32_t RF9:1;
+    uint32_t RF10:1;
+    uint32_t RF11:1;
+    uint32_t RF12:1;
+    uint32_t RF13:1;
+    uint32_t RF14:1;
+    uint32_t RF15:1;
+} HOST_PORTF_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELF0:1;
+    uint32_t ANSELF1:1;
+    uint32_t ANSELF2:1;
+    uint32_t ANSELF3:1;
+    uint32_t ANSELF4:1;
+    uint32_t ANSELF5:1;
+    uint32_t ANSELF6:1;
+    uint32_t ANSELF7:1;
+    uint32_t ANSELF8:1;
+    uint32_t ANSELF9:1;
+    uint32_t ANSELF10:1;
+    uint32_t ANSELF11:1;
+    uint32_t ANSELF12:1;
+    uint32_t ANSELF13:1;
+    uint32_t ANSELF14:1;
+    uint32_t ANSELF15:1;
+} HOST_ANSELF_BITS_T;
+
+typedef struct
+{
+    uint32_t TRISG0:1;
+    uint32_t TRISG1:1;
+    uint32_t TRISG2:1;
+    uint32_t TRISG3:1;
+    uint32_t TRISG4:1;
+    uint32_t TRISG5:1;
+    uint32_t TRISG6:1;
+    uint32_t TRISG7:1;
+    uint32_t TRISG8:1;
+    uint32_t TRISG9:1;
+    uint32_t TRISG10:1;
+    uint32_t TRISG11:1;
+    uint32_t TRISG12:1;
+    uint32_t TRISG13:1;
+    uint32_t TRISG14:1;
+    uint32_t TRISG15:1;
+} HOST_TRISG_BITS_T;
+
+typedef struct
+{
+    uint32_t LATG0:1;
+    uint32_t LATG1:1;
+    uint32_t LATG2:1;
+    uint32_t LATG3:1;
+    uint32_t LATG4:1;
+    uint32_t LATG5:1;
+    uint32_t LATG6:1;
+    uint32_t LATG7:1;
+    uint32_t LATG8:1;
+    uint32_t LATG9:1;
+    uint32_t LATG10:1;
+    uint32_t LATG11:1;
+    uint32_t LATG12:1;
+    uint32_t LATG13:1;
+    uint32_t LATG14:1;
+    uint32_t LATG15:1;
+} HOST_LATG_BITS_T;
+
+typedef struct
+{
+    uint32_t RG0:1;
+    uint32_t RG1:1;
+    uint32_t RG2:1;
+    uint32_t RG3:1;
+    uint32_t RG4:1;
+    uint32_t RG5:1;
+    uint32_t RG6:1;
+    uint32_t RG7:1;
+    uint32_t RG8:1;
+    uint32_t RG9:1;
+    uint32_t RG10:1;
+    uint32_t RG11:1;
+    uint32_t RG12:1;
+    uint32_t RG13:1;
+    uint32_t RG14:1;
+    uint32_t RG15:1;
+} HOST_PORTG_BITS_T;
+
+typedef struct
+{
+    uint32_t ANSELG0:1;
+    uint32_t ANSELG1:1;
+    uint32_t ANSELG2:1;
+    uint32_t ANSELG3:1;
+    uint32_t ANSELG4:1;
+    uint32_t ANSELG5:1;
+    uint32_t ANSELG6:1;
+    uint32_t ANSELG7:1;
+    uint32_t ANSELG8:1;
+    uint32_t ANSELG9:1;
+    uint32_t ANSELG10:1;
+    uint32_t ANSELG11:1;
+    uint32_t ANSELG12:1;
+    uint32_t ANSELG13:1;
+    uint32_t ANSELG14:1;
+    uint32_t ANSELG15:1;
+} HOST_ANSELG_BITS_T;
+
+typedef struct
+{
+    uint32_t RP1R:8;
+    uint32_t RP2R:8;
+    uint32_t RP3R:8;
+    uint32_t RP4R:8;
+} HOST_RPOR0_BITS_T;
+
+typedef struct
+{
+    uint32_t RP5R:8;
+    uint32_t RP6R:8;
+    uint32_t RP7R:8;
+    uint32_t RP8R:8;
+} HOST_RPOR1_BITS_T;
+
+typedef struct
+{
+    uint32_t RP9R:8;
+    uint32_t RP10R:8;
+    uint32_t RP11R:8;
+    uint32_t RP12R:8;
+} HOST_RPOR2_BITS_T;
+
+typedef struct
+{
+    uint32_t RP13R:8;
+    uint32_t RP14R:8;
+    uint32_t RP15R:8;
+    uint32_t RP16R:8;
+} HOST_RPOR3_BITS_T;
+
+typedef struct
+{
+    uint32_t RP17R:8;
+    uint32_t RP18R:8;
+    uint32_t RP19R:8;
+    uint32_t RP20R:8;
+} HOST_RPOR4_BITS_T;
+
+typedef struct
+{
+    uint32_t RP21R:8;
+    uint32_t RP22R:8;
+    uint32_t RP23R:8;
+    uint32_t RP24R:8;
+} HOST_RPOR5_BITS_T;
+
+typedef struct
+{
+    uint32_t RP25R:8;
+    uint32_t RP26R:8;
+    uint32_t RP27R:8;
+    uint32_t RP28R:8;
+} HOST_RPOR6_BITS_T;
+
+typedef struct
+{
+    uint32_t RP29R:8;
+    uint32_t RP30R:8;
+    uint32_t RP31R:8;
+    uint32_t RP32R:8;
+} HOST_RPOR7_BITS_T;
+
+typedef struct
+{
+    uint32_t RP33R:8;
+    uint32_t RP34R:8;
+    uint32_t RP35R:8;
+    uint32_t RP36R:8;
+} HOST_RPOR8_BITS_T;
+
+typedef struct
+{
+    uint32_t RP37R:8;
+    uint32_t RP38R:8;
+    uint32_t RP39R:8;
+    uint32_t RP40R:8;
+} HOST_RPOR9_BITS_T;
+
+typedef struct
+{
+    uint32_t RP41R:8;
+    uint32_t RP42R:8;
+    uint32_t RP43R:8;
+    uint32_t RP44R:8;
+} HOST_RPOR10_BITS_T;
+
+typedef struct
+{
+    uint32_t RP45R:8;
+    uint32_t RP46R:8;
+    uint32_t RP47R:8;
+    uint32_t RP48R:8;
+} HOST_RPOR11_BITS_T;
+
+typedef struct
+{
+    uint32_t RP49R:8;
+    uint32_t RP50R:8;
+    uint32_t RP51R:8;
+    uint32_t RP52R:8;
+} HOST_RPOR12_BITS_T;
+
+typedef struct
+{
+    uint32_t RP53R:8;
+    uint32_t RP54R:8;
+    uint32_t RP55R:8;
+    uint32_t RP56R:8;
+} HOST_RPOR13_BITS_T;
+
+typedef struct
+{
+    uint32_t RP57R:8;
+    uint32_t RP58R:8;
+    uint32_t RP59R:8;
+    uint32_t RP60R:8;
+} HOST_RPOR14_BITS_T;
+
+typedef struct
+{
+    uint32_t RP61R:8;
+    uint32_t RP62R:8;
+    uint32_t RP63R:8;
+    uint32_t RP64R:8;
+} HOST_RPOR15_BITS_T;
+
+typedef struct
+{
+    uint32_t RP65R:8;
+    uint32_t RP66R:8;
+    uint32_t RP67R:8;
+    uint32_t RP68R:8;
+} HOST_RPOR16_BITS_T;
+
+typedef struct
+{
+    uint32_t RP69R:8;
+    uint32_t RP70R:8;
+    uint32_t RP71R:8;
+    uint32_t RP72R:8;
+} HOST_RPOR17_BITS_T;
+
+typedef struct
+{
+    uint32_t RP73R:8;
+    uint32_t RP74R:8;
+    uint32_t RP75R:8;
+    uint32_t RP76R:8;
+} HOST_RPOR18_BITS_T;
+
+typedef struct
+{
+    uint32_t RP77R:8;
+    uint32_t RP78R:8;
+    uint32_t RP79R:8;
+    uint32_t RP80R:8;
+} HOST_RPOR19_BITS_T;
+
+typedef struct
+{
+    uint32_t RP81R:8;
+    uint32_t RP82R:8;
+    uint32_t RP83R:8;
+    uint32_t RP84R:8;
+} HOST_RPOR20_BITS_T;
+
+typedef struct
+{
+    uint32_t RP85R:8;
+    uint32_t RP86R:8;
+    uint32_t RP87R:8;
+    uint32_t RP88R:8;
+} HOST_RPOR21_BITS_T;
+
+typedef struct
+{
+    uint32_t RP89R:8;
+    uint32_t RP90R:8;
+    uint32_t RP91R:8;
+    uint32_t RP92R:8;
+} HOST_RPOR22_BITS_T;
+
+typedef struct
+{
+    uint32_t RP93R:8;
+    uint32_t RP94R:8;
+    uint32_t RP95R:8;
+    uint32_t RP96R:8;
+} HOST_RPOR23_BITS_T;
+
+typedef struct
+{
+    uint32_t RP97R:8;
+    uint32_t RP98R:8;
+    uint32_t RP99R:8;
+    uint32_t RP100R:8;
+} HOST_RPOR24_BITS_T;
+
+typedef struct
+{
+    uint32_t RP101R:8;
+    uint32_t RP102R:8;
+    uint32_t RP103R:8;
+    uint32_t RP104R:8;
+} HOST_RPOR25_BITS_T;
+
+typedef struct
+{
+    uint32_t RP105R:8;
+    uint32_t RP106R:8;
+    uint32_t RP107R:8;
+    uint32_t RP108R:8;
+} HOST_RPOR26_BITS_T;
+
+typedef struct
+{
+    uint32_t RP109R:8;
+    uint32_t RP110R:8;
+    uint32_t RP111R:8;
+    uint32_t RP112R:8;
+} HOST_RPOR27_BITS_T;
+
+typedef struct
+{
+    uint32_t RP113R:8;
+    uint32_t RP114R:8;
+    uint32_t RP115R:8;
+    uint32_t RP116R:8;
+} HOST_RPOR28_BITS_T;
+
+typedef struct
+{
+    uint32_t RP117R:8;
+    uint32_t RP118R:8;
+    uint32_t RP119R:8;
+    uint32_t RP120R:8;
+} HOST_RPOR29_BITS_T;
+
+typedef struct
+{
+    uint32_t RP121R:8;
+    uint32_t RP122R:8;
+    uint32_t RP123R:8;
+    uint32_t RP124R:8;
+} HOST_RPOR30_BITS_T;
+
+typedef struct
+{
+    uint32_t RP125R:8;
+    uint32_t RP126R:8;
+    uint32_t RP127R:8;
+    uint32_t RP128R:8;
+} HOST_RPOR31_BITS_T;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="BIT FIELD POSITIONS ">
+
+/* Field position and mask of the host bit field layouts, named as in the 
+   device header */
+#define _PCLKCON_MCLKSEL_POSITION 0x00000000
+#define _PCLKCON_MCLKSEL_MASK 0x00000003
+#define _PCLKCON_DIVSEL_POSITION 0x00000004
+#define _PCLKCON_DIVSEL_MASK 0x00000030
+#define _PCLKCON_LOCK_POSITION 0x00000008
+#define _PCLKCON_LOCK_MASK 0x00000100
+#define _PCLKCON_HRERR_POSITION 0x0000000E
+#define _PCLKCON_HRERR_MASK 0x00004000
+#define _PCLKCON_HRRDY_POSITION 0x0000000F
+#define _PCLKCON_HRRDY_MASK 0x00008000
+#define _PWMEVTA_EVTAPGS_POSITION 0x00000000
+#define _PWMEVTA_EVTAPGS_MASK 0x00000007
+#define _PWMEVTA_EVTASEL_POSITION 0x00000004
+#define _PWMEVTA_EVTASEL_MASK 0x000001F0
+#define _PWMEVTA_EVTASYNC_POSITION 0x0000000C
+#define _PWMEVTA_EVTASYNC_MASK 0x00001000
+#define _PWMEVTA_EVTASTRD_POSITION 0x0000000D
+#define _PWMEVTA_EVTASTRD_MASK 0x00002000
+#define _PWMEVTA_EVTAPOL_POSITION 0x0000000E
+#define _PWMEVTA_EVTAPOL_MASK 0x00004000
+#define _PWMEVTA_EVTAOEN_POSITION 0x0000000F
+#define _PWMEVTA_EVTAOEN_MASK 0x00008000
+#define _PWMEVTB_EVTBPGS_POSITION 0x00000000
+#define _PWMEVTB_EVTBPGS_MASK 0x00000007
+#define _PWMEVTB_EVTBSEL_POSITION 0x00000004
+#define _PWMEVTB_EVTBSEL_MASK 0x000001F0
+#define _PWMEVTB_EVTBSYNC_POSITION 0x0000000C
+#define _PWMEVTB_EVTBSYNC_MASK 0x00001000
+#define _PWMEVTB_EVTBSTRD_POSITION 0x0000000D
+#define _PWMEVTB_EVTBSTRD_MASK 0x00002000
+#define _PWMEVTB_EVTBPOL_POSITION 0x0000000E
+#define _PWMEVTB_EVTBPOL_MASK 0x00004000
+#define _PWMEVTB_EVTBOEN_POSITION 0x0000000F
+#define _PWMEVTB_EVTBOEN_MASK 0x00008000
+#define _PWMEVTC_EVTCPGS_POSITION 0x00000000
+#define _PWMEVTC_EVTCPGS_MASK 0x00000007
+#define _PWMEVTC_EVTCSEL_POSITION 0x00000004
+#define _PWMEVTC_EVTCSEL_MASK 0x000001F0
+#define _PWMEVTC_EVTCSYNC_POSITION 0x0000000C
+#define _PWMEVTC_EVTCSYNC_MASK 0x00001000
+#define _PWMEVTC_EVTCSTRD_POSITION 0x0000000D
+#define _PWMEVTC_EVTCSTRD_MASK 0x00002000
+#define _PWMEVTC_EVTCPOL_POSITION 0x0000000E
+#define _PWMEVTC_EVTCPOL_MASK 0x00004000
+#define _PWMEVTC_EVTCOEN_POSITION 0x0000000F
+#define _PWMEVTC_EVTCOEN_MASK 0x00008000
+#define _PWMEVTD_EVTDPGS_POSITION 0x00000000
+#define _PWMEVTD_EVTDPGS_MASK 0x00000007
+#define _PWMEVTD_EVTDSEL_POSITION 0x00000004
+#define _PWMEVTD_EVTDSEL_MASK 0x000001F0
+#define _PWMEVTD_EVTDSYNC_POSITION 0x0000000C
+#define _PWMEVTD_EVTDSYNC_MASK 0x00001000
+#define _PWMEVTD_EVTDSTRD_POSITION 0x0000000D
+#define _PWMEVTD_EVTDSTRD_MASK 0x00002000
+#define _PWMEVTD_EVTDPOL_POSITION 0x0000000E
+#define _PWMEVTD_EVTDPOL_MASK 0x00004000
+#define _PWMEVTD_EVTDOEN_POSITION 0x0000000F
+#define _PWMEVTD_EVTDOEN_MASK 0x00008000
+#define _PWMEVTE_EVTEPGS_POSITION 0x00000000
+#define _PWMEVTE_EVTEPGS_MASK 0x00000007
+#define _PWMEVTE_EVTESEL_POSITION 0x00000004
+#define _PWMEVTE_EVTESEL_MASK 0x000001F0
+#define _PWMEVTE_EVTESYNC_POSITION 0x0000000C
+#define _PWMEVTE_EVTESYNC_MASK 0x00001000
+#define _PWMEVTE_EVTESTRD_POSITION 0x0000000D
+#define _PWMEVTE_EVTESTRD_MASK 0x00002000
+#define _PWMEVTE_EVTEPOL_POSITION 0x0000000E
+#define _PWMEVTE_EVTEPOL_MASK 0x00004000
+#define _PWMEVTE_EVTEOEN_POSITION 0x0000000F
+#define _PWMEVTE_EVTEOEN_MASK 0x00008000
+#define _PWMEVTF_EVTFPGS_POSITION 0x00000000
+#define _PWMEVTF_EVTFPGS_MASK 0x00000007
+#define _PWMEVTF_EVTFSEL_POSITION 0x00000004
+#define _PWMEVTF_EVTFSEL_MASK 0x000001F0
+#define _PWMEVTF_EVTFSYNC_POSITION 0x0000000C
+#define _PWMEVTF_EVTFSYNC_MASK 0x00001000
+#define _PWMEVTF_EVTFSTRD_POSITION 0x0000000D
+#define _PWMEVTF_EVTFSTRD_MASK 0x00002000
+#define _PWMEVTF_EVTFPOL_POSITION 0x0000000E
+#define _PWMEVTF_EVTFPOL_MASK 0x00004000
+#define _PWMEVTF_EVTFOEN_POSITION 0x0000000F
+#define _PWMEVTF_EVTFOEN_MASK 0x00008000
+#define _PG1CON_MODSEL_POSITION 0x00000000
+#define _PG1CON_MODSEL_MASK 0x00000007
+#define _PG1CON_CLKSEL_POSITION 0x00000003
+#define _PG1CON_CLKSEL_MASK 0x00000018
+#define _PG1CON_HREN_POSITION 0x00000007
+#define _PG1CON_HREN_MASK 0x00000080
+#define _PG1CON_TRGCNT_POSITION 0x00000008
+#define _PG1CON_TRGCNT_MASK 0x00000700
+#define _PG1CON_ON_POSITION 0x0000000F
+#define _PG1CON_ON_MASK 0x00008000
+#define _PG1CON_SOCS_POSITION 0x00000010
+#define _PG1CON_SOCS_MASK 0x000F0000
+#define _PG1CON_TRGMOD_POSITION 0x00000016
+#define _PG1CON_TRGMOD_MASK 0x00C00000
+#define _PG1CON_UPDMOD_POSITION 0x00000018
+#define _PG1CON_UPDMOD_MASK 0x07000000
+#define _PG1CON_MSTEN_POSITION 0x0000001B
+#define _PG1CON_MSTEN_MASK 0x08000000
+#define _PG1CON_MPHSEL_POSITION 0x0000001D
+#define _PG1CON_MPHSEL_MASK 0x20000000
+#define _PG1CON_MPERSEL_POSITION 0x0000001E
+#define _PG1CON_MPERSEL_MASK 0x40000000
+#define _PG1CON_MDCSEL_POSITION 0x0000001F
+#define _PG1CON_MDCSEL_MASK 0x80000000
+#define _PG1STAT_TRIG_POSITION 0x00000000
+#define _PG1STAT_TRIG_MASK 0x00000001
+#define _PG1STAT_CAHALF_POSITION 0x00000001
+#define _PG1STAT_CAHALF_MASK 0x00000002
+#define _PG1STAT_STEER_POSITION 0x00000002
+#define _PG1STAT_STEER_MASK 0x00000004
+#define _PG1STAT_UPDREQ_POSITION 0x00000003
+#define _PG1STAT_UPDREQ_MASK 0x00000008
+#define _PG1STAT_UPDATE_POSITION 0x00000004
+#define _PG1STAT_UPDATE_MASK 0x00000010
+#define _PG1STAT_CAP_POSITION 0x00000005
+#define _PG1STAT_CAP_MASK 0x00000020
+#define _PG1STAT_TRCLR_POSITION 0x00000006
+#define _PG1STAT_TRCLR_MASK 0x00000040
+#define _PG1STAT_TRSET_POSITION 0x00000007
+#define _PG1STAT_TRSET_MASK 0x00000080
+#define _PG1STAT_FFACT_POSITION 0x00000008
+#define _PG1STAT_FFACT_MASK 0x00000100
+#define _PG1STAT_CLACT_POSITION 0x00000009
+#define _PG1STAT_CLACT_MASK 0x00000200
+#define _PG1STAT_FLTACT_POSITION 0x0000000A
+#define _PG1STAT_FLTACT_MASK 0x00000400
+#define _PG1STAT_SACT_POSITION 0x0000000B
+#define _PG1STAT_SACT_MASK 0x00000800
+#define _PG1STAT_FFEVT_POSITION 0x0000000C
+#define _PG1STAT_FFEVT_MASK 0x00001000
+#define _PG1STAT_CLEVT_POSITION 0x0000000D
+#define _PG1STAT_CLEVT_MASK 0x00002000
+#define _PG1STAT_FLTEVT_POSITION 0x0000000E
+#define _PG1STAT_FLTEVT_MASK 0x00004000
+#define _PG1STAT_SEVT_POSITION 0x0000000F
+#define _PG1STAT_SEVT_MASK 0x00008000
+#define _PG1IOCON1_POLL_POSITION 0x00000000
+#define _PG1IOCON1_POLL_MASK 0x00000001
+#define _PG1IOCON1_POLH_POSITION 0x00000001
+#define _PG1IOCON1_POLH_MASK 0x00000002
+#define _PG1IOCON1_PENL_POSITION 0x00000002
+#define _PG1IOCON1_PENL_MASK 0x00000004
+#define _PG1IOCON1_PENH_POSITION 0x00000003
+#define _PG1IOCON1_PENH_MASK 0x00000008
+#define _PG1IOCON1_PMOD_POSITION 0x00000004
+#define _PG1IOCON1_PMOD_MASK 0x00000030
+#define _PG1IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG1IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG1IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG1IOCON1_CAPSRC_MASK 0x00007000
+#define _PG1IOCON1_SWAP_POSITION 0x00000010
+#define _PG1IOCON1_SWAP_MASK 0x00010000
+#define _PG1IOCON2_DBDAT_POSITION 0x00000000
+#define _PG1IOCON2_DBDAT_MASK 0x00000003
+#define _PG1IOCON2_FFDAT_POSITION 0x00000002
+#define _PG1IOCON2_FFDAT_MASK 0x0000000C
+#define _PG1IOCON2_CLDAT_POSITION 0x00000004
+#define _PG1IOCON2_CLDAT_MASK 0x00000030
+#define _PG1IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG1IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG1IOCON2_OSYNC_POSITION 0x00000008
+#define _PG1IOCON2_OSYNC_MASK 0x00000300
+#define _PG1IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG1IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG1IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG1IOCON2_OVRENL_MASK 0x00001000
+#define _PG1IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG1IOCON2_OVRENH_MASK 0x00002000
+#define _PG1IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG1IOCON2_CLMOD_MASK 0x00008000
+#define _PG1EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG1EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG1EVT1_UPDTRG_POSITION 0x00000003
+#define _PG1EVT1_UPDTRG_MASK 0x00000018
+#define _PG1EVT1_PWMPCI_POSITION 0x00000005
+#define _PG1EVT1_PWMPCI_MASK 0x000000E0
+#define _PG1EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG1EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG1EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG1EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG1EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG1EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG1EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG1EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG1EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG1EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG1EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG1EVT1_IEVTSEL_MASK 0x03000000
+#define _PG1EVT1_SIEN_POSITION 0x0000001C
+#define _PG1EVT1_SIEN_MASK 0x10000000
+#define _PG1EVT1_FFIEN_POSITION 0x0000001D
+#define _PG1EVT1_FFIEN_MASK 0x20000000
+#define _PG1EVT1_CLIEN_POSITION 0x0000001E
+#define _PG1EVT1_CLIEN_MASK 0x40000000
+#define _PG1EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG1EVT1_FLT1IEN_MASK 0x80000000
+#define _PG1EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG1EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG1EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG1EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG1EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG1EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG1EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG1EVT2_FLT2IEN_MASK 0x80000000
+#define _PG1SPCI1_PSS_POSITION 0x00000000
+#define _PG1SPCI1_PSS_MASK 0x0000001F
+#define _PG1SPCI1_PPS_POSITION 0x00000005
+#define _PG1SPCI1_PPS_MASK 0x00000020
+#define _PG1SPCI1_SWTERM_POSITION 0x00000006
+#define _PG1SPCI1_SWTERM_MASK 0x00000040
+#define _PG1SPCI1_PSYNC_POSITION 0x00000007
+#define _PG1SPCI1_PSYNC_MASK 0x00000080
+#define _PG1SPCI1_TERM_POSITION 0x0000000C
+#define _PG1SPCI1_TERM_MASK 0x00007000
+#define _PG1SPCI1_AQPS_POSITION 0x0000000F
+#define _PG1SPCI1_AQPS_MASK 0x00008000
+#define _PG1SPCI1_AQSS_POSITION 0x00000010
+#define _PG1SPCI1_AQSS_MASK 0x00070000
+#define _PG1SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG1SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG1SPCI1_ACP_POSITION 0x00000018
+#define _PG1SPCI1_ACP_MASK 0x07000000
+#define _PG1SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG1SPCI1_SWPCI_MASK 0x08000000
+#define _PG1SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG1SPCI1_SWPCIM_MASK 0x30000000
+#define _PG1DT_DTL_POSITION 0x00000000
+#define _PG1DT_DTL_MASK 0x0000FFFF
+#define _PG1DT_DTH_POSITION 0x00000010
+#define _PG1DT_DTH_MASK 0xFFFF0000
+#define _PG2CON_MODSEL_POSITION 0x00000000
+#define _PG2CON_MODSEL_MASK 0x00000007
+#define _PG2CON_CLKSEL_POSITION 0x00000003
+#define _PG2CON_CLKSEL_MASK 0x00000018
+#define _PG2CON_HREN_POSITION 0x00000007
+#define _PG2CON_HREN_MASK 0x00000080
+#define _PG2CON_TRGCNT_POSITION 0x00000008
+#define _PG2CON_TRGCNT_MASK 0x00000700
+#define _PG2CON_ON_POSITION 0x0000000F
+#define _PG2CON_ON_MASK 0x00008000
+#define _PG2CON_SOCS_POSITION 0x00000010
+#define _PG2CON_SOCS_MASK 0x000F0000
+#define _PG2CON_TRGMOD_POSITION 0x00000016
+#define _PG2CON_TRGMOD_MASK 0x00C00000
+#define _PG2CON_UPDMOD_POSITION 0x00000018
+#define _PG2CON_UPDMOD_MASK 0x07000000
+#define _PG2CON_MSTEN_POSITION 0x0000001B
+#define _PG2CON_MSTEN_MASK 0x08000000
+#define _PG2CON_MPHSEL_POSITION 0x0000001D
+#define _PG2CON_MPHSEL_MASK 0x20000000
+#define _PG2CON_MPERSEL_POSITION 0x0000001E
+#define _PG2CON_MPERSEL_MASK 0x40000000
+#define _PG2CON_MDCSEL_POSITION 0x0000001F
+#define _PG2CON_MDCSEL_MASK 0x80000000
+#define _PG2STAT_TRIG_POSITION 0x00000000
+#define _PG2STAT_TRIG_MASK 0x00000001
+#define _PG2STAT_CAHALF_POSITION 0x00000001
+#define _PG2STAT_CAHALF_MASK 0x00000002
+#define _PG2STAT_STEER_POSITION 0x00000002
+#define _PG2STAT_STEER_MASK 0x00000004
+#define _PG2STAT_UPDREQ_POSITION 0x00000003
+#define _PG2STAT_UPDREQ_MASK 0x00000008
+#define _PG2STAT_UPDATE_POSITION 0x00000004
+#define _PG2STAT_UPDATE_MASK 0x00000010
+#define _PG2STAT_CAP_POSITION 0x00000005
+#define _PG2STAT_CAP_MASK 0x00000020
+#define _PG2STAT_TRCLR_POSITION 0x00000006
+#define _PG2STAT_TRCLR_MASK 0x00000040
+#define _PG2STAT_TRSET_POSITION 0x00000007
+#define _PG2STAT_TRSET_MASK 0x00000080
+#define _PG2STAT_FFACT_POSITION 0x00000008
+#define _PG2STAT_FFACT_MASK 0x00000100
+#define _PG2STAT_CLACT_POSITION 0x00000009
+#define _PG2STAT_CLACT_MASK 0x00000200
+#define _PG2STAT_FLTACT_POSITION 0x0000000A
+#define _PG2STAT_FLTACT_MASK 0x00000400
+#define _PG2STAT_SACT_POSITION 0x0000000B
+#define _PG2STAT_SACT_MASK 0x00000800
+#define _PG2STAT_FFEVT_POSITION 0x0000000C
+#define _PG2STAT_FFEVT_MASK 0x00001000
+#define _PG2STAT_CLEVT_POSITION 0x0000000D
+#define _PG2STAT_CLEVT_MASK 0x00002000
+#define _PG2STAT_FLTEVT_POSITION 0x0000000E
+#define _PG2STAT_FLTEVT_MASK 0x00004000
+#define _PG2STAT_SEVT_POSITION 0x0000000F
+#define _PG2STAT_SEVT_MASK 0x00008000
+#define _PG2IOCON1_POLL_POSITION 0x00000000
+#define _PG2IOCON1_POLL_MASK 0x00000001
+#define _PG2IOCON1_POLH_POSITION 0x00000001
+#define _PG2IOCON1_POLH_MASK 0x00000002
+#define _PG2IOCON1_PENL_POSITION 0x00000002
+#define _PG2IOCON1_PENL_MASK 0x00000004
+#define _PG2IOCON1_PENH_POSITION 0x00000003
+#define _PG2IOCON1_PENH_MASK 0x00000008
+#define _PG2IOCON1_PMOD_POSITION 0x00000004
+#define _PG2IOCON1_PMOD_MASK 0x00000030
+#define _PG2IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG2IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG2IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG2IOCON1_CAPSRC_MASK 0x00007000
+#define _PG2IOCON1_SWAP_POSITION 0x00000010
+#define _PG2IOCON1_SWAP_MASK 0x00010000
+#define _PG2IOCON2_DBDAT_POSITION 0x00000000
+#define _PG2IOCON2_DBDAT_MASK 0x00000003
+#define _PG2IOCON2_FFDAT_POSITION 0x00000002
+#define _PG2IOCON2_FFDAT_MASK 0x0000000C
+#define _PG2IOCON2_CLDAT_POSITION 0x00000004
+#define _PG2IOCON2_CLDAT_MASK 0x00000030
+#define _PG2IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG2IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG2IOCON2_OSYNC_POSITION 0x00000008
+#define _PG2IOCON2_OSYNC_MASK 0x00000300
+#define _PG2IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG2IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG2IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG2IOCON2_OVRENL_MASK 0x00001000
+#define _PG2IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG2IOCON2_OVRENH_MASK 0x00002000
+#define _PG2IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG2IOCON2_CLMOD_MASK 0x00008000
+#define _PG2EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG2EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG2EVT1_UPDTRG_POSITION 0x00000003
+#define _PG2EVT1_UPDTRG_MASK 0x00000018
+#define _PG2EVT1_PWMPCI_POSITION 0x00000005
+#define _PG2EVT1_PWMPCI_MASK 0x000000E0
+#define _PG2EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG2EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG2EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG2EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG2EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG2EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG2EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG2EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG2EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG2EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG2EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG2EVT1_IEVTSEL_MASK 0x03000000
+#define _PG2EVT1_SIEN_POSITION 0x0000001C
+#define _PG2EVT1_SIEN_MASK 0x10000000
+#define _PG2EVT1_FFIEN_POSITION 0x0000001D
+#define _PG2EVT1_FFIEN_MASK 0x20000000
+#define _PG2EVT1_CLIEN_POSITION 0x0000001E
+#define _PG2EVT1_CLIEN_MASK 0x40000000
+#define _PG2EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG2EVT1_FLT1IEN_MASK 0x80000000
+#define _PG2EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG2EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG2EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG2EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG2EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG2EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG2EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG2EVT2_FLT2IEN_MASK 0x80000000
+#define _PG2SPCI1_PSS_POSITION 0x00000000
+#define _PG2SPCI1_PSS_MASK 0x0000001F
+#define _PG2SPCI1_PPS_POSITION 0x00000005
+#define _PG2SPCI1_PPS_MASK 0x00000020
+#define _PG2SPCI1_SWTERM_POSITION 0x00000006
+#define _PG2SPCI1_SWTERM_MASK 0x00000040
+#define _PG2SPCI1_PSYNC_POSITION 0x00000007
+#define _PG2SPCI1_PSYNC_MASK 0x00000080
+#define _PG2SPCI1_TERM_POSITION 0x0000000C
+#define _PG2SPCI1_TERM_MASK 0x00007000
+#define _PG2SPCI1_AQPS_POSITION 0x0000000F
+#define _PG2SPCI1_AQPS_MASK 0x00008000
+#define _PG2SPCI1_AQSS_POSITION 0x00000010
+#define _PG2SPCI1_AQSS_MASK 0x00070000
+#define _PG2SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG2SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG2SPCI1_ACP_POSITION 0x00000018
+#define _PG2SPCI1_ACP_MASK 0x07000000
+#define _PG2SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG2SPCI1_SWPCI_MASK 0x08000000
+#define _PG2SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG2SPCI1_SWPCIM_MASK 0x30000000
+#define _PG2DT_DTL_POSITION 0x00000000
+#define _PG2DT_DTL_MASK 0x0000FFFF
+#define _PG2DT_DTH_POSITION 0x00000010
+#define _PG2DT_DTH_MASK 0xFFFF0000
+#define _PG3CON_MODSEL_POSITION 0x00000000
+#define _PG3CON_MODSEL_MASK 0x00000007
+#define _PG3CON_CLKSEL_POSITION 0x00000003
+#define _PG3CON_CLKSEL_MASK 0x00000018
+#define _PG3CON_HREN_POSITION 0x00000007
+#define _PG3CON_HREN_MASK 0x00000080
+#define _PG3CON_TRGCNT_POSITION 0x00000008
+#define _PG3CON_TRGCNT_MASK 0x00000700
+#define _PG3CON_ON_POSITION 0x0000000F
+#define _PG3CON_ON_MASK 0x00008000
+#define _PG3CON_SOCS_POSITION 0x00000010
+#define _PG3CON_SOCS_MASK 0x000F0000
+#define _PG3CON_TRGMOD_POSITION 0x00000016
+#define _PG3CON_TRGMOD_MASK 0x00C00000
+#define _PG3CON_UPDMOD_POSITION 0x00000018
+#define _PG3CON_UPDMOD_MASK 0x07000000
+#define _PG3CON_MSTEN_POSITION 0x0000001B
+#define _PG3CON_MSTEN_MASK 0x08000000
+#define _PG3CON_MPHSEL_POSITION 0x0000001D
+#define _PG3CON_MPHSEL_MASK 0x20000000
+#define _PG3CON_MPERSEL_POSITION 0x0000001E
+#define _PG3CON_MPERSEL_MASK 0x40000000
+#define _PG3CON_MDCSEL_POSITION 0x0000001F
+#define _PG3CON_MDCSEL_MASK 0x80000000
+#define _PG3STAT_TRIG_POSITION 0x00000000
+#define _PG3STAT_TRIG_MASK 0x00000001
+#define _PG3STAT_CAHALF_POSITION 0x00000001
+#define _PG3STAT_CAHALF_MASK 0x00000002
+#define _PG3STAT_STEER_POSITION 0x00000002
+#define _PG3STAT_STEER_MASK 0x00000004
+#define _PG3STAT_UPDREQ_POSITION 0x00000003
+#define _PG3STAT_UPDREQ_MASK 0x00000008
+#define _PG3STAT_UPDATE_POSITION 0x00000004
+#define _PG3STAT_UPDATE_MASK 0x00000010
+#define _PG3STAT_CAP_POSITION 0x00000005
+#define _PG3STAT_CAP_MASK 0x00000020
+#define _PG3STAT_TRCLR_POSITION 0x00000006
+#define _PG3STAT_TRCLR_MASK 0x00000040
+#define _PG3STAT_TRSET_POSITION 0x00000007
+#define _PG3STAT_TRSET_MASK 0x00000080
+#define _PG3STAT_FFACT_POSITION 0x00000008
+#define _PG3STAT_FFACT_MASK 0x00000100
+#define _PG3STAT_CLACT_POSITION 0x00000009
+#define _PG3STAT_CLACT_MASK 0x00000200
+#define _PG3STAT_FLTACT_POSITION 0x0000000A
+#define _PG3STAT_FLTACT_MASK 0x00000400
+#define _PG3STAT_SACT_POSITION 0x0000000B
+#define _PG3STAT_SACT_MASK 0x00000800
+#define _PG3STAT_FFEVT_POSITION 0x0000000C
+#define _PG3STAT_FFEVT_MASK 0x00001000
+#define _PG3STAT_CLEVT_POSITION 0x0000000D
+#define _PG3STAT_CLEVT_MASK 0x00002000
+#define _PG3STAT_FLTEVT_POSITION 0x0000000E
+#define _PG3STAT_FLTEVT_MASK 0x00004000
+#define _PG3STAT_SEVT_POSITION 0x0000000F
+#define _PG3STAT_SEVT_MASK 0x00008000
+#define _PG3IOCON1_POLL_POSITION 0x00000000
+#define _PG3IOCON1_POLL_MASK 0x00000001
+#define _PG3IOCON1_POLH_POSITION 0x00000001
+#define _PG3IOCON1_POLH_MASK 0x00000002
+#define _PG3IOCON1_PENL_POSITION 0x00000002
+#define _PG3IOCON1_PENL_MASK 0x00000004
+#define _PG3IOCON1_PENH_POSITION 0x00000003
+#define _PG3IOCON1_PENH_MASK 0x00000008
+#define _PG3IOCON1_PMOD_POSITION 0x00000004
+#define _PG3IOCON1_PMOD_MASK 0x00000030
+#define _PG3IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG3IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG3IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG3IOCON1_CAPSRC_MASK 0x00007000
+#define _PG3IOCON1_SWAP_POSITION 0x00000010
+#define _PG3IOCON1_SWAP_MASK 0x00010000
+#define _PG3IOCON2_DBDAT_POSITION 0x00000000
+#define _PG3IOCON2_DBDAT_MASK 0x00000003
+#define _PG3IOCON2_FFDAT_POSITION 0x00000002
+#define _PG3IOCON2_FFDAT_MASK 0x0000000C
+#define _PG3IOCON2_CLDAT_POSITION 0x00000004
+#define _PG3IOCON2_CLDAT_MASK 0x00000030
+#define _PG3IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG3IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG3IOCON2_OSYNC_POSITION 0x00000008
+#define _PG3IOCON2_OSYNC_MASK 0x00000300
+#define _PG3IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG3IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG3IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG3IOCON2_OVRENL_MASK 0x00001000
+#define _PG3IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG3IOCON2_OVRENH_MASK 0x00002000
+#define _PG3IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG3IOCON2_CLMOD_MASK 0x00008000
+#define _PG3EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG3EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG3EVT1_UPDTRG_POSITION 0x00000003
+#define _PG3EVT1_UPDTRG_MASK 0x00000018
+#define _PG3EVT1_PWMPCI_POSITION 0x00000005
+#define _PG3EVT1_PWMPCI_MASK 0x000000E0
+#define _PG3EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG3EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG3EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG3EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG3EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG3EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG3EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG3EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG3EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG3EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG3EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG3EVT1_IEVTSEL_MASK 0x03000000
+#define _PG3EVT1_SIEN_POSITION 0x0000001C
+#define _PG3EVT1_SIEN_MASK 0x10000000
+#define _PG3EVT1_FFIEN_POSITION 0x0000001D
+#define _PG3EVT1_FFIEN_MASK 0x20000000
+#define _PG3EVT1_CLIEN_POSITION 0x0000001E
+#define _PG3EVT1_CLIEN_MASK 0x40000000
+#define _PG3EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG3EVT1_FLT1IEN_MASK 0x80000000
+#define _PG3EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG3EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG3EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG3EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG3EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG3EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG3EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG3EVT2_FLT2IEN_MASK 0x80000000
+#define _PG3SPCI1_PSS_POSITION 0x00000000
+#define _PG3SPCI1_PSS_MASK 0x0000001F
+#define _PG3SPCI1_PPS_POSITION 0x00000005
+#define _PG3SPCI1_PPS_MASK 0x00000020
+#define _PG3SPCI1_SWTERM_POSITION 0x00000006
+#define _PG3SPCI1_SWTERM_MASK 0x00000040
+#define _PG3SPCI1_PSYNC_POSITION 0x00000007
+#define _PG3SPCI1_PSYNC_MASK 0x00000080
+#define _PG3SPCI1_TERM_POSITION 0x0000000C
+#define _PG3SPCI1_TERM_MASK 0x00007000
+#define _PG3SPCI1_AQPS_POSITION 0x0000000F
+#define _PG3SPCI1_AQPS_MASK 0x00008000
+#define _PG3SPCI1_AQSS_POSITION 0x00000010
+#define _PG3SPCI1_AQSS_MASK 0x00070000
+#define _PG3SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG3SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG3SPCI1_ACP_POSITION 0x00000018
+#define _PG3SPCI1_ACP_MASK 0x07000000
+#define _PG3SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG3SPCI1_SWPCI_MASK 0x08000000
+#define _PG3SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG3SPCI1_SWPCIM_MASK 0x30000000
+#define _PG3DT_DTL_POSITION 0x00000000
+#define _PG3DT_DTL_MASK 0x0000FFFF
+#define _PG3DT_DTH_POSITION 0x00000010
+#define _PG3DT_DTH_MASK 0xFFFF0000
+#define _PG4CON_MODSEL_POSITION 0x00000000
+#define _PG4CON_MODSEL_MASK 0x00000007
+#define _PG4CON_CLKSEL_POSITION 0x00000003
+#define _PG4CON_CLKSEL_MASK 0x00000018
+#define _PG4CON_HREN_POSITION 0x00000007
+#define _PG4CON_HREN_MASK 0x00000080
+#define _PG4CON_TRGCNT_POSITION 0x00000008
+#define _PG4CON_TRGCNT_MASK 0x00000700
+#define _PG4CON_ON_POSITION 0x0000000F
+#define _PG4CON_ON_MASK 0x00008000
+#define _PG4CON_SOCS_POSITION 0x00000010
+#define _PG4CON_SOCS_MASK 0x000F0000
+#define _PG4CON_TRGMOD_POSITION 0x00000016
+#define _PG4CON_TRGMOD_MASK 0x00C00000
+#define _PG4CON_UPDMOD_POSITION 0x00000018
+#define _PG4CON_UPDMOD_MASK 0x07000000
+#define _PG4CON_MSTEN_POSITION 0x0000001B
+#define _PG4CON_MSTEN_MASK 0x08000000
+#define _PG4CON_MPHSEL_POSITION 0x0000001D
+#define _PG4CON_MPHSEL_MASK 0x20000000
+#define _PG4CON_MPERSEL_POSITION 0x0000001E
+#define _PG4CON_MPERSEL_MASK 0x40000000
+#define _PG4CON_MDCSEL_POSITION 0x0000001F
+#define _PG4CON_MDCSEL_MASK 0x80000000
+#define _PG4STAT_TRIG_POSITION 0x00000000
+#define _PG4STAT_TRIG_MASK 0x00000001
+#define _PG4STAT_CAHALF_POSITION 0x00000001
+#define _PG4STAT_CAHALF_MASK 0x00000002
+#define _PG4STAT_STEER_POSITION 0x00000002
+#define _PG4STAT_STEER_MASK 0x00000004
+#define _PG4STAT_UPDREQ_POSITION 0x00000003
+#define _PG4STAT_UPDREQ_MASK 0x00000008
+#define _PG4STAT_UPDATE_POSITION 0x00000004
+#define _PG4STAT_UPDATE_MASK 0x00000010
+#define _PG4STAT_CAP_POSITION 0x00000005
+#define _PG4STAT_CAP_MASK 0x00000020
+#define _PG4STAT_TRCLR_POSITION 0x00000006
+#define _PG4STAT_TRCLR_MASK 0x00000040
+#define _PG4STAT_TRSET_POSITION 0x00000007
+#define _PG4STAT_TRSET_MASK 0x00000080
+#define _PG4STAT_FFACT_POSITION 0x00000008
+#define _PG4STAT_FFACT_MASK 0x00000100
+#define _PG4STAT_CLACT_POSITION 0x00000009
+#define _PG4STAT_CLACT_MASK 0x00000200
+#define _PG4STAT_FLTACT_POSITION 0x0000000A
+#define _PG4STAT_FLTACT_MASK 0x00000400
+#define _PG4STAT_SACT_POSITION 0x0000000B
+#define _PG4STAT_SACT_MASK 0x00000800
+#define _PG4STAT_FFEVT_POSITION 0x0000000C
+#define _PG4STAT_FFEVT_MASK 0x00001000
+#define _PG4STAT_CLEVT_POSITION 0x0000000D
+#define _PG4STAT_CLEVT_MASK 0x00002000
+#define _PG4STAT_FLTEVT_POSITION 0x0000000E
+#define _PG4STAT_FLTEVT_MASK 0x00004000
+#define _PG4STAT_SEVT_POSITION 0x0000000F
+#define _PG4STAT_SEVT_MASK 0x00008000
+#define _PG4IOCON1_POLL_POSITION 0x00000000
+#define _PG4IOCON1_POLL_MASK 0x00000001
+#define _PG4IOCON1_POLH_POSITION 0x00000001
+#define _PG4IOCON1_POLH_MASK 0x00000002
+#define _PG4IOCON1_PENL_POSITION 0x00000002
+#define _PG4IOCON1_PENL_MASK 0x00000004
+#define _PG4IOCON1_PENH_POSITION 0x00000003
+#define _PG4IOCON1_PENH_MASK 0x00000008
+#define _PG4IOCON1_PMOD_POSITION 0x00000004
+#define _PG4IOCON1_PMOD_MASK 0x00000030
+#define _PG4IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG4IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG4IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG4IOCON1_CAPSRC_MASK 0x00007000
+#define _PG4IOCON1_SWAP_POSITION 0x00000010
+#define _PG4IOCON1_SWAP_MASK 0x00010000
+#define _PG4IOCON2_DBDAT_POSITION 0x00000000
+#define _PG4IOCON2_DBDAT_MASK 0x00000003
+#define _PG4IOCON2_FFDAT_POSITION 0x00000002
+#define _PG4IOCON2_FFDAT_MASK 0x0000000C
+#define _PG4IOCON2_CLDAT_POSITION 0x00000004
+#define _PG4IOCON2_CLDAT_MASK 0x00000030
+#define _PG4IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG4IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG4IOCON2_OSYNC_POSITION 0x00000008
+#define _PG4IOCON2_OSYNC_MASK 0x00000300
+#define _PG4IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG4IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG4IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG4IOCON2_OVRENL_MASK 0x00001000
+#define _PG4IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG4IOCON2_OVRENH_MASK 0x00002000
+#define _PG4IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG4IOCON2_CLMOD_MASK 0x00008000
+#define _PG4EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG4EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG4EVT1_UPDTRG_POSITION 0x00000003
+#define _PG4EVT1_UPDTRG_MASK 0x00000018
+#define _PG4EVT1_PWMPCI_POSITION 0x00000005
+#define _PG4EVT1_PWMPCI_MASK 0x000000E0
+#define _PG4EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG4EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG4EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG4EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG4EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG4EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG4EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG4EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG4EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG4EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG4EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG4EVT1_IEVTSEL_MASK 0x03000000
+#define _PG4EVT1_SIEN_POSITION 0x0000001C
+#define _PG4EVT1_SIEN_MASK 0x10000000
+#define _PG4EVT1_FFIEN_POSITION 0x0000001D
+#define _PG4EVT1_FFIEN_MASK 0x20000000
+#define _PG4EVT1_CLIEN_POSITION 0x0000001E
+#define _PG4EVT1_CLIEN_MASK 0x40000000
+#define _PG4EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG4EVT1_FLT1IEN_MASK 0x80000000
+#define _PG4EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG4EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG4EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG4EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG4EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG4EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG4EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG4EVT2_FLT2IEN_MASK 0x80000000
+#define _PG4SPCI1_PSS_POSITION 0x00000000
+#define _PG4SPCI1_PSS_MASK 0x0000001F
+#define _PG4SPCI1_PPS_POSITION 0x00000005
+#define _PG4SPCI1_PPS_MASK 0x00000020
+#define _PG4SPCI1_SWTERM_POSITION 0x00000006
+#define _PG4SPCI1_SWTERM_MASK 0x00000040
+#define _PG4SPCI1_PSYNC_POSITION 0x00000007
+#define _PG4SPCI1_PSYNC_MASK 0x00000080
+#define _PG4SPCI1_TERM_POSITION 0x0000000C
+#define _PG4SPCI1_TERM_MASK 0x00007000
+#define _PG4SPCI1_AQPS_POSITION 0x0000000F
+#define _PG4SPCI1_AQPS_MASK 0x00008000
+#define _PG4SPCI1_AQSS_POSITION 0x00000010
+#define _PG4SPCI1_AQSS_MASK 0x00070000
+#define _PG4SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG4SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG4SPCI1_ACP_POSITION 0x00000018
+#define _PG4SPCI1_ACP_MASK 0x07000000
+#define _PG4SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG4SPCI1_SWPCI_MASK 0x08000000
+#define _PG4SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG4SPCI1_SWPCIM_MASK 0x30000000
+#define _PG4DT_DTL_POSITION 0x00000000
+#define _PG4DT_DTL_MASK 0x0000FFFF
+#define _PG4DT_DTH_POSITION 0x00000010
+#define _PG4DT_DTH_MASK 0xFFFF0000
+#define _PG5CON_MODSEL_POSITION 0x00000000
+#define _PG5CON_MODSEL_MASK 0x00000007
+#define _PG5CON_CLKSEL_POSITION 0x00000003
+#define _PG5CON_CLKSEL_MASK 0x00000018
+#define _PG5CON_HREN_POSITION 0x00000007
+#define _PG5CON_HREN_MASK 0x00000080
+#define _PG5CON_TRGCNT_POSITION 0x00000008
+#define _PG5CON_TRGCNT_MASK 0x00000700
+#define _PG5CON_ON_POSITION 0x0000000F
+#define _PG5CON_ON_MASK 0x00008000
+#define _PG5CON_SOCS_POSITION 0x00000010
+#define _PG5CON_SOCS_MASK 0x000F0000
+#define _PG5CON_TRGMOD_POSITION 0x00000016
+#define _PG5CON_TRGMOD_MASK 0x00C00000
+#define _PG5CON_UPDMOD_POSITION 0x00000018
+#define _PG5CON_UPDMOD_MASK 0x07000000
+#define _PG5CON_MSTEN_POSITION 0x0000001B
+#define _PG5CON_MSTEN_MASK 0x08000000
+#define _PG5CON_MPHSEL_POSITION 0x0000001D
+#define _PG5CON_MPHSEL_MASK 0x20000000
+#define _PG5CON_MPERSEL_POSITION 0x0000001E
+#define _PG5CON_MPERSEL_MASK 0x40000000
+#define _PG5CON_MDCSEL_POSITION 0x0000001F
+#define _PG5CON_MDCSEL_MASK 0x80000000
+#define _PG5STAT_TRIG_POSITION 0x00000000
+#define _PG5STAT_TRIG_MASK 0x00000001
+#define _PG5STAT_CAHALF_POSITION 0x00000001
+#define _PG5STAT_CAHALF_MASK 0x00000002
+#define _PG5STAT_STEER_POSITION 0x00000002
+#define _PG5STAT_STEER_MASK 0x00000004
+#define _PG5STAT_UPDREQ_POSITION 0x00000003
+#define _PG5STAT_UPDREQ_MASK 0x00000008
+#define _PG5STAT_UPDATE_POSITION 0x00000004
+#define _PG5STAT_UPDATE_MASK 0x00000010
+#define _PG5STAT_CAP_POSITION 0x00000005
+#define _PG5STAT_CAP_MASK 0x00000020
+#define _PG5STAT_TRCLR_POSITION 0x00000006
+#define _PG5STAT_TRCLR_MASK 0x00000040
+#define _PG5STAT_TRSET_POSITION 0x00000007
+#define _PG5STAT_TRSET_MASK 0x00000080
+#define _PG5STAT_FFACT_POSITION 0x00000008
+#define _PG5STAT_FFACT_MASK 0x00000100
+#define _PG5STAT_CLACT_POSITION 0x00000009
+#define _PG5STAT_CLACT_MASK 0x00000200
+#define _PG5STAT_FLTACT_POSITION 0x0000000A
+#define _PG5STAT_FLTACT_MASK 0x00000400
+#define _PG5STAT_SACT_POSITION 0x0000000B
+#define _PG5STAT_SACT_MASK 0x00000800
+#define _PG5STAT_FFEVT_POSITION 0x0000000C
+#define _PG5STAT_FFEVT_MASK 0x00001000
+#define _PG5STAT_CLEVT_POSITION 0x0000000D
+#define _PG5STAT_CLEVT_MASK 0x00002000
+#define _PG5STAT_FLTEVT_POSITION 0x0000000E
+#define _PG5STAT_FLTEVT_MASK 0x00004000
+#define _PG5STAT_SEVT_POSITION 0x0000000F
+#define _PG5STAT_SEVT_MASK 0x00008000
+#define _PG5IOCON1_POLL_POSITION 0x00000000
+#define _PG5IOCON1_POLL_MASK 0x00000001
+#define _PG5IOCON1_POLH_POSITION 0x00000001
+#define _PG5IOCON1_POLH_MASK 0x00000002
+#define _PG5IOCON1_PENL_POSITION 0x00000002
+#define _PG5IOCON1_PENL_MASK 0x00000004
+#define _PG5IOCON1_PENH_POSITION 0x00000003
+#define _PG5IOCON1_PENH_MASK 0x00000008
+#define _PG5IOCON1_PMOD_POSITION 0x00000004
+#define _PG5IOCON1_PMOD_MASK 0x00000030
+#define _PG5IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG5IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG5IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG5IOCON1_CAPSRC_MASK 0x00007000
+#define _PG5IOCON1_SWAP_POSITION 0x00000010
+#define _PG5IOCON1_SWAP_MASK 0x00010000
+#define _PG5IOCON2_DBDAT_POSITION 0x00000000
+#define _PG5IOCON2_DBDAT_MASK 0x00000003
+#define _PG5IOCON2_FFDAT_POSITION 0x00000002
+#define _PG5IOCON2_FFDAT_MASK 0x0000000C
+#define _PG5IOCON2_CLDAT_POSITION 0x00000004
+#define _PG5IOCON2_CLDAT_MASK 0x00000030
+#define _PG5IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG5IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG5IOCON2_OSYNC_POSITION 0x00000008
+#define _PG5IOCON2_OSYNC_MASK 0x00000300
+#define _PG5IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG5IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG5IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG5IOCON2_OVRENL_MASK 0x00001000
+#define _PG5IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG5IOCON2_OVRENH_MASK 0x00002000
+#define _PG5IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG5IOCON2_CLMOD_MASK 0x00008000
+#define _PG5EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG5EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG5EVT1_UPDTRG_POSITION 0x00000003
+#define _PG5EVT1_UPDTRG_MASK 0x00000018
+#define _PG5EVT1_PWMPCI_POSITION 0x00000005
+#define _PG5EVT1_PWMPCI_MASK 0x000000E0
+#define _PG5EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG5EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG5EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG5EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG5EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG5EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG5EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG5EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG5EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG5EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG5EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG5EVT1_IEVTSEL_MASK 0x03000000
+#define _PG5EVT1_SIEN_POSITION 0x0000001C
+#define _PG5EVT1_SIEN_MASK 0x10000000
+#define _PG5EVT1_FFIEN_POSITION 0x0000001D
+#define _PG5EVT1_FFIEN_MASK 0x20000000
+#define _PG5EVT1_CLIEN_POSITION 0x0000001E
+#define _PG5EVT1_CLIEN_MASK 0x40000000
+#define _PG5EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG5EVT1_FLT1IEN_MASK 0x80000000
+#define _PG5EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG5EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG5EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG5EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG5EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG5EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG5EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG5EVT2_FLT2IEN_MASK 0x80000000
+#define _PG5SPCI1_PSS_POSITION 0x00000000
+#define _PG5SPCI1_PSS_MASK 0x0000001F
+#define _PG5SPCI1_PPS_POSITION 0x00000005
+#define _PG5SPCI1_PPS_MASK 0x00000020
+#define _PG5SPCI1_SWTERM_POSITION 0x00000006
+#define _PG5SPCI1_SWTERM_MASK 0x00000040
+#define _PG5SPCI1_PSYNC_POSITION 0x00000007
+#define _PG5SPCI1_PSYNC_MASK 0x00000080
+#define _PG5SPCI1_TERM_POSITION 0x0000000C
+#define _PG5SPCI1_TERM_MASK 0x00007000
+#define _PG5SPCI1_AQPS_POSITION 0x0000000F
+#define _PG5SPCI1_AQPS_MASK 0x00008000
+#define _PG5SPCI1_AQSS_POSITION 0x00000010
+#define _PG5SPCI1_AQSS_MASK 0x00070000
+#define _PG5SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG5SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG5SPCI1_ACP_POSITION 0x00000018
+#define _PG5SPCI1_ACP_MASK 0x07000000
+#define _PG5SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG5SPCI1_SWPCI_MASK 0x08000000
+#define _PG5SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG5SPCI1_SWPCIM_MASK 0x30000000
+#define _PG5DT_DTL_POSITION 0x00000000
+#define _PG5DT_DTL_MASK 0x0000FFFF
+#define _PG5DT_DTH_POSITION 0x00000010
+#define _PG5DT_DTH_MASK 0xFFFF0000
+#define _PG6CON_MODSEL_POSITION 0x00000000
+#define _PG6CON_MODSEL_MASK 0x00000007
+#define _PG6CON_CLKSEL_POSITION 0x00000003
+#define _PG6CON_CLKSEL_MASK 0x00000018
+#define _PG6CON_HREN_POSITION 0x00000007
+#define _PG6CON_HREN_MASK 0x00000080
+#define _PG6CON_TRGCNT_POSITION 0x00000008
+#define _PG6CON_TRGCNT_MASK 0x00000700
+#define _PG6CON_ON_POSITION 0x0000000F
+#define _PG6CON_ON_MASK 0x00008000
+#define _PG6CON_SOCS_POSITION 0x00000010
+#define _PG6CON_SOCS_MASK 0x000F0000
+#define _PG6CON_TRGMOD_POSITION 0x00000016
+#define _PG6CON_TRGMOD_MASK 0x00C00000
+#define _PG6CON_UPDMOD_POSITION 0x00000018
+#define _PG6CON_UPDMOD_MASK 0x07000000
+#define _PG6CON_MSTEN_POSITION 0x0000001B
+#define _PG6CON_MSTEN_MASK 0x08000000
+#define _PG6CON_MPHSEL_POSITION 0x0000001D
+#define _PG6CON_MPHSEL_MASK 0x20000000
+#define _PG6CON_MPERSEL_POSITION 0x0000001E
+#define _PG6CON_MPERSEL_MASK 0x40000000
+#define _PG6CON_MDCSEL_POSITION 0x0000001F
+#define _PG6CON_MDCSEL_MASK 0x80000000
+#define _PG6STAT_TRIG_POSITION 0x00000000
+#define _PG6STAT_TRIG_MASK 0x00000001
+#define _PG6STAT_CAHALF_POSITION 0x00000001
+#define _PG6STAT_CAHALF_MASK 0x00000002
+#define _PG6STAT_STEER_POSITION 0x00000002
+#define _PG6STAT_STEER_MASK 0x00000004
+#define _PG6STAT_UPDREQ_POSITION 0x00000003
+#define _PG6STAT_UPDREQ_MASK 0x00000008
+#define _PG6STAT_UPDATE_POSITION 0x00000004
+#define _PG6STAT_UPDATE_MASK 0x00000010
+#define _PG6STAT_CAP_POSITION 0x00000005
+#define _PG6STAT_CAP_MASK 0x00000020
+#define _PG6STAT_TRCLR_POSITION 0x00000006
+#define _PG6STAT_TRCLR_MASK 0x00000040
+#define _PG6STAT_TRSET_POSITION 0x00000007
+#define _PG6STAT_TRSET_MASK 0x00000080
+#define _PG6STAT_FFACT_POSITION 0x00000008
+#define _PG6STAT_FFACT_MASK 0x00000100
+#define _PG6STAT_CLACT_POSITION 0x00000009
+#define _PG6STAT_CLACT_MASK 0x00000200
+#define _PG6STAT_FLTACT_POSITION 0x0000000A
+#define _PG6STAT_FLTACT_MASK 0x00000400
+#define _PG6STAT_SACT_POSITION 0x0000000B
+#define _PG6STAT_SACT_MASK 0x00000800
+#define _PG6STAT_FFEVT_POSITION 0x0000000C
+#define _PG6STAT_FFEVT_MASK 0x00001000
+#define _PG6STAT_CLEVT_POSITION 0x0000000D
+#define _PG6STAT_CLEVT_MASK 0x00002000
+#define _PG6STAT_FLTEVT_POSITION 0x0000000E
+#define _PG6STAT_FLTEVT_MASK 0x00004000
+#define _PG6STAT_SEVT_POSITION 0x0000000F
+#define _PG6STAT_SEVT_MASK 0x00008000
+#define _PG6IOCON1_POLL_POSITION 0x00000000
+#define _PG6IOCON1_POLL_MASK 0x00000001
+#define _PG6IOCON1_POLH_POSITION 0x00000001
+#define _PG6IOCON1_POLH_MASK 0x00000002
+#define _PG6IOCON1_PENL_POSITION 0x00000002
+#define _PG6IOCON1_PENL_MASK 0x00000004
+#define _PG6IOCON1_PENH_POSITION 0x00000003
+#define _PG6IOCON1_PENH_MASK 0x00000008
+#define _PG6IOCON1_PMOD_POSITION 0x00000004
+#define _PG6IOCON1_PMOD_MASK 0x00000030
+#define _PG6IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG6IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG6IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG6IOCON1_CAPSRC_MASK 0x00007000
+#define _PG6IOCON1_SWAP_POSITION 0x00000010
+#define _PG6IOCON1_SWAP_MASK 0x00010000
+#define _PG6IOCON2_DBDAT_POSITION 0x00000000
+#define _PG6IOCON2_DBDAT_MASK 0x00000003
+#define _PG6IOCON2_FFDAT_POSITION 0x00000002
+#define _PG6IOCON2_FFDAT_MASK 0x0000000C
+#define _PG6IOCON2_CLDAT_POSITION 0x00000004
+#define _PG6IOCON2_CLDAT_MASK 0x00000030
+#define _PG6IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG6IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG6IOCON2_OSYNC_POSITION 0x00000008
+#define _PG6IOCON2_OSYNC_MASK 0x00000300
+#define _PG6IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG6IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG6IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG6IOCON2_OVRENL_MASK 0x00001000
+#define _PG6IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG6IOCON2_OVRENH_MASK 0x00002000
+#define _PG6IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG6IOCON2_CLMOD_MASK 0x00008000
+#define _PG6EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG6EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG6EVT1_UPDTRG_POSITION 0x00000003
+#define _PG6EVT1_UPDTRG_MASK 0x00000018
+#define _PG6EVT1_PWMPCI_POSITION 0x00000005
+#define _PG6EVT1_PWMPCI_MASK 0x000000E0
+#define _PG6EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG6EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG6EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG6EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG6EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG6EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG6EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG6EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG6EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG6EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG6EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG6EVT1_IEVTSEL_MASK 0x03000000
+#define _PG6EVT1_SIEN_POSITION 0x0000001C
+#define _PG6EVT1_SIEN_MASK 0x10000000
+#define _PG6EVT1_FFIEN_POSITION 0x0000001D
+#define _PG6EVT1_FFIEN_MASK 0x20000000
+#define _PG6EVT1_CLIEN_POSITION 0x0000001E
+#define _PG6EVT1_CLIEN_MASK 0x40000000
+#define _PG6EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG6EVT1_FLT1IEN_MASK 0x80000000
+#define _PG6EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG6EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG6EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG6EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG6EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG6EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG6EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG6EVT2_FLT2IEN_MASK 0x80000000
+#define _PG6SPCI1_PSS_POSITION 0x00000000
+#define _PG6SPCI1_PSS_MASK 0x0000001F
+#define _PG6SPCI1_PPS_POSITION 0x00000005
+#define _PG6SPCI1_PPS_MASK 0x00000020
+#define _PG6SPCI1_SWTERM_POSITION 0x00000006
+#define _PG6SPCI1_SWTERM_MASK 0x00000040
+#define _PG6SPCI1_PSYNC_POSITION 0x00000007
+#define _PG6SPCI1_PSYNC_MASK 0x00000080
+#define _PG6SPCI1_TERM_POSITION 0x0000000C
+#define _PG6SPCI1_TERM_MASK 0x00007000
+#define _PG6SPCI1_AQPS_POSITION 0x0000000F
+#define _PG6SPCI1_AQPS_MASK 0x00008000
+#define _PG6SPCI1_AQSS_POSITION 0x00000010
+#define _PG6SPCI1_AQSS_MASK 0x00070000
+#define _PG6SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG6SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG6SPCI1_ACP_POSITION 0x00000018
+#define _PG6SPCI1_ACP_MASK 0x07000000
+#define _PG6SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG6SPCI1_SWPCI_MASK 0x08000000
+#define _PG6SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG6SPCI1_SWPCIM_MASK 0x30000000
+#define _PG6DT_DTL_POSITION 0x00000000
+#define _PG6DT_DTL_MASK 0x0000FFFF
+#define _PG6DT_DTH_POSITION 0x00000010
+#define _PG6DT_DTH_MASK 0xFFFF0000
+#define _PG7CON_MODSEL_POSITION 0x00000000
+#define _PG7CON_MODSEL_MASK 0x00000007
+#define _PG7CON_CLKSEL_POSITION 0x00000003
+#define _PG7CON_CLKSEL_MASK 0x00000018
+#define _PG7CON_HREN_POSITION 0x00000007
+#define _PG7CON_HREN_MASK 0x00000080
+#define _PG7CON_TRGCNT_POSITION 0x00000008
+#define _PG7CON_TRGCNT_MASK 0x00000700
+#define _PG7CON_ON_POSITION 0x0000000F
+#define _PG7CON_ON_MASK 0x00008000
+#define _PG7CON_SOCS_POSITION 0x00000010
+#define _PG7CON_SOCS_MASK 0x000F0000
+#define _PG7CON_TRGMOD_POSITION 0x00000016
+#define _PG7CON_TRGMOD_MASK 0x00C00000
+#define _PG7CON_UPDMOD_POSITION 0x00000018
+#define _PG7CON_UPDMOD_MASK 0x07000000
+#define _PG7CON_MSTEN_POSITION 0x0000001B
+#define _PG7CON_MSTEN_MASK 0x08000000
+#define _PG7CON_MPHSEL_POSITION 0x0000001D
+#define _PG7CON_MPHSEL_MASK 0x20000000
+#define _PG7CON_MPERSEL_POSITION 0x0000001E
+#define _PG7CON_MPERSEL_MASK 0x40000000
+#define _PG7CON_MDCSEL_POSITION 0x0000001F
+#define _PG7CON_MDCSEL_MASK 0x80000000
+#define _PG7STAT_TRIG_POSITION 0x00000000
+#define _PG7STAT_TRIG_MASK 0x00000001
+#define _PG7STAT_CAHALF_POSITION 0x00000001
+#define _PG7STAT_CAHALF_MASK 0x00000002
+#define _PG7STAT_STEER_POSITION 0x00000002
+#define _PG7STAT_STEER_MASK 0x00000004
+#define _PG7STAT_UPDREQ_POSITION 0x00000003
+#define _PG7STAT_UPDREQ_MASK 0x00000008
+#define _PG7STAT_UPDATE_POSITION 0x00000004
+#define _PG7STAT_UPDATE_MASK 0x00000010
+#define _PG7STAT_CAP_POSITION 0x00000005
+#define _PG7STAT_CAP_MASK 0x00000020
+#define _PG7STAT_TRCLR_POSITION 0x00000006
+#define _PG7STAT_TRCLR_MASK 0x00000040
+#define _PG7STAT_TRSET_POSITION 0x00000007
+#define _PG7STAT_TRSET_MASK 0x00000080
+#define _PG7STAT_FFACT_POSITION 0x00000008
+#define _PG7STAT_FFACT_MASK 0x00000100
+#define _PG7STAT_CLACT_POSITION 0x00000009
+#define _PG7STAT_CLACT_MASK 0x00000200
+#define _PG7STAT_FLTACT_POSITION 0x0000000A
+#define _PG7STAT_FLTACT_MASK 0x00000400
+#define _PG7STAT_SACT_POSITION 0x0000000B
+#define _PG7STAT_SACT_MASK 0x00000800
+#define _PG7STAT_FFEVT_POSITION 0x0000000C
+#define _PG7STAT_FFEVT_MASK 0x00001000
+#define _PG7STAT_CLEVT_POSITION 0x0000000D
+#define _PG7STAT_CLEVT_MASK 0x00002000
+#define _PG7STAT_FLTEVT_POSITION 0x0000000E
+#define _PG7STAT_FLTEVT_MASK 0x00004000
+#define _PG7STAT_SEVT_POSITION 0x0000000F
+#define _PG7STAT_SEVT_MASK 0x00008000
+#define _PG7IOCON1_POLL_POSITION 0x00000000
+#define _PG7IOCON1_POLL_MASK 0x00000001
+#define _PG7IOCON1_POLH_POSITION 0x00000001
+#define _PG7IOCON1_POLH_MASK 0x00000002
+#define _PG7IOCON1_PENL_POSITION 0x00000002
+#define _PG7IOCON1_PENL_MASK 0x00000004
+#define _PG7IOCON1_PENH_POSITION 0x00000003
+#define _PG7IOCON1_PENH_MASK 0x00000008
+#define _PG7IOCON1_PMOD_POSITION 0x00000004
+#define _PG7IOCON1_PMOD_MASK 0x00000030
+#define _PG7IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG7IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG7IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG7IOCON1_CAPSRC_MASK 0x00007000
+#define _PG7IOCON1_SWAP_POSITION 0x00000010
+#define _PG7IOCON1_SWAP_MASK 0x00010000
+#define _PG7IOCON2_DBDAT_POSITION 0x00000000
+#define _PG7IOCON2_DBDAT_MASK 0x00000003
+#define _PG7IOCON2_FFDAT_POSITION 0x00000002
+#define _PG7IOCON2_FFDAT_MASK 0x0000000C
+#define _PG7IOCON2_CLDAT_POSITION 0x00000004
+#define _PG7IOCON2_CLDAT_MASK 0x00000030
+#define _PG7IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG7IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG7IOCON2_OSYNC_POSITION 0x00000008
+#define _PG7IOCON2_OSYNC_MASK 0x00000300
+#define _PG7IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG7IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG7IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG7IOCON2_OVRENL_MASK 0x00001000
+#define _PG7IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG7IOCON2_OVRENH_MASK 0x00002000
+#define _PG7IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG7IOCON2_CLMOD_MASK 0x00008000
+#define _PG7EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG7EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG7EVT1_UPDTRG_POSITION 0x00000003
+#define _PG7EVT1_UPDTRG_MASK 0x00000018
+#define _PG7EVT1_PWMPCI_POSITION 0x00000005
+#define _PG7EVT1_PWMPCI_MASK 0x000000E0
+#define _PG7EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG7EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG7EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG7EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG7EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG7EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG7EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG7EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG7EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG7EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG7EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG7EVT1_IEVTSEL_MASK 0x03000000
+#define _PG7EVT1_SIEN_POSITION 0x0000001C
+#define _PG7EVT1_SIEN_MASK 0x10000000
+#define _PG7EVT1_FFIEN_POSITION 0x0000001D
+#define _PG7EVT1_FFIEN_MASK 0x20000000
+#define _PG7EVT1_CLIEN_POSITION 0x0000001E
+#define _PG7EVT1_CLIEN_MASK 0x40000000
+#define _PG7EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG7EVT1_FLT1IEN_MASK 0x80000000
+#define _PG7EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG7EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG7EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG7EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG7EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG7EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG7EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG7EVT2_FLT2IEN_MASK 0x80000000
+#define _PG7SPCI1_PSS_POSITION 0x00000000
+#define _PG7SPCI1_PSS_MASK 0x0000001F
+#define _PG7SPCI1_PPS_POSITION 0x00000005
+#define _PG7SPCI1_PPS_MASK 0x00000020
+#define _PG7SPCI1_SWTERM_POSITION 0x00000006
+#define _PG7SPCI1_SWTERM_MASK 0x00000040
+#define _PG7SPCI1_PSYNC_POSITION 0x00000007
+#define _PG7SPCI1_PSYNC_MASK 0x00000080
+#define _PG7SPCI1_TERM_POSITION 0x0000000C
+#define _PG7SPCI1_TERM_MASK 0x00007000
+#define _PG7SPCI1_AQPS_POSITION 0x0000000F
+#define _PG7SPCI1_AQPS_MASK 0x00008000
+#define _PG7SPCI1_AQSS_POSITION 0x00000010
+#define _PG7SPCI1_AQSS_MASK 0x00070000
+#define _PG7SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG7SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG7SPCI1_ACP_POSITION 0x00000018
+#define _PG7SPCI1_ACP_MASK 0x07000000
+#define _PG7SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG7SPCI1_SWPCI_MASK 0x08000000
+#define _PG7SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG7SPCI1_SWPCIM_MASK 0x30000000
+#define _PG7DT_DTL_POSITION 0x00000000
+#define _PG7DT_DTL_MASK 0x0000FFFF
+#define _PG7DT_DTH_POSITION 0x00000010
+#define _PG7DT_DTH_MASK 0xFFFF0000
+#define _PG8CON_MODSEL_POSITION 0x00000000
+#define _PG8CON_MODSEL_MASK 0x00000007
+#define _PG8CON_CLKSEL_POSITION 0x00000003
+#define _PG8CON_CLKSEL_MASK 0x00000018
+#define _PG8CON_HREN_POSITION 0x00000007
+#define _PG8CON_HREN_MASK 0x00000080
+#define _PG8CON_TRGCNT_POSITION 0x00000008
+#define _PG8CON_TRGCNT_MASK 0x00000700
+#define _PG8CON_ON_POSITION 0x0000000F
+#define _PG8CON_ON_MASK 0x00008000
+#define _PG8CON_SOCS_POSITION 0x00000010
+#define _PG8CON_SOCS_MASK 0x000F0000
+#define _PG8CON_TRGMOD_POSITION 0x00000016
+#define _PG8CON_TRGMOD_MASK 0x00C00000
+#define _PG8CON_UPDMOD_POSITION 0x00000018
+#define _PG8CON_UPDMOD_MASK 0x07000000
+#define _PG8CON_MSTEN_POSITION 0x0000001B
+#define _PG8CON_MSTEN_MASK 0x08000000
+#define _PG8CON_MPHSEL_POSITION 0x0000001D
+#define _PG8CON_MPHSEL_MASK 0x20000000
+#define _PG8CON_MPERSEL_POSITION 0x0000001E
+#define _PG8CON_MPERSEL_MASK 0x40000000
+#define _PG8CON_MDCSEL_POSITION 0x0000001F
+#define _PG8CON_MDCSEL_MASK 0x80000000
+#define _PG8STAT_TRIG_POSITION 0x00000000
+#define _PG8STAT_TRIG_MASK 0x00000001
+#define _PG8STAT_CAHALF_POSITION 0x00000001
+#define _PG8STAT_CAHALF_MASK 0x00000002
+#define _PG8STAT_STEER_POSITION 0x00000002
+#define _PG8STAT_STEER_MASK 0x00000004
+#define _PG8STAT_UPDREQ_POSITION 0x00000003
+#define _PG8STAT_UPDREQ_MASK 0x00000008
+#define _PG8STAT_UPDATE_POSITION 0x00000004
+#define _PG8STAT_UPDATE_MASK 0x00000010
+#define _PG8STAT_CAP_POSITION 0x00000005
+#define _PG8STAT_CAP_MASK 0x00000020
+#define _PG8STAT_TRCLR_POSITION 0x00000006
+#define _PG8STAT_TRCLR_MASK 0x00000040
+#define _PG8STAT_TRSET_POSITION 0x00000007
+#define _PG8STAT_TRSET_MASK 0x00000080
+#define _PG8STAT_FFACT_POSITION 0x00000008
+#define _PG8STAT_FFACT_MASK 0x00000100
+#define _PG8STAT_CLACT_POSITION 0x00000009
+#define _PG8STAT_CLACT_MASK 0x00000200
+#define _PG8STAT_FLTACT_POSITION 0x0000000A
+#define _PG8STAT_FLTACT_MASK 0x00000400
+#define _PG8STAT_SACT_POSITION 0x0000000B
+#define _PG8STAT_SACT_MASK 0x00000800
+#define _PG8STAT_FFEVT_POSITION 0x0000000C
+#define _PG8STAT_FFEVT_MASK 0x00001000
+#define _PG8STAT_CLEVT_POSITION 0x0000000D
+#define _PG8STAT_CLEVT_MASK 0x00002000
+#define _PG8STAT_FLTEVT_POSITION 0x0000000E
+#define _PG8STAT_FLTEVT_MASK 0x00004000
+#define _PG8STAT_SEVT_POSITION 0x0000000F
+#define _PG8STAT_SEVT_MASK 0x00008000
+#define _PG8IOCON1_POLL_POSITION 0x00000000
+#define _PG8IOCON1_POLL_MASK 0x00000001
+#define _PG8IOCON1_POLH_POSITION 0x00000001
+#define _PG8IOCON1_POLH_MASK 0x00000002
+#define _PG8IOCON1_PENL_POSITION 0x00000002
+#define _PG8IOCON1_PENL_MASK 0x00000004
+#define _PG8IOCON1_PENH_POSITION 0x00000003
+#define _PG8IOCON1_PENH_MASK 0x00000008
+#define _PG8IOCON1_PMOD_POSITION 0x00000004
+#define _PG8IOCON1_PMOD_MASK 0x00000030
+#define _PG8IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _PG8IOCON1_DTCMPSEL_MASK 0x00000100
+#define _PG8IOCON1_CAPSRC_POSITION 0x0000000C
+#define _PG8IOCON1_CAPSRC_MASK 0x00007000
+#define _PG8IOCON1_SWAP_POSITION 0x00000010
+#define _PG8IOCON1_SWAP_MASK 0x00010000
+#define _PG8IOCON2_DBDAT_POSITION 0x00000000
+#define _PG8IOCON2_DBDAT_MASK 0x00000003
+#define _PG8IOCON2_FFDAT_POSITION 0x00000002
+#define _PG8IOCON2_FFDAT_MASK 0x0000000C
+#define _PG8IOCON2_CLDAT_POSITION 0x00000004
+#define _PG8IOCON2_CLDAT_MASK 0x00000030
+#define _PG8IOCON2_FLT1DAT_POSITION 0x00000006
+#define _PG8IOCON2_FLT1DAT_MASK 0x000000C0
+#define _PG8IOCON2_OSYNC_POSITION 0x00000008
+#define _PG8IOCON2_OSYNC_MASK 0x00000300
+#define _PG8IOCON2_OVRDAT_POSITION 0x0000000A
+#define _PG8IOCON2_OVRDAT_MASK 0x00000C00
+#define _PG8IOCON2_OVRENL_POSITION 0x0000000C
+#define _PG8IOCON2_OVRENL_MASK 0x00001000
+#define _PG8IOCON2_OVRENH_POSITION 0x0000000D
+#define _PG8IOCON2_OVRENH_MASK 0x00002000
+#define _PG8IOCON2_CLMOD_POSITION 0x0000000F
+#define _PG8IOCON2_CLMOD_MASK 0x00008000
+#define _PG8EVT1_PGTRGSEL_POSITION 0x00000000
+#define _PG8EVT1_PGTRGSEL_MASK 0x00000007
+#define _PG8EVT1_UPDTRG_POSITION 0x00000003
+#define _PG8EVT1_UPDTRG_MASK 0x00000018
+#define _PG8EVT1_PWMPCI_POSITION 0x00000005
+#define _PG8EVT1_PWMPCI_MASK 0x000000E0
+#define _PG8EVT1_ADTR1EN1_POSITION 0x00000008
+#define _PG8EVT1_ADTR1EN1_MASK 0x00000100
+#define _PG8EVT1_ADTR1EN2_POSITION 0x00000009
+#define _PG8EVT1_ADTR1EN2_MASK 0x00000200
+#define _PG8EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _PG8EVT1_ADTR1EN3_MASK 0x00000400
+#define _PG8EVT1_ADTR1PS_POSITION 0x0000000B
+#define _PG8EVT1_ADTR1PS_MASK 0x0000F800
+#define _PG8EVT1_ADTR1OFS_POSITION 0x00000010
+#define _PG8EVT1_ADTR1OFS_MASK 0x001F0000
+#define _PG8EVT1_IEVTSEL_POSITION 0x00000018
+#define _PG8EVT1_IEVTSEL_MASK 0x03000000
+#define _PG8EVT1_SIEN_POSITION 0x0000001C
+#define _PG8EVT1_SIEN_MASK 0x10000000
+#define _PG8EVT1_FFIEN_POSITION 0x0000001D
+#define _PG8EVT1_FFIEN_MASK 0x20000000
+#define _PG8EVT1_CLIEN_POSITION 0x0000001E
+#define _PG8EVT1_CLIEN_MASK 0x40000000
+#define _PG8EVT1_FLT1IEN_POSITION 0x0000001F
+#define _PG8EVT1_FLT1IEN_MASK 0x80000000
+#define _PG8EVT2_ADTR2EN1_POSITION 0x00000005
+#define _PG8EVT2_ADTR2EN1_MASK 0x00000020
+#define _PG8EVT2_ADTR2EN2_POSITION 0x00000006
+#define _PG8EVT2_ADTR2EN2_MASK 0x00000040
+#define _PG8EVT2_ADTR2EN3_POSITION 0x00000007
+#define _PG8EVT2_ADTR2EN3_MASK 0x00000080
+#define _PG8EVT2_FLT2IEN_POSITION 0x0000001F
+#define _PG8EVT2_FLT2IEN_MASK 0x80000000
+#define _PG8SPCI1_PSS_POSITION 0x00000000
+#define _PG8SPCI1_PSS_MASK 0x0000001F
+#define _PG8SPCI1_PPS_POSITION 0x00000005
+#define _PG8SPCI1_PPS_MASK 0x00000020
+#define _PG8SPCI1_SWTERM_POSITION 0x00000006
+#define _PG8SPCI1_SWTERM_MASK 0x00000040
+#define _PG8SPCI1_PSYNC_POSITION 0x00000007
+#define _PG8SPCI1_PSYNC_MASK 0x00000080
+#define _PG8SPCI1_TERM_POSITION 0x0000000C
+#define _PG8SPCI1_TERM_MASK 0x00007000
+#define _PG8SPCI1_AQPS_POSITION 0x0000000F
+#define _PG8SPCI1_AQPS_MASK 0x00008000
+#define _PG8SPCI1_AQSS_POSITION 0x00000010
+#define _PG8SPCI1_AQSS_MASK 0x00070000
+#define _PG8SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _PG8SPCI1_TSYNCDIS_MASK 0x00800000
+#define _PG8SPCI1_ACP_POSITION 0x00000018
+#define _PG8SPCI1_ACP_MASK 0x07000000
+#define _PG8SPCI1_SWPCI_POSITION 0x0000001B
+#define _PG8SPCI1_SWPCI_MASK 0x08000000
+#define _PG8SPCI1_SWPCIM_POSITION 0x0000001C
+#define _PG8SPCI1_SWPCIM_MASK 0x30000000
+#define _PG8DT_DTL_POSITION 0x00000000
+#define _PG8DT_DTL_MASK 0x0000FFFF
+#define _PG8DT_DTH_POSITION 0x00000010
+#define _PG8DT_DTH_MASK 0xFFFF0000
+#define _APG1CON_MODSEL_POSITION 0x00000000
+#define _APG1CON_MODSEL_MASK 0x00000007
+#define _APG1CON_CLKSEL_POSITION 0x00000003
+#define _APG1CON_CLKSEL_MASK 0x00000018
+#define _APG1CON_HREN_POSITION 0x00000007
+#define _APG1CON_HREN_MASK 0x00000080
+#define _APG1CON_TRGCNT_POSITION 0x00000008
+#define _APG1CON_TRGCNT_MASK 0x00000700
+#define _APG1CON_ON_POSITION 0x0000000F
+#define _APG1CON_ON_MASK 0x00008000
+#define _APG1CON_SOCS_POSITION 0x00000010
+#define _APG1CON_SOCS_MASK 0x000F0000
+#define _APG1CON_TRGMOD_POSITION 0x00000016
+#define _APG1CON_TRGMOD_MASK 0x00C00000
+#define _APG1CON_UPDMOD_POSITION 0x00000018
+#define _APG1CON_UPDMOD_MASK 0x07000000
+#define _APG1CON_MSTEN_POSITION 0x0000001B
+#define _APG1CON_MSTEN_MASK 0x08000000
+#define _APG1CON_MPHSEL_POSITION 0x0000001D
+#define _APG1CON_MPHSEL_MASK 0x20000000
+#define _APG1CON_MPERSEL_POSITION 0x0000001E
+#define _APG1CON_MPERSEL_MASK 0x40000000
+#define _APG1CON_MDCSEL_POSITION 0x0000001F
+#define _APG1CON_MDCSEL_MASK 0x80000000
+#define _APG1STAT_TRIG_POSITION 0x00000000
+#define _APG1STAT_TRIG_MASK 0x00000001
+#define _APG1STAT_CAHALF_POSITION 0x00000001
+#define _APG1STAT_CAHALF_MASK 0x00000002
+#define _APG1STAT_STEER_POSITION 0x00000002
+#define _APG1STAT_STEER_MASK 0x00000004
+#define _APG1STAT_UPDREQ_POSITION 0x00000003
+#define _APG1STAT_UPDREQ_MASK 0x00000008
+#define _APG1STAT_UPDATE_POSITION 0x00000004
+#define _APG1STAT_UPDATE_MASK 0x00000010
+#define _APG1STAT_CAP_POSITION 0x00000005
+#define _APG1STAT_CAP_MASK 0x00000020
+#define _APG1STAT_TRCLR_POSITION 0x00000006
+#define _APG1STAT_TRCLR_MASK 0x00000040
+#define _APG1STAT_TRSET_POSITION 0x00000007
+#define _APG1STAT_TRSET_MASK 0x00000080
+#define _APG1STAT_FFACT_POSITION 0x00000008
+#define _APG1STAT_FFACT_MASK 0x00000100
+#define _APG1STAT_CLACT_POSITION 0x00000009
+#define _APG1STAT_CLACT_MASK 0x00000200
+#define _APG1STAT_FLTACT_POSITION 0x0000000A
+#define _APG1STAT_FLTACT_MASK 0x00000400
+#define _APG1STAT_SACT_POSITION 0x0000000B
+#define _APG1STAT_SACT_MASK 0x00000800
+#define _APG1STAT_FFEVT_POSITION 0x0000000C
+#define _APG1STAT_FFEVT_MASK 0x00001000
+#define _APG1STAT_CLEVT_POSITION 0x0000000D
+#define _APG1STAT_CLEVT_MASK 0x00002000
+#define _APG1STAT_FLTEVT_POSITION 0x0000000E
+#define _APG1STAT_FLTEVT_MASK 0x00004000
+#define _APG1STAT_SEVT_POSITION 0x0000000F
+#define _APG1STAT_SEVT_MASK 0x00008000
+#define _APG1IOCON1_POLL_POSITION 0x00000000
+#define _APG1IOCON1_POLL_MASK 0x00000001
+#define _APG1IOCON1_POLH_POSITION 0x00000001
+#define _APG1IOCON1_POLH_MASK 0x00000002
+#define _APG1IOCON1_PENL_POSITION 0x00000002
+#define _APG1IOCON1_PENL_MASK 0x00000004
+#define _APG1IOCON1_PENH_POSITION 0x00000003
+#define _APG1IOCON1_PENH_MASK 0x00000008
+#define _APG1IOCON1_PMOD_POSITION 0x00000004
+#define _APG1IOCON1_PMOD_MASK 0x00000030
+#define _APG1IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _APG1IOCON1_DTCMPSEL_MASK 0x00000100
+#define _APG1IOCON1_CAPSRC_POSITION 0x0000000C
+#define _APG1IOCON1_CAPSRC_MASK 0x00007000
+#define _APG1IOCON1_SWAP_POSITION 0x00000010
+#define _APG1IOCON1_SWAP_MASK 0x00010000
+#define _APG1IOCON2_DBDAT_POSITION 0x00000000
+#define _APG1IOCON2_DBDAT_MASK 0x00000003
+#define _APG1IOCON2_FFDAT_POSITION 0x00000002
+#define _APG1IOCON2_FFDAT_MASK 0x0000000C
+#define _APG1IOCON2_CLDAT_POSITION 0x00000004
+#define _APG1IOCON2_CLDAT_MASK 0x00000030
+#define _APG1IOCON2_FLT1DAT_POSITION 0x00000006
+#define _APG1IOCON2_FLT1DAT_MASK 0x000000C0
+#define _APG1IOCON2_OSYNC_POSITION 0x00000008
+#define _APG1IOCON2_OSYNC_MASK 0x00000300
+#define _APG1IOCON2_OVRDAT_POSITION 0x0000000A
+#define _APG1IOCON2_OVRDAT_MASK 0x00000C00
+#define _APG1IOCON2_OVRENL_POSITION 0x0000000C
+#define _APG1IOCON2_OVRENL_MASK 0x00001000
+#define _APG1IOCON2_OVRENH_POSITION 0x0000000D
+#define _APG1IOCON2_OVRENH_MASK 0x00002000
+#define _APG1IOCON2_CLMOD_POSITION 0x0000000F
+#define _APG1IOCON2_CLMOD_MASK 0x00008000
+#define _APG1EVT1_PGTRGSEL_POSITION 0x00000000
+#define _APG1EVT1_PGTRGSEL_MASK 0x00000007
+#define _APG1EVT1_UPDTRG_POSITION 0x00000003
+#define _APG1EVT1_UPDTRG_MASK 0x00000018
+#define _APG1EVT1_PWMPCI_POSITION 0x00000005
+#define _APG1EVT1_PWMPCI_MASK 0x000000E0
+#define _APG1EVT1_ADTR1EN1_POSITION 0x00000008
+#define _APG1EVT1_ADTR1EN1_MASK 0x00000100
+#define _APG1EVT1_ADTR1EN2_POSITION 0x00000009
+#define _APG1EVT1_ADTR1EN2_MASK 0x00000200
+#define _APG1EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _APG1EVT1_ADTR1EN3_MASK 0x00000400
+#define _APG1EVT1_ADTR1PS_POSITION 0x0000000B
+#define _APG1EVT1_ADTR1PS_MASK 0x0000F800
+#define _APG1EVT1_ADTR1OFS_POSITION 0x00000010
+#define _APG1EVT1_ADTR1OFS_MASK 0x001F0000
+#define _APG1EVT1_IEVTSEL_POSITION 0x00000018
+#define _APG1EVT1_IEVTSEL_MASK 0x03000000
+#define _APG1EVT1_SIEN_POSITION 0x0000001C
+#define _APG1EVT1_SIEN_MASK 0x10000000
+#define _APG1EVT1_FFIEN_POSITION 0x0000001D
+#define _APG1EVT1_FFIEN_MASK 0x20000000
+#define _APG1EVT1_CLIEN_POSITION 0x0000001E
+#define _APG1EVT1_CLIEN_MASK 0x40000000
+#define _APG1EVT1_FLT1IEN_POSITION 0x0000001F
+#define _APG1EVT1_FLT1IEN_MASK 0x80000000
+#define _APG1EVT2_ADTR2EN1_POSITION 0x00000005
+#define _APG1EVT2_ADTR2EN1_MASK 0x00000020
+#define _APG1EVT2_ADTR2EN2_POSITION 0x00000006
+#define _APG1EVT2_ADTR2EN2_MASK 0x00000040
+#define _APG1EVT2_ADTR2EN3_POSITION 0x00000007
+#define _APG1EVT2_ADTR2EN3_MASK 0x00000080
+#define _APG1EVT2_FLT2IEN_POSITION 0x0000001F
+#define _APG1EVT2_FLT2IEN_MASK 0x80000000
+#define _APG1SPCI1_PSS_POSITION 0x00000000
+#define _APG1SPCI1_PSS_MASK 0x0000001F
+#define _APG1SPCI1_PPS_POSITION 0x00000005
+#define _APG1SPCI1_PPS_MASK 0x00000020
+#define _APG1SPCI1_SWTERM_POSITION 0x00000006
+#define _APG1SPCI1_SWTERM_MASK 0x00000040
+#define _APG1SPCI1_PSYNC_POSITION 0x00000007
+#define _APG1SPCI1_PSYNC_MASK 0x00000080
+#define _APG1SPCI1_TERM_POSITION 0x0000000C
+#define _APG1SPCI1_TERM_MASK 0x00007000
+#define _APG1SPCI1_AQPS_POSITION 0x0000000F
+#define _APG1SPCI1_AQPS_MASK 0x00008000
+#define _APG1SPCI1_AQSS_POSITION 0x00000010
+#define _APG1SPCI1_AQSS_MASK 0x00070000
+#define _APG1SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _APG1SPCI1_TSYNCDIS_MASK 0x00800000
+#define _APG1SPCI1_ACP_POSITION 0x00000018
+#define _APG1SPCI1_ACP_MASK 0x07000000
+#define _APG1SPCI1_SWPCI_POSITION 0x0000001B
+#define _APG1SPCI1_SWPCI_MASK 0x08000000
+#define _APG1SPCI1_SWPCIM_POSITION 0x0000001C
+#define _APG1SPCI1_SWPCIM_MASK 0x30000000
+#define _APG1DT_DTL_POSITION 0x00000000
+#define _APG1DT_DTL_MASK 0x0000FFFF
+#define _APG1DT_DTH_POSITION 0x00000010
+#define _APG1DT_DTH_MASK 0xFFFF0000
+#define _APG2CON_MODSEL_POSITION 0x00000000
+#define _APG2CON_MODSEL_MASK 0x00000007
+#define _APG2CON_CLKSEL_POSITION 0x00000003
+#define _APG2CON_CLKSEL_MASK 0x00000018
+#define _APG2CON_HREN_POSITION 0x00000007
+#define _APG2CON_HREN_MASK 0x00000080
+#define _APG2CON_TRGCNT_POSITION 0x00000008
+#define _APG2CON_TRGCNT_MASK 0x00000700
+#define _APG2CON_ON_POSITION 0x0000000F
+#define _APG2CON_ON_MASK 0x00008000
+#define _APG2CON_SOCS_POSITION 0x00000010
+#define _APG2CON_SOCS_MASK 0x000F0000
+#define _APG2CON_TRGMOD_POSITION 0x00000016
+#define _APG2CON_TRGMOD_MASK 0x00C00000
+#define _APG2CON_UPDMOD_POSITION 0x00000018
+#define _APG2CON_UPDMOD_MASK 0x07000000
+#define _APG2CON_MSTEN_POSITION 0x0000001B
+#define _APG2CON_MSTEN_MASK 0x08000000
+#define _APG2CON_MPHSEL_POSITION 0x0000001D
+#define _APG2CON_MPHSEL_MASK 0x20000000
+#define _APG2CON_MPERSEL_POSITION 0x0000001E
+#define _APG2CON_MPERSEL_MASK 0x40000000
+#define _APG2CON_MDCSEL_POSITION 0x0000001F
+#define _APG2CON_MDCSEL_MASK 0x80000000
+#define _APG2STAT_TRIG_POSITION 0x00000000
+#define _APG2STAT_TRIG_MASK 0x00000001
+#define _APG2STAT_CAHALF_POSITION 0x00000001
+#define _APG2STAT_CAHALF_MASK 0x00000002
+#define _APG2STAT_STEER_POSITION 0x00000002
+#define _APG2STAT_STEER_MASK 0x00000004
+#define _APG2STAT_UPDREQ_POSITION 0x00000003
+#define _APG2STAT_UPDREQ_MASK 0x00000008
+#define _APG2STAT_UPDATE_POSITION 0x00000004
+#define _APG2STAT_UPDATE_MASK 0x00000010
+#define _APG2STAT_CAP_POSITION 0x00000005
+#define _APG2STAT_CAP_MASK 0x00000020
+#define _APG2STAT_TRCLR_POSITION 0x00000006
+#define _APG2STAT_TRCLR_MASK 0x00000040
+#define _APG2STAT_TRSET_POSITION 0x00000007
+#define _APG2STAT_TRSET_MASK 0x00000080
+#define _APG2STAT_FFACT_POSITION 0x00000008
+#define _APG2STAT_FFACT_MASK 0x00000100
+#define _APG2STAT_CLACT_POSITION 0x00000009
+#define _APG2STAT_CLACT_MASK 0x00000200
+#define _APG2STAT_FLTACT_POSITION 0x0000000A
+#define _APG2STAT_FLTACT_MASK 0x00000400
+#define _APG2STAT_SACT_POSITION 0x0000000B
+#define _APG2STAT_SACT_MASK 0x00000800
+#define _APG2STAT_FFEVT_POSITION 0x0000000C
+#define _APG2STAT_FFEVT_MASK 0x00001000
+#define _APG2STAT_CLEVT_POSITION 0x0000000D
+#define _APG2STAT_CLEVT_MASK 0x00002000
+#define _APG2STAT_FLTEVT_POSITION 0x0000000E
+#define _APG2STAT_FLTEVT_MASK 0x00004000
+#define _APG2STAT_SEVT_POSITION 0x0000000F
+#define _APG2STAT_SEVT_MASK 0x00008000
+#define _APG2IOCON1_POLL_POSITION 0x00000000
+#define _APG2IOCON1_POLL_MASK 0x00000001
+#define _APG2IOCON1_POLH_POSITION 0x00000001
+#define _APG2IOCON1_POLH_MASK 0x00000002
+#define _APG2IOCON1_PENL_POSITION 0x00000002
+#define _APG2IOCON1_PENL_MASK 0x00000004
+#define _APG2IOCON1_PENH_POSITION 0x00000003
+#define _APG2IOCON1_PENH_MASK 0x00000008
+#define _APG2IOCON1_PMOD_POSITION 0x00000004
+#define _APG2IOCON1_PMOD_MASK 0x00000030
+#define _APG2IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _APG2IOCON1_DTCMPSEL_MASK 0x00000100
+#define _APG2IOCON1_CAPSRC_POSITION 0x0000000C
+#define _APG2IOCON1_CAPSRC_MASK 0x00007000
+#define _APG2IOCON1_SWAP_POSITION 0x00000010
+#define _APG2IOCON1_SWAP_MASK 0x00010000
+#define _APG2IOCON2_DBDAT_POSITION 0x00000000
+#define _APG2IOCON2_DBDAT_MASK 0x00000003
+#define _APG2IOCON2_FFDAT_POSITION 0x00000002
+#define _APG2IOCON2_FFDAT_MASK 0x0000000C
+#define _APG2IOCON2_CLDAT_POSITION 0x00000004
+#define _APG2IOCON2_CLDAT_MASK 0x00000030
+#define _APG2IOCON2_FLT1DAT_POSITION 0x00000006
+#define _APG2IOCON2_FLT1DAT_MASK 0x000000C0
+#define _APG2IOCON2_OSYNC_POSITION 0x00000008
+#define _APG2IOCON2_OSYNC_MASK 0x00000300
+#define _APG2IOCON2_OVRDAT_POSITION 0x0000000A
+#define _APG2IOCON2_OVRDAT_MASK 0x00000C00
+#define _APG2IOCON2_OVRENL_POSITION 0x0000000C
+#define _APG2IOCON2_OVRENL_MASK 0x00001000
+#define _APG2IOCON2_OVRENH_POSITION 0x0000000D
+#define _APG2IOCON2_OVRENH_MASK 0x00002000
+#define _APG2IOCON2_CLMOD_POSITION 0x0000000F
+#define _APG2IOCON2_CLMOD_MASK 0x00008000
+#define _APG2EVT1_PGTRGSEL_POSITION 0x00000000
+#define _APG2EVT1_PGTRGSEL_MASK 0x00000007
+#define _APG2EVT1_UPDTRG_POSITION 0x00000003
+#define _APG2EVT1_UPDTRG_MASK 0x00000018
+#define _APG2EVT1_PWMPCI_POSITION 0x00000005
+#define _APG2EVT1_PWMPCI_MASK 0x000000E0
+#define _APG2EVT1_ADTR1EN1_POSITION 0x00000008
+#define _APG2EVT1_ADTR1EN1_MASK 0x00000100
+#define _APG2EVT1_ADTR1EN2_POSITION 0x00000009
+#define _APG2EVT1_ADTR1EN2_MASK 0x00000200
+#define _APG2EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _APG2EVT1_ADTR1EN3_MASK 0x00000400
+#define _APG2EVT1_ADTR1PS_POSITION 0x0000000B
+#define _APG2EVT1_ADTR1PS_MASK 0x0000F800
+#define _APG2EVT1_ADTR1OFS_POSITION 0x00000010
+#define _APG2EVT1_ADTR1OFS_MASK 0x001F0000
+#define _APG2EVT1_IEVTSEL_POSITION 0x00000018
+#define _APG2EVT1_IEVTSEL_MASK 0x03000000
+#define _APG2EVT1_SIEN_POSITION 0x0000001C
+#define _APG2EVT1_SIEN_MASK 0x10000000
+#define _APG2EVT1_FFIEN_POSITION 0x0000001D
+#define _APG2EVT1_FFIEN_MASK 0x20000000
+#define _APG2EVT1_CLIEN_POSITION 0x0000001E
+#define _APG2EVT1_CLIEN_MASK 0x40000000
+#define _APG2EVT1_FLT1IEN_POSITION 0x0000001F
+#define _APG2EVT1_FLT1IEN_MASK 0x80000000
+#define _APG2EVT2_ADTR2EN1_POSITION 0x00000005
+#define _APG2EVT2_ADTR2EN1_MASK 0x00000020
+#define _APG2EVT2_ADTR2EN2_POSITION 0x00000006
+#define _APG2EVT2_ADTR2EN2_MASK 0x00000040
+#define _APG2EVT2_ADTR2EN3_POSITION 0x00000007
+#define _APG2EVT2_ADTR2EN3_MASK 0x00000080
+#define _APG2EVT2_FLT2IEN_POSITION 0x0000001F
+#define _APG2EVT2_FLT2IEN_MASK 0x80000000
+#define _APG2SPCI1_PSS_POSITION 0x00000000
+#define _APG2SPCI1_PSS_MASK 0x0000001F
+#define _APG2SPCI1_PPS_POSITION 0x00000005
+#define _APG2SPCI1_PPS_MASK 0x00000020
+#define _APG2SPCI1_SWTERM_POSITION 0x00000006
+#define _APG2SPCI1_SWTERM_MASK 0x00000040
+#define _APG2SPCI1_PSYNC_POSITION 0x00000007
+#define _APG2SPCI1_PSYNC_MASK 0x00000080
+#define _APG2SPCI1_TERM_POSITION 0x0000000C
+#define _APG2SPCI1_TERM_MASK 0x00007000
+#define _APG2SPCI1_AQPS_POSITION 0x0000000F
+#define _APG2SPCI1_AQPS_MASK 0x00008000
+#define _APG2SPCI1_AQSS_POSITION 0x00000010
+#define _APG2SPCI1_AQSS_MASK 0x00070000
+#define _APG2SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _APG2SPCI1_TSYNCDIS_MASK 0x00800000
+#define _APG2SPCI1_ACP_POSITION 0x00000018
+#define _APG2SPCI1_ACP_MASK 0x07000000
+#define _APG2SPCI1_SWPCI_POSITION 0x0000001B
+#define _APG2SPCI1_SWPCI_MASK 0x08000000
+#define _APG2SPCI1_SWPCIM_POSITION 0x0000001C
+#define _APG2SPCI1_SWPCIM_MASK 0x30000000
+#define _APG2DT_DTL_POSITION 0x00000000
+#define _APG2DT_DTL_MASK 0x0000FFFF
+#define _APG2DT_DTH_POSITION 0x00000010
+#define _APG2DT_DTH_MASK 0xFFFF0000
+#define _APG3CON_MODSEL_POSITION 0x00000000
+#define _APG3CON_MODSEL_MASK 0x00000007
+#define _APG3CON_CLKSEL_POSITION 0x00000003
+#define _APG3CON_CLKSEL_MASK 0x00000018
+#define _APG3CON_HREN_POSITION 0x00000007
+#define _APG3CON_HREN_MASK 0x00000080
+#define _APG3CON_TRGCNT_POSITION 0x00000008
+#define _APG3CON_TRGCNT_MASK 0x00000700
+#define _APG3CON_ON_POSITION 0x0000000F
+#define _APG3CON_ON_MASK 0x00008000
+#define _APG3CON_SOCS_POSITION 0x00000010
+#define _APG3CON_SOCS_MASK 0x000F0000
+#define _APG3CON_TRGMOD_POSITION 0x00000016
+#define _APG3CON_TRGMOD_MASK 0x00C00000
+#define _APG3CON_UPDMOD_POSITION 0x00000018
+#define _APG3CON_UPDMOD_MASK 0x07000000
+#define _APG3CON_MSTEN_POSITION 0x0000001B
+#define _APG3CON_MSTEN_MASK 0x08000000
+#define _APG3CON_MPHSEL_POSITION 0x0000001D
+#define _APG3CON_MPHSEL_MASK 0x20000000
+#define _APG3CON_MPERSEL_POSITION 0x0000001E
+#define _APG3CON_MPERSEL_MASK 0x40000000
+#define _APG3CON_MDCSEL_POSITION 0x0000001F
+#define _APG3CON_MDCSEL_MASK 0x80000000
+#define _APG3STAT_TRIG_POSITION 0x00000000
+#define _APG3STAT_TRIG_MASK 0x00000001
+#define _APG3STAT_CAHALF_POSITION 0x00000001
+#define _APG3STAT_CAHALF_MASK 0x00000002
+#define _APG3STAT_STEER_POSITION 0x00000002
+#define _APG3STAT_STEER_MASK 0x00000004
+#define _APG3STAT_UPDREQ_POSITION 0x00000003
+#define _APG3STAT_UPDREQ_MASK 0x00000008
+#define _APG3STAT_UPDATE_POSITION 0x00000004
+#define _APG3STAT_UPDATE_MASK 0x00000010
+#define _APG3STAT_CAP_POSITION 0x00000005
+#define _APG3STAT_CAP_MASK 0x00000020
+#define _APG3STAT_TRCLR_POSITION 0x00000006
+#define _APG3STAT_TRCLR_MASK 0x00000040
+#define _APG3STAT_TRSET_POSITION 0x00000007
+#define _APG3STAT_TRSET_MASK 0x00000080
+#define _APG3STAT_FFACT_POSITION 0x00000008
+#define _APG3STAT_FFACT_MASK 0x00000100
+#define _APG3STAT_CLACT_POSITION 0x00000009
+#define _APG3STAT_CLACT_MASK 0x00000200
+#define _APG3STAT_FLTACT_POSITION 0x0000000A
+#define _APG3STAT_FLTACT_MASK 0x00000400
+#define _APG3STAT_SACT_POSITION 0x0000000B
+#define _APG3STAT_SACT_MASK 0x00000800
+#define _APG3STAT_FFEVT_POSITION 0x0000000C
+#define _APG3STAT_FFEVT_MASK 0x00001000
+#define _APG3STAT_CLEVT_POSITION 0x0000000D
+#define _APG3STAT_CLEVT_MASK 0x00002000
+#define _APG3STAT_FLTEVT_POSITION 0x0000000E
+#define _APG3STAT_FLTEVT_MASK 0x00004000
+#define _APG3STAT_SEVT_POSITION 0x0000000F
+#define _APG3STAT_SEVT_MASK 0x00008000
+#define _APG3IOCON1_POLL_POSITION 0x00000000
+#define _APG3IOCON1_POLL_MASK 0x00000001
+#define _APG3IOCON1_POLH_POSITION 0x00000001
+#define _APG3IOCON1_POLH_MASK 0x00000002
+#define _APG3IOCON1_PENL_POSITION 0x00000002
+#define _APG3IOCON1_PENL_MASK 0x00000004
+#define _APG3IOCON1_PENH_POSITION 0x00000003
+#define _APG3IOCON1_PENH_MASK 0x00000008
+#define _APG3IOCON1_PMOD_POSITION 0x00000004
+#define _APG3IOCON1_PMOD_MASK 0x00000030
+#define _APG3IOCON1_DTCMPSEL_POSITION 0x00000008
+#define _APG3IOCON1_DTCMPSEL_MASK 0x00000100
+#define _APG3IOCON1_CAPSRC_POSITION 0x0000000C
+#define _APG3IOCON1_CAPSRC_MASK 0x00007000
+#define _APG3IOCON1_SWAP_POSITION 0x00000010
+#define _APG3IOCON1_SWAP_MASK 0x00010000
+#define _APG3IOCON2_DBDAT_POSITION 0x00000000
+#define _APG3IOCON2_DBDAT_MASK 0x00000003
+#define _APG3IOCON2_FFDAT_POSITION 0x00000002
+#define _APG3IOCON2_FFDAT_MASK 0x0000000C
+#define _APG3IOCON2_CLDAT_POSITION 0x00000004
+#define _APG3IOCON2_CLDAT_MASK 0x00000030
+#define _APG3IOCON2_FLT1DAT_POSITION 0x00000006
+#define _APG3IOCON2_FLT1DAT_MASK 0x000000C0
+#define _APG3IOCON2_OSYNC_POSITION 0x00000008
+#define _APG3IOCON2_OSYNC_MASK 0x00000300
+#define _APG3IOCON2_OVRDAT_POSITION 0x0000000A
+#define _APG3IOCON2_OVRDAT_MASK 0x00000C00
+#define _APG3IOCON2_OVRENL_POSITION 0x0000000C
+#define _APG3IOCON2_OVRENL_MASK 0x00001000
+#define _APG3IOCON2_OVRENH_POSITION 0x0000000D
+#define _APG3IOCON2_OVRENH_MASK 0x00002000
+#define _APG3IOCON2_CLMOD_POSITION 0x0000000F
+#define _APG3IOCON2_CLMOD_MASK 0x00008000
+#define _APG3EVT1_PGTRGSEL_POSITION 0x00000000
+#define _APG3EVT1_PGTRGSEL_MASK 0x00000007
+#define _APG3EVT1_UPDTRG_POSITION 0x00000003
+#define _APG3EVT1_UPDTRG_MASK 0x00000018
+#define _APG3EVT1_PWMPCI_POSITION 0x00000005
+#define _APG3EVT1_PWMPCI_MASK 0x000000E0
+#define _APG3EVT1_ADTR1EN1_POSITION 0x00000008
+#define _APG3EVT1_ADTR1EN1_MASK 0x00000100
+#define _APG3EVT1_ADTR1EN2_POSITION 0x00000009
+#define _APG3EVT1_ADTR1EN2_MASK 0x00000200
+#define _APG3EVT1_ADTR1EN3_POSITION 0x0000000A
+#define _APG3EVT1_ADTR1EN3_MASK 0x00000400
+#define _APG3EVT1_ADTR1PS_POSITION 0x0000000B
+#define _APG3EVT1_ADTR1PS_MASK 0x0000F800
+#define _APG3EVT1_ADTR1OFS_POSITION 0x00000010
+#define _APG3EVT1_ADTR1OFS_MASK 0x001F0000
+#define _APG3EVT1_IEVTSEL_POSITION 0x00000018
+#define _APG3EVT1_IEVTSEL_MASK 0x03000000
+#define _APG3EVT1_SIEN_POSITION 0x0000001C
+#define _APG3EVT1_SIEN_MASK 0x10000000
+#define _APG3EVT1_FFIEN_POSITION 0x0000001D
+#define _APG3EVT1_FFIEN_MASK 0x20000000
+#define _APG3EVT1_CLIEN_POSITION 0x0000001E
+#define _APG3EVT1_CLIEN_MASK 0x40000000
+#define _APG3EVT1_FLT1IEN_POSITION 0x0000001F
+#define _APG3EVT1_FLT1IEN_MASK 0x80000000
+#define _APG3EVT2_ADTR2EN1_POSITION 0x00000005
+#define _APG3EVT2_ADTR2EN1_MASK 0x00000020
+#define _APG3EVT2_ADTR2EN2_POSITION 0x00000006
+#define _APG3EVT2_ADTR2EN2_MASK 0x00000040
+#define _APG3EVT2_ADTR2EN3_POSITION 0x00000007
+#define _APG3EVT2_ADTR2EN3_MASK 0x00000080
+#define _APG3EVT2_FLT2IEN_POSITION 0x0000001F
+#define _APG3EVT2_FLT2IEN_MASK 0x80000000
+#define _APG3SPCI1_PSS_POSITION 0x00000000
+#define _APG3SPCI1_PSS_MASK 0x0000001F
+#define _APG3SPCI1_PPS_POSITION 0x00000005
+#define _APG3SPCI1_PPS_MASK 0x00000020
+#define _APG3SPCI1_SWTERM_POSITION 0x00000006
+#define _APG3SPCI1_SWTERM_MASK 0x00000040
+#define _APG3SPCI1_PSYNC_POSITION 0x00000007
+#define _APG3SPCI1_PSYNC_MASK 0x00000080
+#define _APG3SPCI1_TERM_POSITION 0x0000000C
+#define _APG3SPCI1_TERM_MASK 0x00007000
+#define _APG3SPCI1_AQPS_POSITION 0x0000000F
+#define _APG3SPCI1_AQPS_MASK 0x00008000
+#define _APG3SPCI1_AQSS_POSITION 0x00000010
+#define _APG3SPCI1_AQSS_MASK 0x00070000
+#define _APG3SPCI1_TSYNCDIS_POSITION 0x00000017
+#define _APG3SPCI1_TSYNCDIS_MASK 0x00800000
+#define _APG3SPCI1_ACP_POSITION 0x00000018
+#define _APG3SPCI1_ACP_MASK 0x07000000
+#define _APG3SPCI1_SWPCI_POSITION 0x0000001B
+#define _APG3SPCI1_SWPCI_MASK 0x08000000
+#define _APG3SPCI1_SWPCIM_POSITION 0x0000001C
+#define _APG3SPCI1_SWPCIM_MASK 0x30000000
+#define _APG3DT_DTL_POSITION 0x00000000
+#define _APG3DT_DTL_MASK 0x0000FFFF
+#define _APG3DT_DTH_POSITION 0x00000010
+#define _APG3DT_DTH_MASK 0xFFFF0000
+#define _OSCCTRL_FRCEN_POSITION 0x00000000
+#define _OSCCTRL_FRCEN_MASK 0x00000001
+#define _OSCCTRL_BFRCEN_POSITION 0x00000001
+#define _OSCCTRL_BFRCEN_MASK 0x00000002
+#define _OSCCTRL_POSCEN_POSITION 0x00000002
+#define _OSCCTRL_POSCEN_MASK 0x00000004
+#define _OSCCTRL_LPRCEN_POSITION 0x00000003
+#define _OSCCTRL_LPRCEN_MASK 0x00000008
+#define _OSCCTRL_PLL1EN_POSITION 0x00000006
+#define _OSCCTRL_PLL1EN_MASK 0x00000040
+#define _OSCCTRL_PLL2EN_POSITION 0x00000007
+#define _OSCCTRL_PLL2EN_MASK 0x00000080
+#define _OSCCFG_POSCMD_POSITION 0x00000000
+#define _OSCCFG_POSCMD_MASK 0x00000003
+#define _OSCCFG_POSCIOFNC_POSITION 0x00000005
+#define _OSCCFG_POSCIOFNC_MASK 0x00000020
+#define _PLL1CON_NOSC_POSITION 0x00000000
+#define _PLL1CON_NOSC_MASK 0x0000000F
+#define _PLL1CON_COSC_POSITION 0x00000004
+#define _PLL1CON_COSC_MASK 0x000000F0
+#define _PLL1CON_OSWEN_POSITION 0x00000008
+#define _PLL1CON_OSWEN_MASK 0x00000100
+#define _PLL1CON_DIVSWEN_POSITION 0x00000009
+#define _PLL1CON_DIVSWEN_MASK 0x00000200
+#define _PLL1CON_FOUTSWEN_POSITION 0x0000000A
+#define _PLL1CON_FOUTSWEN_MASK 0x00000400
+#define _PLL1CON_PLLSWEN_POSITION 0x0000000B
+#define _PLL1CON_PLLSWEN_MASK 0x00000800
+#define _PLL1CON_OE_POSITION 0x0000000C
+#define _PLL1CON_OE_MASK 0x00001000
+#define _PLL1CON_SIDL_POSITION 0x0000000D
+#define _PLL1CON_SIDL_MASK 0x00002000
+#define _PLL1CON_ON_POSITION 0x0000000F
+#define _PLL1CON_ON_MASK 0x00008000
+#define _PLL1CON_BOSC_POSITION 0x00000010
+#define _PLL1CON_BOSC_MASK 0x000F0000
+#define _PLL1CON_FSCMEN_POSITION 0x00000014
+#define _PLL1CON_FSCMEN_MASK 0x00100000
+#define _PLL1CON_CLKRDY_POSITION 0x0000001F
+#define _PLL1CON_CLKRDY_MASK 0x80000000
+#define _PLL1DIV_POSTDIV2_POSITION 0x00000000
+#define _PLL1DIV_POSTDIV2_MASK 0x00000007
+#define _PLL1DIV_POSTDIV1_POSITION 0x00000004
+#define _PLL1DIV_POSTDIV1_MASK 0x00000070
+#define _PLL1DIV_PLLFBDIV_POSITION 0x00000008
+#define _PLL1DIV_PLLFBDIV_MASK 0x000FFF00
+#define _PLL1DIV_PLLPRE_POSITION 0x00000018
+#define _PLL1DIV_PLLPRE_MASK 0x0F000000
+#define _PLL2CON_NOSC_POSITION 0x00000000
+#define _PLL2CON_NOSC_MASK 0x0000000F
+#define _PLL2CON_COSC_POSITION 0x00000004
+#define _PLL2CON_COSC_MASK 0x000000F0
+#define _PLL2CON_OSWEN_POSITION 0x00000008
+#define _PLL2CON_OSWEN_MASK 0x00000100
+#define _PLL2CON_DIVSWEN_POSITION 0x00000009
+#define _PLL2CON_DIVSWEN_MASK 0x00000200
+#define _PLL2CON_FOUTSWEN_POSITION 0x0000000A
+#define _PLL2CON_FOUTSWEN_MASK 0x00000400
+#define _PLL2CON_PLLSWEN_POSITION 0x0000000B
+#define _PLL2CON_PLLSWEN_MASK 0x00000800
+#define _PLL2CON_OE_POSITION 0x0000000C
+#define _PLL2CON_OE_MASK 0x00001000
+#define _PLL2CON_SIDL_POSITION 0x0000000D
+#define _PLL2CON_SIDL_MASK 0x00002000
+#define _PLL2CON_ON_POSITION 0x0000000F
+#define _PLL2CON_ON_MASK 0x00008000
+#define _PLL2CON_BOSC_POSITION 0x00000010
+#define _PLL2CON_BOSC_MASK 0x000F0000
+#define _PLL2CON_FSCMEN_POSITION 0x00000014
+#define _PLL2CON_FSCMEN_MASK 0x00100000
+#define _PLL2CON_CLKRDY_POSITION 0x0000001F
+#define _PLL2CON_CLKRDY_MASK 0x80000000
+#define _PLL2DIV_POSTDIV2_POSITION 0x00000000
+#define _PLL2DIV_POSTDIV2_MASK 0x00000007
+#define _PLL2DIV_POSTDIV1_POSITION 0x00000004
+#define _PLL2DIV_POSTDIV1_MASK 0x00000070
+#define _PLL2DIV_PLLFBDIV_POSITION 0x00000008
+#define _PLL2DIV_PLLFBDIV_MASK 0x000FFF00
+#define _PLL2DIV_PLLPRE_POSITION 0x00000018
+#define _PLL2DIV_PLLPRE_MASK 0x0F000000
+#define _CLK1CON_NOSC_POSITION 0x00000000
+#define _CLK1CON_NOSC_MASK 0x0000000F
+#define _CLK1CON_COSC_POSITION 0x00000004
+#define _CLK1CON_COSC_MASK 0x000000F0
+#define _CLK1CON_OSWEN_POSITION 0x00000008
+#define _CLK1CON_OSWEN_MASK 0x00000100
+#define _CLK1CON_DIVSWEN_POSITION 0x00000009
+#define _CLK1CON_DIVSWEN_MASK 0x00000200
+#define _CLK1CON_OE_POSITION 0x0000000C
+#define _CLK1CON_OE_MASK 0x00001000
+#define _CLK1CON_SIDL_POSITION 0x0000000D
+#define _CLK1CON_SIDL_MASK 0x00002000
+#define _CLK1CON_ON_POSITION 0x0000000F
+#define _CLK1CON_ON_MASK 0x00008000
+#define _CLK1CON_BOSC_POSITION 0x00000010
+#define _CLK1CON_BOSC_MASK 0x000F0000
+#define _CLK1CON_FSCMEN_POSITION 0x00000014
+#define _CLK1CON_FSCMEN_MASK 0x00100000
+#define _CLK1CON_CLKRDY_POSITION 0x0000001F
+#define _CLK1CON_CLKRDY_MASK 0x80000000
+#define _CLK1DIV_FRACDIV_POSITION 0x00000000
+#define _CLK1DIV_FRACDIV_MASK 0x000001FF
+#define _CLK1DIV_INTDIV_POSITION 0x00000010
+#define _CLK1DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK2CON_NOSC_POSITION 0x00000000
+#define _CLK2CON_NOSC_MASK 0x0000000F
+#define _CLK2CON_COSC_POSITION 0x00000004
+#define _CLK2CON_COSC_MASK 0x000000F0
+#define _CLK2CON_OSWEN_POSITION 0x00000008
+#define _CLK2CON_OSWEN_MASK 0x00000100
+#define _CLK2CON_DIVSWEN_POSITION 0x00000009
+#define _CLK2CON_DIVSWEN_MASK 0x00000200
+#define _CLK2CON_OE_POSITION 0x0000000C
+#define _CLK2CON_OE_MASK 0x00001000
+#define _CLK2CON_SIDL_POSITION 0x0000000D
+#define _CLK2CON_SIDL_MASK 0x00002000
+#define _CLK2CON_ON_POSITION 0x0000000F
+#define _CLK2CON_ON_MASK 0x00008000
+#define _CLK2CON_BOSC_POSITION 0x00000010
+#define _CLK2CON_BOSC_MASK 0x000F0000
+#define _CLK2CON_FSCMEN_POSITION 0x00000014
+#define _CLK2CON_FSCMEN_MASK 0x00100000
+#define _CLK2CON_CLKRDY_POSITION 0x0000001F
+#define _CLK2CON_CLKRDY_MASK 0x80000000
+#define _CLK2DIV_FRACDIV_POSITION 0x00000000
+#define _CLK2DIV_FRACDIV_MASK 0x000001FF
+#define _CLK2DIV_INTDIV_POSITION 0x00000010
+#define _CLK2DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK3CON_NOSC_POSITION 0x00000000
+#define _CLK3CON_NOSC_MASK 0x0000000F
+#define _CLK3CON_COSC_POSITION 0x00000004
+#define _CLK3CON_COSC_MASK 0x000000F0
+#define _CLK3CON_OSWEN_POSITION 0x00000008
+#define _CLK3CON_OSWEN_MASK 0x00000100
+#define _CLK3CON_DIVSWEN_POSITION 0x00000009
+#define _CLK3CON_DIVSWEN_MASK 0x00000200
+#define _CLK3CON_OE_POSITION 0x0000000C
+#define _CLK3CON_OE_MASK 0x00001000
+#define _CLK3CON_SIDL_POSITION 0x0000000D
+#define _CLK3CON_SIDL_MASK 0x00002000
+#define _CLK3CON_ON_POSITION 0x0000000F
+#define _CLK3CON_ON_MASK 0x00008000
+#define _CLK3CON_BOSC_POSITION 0x00000010
+#define _CLK3CON_BOSC_MASK 0x000F0000
+#define _CLK3CON_FSCMEN_POSITION 0x00000014
+#define _CLK3CON_FSCMEN_MASK 0x00100000
+#define _CLK3CON_CLKRDY_POSITION 0x0000001F
+#define _CLK3CON_CLKRDY_MASK 0x80000000
+#define _CLK3DIV_FRACDIV_POSITION 0x00000000
+#define _CLK3DIV_FRACDIV_MASK 0x000001FF
+#define _CLK3DIV_INTDIV_POSITION 0x00000010
+#define _CLK3DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK4CON_NOSC_POSITION 0x00000000
+#define _CLK4CON_NOSC_MASK 0x0000000F
+#define _CLK4CON_COSC_POSITION 0x00000004
+#define _CLK4CON_COSC_MASK 0x000000F0
+#define _CLK4CON_OSWEN_POSITION 0x00000008
+#define _CLK4CON_OSWEN_MASK 0x00000100
+#define _CLK4CON_DIVSWEN_POSITION 0x00000009
+#define _CLK4CON_DIVSWEN_MASK 0x00000200
+#define _CLK4CON_OE_POSITION 0x0000000C
+#define _CLK4CON_OE_MASK 0x00001000
+#define _CLK4CON_SIDL_POSITION 0x0000000D
+#define _CLK4CON_SIDL_MASK 0x00002000
+#define _CLK4CON_ON_POSITION 0x0000000F
+#define _CLK4CON_ON_MASK 0x00008000
+#define _CLK4CON_BOSC_POSITION 0x00000010
+#define _CLK4CON_BOSC_MASK 0x000F0000
+#define _CLK4CON_FSCMEN_POSITION 0x00000014
+#define _CLK4CON_FSCMEN_MASK 0x00100000
+#define _CLK4CON_CLKRDY_POSITION 0x0000001F
+#define _CLK4CON_CLKRDY_MASK 0x80000000
+#define _CLK4DIV_FRACDIV_POSITION 0x00000000
+#define _CLK4DIV_FRACDIV_MASK 0x000001FF
+#define _CLK4DIV_INTDIV_POSITION 0x00000010
+#define _CLK4DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK5CON_NOSC_POSITION 0x00000000
+#define _CLK5CON_NOSC_MASK 0x0000000F
+#define _CLK5CON_COSC_POSITION 0x00000004
+#define _CLK5CON_COSC_MASK 0x000000F0
+#define _CLK5CON_OSWEN_POSITION 0x00000008
+#define _CLK5CON_OSWEN_MASK 0x00000100
+#define _CLK5CON_DIVSWEN_POSITION 0x00000009
+#define _CLK5CON_DIVSWEN_MASK 0x00000200
+#define _CLK5CON_OE_POSITION 0x0000000C
+#define _CLK5CON_OE_MASK 0x00001000
+#define _CLK5CON_SIDL_POSITION 0x0000000D
+#define _CLK5CON_SIDL_MASK 0x00002000
+#define _CLK5CON_ON_POSITION 0x0000000F
+#define _CLK5CON_ON_MASK 0x00008000
+#define _CLK5CON_BOSC_POSITION 0x00000010
+#define _CLK5CON_BOSC_MASK 0x000F0000
+#define _CLK5CON_FSCMEN_POSITION 0x00000014
+#define _CLK5CON_FSCMEN_MASK 0x00100000
+#define _CLK5CON_CLKRDY_POSITION 0x0000001F
+#define _CLK5CON_CLKRDY_MASK 0x80000000
+#define _CLK5DIV_FRACDIV_POSITION 0x00000000
+#define _CLK5DIV_FRACDIV_MASK 0x000001FF
+#define _CLK5DIV_INTDIV_POSITION 0x00000010
+#define _CLK5DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK6CON_NOSC_POSITION 0x00000000
+#define _CLK6CON_NOSC_MASK 0x0000000F
+#define _CLK6CON_COSC_POSITION 0x00000004
+#define _CLK6CON_COSC_MASK 0x000000F0
+#define _CLK6CON_OSWEN_POSITION 0x00000008
+#define _CLK6CON_OSWEN_MASK 0x00000100
+#define _CLK6CON_DIVSWEN_POSITION 0x00000009
+#define _CLK6CON_DIVSWEN_MASK 0x00000200
+#define _CLK6CON_OE_POSITION 0x0000000C
+#define _CLK6CON_OE_MASK 0x00001000
+#define _CLK6CON_SIDL_POSITION 0x0000000D
+#define _CLK6CON_SIDL_MASK 0x00002000
+#define _CLK6CON_ON_POSITION 0x0000000F
+#define _CLK6CON_ON_MASK 0x00008000
+#define _CLK6CON_BOSC_POSITION 0x00000010
+#define _CLK6CON_BOSC_MASK 0x000F0000
+#define _CLK6CON_FSCMEN_POSITION 0x00000014
+#define _CLK6CON_FSCMEN_MASK 0x00100000
+#define _CLK6CON_CLKRDY_POSITION 0x0000001F
+#define _CLK6CON_CLKRDY_MASK 0x80000000
+#define _CLK6DIV_FRACDIV_POSITION 0x00000000
+#define _CLK6DIV_FRACDIV_MASK 0x000001FF
+#define _CLK6DIV_INTDIV_POSITION 0x00000010
+#define _CLK6DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK7CON_NOSC_POSITION 0x00000000
+#define _CLK7CON_NOSC_MASK 0x0000000F
+#define _CLK7CON_COSC_POSITION 0x00000004
+#define _CLK7CON_COSC_MASK 0x000000F0
+#define _CLK7CON_OSWEN_POSITION 0x00000008
+#define _CLK7CON_OSWEN_MASK 0x00000100
+#define _CLK7CON_DIVSWEN_POSITION 0x00000009
+#define _CLK7CON_DIVSWEN_MASK 0x00000200
+#define _CLK7CON_OE_POSITION 0x0000000C
+#define _CLK7CON_OE_MASK 0x00001000
+#define _CLK7CON_SIDL_POSITION 0x0000000D
+#define _CLK7CON_SIDL_MASK 0x00002000
+#define _CLK7CON_ON_POSITION 0x0000000F
+#define _CLK7CON_ON_MASK 0x00008000
+#define _CLK7CON_BOSC_POSITION 0x00000010
+#define _CLK7CON_BOSC_MASK 0x000F0000
+#define _CLK7CON_FSCMEN_POSITION 0x00000014
+#define _CLK7CON_FSCMEN_MASK 0x00100000
+#define _CLK7CON_CLKRDY_POSITION 0x0000001F
+#define _CLK7CON_CLKRDY_MASK 0x80000000
+#define _CLK7DIV_FRACDIV_POSITION 0x00000000
+#define _CLK7DIV_FRACDIV_MASK 0x000001FF
+#define _CLK7DIV_INTDIV_POSITION 0x00000010
+#define _CLK7DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK8CON_NOSC_POSITION 0x00000000
+#define _CLK8CON_NOSC_MASK 0x0000000F
+#define _CLK8CON_COSC_POSITION 0x00000004
+#define _CLK8CON_COSC_MASK 0x000000F0
+#define _CLK8CON_OSWEN_POSITION 0x00000008
+#define _CLK8CON_OSWEN_MASK 0x00000100
+#define _CLK8CON_DIVSWEN_POSITION 0x00000009
+#define _CLK8CON_DIVSWEN_MASK 0x00000200
+#define _CLK8CON_OE_POSITION 0x0000000C
+#define _CLK8CON_OE_MASK 0x00001000
+#define _CLK8CON_SIDL_POSITION 0x0000000D
+#define _CLK8CON_SIDL_MASK 0x00002000
+#define _CLK8CON_ON_POSITION 0x0000000F
+#define _CLK8CON_ON_MASK 0x00008000
+#define _CLK8CON_BOSC_POSITION 0x00000010
+#define _CLK8CON_BOSC_MASK 0x000F0000
+#define _CLK8CON_FSCMEN_POSITION 0x00000014
+#define _CLK8CON_FSCMEN_MASK 0x00100000
+#define _CLK8CON_CLKRDY_POSITION 0x0000001F
+#define _CLK8CON_CLKRDY_MASK 0x80000000
+#define _CLK8DIV_FRACDIV_POSITION 0x00000000
+#define _CLK8DIV_FRACDIV_MASK 0x000001FF
+#define _CLK8DIV_INTDIV_POSITION 0x00000010
+#define _CLK8DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK9CON_NOSC_POSITION 0x00000000
+#define _CLK9CON_NOSC_MASK 0x0000000F
+#define _CLK9CON_COSC_POSITION 0x00000004
+#define _CLK9CON_COSC_MASK 0x000000F0
+#define _CLK9CON_OSWEN_POSITION 0x00000008
+#define _CLK9CON_OSWEN_MASK 0x00000100
+#define _CLK9CON_DIVSWEN_POSITION 0x00000009
+#define _CLK9CON_DIVSWEN_MASK 0x00000200
+#define _CLK9CON_OE_POSITION 0x0000000C
+#define _CLK9CON_OE_MASK 0x00001000
+#define _CLK9CON_SIDL_POSITION 0x0000000D
+#define _CLK9CON_SIDL_MASK 0x00002000
+#define _CLK9CON_ON_POSITION 0x0000000F
+#define _CLK9CON_ON_MASK 0x00008000
+#define _CLK9CON_BOSC_POSITION 0x00000010
+#define _CLK9CON_BOSC_MASK 0x000F0000
+#define _CLK9CON_FSCMEN_POSITION 0x00000014
+#define _CLK9CON_FSCMEN_MASK 0x00100000
+#define _CLK9CON_CLKRDY_POSITION 0x0000001F
+#define _CLK9CON_CLKRDY_MASK 0x80000000
+#define _CLK9DIV_FRACDIV_POSITION 0x00000000
+#define _CLK9DIV_FRACDIV_MASK 0x000001FF
+#define _CLK9DIV_INTDIV_POSITION 0x00000010
+#define _CLK9DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK10CON_NOSC_POSITION 0x00000000
+#define _CLK10CON_NOSC_MASK 0x0000000F
+#define _CLK10CON_COSC_POSITION 0x00000004
+#define _CLK10CON_COSC_MASK 0x000000F0
+#define _CLK10CON_OSWEN_POSITION 0x00000008
+#define _CLK10CON_OSWEN_MASK 0x00000100
+#define _CLK10CON_DIVSWEN_POSITION 0x00000009
+#define _CLK10CON_DIVSWEN_MASK 0x00000200
+#define _CLK10CON_OE_POSITION 0x0000000C
+#define _CLK10CON_OE_MASK 0x00001000
+#define _CLK10CON_SIDL_POSITION 0x0000000D
+#define _CLK10CON_SIDL_MASK 0x00002000
+#define _CLK10CON_ON_POSITION 0x0000000F
+#define _CLK10CON_ON_MASK 0x00008000
+#define _CLK10CON_BOSC_POSITION 0x00000010
+#define _CLK10CON_BOSC_MASK 0x000F0000
+#define _CLK10CON_FSCMEN_POSITION 0x00000014
+#define _CLK10CON_FSCMEN_MASK 0x00100000
+#define _CLK10CON_CLKRDY_POSITION 0x0000001F
+#define _CLK10CON_CLKRDY_MASK 0x80000000
+#define _CLK10DIV_FRACDIV_POSITION 0x00000000
+#define _CLK10DIV_FRACDIV_MASK 0x000001FF
+#define _CLK10DIV_INTDIV_POSITION 0x00000010
+#define _CLK10DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK11CON_NOSC_POSITION 0x00000000
+#define _CLK11CON_NOSC_MASK 0x0000000F
+#define _CLK11CON_COSC_POSITION 0x00000004
+#define _CLK11CON_COSC_MASK 0x000000F0
+#define _CLK11CON_OSWEN_POSITION 0x00000008
+#define _CLK11CON_OSWEN_MASK 0x00000100
+#define _CLK11CON_DIVSWEN_POSITION 0x00000009
+#define _CLK11CON_DIVSWEN_MASK 0x00000200
+#define _CLK11CON_OE_POSITION 0x0000000C
+#define _CLK11CON_OE_MASK 0x00001000
+#define _CLK11CON_SIDL_POSITION 0x0000000D
+#define _CLK11CON_SIDL_MASK 0x00002000
+#define _CLK11CON_ON_POSITION 0x0000000F
+#define _CLK11CON_ON_MASK 0x00008000
+#define _CLK11CON_BOSC_POSITION 0x00000010
+#define _CLK11CON_BOSC_MASK 0x000F0000
+#define _CLK11CON_FSCMEN_POSITION 0x00000014
+#define _CLK11CON_FSCMEN_MASK 0x00100000
+#define _CLK11CON_CLKRDY_POSITION 0x0000001F
+#define _CLK11CON_CLKRDY_MASK 0x80000000
+#define _CLK11DIV_FRACDIV_POSITION 0x00000000
+#define _CLK11DIV_FRACDIV_MASK 0x000001FF
+#define _CLK11DIV_INTDIV_POSITION 0x00000010
+#define _CLK11DIV_INTDIV_MASK 0xFFFF0000
+#define _CLK12CON_NOSC_POSITION 0x00000000
+#define _CLK12CON_NOSC_MASK 0x0000000F
+#define _CLK12CON_COSC_POSITION 0x00000004
+#define _CLK12CON_COSC_MASK 0x000000F0
+#define _CLK12CON_OSWEN_POSITION 0x00000008
+#define _CLK12CON_OSWEN_MASK 0x00000100
+#define _CLK12CON_DIVSWEN_POSITION 0x00000009
+#define _CLK12CON_DIVSWEN_MASK 0x00000200
+#define _CLK12CON_OE_POSITION 0x0000000C
+#define _CLK12CON_OE_MASK 0x00001000
+#define _CLK12CON_SIDL_POSITION 0x0000000D
+#define _CLK12CON_SIDL_MASK 0x00002000
+#define _CLK12CON_ON_POSITION 0x0000000F
+#define _CLK12CON_ON_MASK 0x00008000
+#define _CLK12CON_BOSC_POSITION 0x00000010
+#define _CLK12CON_BOSC_MASK 0x000F0000
+#define _CLK12CON_FSCMEN_POSITION 0x00000014
+#define _CLK12CON_FSCMEN_MASK 0x00100000
+#define _CLK12CON_CLKRDY_POSITION 0x0000001F
+#define _CLK12CON_CLKRDY_MASK 0x80000000
+#define _CLK12DIV_FRACDIV_POSITION 0x00000000
+#define _CLK12DIV_FRACDIV_MASK 0x000001FF
+#define _CLK12DIV_INTDIV_POSITION 0x00000010
+#define _CLK12DIV_INTDIV_MASK 0xFFFF0000
+#define _AD1CON_ON_POSITION 0x0000000F
+#define _AD1CON_ON_MASK 0x00008000
+#define _AD1CON_ADRDY_POSITION 0x0000001F
+#define _AD1CON_ADRDY_MASK 0x80000000
+#define _AD1CH0CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH0CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH0CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH0CON1_NINSEL_MASK 0x00000300
+#define _AD1CH0CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH0CON1_FRAC_MASK 0x00000400
+#define _AD1CH0CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH0CON1_DIFF_MASK 0x00000800
+#define _AD1CH0CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH0CON1_SAMC_MASK 0x003FF000
+#define _AD1CH0CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH0CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH0CON2_MODE_POSITION 0x00000000
+#define _AD1CH0CON2_MODE_MASK 0x00000003
+#define _AD1CH0CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH0CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH1CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH1CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH1CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH1CON1_NINSEL_MASK 0x00000300
+#define _AD1CH1CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH1CON1_FRAC_MASK 0x00000400
+#define _AD1CH1CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH1CON1_DIFF_MASK 0x00000800
+#define _AD1CH1CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH1CON1_SAMC_MASK 0x003FF000
+#define _AD1CH1CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH1CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH1CON2_MODE_POSITION 0x00000000
+#define _AD1CH1CON2_MODE_MASK 0x00000003
+#define _AD1CH1CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH1CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH2CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH2CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH2CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH2CON1_NINSEL_MASK 0x00000300
+#define _AD1CH2CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH2CON1_FRAC_MASK 0x00000400
+#define _AD1CH2CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH2CON1_DIFF_MASK 0x00000800
+#define _AD1CH2CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH2CON1_SAMC_MASK 0x003FF000
+#define _AD1CH2CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH2CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH2CON2_MODE_POSITION 0x00000000
+#define _AD1CH2CON2_MODE_MASK 0x00000003
+#define _AD1CH2CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH2CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH3CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH3CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH3CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH3CON1_NINSEL_MASK 0x00000300
+#define _AD1CH3CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH3CON1_FRAC_MASK 0x00000400
+#define _AD1CH3CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH3CON1_DIFF_MASK 0x00000800
+#define _AD1CH3CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH3CON1_SAMC_MASK 0x003FF000
+#define _AD1CH3CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH3CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH3CON2_MODE_POSITION 0x00000000
+#define _AD1CH3CON2_MODE_MASK 0x00000003
+#define _AD1CH3CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH3CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH4CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH4CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH4CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH4CON1_NINSEL_MASK 0x00000300
+#define _AD1CH4CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH4CON1_FRAC_MASK 0x00000400
+#define _AD1CH4CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH4CON1_DIFF_MASK 0x00000800
+#define _AD1CH4CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH4CON1_SAMC_MASK 0x003FF000
+#define _AD1CH4CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH4CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH4CON2_MODE_POSITION 0x00000000
+#define _AD1CH4CON2_MODE_MASK 0x00000003
+#define _AD1CH4CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH4CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH5CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH5CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH5CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH5CON1_NINSEL_MASK 0x00000300
+#define _AD1CH5CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH5CON1_FRAC_MASK 0x00000400
+#define _AD1CH5CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH5CON1_DIFF_MASK 0x00000800
+#define _AD1CH5CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH5CON1_SAMC_MASK 0x003FF000
+#define _AD1CH5CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH5CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH5CON2_MODE_POSITION 0x00000000
+#define _AD1CH5CON2_MODE_MASK 0x00000003
+#define _AD1CH5CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH5CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH6CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH6CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH6CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH6CON1_NINSEL_MASK 0x00000300
+#define _AD1CH6CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH6CON1_FRAC_MASK 0x00000400
+#define _AD1CH6CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH6CON1_DIFF_MASK 0x00000800
+#define _AD1CH6CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH6CON1_SAMC_MASK 0x003FF000
+#define _AD1CH6CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH6CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH6CON2_MODE_POSITION 0x00000000
+#define _AD1CH6CON2_MODE_MASK 0x00000003
+#define _AD1CH6CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH6CON2_ACCNUM_MASK 0x00000300
+#define _AD1CH7CON1_PINSEL_POSITION 0x00000000
+#define _AD1CH7CON1_PINSEL_MASK 0x0000003F
+#define _AD1CH7CON1_NINSEL_POSITION 0x00000008
+#define _AD1CH7CON1_NINSEL_MASK 0x00000300
+#define _AD1CH7CON1_FRAC_POSITION 0x0000000A
+#define _AD1CH7CON1_FRAC_MASK 0x00000400
+#define _AD1CH7CON1_DIFF_POSITION 0x0000000B
+#define _AD1CH7CON1_DIFF_MASK 0x00000800
+#define _AD1CH7CON1_SAMC_POSITION 0x0000000C
+#define _AD1CH7CON1_SAMC_MASK 0x003FF000
+#define _AD1CH7CON1_TRG1SRC_POSITION 0x00000018
+#define _AD1CH7CON1_TRG1SRC_MASK 0x1F000000
+#define _AD1CH7CON2_MODE_POSITION 0x00000000
+#define _AD1CH7CON2_MODE_MASK 0x00000003
+#define _AD1CH7CON2_ACCNUM_POSITION 0x00000008
+#define _AD1CH7CON2_ACCNUM_MASK 0x00000300
+#define _AD2CON_ON_POSITION 0x0000000F
+#define _AD2CON_ON_MASK 0x00008000
+#define _AD2CON_ADRDY_POSITION 0x0000001F
+#define _AD2CON_ADRDY_MASK 0x80000000
+#define _AD2CH0CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH0CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH0CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH0CON1_NINSEL_MASK 0x00000300
+#define _AD2CH0CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH0CON1_FRAC_MASK 0x00000400
+#define _AD2CH0CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH0CON1_DIFF_MASK 0x00000800
+#define _AD2CH0CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH0CON1_SAMC_MASK 0x003FF000
+#define _AD2CH0CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH0CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH0CON2_MODE_POSITION 0x00000000
+#define _AD2CH0CON2_MODE_MASK 0x00000003
+#define _AD2CH0CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH0CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH1CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH1CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH1CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH1CON1_NINSEL_MASK 0x00000300
+#define _AD2CH1CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH1CON1_FRAC_MASK 0x00000400
+#define _AD2CH1CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH1CON1_DIFF_MASK 0x00000800
+#define _AD2CH1CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH1CON1_SAMC_MASK 0x003FF000
+#define _AD2CH1CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH1CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH1CON2_MODE_POSITION 0x00000000
+#define _AD2CH1CON2_MODE_MASK 0x00000003
+#define _AD2CH1CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH1CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH2CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH2CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH2CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH2CON1_NINSEL_MASK 0x00000300
+#define _AD2CH2CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH2CON1_FRAC_MASK 0x00000400
+#define _AD2CH2CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH2CON1_DIFF_MASK 0x00000800
+#define _AD2CH2CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH2CON1_SAMC_MASK 0x003FF000
+#define _AD2CH2CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH2CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH2CON2_MODE_POSITION 0x00000000
+#define _AD2CH2CON2_MODE_MASK 0x00000003
+#define _AD2CH2CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH2CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH3CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH3CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH3CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH3CON1_NINSEL_MASK 0x00000300
+#define _AD2CH3CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH3CON1_FRAC_MASK 0x00000400
+#define _AD2CH3CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH3CON1_DIFF_MASK 0x00000800
+#define _AD2CH3CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH3CON1_SAMC_MASK 0x003FF000
+#define _AD2CH3CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH3CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH3CON2_MODE_POSITION 0x00000000
+#define _AD2CH3CON2_MODE_MASK 0x00000003
+#define _AD2CH3CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH3CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH4CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH4CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH4CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH4CON1_NINSEL_MASK 0x00000300
+#define _AD2CH4CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH4CON1_FRAC_MASK 0x00000400
+#define _AD2CH4CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH4CON1_DIFF_MASK 0x00000800
+#define _AD2CH4CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH4CON1_SAMC_MASK 0x003FF000
+#define _AD2CH4CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH4CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH4CON2_MODE_POSITION 0x00000000
+#define _AD2CH4CON2_MODE_MASK 0x00000003
+#define _AD2CH4CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH4CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH5CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH5CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH5CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH5CON1_NINSEL_MASK 0x00000300
+#define _AD2CH5CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH5CON1_FRAC_MASK 0x00000400
+#define _AD2CH5CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH5CON1_DIFF_MASK 0x00000800
+#define _AD2CH5CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH5CON1_SAMC_MASK 0x003FF000
+#define _AD2CH5CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH5CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH5CON2_MODE_POSITION 0x00000000
+#define _AD2CH5CON2_MODE_MASK 0x00000003
+#define _AD2CH5CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH5CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH6CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH6CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH6CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH6CON1_NINSEL_MASK 0x00000300
+#define _AD2CH6CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH6CON1_FRAC_MASK 0x00000400
+#define _AD2CH6CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH6CON1_DIFF_MASK 0x00000800
+#define _AD2CH6CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH6CON1_SAMC_MASK 0x003FF000
+#define _AD2CH6CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH6CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH6CON2_MODE_POSITION 0x00000000
+#define _AD2CH6CON2_MODE_MASK 0x00000003
+#define _AD2CH6CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH6CON2_ACCNUM_MASK 0x00000300
+#define _AD2CH7CON1_PINSEL_POSITION 0x00000000
+#define _AD2CH7CON1_PINSEL_MASK 0x0000003F
+#define _AD2CH7CON1_NINSEL_POSITION 0x00000008
+#define _AD2CH7CON1_NINSEL_MASK 0x00000300
+#define _AD2CH7CON1_FRAC_POSITION 0x0000000A
+#define _AD2CH7CON1_FRAC_MASK 0x00000400
+#define _AD2CH7CON1_DIFF_POSITION 0x0000000B
+#define _AD2CH7CON1_DIFF_MASK 0x00000800
+#define _AD2CH7CON1_SAMC_POSITION 0x0000000C
+#define _AD2CH7CON1_SAMC_MASK 0x003FF000
+#define _AD2CH7CON1_TRG1SRC_POSITION 0x00000018
+#define _AD2CH7CON1_TRG1SRC_MASK 0x1F000000
+#define _AD2CH7CON2_MODE_POSITION 0x00000000
+#define _AD2CH7CON2_MODE_MASK 0x00000003
+#define _AD2CH7CON2_ACCNUM_POSITION 0x00000008
+#define _AD2CH7CON2_ACCNUM_MASK 0x00000300
+#define _AD3CON_ON_POSITION 0x0000000F
+#define _AD3CON_ON_MASK 0x00008000
+#define _AD3CON_ADRDY_POSITION 0x0000001F
+#define _AD3CON_ADRDY_MASK 0x80000000
+#define _AD3CH0CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH0CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH0CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH0CON1_NINSEL_MASK 0x00000300
+#define _AD3CH0CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH0CON1_FRAC_MASK 0x00000400
+#define _AD3CH0CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH0CON1_DIFF_MASK 0x00000800
+#define _AD3CH0CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH0CON1_SAMC_MASK 0x003FF000
+#define _AD3CH0CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH0CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH0CON2_MODE_POSITION 0x00000000
+#define _AD3CH0CON2_MODE_MASK 0x00000003
+#define _AD3CH0CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH0CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH1CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH1CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH1CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH1CON1_NINSEL_MASK 0x00000300
+#define _AD3CH1CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH1CON1_FRAC_MASK 0x00000400
+#define _AD3CH1CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH1CON1_DIFF_MASK 0x00000800
+#define _AD3CH1CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH1CON1_SAMC_MASK 0x003FF000
+#define _AD3CH1CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH1CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH1CON2_MODE_POSITION 0x00000000
+#define _AD3CH1CON2_MODE_MASK 0x00000003
+#define _AD3CH1CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH1CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH2CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH2CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH2CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH2CON1_NINSEL_MASK 0x00000300
+#define _AD3CH2CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH2CON1_FRAC_MASK 0x00000400
+#define _AD3CH2CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH2CON1_DIFF_MASK 0x00000800
+#define _AD3CH2CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH2CON1_SAMC_MASK 0x003FF000
+#define _AD3CH2CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH2CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH2CON2_MODE_POSITION 0x00000000
+#define _AD3CH2CON2_MODE_MASK 0x00000003
+#define _AD3CH2CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH2CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH3CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH3CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH3CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH3CON1_NINSEL_MASK 0x00000300
+#define _AD3CH3CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH3CON1_FRAC_MASK 0x00000400
+#define _AD3CH3CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH3CON1_DIFF_MASK 0x00000800
+#define _AD3CH3CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH3CON1_SAMC_MASK 0x003FF000
+#define _AD3CH3CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH3CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH3CON2_MODE_POSITION 0x00000000
+#define _AD3CH3CON2_MODE_MASK 0x00000003
+#define _AD3CH3CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH3CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH4CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH4CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH4CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH4CON1_NINSEL_MASK 0x00000300
+#define _AD3CH4CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH4CON1_FRAC_MASK 0x00000400
+#define _AD3CH4CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH4CON1_DIFF_MASK 0x00000800
+#define _AD3CH4CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH4CON1_SAMC_MASK 0x003FF000
+#define _AD3CH4CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH4CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH4CON2_MODE_POSITION 0x00000000
+#define _AD3CH4CON2_MODE_MASK 0x00000003
+#define _AD3CH4CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH4CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH5CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH5CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH5CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH5CON1_NINSEL_MASK 0x00000300
+#define _AD3CH5CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH5CON1_FRAC_MASK 0x00000400
+#define _AD3CH5CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH5CON1_DIFF_MASK 0x00000800
+#define _AD3CH5CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH5CON1_SAMC_MASK 0x003FF000
+#define _AD3CH5CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH5CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH5CON2_MODE_POSITION 0x00000000
+#define _AD3CH5CON2_MODE_MASK 0x00000003
+#define _AD3CH5CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH5CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH6CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH6CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH6CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH6CON1_NINSEL_MASK 0x00000300
+#define _AD3CH6CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH6CON1_FRAC_MASK 0x00000400
+#define _AD3CH6CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH6CON1_DIFF_MASK 0x00000800
+#define _AD3CH6CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH6CON1_SAMC_MASK 0x003FF000
+#define _AD3CH6CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH6CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH6CON2_MODE_POSITION 0x00000000
+#define _AD3CH6CON2_MODE_MASK 0x00000003
+#define _AD3CH6CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH6CON2_ACCNUM_MASK 0x00000300
+#define _AD3CH7CON1_PINSEL_POSITION 0x00000000
+#define _AD3CH7CON1_PINSEL_MASK 0x0000003F
+#define _AD3CH7CON1_NINSEL_POSITION 0x00000008
+#define _AD3CH7CON1_NINSEL_MASK 0x00000300
+#define _AD3CH7CON1_FRAC_POSITION 0x0000000A
+#define _AD3CH7CON1_FRAC_MASK 0x00000400
+#define _AD3CH7CON1_DIFF_POSITION 0x0000000B
+#define _AD3CH7CON1_DIFF_MASK 0x00000800
+#define _AD3CH7CON1_SAMC_POSITION 0x0000000C
+#define _AD3CH7CON1_SAMC_MASK 0x003FF000
+#define _AD3CH7CON1_TRG1SRC_POSITION 0x00000018
+#define _AD3CH7CON1_TRG1SRC_MASK 0x1F000000
+#define _AD3CH7CON2_MODE_POSITION 0x00000000
+#define _AD3CH7CON2_MODE_MASK 0x00000003
+#define _AD3CH7CON2_ACCNUM_POSITION 0x00000008
+#define _AD3CH7CON2_ACCNUM_MASK 0x00000300
+#define _DACCTRL1_DNLADJ_POSITION 0x00000000
+#define _DACCTRL1_DNLADJ_MASK 0x000000FF
+#define _DACCTRL1_NEGINLADJ_POSITION 0x00000008
+#define _DACCTRL1_NEGINLADJ_MASK 0x0000FF00
+#define _DACCTRL1_POSINLADJ_POSITION 0x00000010
+#define _DACCTRL1_POSINLADJ_MASK 0x00FF0000
+#define _DACCTRL1_FCLKDIV_POSITION 0x00000018
+#define _DACCTRL1_FCLKDIV_MASK 0x07000000
+#define _DACCTRL1_SIDL_POSITION 0x0000001D
+#define _DACCTRL1_SIDL_MASK 0x20000000
+#define _DACCTRL1_ON_POSITION 0x0000001F
+#define _DACCTRL1_ON_MASK 0x80000000
+#define _DACCTRL2_TMODTIME_POSITION 0x00000000
+#define _DACCTRL2_TMODTIME_MASK 0x000003FF
+#define _DACCTRL2_SSTIME_POSITION 0x00000010
+#define _DACCTRL2_SSTIME_MASK 0x03FF0000
+#define _DAC1CON_TMCB_POSITION 0x00000000
+#define _DAC1CON_TMCB_MASK 0x000003FF
+#define _DAC1CON_DACOEN_POSITION 0x0000000C
+#define _DAC1CON_DACOEN_MASK 0x00001000
+#define _DAC1CON_IRQM_POSITION 0x0000000D
+#define _DAC1CON_IRQM_MASK 0x00006000
+#define _DAC1CON_DACEN_POSITION 0x0000000F
+#define _DAC1CON_DACEN_MASK 0x00008000
+#define _DAC1DAT_DACDAT_POSITION 0x00000000
+#define _DAC1DAT_DACDAT_MASK 0x0000FFFF
+#define _DAC1DAT_DACLOW_POSITION 0x00000010
+#define _DAC1DAT_DACLOW_MASK 0xFFFF0000
+#define _DAC1CMP_INNSEL_POSITION 0x00000000
+#define _DAC1CMP_INNSEL_MASK 0x00000007
+#define _DAC1CMP_INPSEL_POSITION 0x00000004
+#define _DAC1CMP_INPSEL_MASK 0x00000070
+#define _DAC1CMP_HYSSEL_POSITION 0x00000008
+#define _DAC1CMP_HYSSEL_MASK 0x00000300
+#define _DAC1CMP_HYSPOL_POSITION 0x0000000A
+#define _DAC1CMP_HYSPOL_MASK 0x00000400
+#define _DAC1CMP_CMPPOL_POSITION 0x0000000B
+#define _DAC1CMP_CMPPOL_MASK 0x00000800
+#define _DAC1CMP_CMPSTAT_POSITION 0x0000000C
+#define _DAC1CMP_CMPSTAT_MASK 0x00001000
+#define _DAC1CMP_CBE_POSITION 0x0000000D
+#define _DAC1CMP_CBE_MASK 0x00002000
+#define _DAC1CMP_FLTREN_POSITION 0x0000000E
+#define _DAC1CMP_FLTREN_MASK 0x00004000
+#define _DAC1SLPCON_SLPSTRT_POSITION 0x00000000
+#define _DAC1SLPCON_SLPSTRT_MASK 0x0000000F
+#define _DAC1SLPCON_SLPSTOPB_POSITION 0x00000004
+#define _DAC1SLPCON_SLPSTOPB_MASK 0x000000F0
+#define _DAC1SLPCON_SLPSTOPA_POSITION 0x00000008
+#define _DAC1SLPCON_SLPSTOPA_MASK 0x00000F00
+#define _DAC1SLPCON_HCFSEL_POSITION 0x0000000C
+#define _DAC1SLPCON_HCFSEL_MASK 0x0000F000
+#define _DAC1SLPCON_PSE_POSITION 0x00000010
+#define _DAC1SLPCON_PSE_MASK 0x00010000
+#define _DAC1SLPCON_TWME_POSITION 0x00000011
+#define _DAC1SLPCON_TWME_MASK 0x00020000
+#define _DAC1SLPCON_HME_POSITION 0x00000012
+#define _DAC1SLPCON_HME_MASK 0x00040000
+#define _DAC1SLPCON_SLOPEN_POSITION 0x00000013
+#define _DAC1SLPCON_SLOPEN_MASK 0x00080000
+#define _DAC2CON_TMCB_POSITION 0x00000000
+#define _DAC2CON_TMCB_MASK 0x000003FF
+#define _DAC2CON_DACOEN_POSITION 0x0000000C
+#define _DAC2CON_DACOEN_MASK 0x00001000
+#define _DAC2CON_IRQM_POSITION 0x0000000D
+#define _DAC2CON_IRQM_MASK 0x00006000
+#define _DAC2CON_DACEN_POSITION 0x0000000F
+#define _DAC2CON_DACEN_MASK 0x00008000
+#define _DAC2DAT_DACDAT_POSITION 0x00000000
+#define _DAC2DAT_DACDAT_MASK 0x0000FFFF
+#define _DAC2DAT_DACLOW_POSITION 0x00000010
+#define _DAC2DAT_DACLOW_MASK 0xFFFF0000
+#define _DAC2CMP_INNSEL_POSITION 0x00000000
+#define _DAC2CMP_INNSEL_MASK 0x00000007
+#define _DAC2CMP_INPSEL_POSITION 0x00000004
+#define _DAC2CMP_INPSEL_MASK 0x00000070
+#define _DAC2CMP_HYSSEL_POSITION 0x00000008
+#define _DAC2CMP_HYSSEL_MASK 0x00000300
+#define _DAC2CMP_HYSPOL_POSITION 0x0000000A
+#define _DAC2CMP_HYSPOL_MASK 0x00000400
+#define _DAC2CMP_CMPPOL_POSITION 0x0000000B
+#define _DAC2CMP_CMPPOL_MASK 0x00000800
+#define _DAC2CMP_CMPSTAT_POSITION 0x0000000C
+#define _DAC2CMP_CMPSTAT_MASK 0x00001000
+#define _DAC2CMP_CBE_POSITION 0x0000000D
+#define _DAC2CMP_CBE_MASK 0x00002000
+#define _DAC2CMP_FLTREN_POSITION 0x0000000E
+#define _DAC2CMP_FLTREN_MASK 0x00004000
+#define _DAC2SLPCON_SLPSTRT_POSITION 0x00000000
+#define _DAC2SLPCON_SLPSTRT_MASK 0x0000000F
+#define _DAC2SLPCON_SLPSTOPB_POSITION 0x00000004
+#define _DAC2SLPCON_SLPSTOPB_MASK 0x000000F0
+#define _DAC2SLPCON_SLPSTOPA_POSITION 0x00000008
+#define _DAC2SLPCON_SLPSTOPA_MASK 0x00000F00
+#define _DAC2SLPCON_HCFSEL_POSITION 0x0000000C
+#define _DAC2SLPCON_HCFSEL_MASK 0x0000F000
+#define _DAC2SLPCON_PSE_POSITION 0x00000010
+#define _DAC2SLPCON_PSE_MASK 0x00010000
+#define _DAC2SLPCON_TWME_POSITION 0x00000011
+#define _DAC2SLPCON_TWME_MASK 0x00020000
+#define _DAC2SLPCON_HME_POSITION 0x00000012
+#define _DAC2SLPCON_HME_MASK 0x00040000
+#define _DAC2SLPCON_SLOPEN_POSITION 0x00000013
+#define _DAC2SLPCON_SLOPEN_MASK 0x00080000
+#define _DAC3CON_TMCB_POSITION 0x00000000
+#define _DAC3CON_TMCB_MASK 0x000003FF
+#define _DAC3CON_DACOEN_POSITION 0x0000000C
+#define _DAC3CON_DACOEN_MASK 0x00001000
+#define _DAC3CON_IRQM_POSITION 0x0000000D
+#define _DAC3CON_IRQM_MASK 0x00006000
+#define _DAC3CON_DACEN_POSITION 0x0000000F
+#define _DAC3CON_DACEN_MASK 0x00008000
+#define _DAC3DAT_DACDAT_POSITION 0x00000000
+#define _DAC3DAT_DACDAT_MASK 0x0000FFFF
+#define _DAC3DAT_DACLOW_POSITION 0x00000010
+#define _DAC3DAT_DACLOW_MASK 0xFFFF0000
+#define _DAC3CMP_INNSEL_POSITION 0x00000000
+#define _DAC3CMP_INNSEL_MASK 0x00000007
+#define _DAC3CMP_INPSEL_POSITION 0x00000004
+#define _DAC3CMP_INPSEL_MASK 0x00000070
+#define _DAC3CMP_HYSSEL_POSITION 0x00000008
+#define _DAC3CMP_HYSSEL_MASK 0x00000300
+#define _DAC3CMP_HYSPOL_POSITION 0x0000000A
+#define _DAC3CMP_HYSPOL_MASK 0x00000400
+#define _DAC3CMP_CMPPOL_POSITION 0x0000000B
+#define _DAC3CMP_CMPPOL_MASK 0x00000800
+#define _DAC3CMP_CMPSTAT_POSITION 0x0000000C
+#define _DAC3CMP_CMPSTAT_MASK 0x00001000
+#define _DAC3CMP_CBE_POSITION 0x0000000D
+#define _DAC3CMP_CBE_MASK 0x00002000
+#define _DAC3CMP_FLTREN_POSITION 0x0000000E
+#define _DAC3CMP_FLTREN_MASK 0x00004000
+#define _DAC3SLPCON_SLPSTRT_POSITION 0x00000000
+#define _DAC3SLPCON_SLPSTRT_MASK 0x0000000F
+#define _DAC3SLPCON_SLPSTOPB_POSITION 0x00000004
+#define _DAC3SLPCON_SLPSTOPB_MASK 0x000000F0
+#define _DAC3SLPCON_SLPSTOPA_POSITION 0x00000008
+#define _DAC3SLPCON_SLPSTOPA_MASK 0x00000F00
+#define _DAC3SLPCON_HCFSEL_POSITION 0x0000000C
+#define _DAC3SLPCON_HCFSEL_MASK 0x0000F000
+#define _DAC3SLPCON_PSE_POSITION 0x00000010
+#define _DAC3SLPCON_PSE_MASK 0x00010000
+#define _DAC3SLPCON_TWME_POSITION 0x00000011
+#define _DAC3SLPCON_TWME_MASK 0x00020000
+#define _DAC3SLPCON_HME_POSITION 0x00000012
+#define _DAC3SLPCON_HME_MASK 0x00040000
+#define _DAC3SLPCON_SLOPEN_POSITION 0x00000013
+#define _DAC3SLPCON_SLOPEN_MASK 0x00080000
+#define _U1CON_MODE_POSITION 0x00000000
+#define _U1CON_MODE_MASK 0x0000000F
+#define _U1CON_RXEN_POSITION 0x00000004
+#define _U1CON_RXEN_MASK 0x00000010
+#define _U1CON_TXEN_POSITION 0x00000005
+#define _U1CON_TXEN_MASK 0x00000020
+#define _U1CON_ABDEN_POSITION 0x00000006
+#define _U1CON_ABDEN_MASK 0x00000040
+#define _U1CON_BRGS_POSITION 0x00000007
+#define _U1CON_BRGS_MASK 0x00000080
+#define _U1CON_SENDB_POSITION 0x00000008
+#define _U1CON_SENDB_MASK 0x00000100
+#define _U1CON_BRKOVR_POSITION 0x00000009
+#define _U1CON_BRKOVR_MASK 0x00000200
+#define _U1CON_RXBIMD_POSITION 0x0000000A
+#define _U1CON_RXBIMD_MASK 0x00000400
+#define _U1CON_WUE_POSITION 0x0000000B
+#define _U1CON_WUE_MASK 0x00000800
+#define _U1CON_SIDL_POSITION 0x0000000D
+#define _U1CON_SIDL_MASK 0x00002000
+#define _U1CON_ON_POSITION 0x0000000F
+#define _U1CON_ON_MASK 0x00008000
+#define _U1CON_FLO_POSITION 0x00000010
+#define _U1CON_FLO_MASK 0x00030000
+#define _U1CON_TXPOL_POSITION 0x00000012
+#define _U1CON_TXPOL_MASK 0x00040000
+#define _U1CON_C0EN_POSITION 0x00000013
+#define _U1CON_C0EN_MASK 0x00080000
+#define _U1CON_STP_POSITION 0x00000014
+#define _U1CON_STP_MASK 0x00300000
+#define _U1CON_RXPOL_POSITION 0x00000016
+#define _U1CON_RXPOL_MASK 0x00400000
+#define _U1CON_RUNOVF_POSITION 0x00000017
+#define _U1CON_RUNOVF_MASK 0x00800000
+#define _U1CON_HALFDPLX_POSITION 0x00000018
+#define _U1CON_HALFDPLX_MASK 0x01000000
+#define _U1CON_CLKSEL_POSITION 0x00000019
+#define _U1CON_CLKSEL_MASK 0x06000000
+#define _U1CON_ACTIVE_POSITION 0x0000001C
+#define _U1CON_ACTIVE_MASK 0x10000000
+#define _U1CON_SLPEN_POSITION 0x0000001D
+#define _U1CON_SLPEN_MASK 0x20000000
+#define _U1STAT_RXFOIF_POSITION 0x00000000
+#define _U1STAT_RXFOIF_MASK 0x00000001
+#define _U1STAT_RXBKIF_POSITION 0x00000001
+#define _U1STAT_RXBKIF_MASK 0x00000002
+#define _U1STAT_FERIF_POSITION 0x00000002
+#define _U1STAT_FERIF_MASK 0x00000004
+#define _U1STAT_CERIF_POSITION 0x00000003
+#define _U1STAT_CERIF_MASK 0x00000008
+#define _U1STAT_ABDOVIF_POSITION 0x00000004
+#define _U1STAT_ABDOVIF_MASK 0x00000010
+#define _U1STAT_PERIF_POSITION 0x00000005
+#define _U1STAT_PERIF_MASK 0x00000020
+#define _U1STAT_TXCIF_POSITION 0x00000006
+#define _U1STAT_TXCIF_MASK 0x00000040
+#define _U1STAT_TRMT_POSITION 0x00000007
+#define _U1STAT_TRMT_MASK 0x00000080
+#define _U1STAT_RXFOIE_POSITION 0x00000008
+#define _U1STAT_RXFOIE_MASK 0x00000100
+#define _U1STAT_RXBKIE_POSITION 0x00000009
+#define _U1STAT_RXBKIE_MASK 0x00000200
+#define _U1STAT_FERIE_POSITION 0x0000000A
+#define _U1STAT_FERIE_MASK 0x00000400
+#define _U1STAT_CERIE_POSITION 0x0000000B
+#define _U1STAT_CERIE_MASK 0x00000800
+#define _U1STAT_ABDOVIE_POSITION 0x0000000C
+#define _U1STAT_ABDOVIE_MASK 0x00001000
+#define _U1STAT_PERIE_POSITION 0x0000000D
+#define _U1STAT_PERIE_MASK 0x00002000
+#define _U1STAT_TXCIE_POSITION 0x0000000E
+#define _U1STAT_TXCIE_MASK 0x00004000
+#define _U1STAT_TXMTIE_POSITION 0x0000000F
+#define _U1STAT_TXMTIE_MASK 0x00008000
+#define _U1STAT_RXBF_POSITION 0x00000010
+#define _U1STAT_RXBF_MASK 0x00010000
+#define _U1STAT_RXBE_POSITION 0x00000011
+#define _U1STAT_RXBE_MASK 0x00020000
+#define _U1STAT_XON_POSITION 0x00000013
+#define _U1STAT_XON_MASK 0x00080000
+#define _U1STAT_RCIDL_POSITION 0x00000014
+#define _U1STAT_RCIDL_MASK 0x00100000
+#define _U1STAT_TXBF_POSITION 0x00000015
+#define _U1STAT_TXBF_MASK 0x00200000
+#define _U1STAT_TXBE_POSITION 0x00000016
+#define _U1STAT_TXBE_MASK 0x00400000
+#define _U1STAT_STPMD_POSITION 0x00000017
+#define _U1STAT_STPMD_MASK 0x00800000
+#define _U1STAT_TXWRE_POSITION 0x00000018
+#define _U1STAT_TXWRE_MASK 0x01000000
+#define _U1STAT_RXWM_POSITION 0x00000019
+#define _U1STAT_RXWM_MASK 0x0E000000
+#define _U1STAT_TXWM_POSITION 0x0000001C
+#define _U1STAT_TXWM_MASK 0x70000000
+#define _U1RXB_RXB_POSITION 0x00000000
+#define _U1RXB_RXB_MASK 0x000000FF
+#define _U1TXB_TXB_POSITION 0x00000000
+#define _U1TXB_TXB_MASK 0x000000FF
+#define _U1TXB_LAST_POSITION 0x0000000F
+#define _U1TXB_LAST_MASK 0x00008000
+#define _U1UIR_ABDIE_POSITION 0x00000002
+#define _U1UIR_ABDIE_MASK 0x00000004
+#define _U1UIR_ABDIF_POSITION 0x00000006
+#define _U1UIR_ABDIF_MASK 0x00000040
+#define _U1UIR_WUIF_POSITION 0x00000007
+#define _U1UIR_WUIF_MASK 0x00000080
+#define _T1CON_TCS_POSITION 0x00000001
+#define _T1CON_TCS_MASK 0x00000002
+#define _T1CON_TSYNC_POSITION 0x00000002
+#define _T1CON_TSYNC_MASK 0x00000004
+#define _T1CON_TCKPS_POSITION 0x00000004
+#define _T1CON_TCKPS_MASK 0x00000030
+#define _T1CON_TGATE_POSITION 0x00000007
+#define _T1CON_TGATE_MASK 0x00000080
+#define _T1CON_TECS_POSITION 0x00000008
+#define _T1CON_TECS_MASK 0x00000300
+#define _T1CON_PRWIP_POSITION 0x0000000A
+#define _T1CON_PRWIP_MASK 0x00000400
+#define _T1CON_TMWIP_POSITION 0x0000000B
+#define _T1CON_TMWIP_MASK 0x00000800
+#define _T1CON_TMWDIS_POSITION 0x0000000C
+#define _T1CON_TMWDIS_MASK 0x00001000
+#define _T1CON_SIDL_POSITION 0x0000000D
+#define _T1CON_SIDL_MASK 0x00002000
+#define _T1CON_ON_POSITION 0x0000000F
+#define _T1CON_ON_MASK 0x00008000
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="SPECIAL FUNCTION REGISTERS ">
+
+#define PCLKCON                  HOST_SFR(PCLKCON)
+#define PCLKCONbits              HOST_SFRBITS(HOST_PCLKCON_BITS_T, PCLKCON)
+#define FSCL                     HOST_SFR(FSCL)
+#define FSMINPER                 HOST_SFR(FSMINPER)
+#define MPHASE                   HOST_SFR(MPHASE)
+#define MDC                      HOST_SFR(MDC)
+#define MPER                     HOST_SFR(MPER)
+#define LFSR                     HOST_SFR(LFSR)
+#define CMBTRIG                  HOST_SFR(CMBTRIG)
+#define LOGCONA                  HOST_SFR(LOGCONA)
+#define LOGCONB                  HOST_SFR(LOGCONB)
+#define LOGCONC                  HOST_SFR(LOGCONC)
+#define LOGCOND                  HOST_SFR(LOGCOND)
+#define LOGCONE                  HOST_SFR(LOGCONE)
+#define LOGCONF                  HOST_SFR(LOGCONF)
+#define PWMEVTA                  HOST_SFR(PWMEVTA)
+#define PWMEVTAbits              HOST_SFRBITS(HOST_PWMEVTA_BITS_T, PWMEVTA)
+#define PWMEVTB                  HOST_SFR(PWMEVTB)
+#define PWMEVTBbits              HOST_SFRBITS(HOST_PWMEVTB_BITS_T, PWMEVTB)
+#define PWMEVTC                  HOST_SFR(PWMEVTC)
+#define PWMEVTCbits              HOST_SFRBITS(HOST_PWMEVTC_BITS_T, PWMEVTC)
+#define PWMEVTD                  HOST_SFR(PWMEVTD)
+#define PWMEVTDbits              HOST_SFRBITS(HOST_PWMEVTD_BITS_T, PWMEVTD)
+#define PWMEVTE                  HOST_SFR(PWMEVTE)
+#define PWMEVTEbits              HOST_SFRBITS(HOST_PWMEVTE_BITS_T, PWMEVTE)
+#define PWMEVTF                  HOST_SFR(PWMEVTF)
+#define PWMEVTFbits              HOST_SFRBITS(HOST_PWMEVTF_BITS_T, PWMEVTF)
+#define APWMEVTA                 HOST_SFR(APWMEVTA)
+#define PG1CON                   HOST_SFR(PG1CON)
+#define PG1CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG1CON)
+#define PG1STAT                  HOST_SFR(PG1STAT)
+#define PG1STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG1STAT)
+#define PG1IOCON1                HOST_SFR(PG1IOCON1)
+#define PG1IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG1IOCON1)
+#define PG1IOCON2                HOST_SFR(PG1IOCON2)
+#define PG1IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG1IOCON2)
+#define PG1EVT1                  HOST_SFR(PG1EVT1)
+#define PG1EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG1EVT1)
+#define PG1EVT2                  HOST_SFR(PG1EVT2)
+#define PG1EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG1EVT2)
+#define PG1FPCI1                 HOST_SFR(PG1FPCI1)
+#define PG1FPCI2                 HOST_SFR(PG1FPCI2)
+#define PG1CLPCI1                HOST_SFR(PG1CLPCI1)
+#define PG1CLPCI2                HOST_SFR(PG1CLPCI2)
+#define PG1FFPCI1                HOST_SFR(PG1FFPCI1)
+#define PG1FFPCI2                HOST_SFR(PG1FFPCI2)
+#define PG1SPCI1                 HOST_SFR(PG1SPCI1)
+#define PG1SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG1SPCI1)
+#define PG1SPCI2                 HOST_SFR(PG1SPCI2)
+#define PG1LEB                   HOST_SFR(PG1LEB)
+#define PG1PHASE                 HOST_SFR(PG1PHASE)
+#define PG1DC                    HOST_SFR(PG1DC)
+#define PG1DCA                   HOST_SFR(PG1DCA)
+#define PG1PER                   HOST_SFR(PG1PER)
+#define PG1TRIGA                 HOST_SFR(PG1TRIGA)
+#define PG1TRIGB                 HOST_SFR(PG1TRIGB)
+#define PG1TRIGC                 HOST_SFR(PG1TRIGC)
+#define PG1DT                    HOST_SFR(PG1DT)
+#define PG1DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG1DT)
+#define PG1CAP                   HOST_SFR(PG1CAP)
+#define PG2CON                   HOST_SFR(PG2CON)
+#define PG2CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG2CON)
+#define PG2STAT                  HOST_SFR(PG2STAT)
+#define PG2STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG2STAT)
+#define PG2IOCON1                HOST_SFR(PG2IOCON1)
+#define PG2IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG2IOCON1)
+#define PG2IOCON2                HOST_SFR(PG2IOCON2)
+#define PG2IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG2IOCON2)
+#define PG2EVT1                  HOST_SFR(PG2EVT1)
+#define PG2EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG2EVT1)
+#define PG2EVT2                  HOST_SFR(PG2EVT2)
+#define PG2EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG2EVT2)
+#define PG2FPCI1                 HOST_SFR(PG2FPCI1)
+#define PG2FPCI2                 HOST_SFR(PG2FPCI2)
+#define PG2CLPCI1                HOST_SFR(PG2CLPCI1)
+#define PG2CLPCI2                HOST_SFR(PG2CLPCI2)
+#define PG2FFPCI1                HOST_SFR(PG2FFPCI1)
+#define PG2FFPCI2                HOST_SFR(PG2FFPCI2)
+#define PG2SPCI1                 HOST_SFR(PG2SPCI1)
+#define PG2SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG2SPCI1)
+#define PG2SPCI2                 HOST_SFR(PG2SPCI2)
+#define PG2LEB                   HOST_SFR(PG2LEB)
+#define PG2PHASE                 HOST_SFR(PG2PHASE)
+#define PG2DC                    HOST_SFR(PG2DC)
+#define PG2DCA                   HOST_SFR(PG2DCA)
+#define PG2PER                   HOST_SFR(PG2PER)
+#define PG2TRIGA                 HOST_SFR(PG2TRIGA)
+#define PG2TRIGB                 HOST_SFR(PG2TRIGB)
+#define PG2TRIGC                 HOST_SFR(PG2TRIGC)
+#define PG2DT                    HOST_SFR(PG2DT)
+#define PG2DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG2DT)
+#define PG2CAP                   HOST_SFR(PG2CAP)
+#define PG3CON                   HOST_SFR(PG3CON)
+#define PG3CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG3CON)
+#define PG3STAT                  HOST_SFR(PG3STAT)
+#define PG3STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG3STAT)
+#define PG3IOCON1                HOST_SFR(PG3IOCON1)
+#define PG3IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG3IOCON1)
+#define PG3IOCON2                HOST_SFR(PG3IOCON2)
+#define PG3IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG3IOCON2)
+#define PG3EVT1                  HOST_SFR(PG3EVT1)
+#define PG3EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG3EVT1)
+#define PG3EVT2                  HOST_SFR(PG3EVT2)
+#define PG3EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG3EVT2)
+#define PG3FPCI1                 HOST_SFR(PG3FPCI1)
+#define PG3FPCI2                 HOST_SFR(PG3FPCI2)
+#define PG3CLPCI1                HOST_SFR(PG3CLPCI1)
+#define PG3CLPCI2                HOST_SFR(PG3CLPCI2)
+#define PG3FFPCI1                HOST_SFR(PG3FFPCI1)
+#define PG3FFPCI2                HOST_SFR(PG3FFPCI2)
+#define PG3SPCI1                 HOST_SFR(PG3SPCI1)
+#define PG3SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG3SPCI1)
+#define PG3SPCI2                 HOST_SFR(PG3SPCI2)
+#define PG3LEB                   HOST_SFR(PG3LEB)
+#define PG3PHASE                 HOST_SFR(PG3PHASE)
+#define PG3DC                    HOST_SFR(PG3DC)
+#define PG3DCA                   HOST_SFR(PG3DCA)
+#define PG3PER                   HOST_SFR(PG3PER)
+#define PG3TRIGA                 HOST_SFR(PG3TRIGA)
+#define PG3TRIGB                 HOST_SFR(PG3TRIGB)
+#define PG3TRIGC                 HOST_SFR(PG3TRIGC)
+#define PG3DT                    HOST_SFR(PG3DT)
+#define PG3DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG3DT)
+#define PG3CAP                   HOST_SFR(PG3CAP)
+#define PG4CON                   HOST_SFR(PG4CON)
+#define PG4CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG4CON)
+#define PG4STAT                  HOST_SFR(PG4STAT)
+#define PG4STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG4STAT)
+#define PG4IOCON1                HOST_SFR(PG4IOCON1)
+#define PG4IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG4IOCON1)
+#define PG4IOCON2                HOST_SFR(PG4IOCON2)
+#define PG4IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG4IOCON2)
+#define PG4EVT1                  HOST_SFR(PG4EVT1)
+#define PG4EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG4EVT1)
+#define PG4EVT2                  HOST_SFR(PG4EVT2)
+#define PG4EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG4EVT2)
+#define PG4FPCI1                 HOST_SFR(PG4FPCI1)
+#define PG4FPCI2                 HOST_SFR(PG4FPCI2)
+#define PG4CLPCI1                HOST_SFR(PG4CLPCI1)
+#define PG4CLPCI2                HOST_SFR(PG4CLPCI2)
+#define PG4FFPCI1                HOST_SFR(PG4FFPCI1)
+#define PG4FFPCI2                HOST_SFR(PG4FFPCI2)
+#define PG4SPCI1                 HOST_SFR(PG4SPCI1)
+#define PG4SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG4SPCI1)
+#define PG4SPCI2                 HOST_SFR(PG4SPCI2)
+#define PG4LEB                   HOST_SFR(PG4LEB)
+#define PG4PHASE                 HOST_SFR(PG4PHASE)
+#define PG4DC                    HOST_SFR(PG4DC)
+#define PG4DCA                   HOST_SFR(PG4DCA)
+#define PG4PER                   HOST_SFR(PG4PER)
+#define PG4TRIGA                 HOST_SFR(PG4TRIGA)
+#define PG4TRIGB                 HOST_SFR(PG4TRIGB)
+#define PG4TRIGC                 HOST_SFR(PG4TRIGC)
+#define PG4DT                    HOST_SFR(PG4DT)
+#define PG4DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG4DT)
+#define PG4CAP                   HOST_SFR(PG4CAP)
+#define PG5CON                   HOST_SFR(PG5CON)
+#define PG5CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG5CON)
+#define PG5STAT                  HOST_SFR(PG5STAT)
+#define PG5STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG5STAT)
+#define PG5IOCON1                HOST_SFR(PG5IOCON1)
+#define PG5IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG5IOCON1)
+#define PG5IOCON2                HOST_SFR(PG5IOCON2)
+#define PG5IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG5IOCON2)
+#define PG5EVT1                  HOST_SFR(PG5EVT1)
+#define PG5EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG5EVT1)
+#define PG5EVT2                  HOST_SFR(PG5EVT2)
+#define PG5EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG5EVT2)
+#define PG5FPCI1                 HOST_SFR(PG5FPCI1)
+#define PG5FPCI2                 HOST_SFR(PG5FPCI2)
+#define PG5CLPCI1                HOST_SFR(PG5CLPCI1)
+#define PG5CLPCI2                HOST_SFR(PG5CLPCI2)
+#define PG5FFPCI1                HOST_SFR(PG5FFPCI1)
+#define PG5FFPCI2                HOST_SFR(PG5FFPCI2)
+#define PG5SPCI1                 HOST_SFR(PG5SPCI1)
+#define PG5SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG5SPCI1)
+#define PG5SPCI2                 HOST_SFR(PG5SPCI2)
+#define PG5LEB                   HOST_SFR(PG5LEB)
+#define PG5PHASE                 HOST_SFR(PG5PHASE)
+#define PG5DC                    HOST_SFR(PG5DC)
+#define PG5DCA                   HOST_SFR(PG5DCA)
+#define PG5PER                   HOST_SFR(PG5PER)
+#define PG5TRIGA                 HOST_SFR(PG5TRIGA)
+#define PG5TRIGB                 HOST_SFR(PG5TRIGB)
+#define PG5TRIGC                 HOST_SFR(PG5TRIGC)
+#define PG5DT                    HOST_SFR(PG5DT)
+#define PG5DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG5DT)
+#define PG5CAP                   HOST_SFR(PG5CAP)
+#define PG6CON                   HOST_SFR(PG6CON)
+#define PG6CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG6CON)
+#define PG6STAT                  HOST_SFR(PG6STAT)
+#define PG6STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG6STAT)
+#define PG6IOCON1                HOST_SFR(PG6IOCON1)
+#define PG6IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG6IOCON1)
+#define PG6IOCON2                HOST_SFR(PG6IOCON2)
+#define PG6IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG6IOCON2)
+#define PG6EVT1                  HOST_SFR(PG6EVT1)
+#define PG6EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG6EVT1)
+#define PG6EVT2                  HOST_SFR(PG6EVT2)
+#define PG6EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG6EVT2)
+#define PG6FPCI1                 HOST_SFR(PG6FPCI1)
+#define PG6FPCI2                 HOST_SFR(PG6FPCI2)
+#define PG6CLPCI1                HOST_SFR(PG6CLPCI1)
+#define PG6CLPCI2                HOST_SFR(PG6CLPCI2)
+#define PG6FFPCI1                HOST_SFR(PG6FFPCI1)
+#define PG6FFPCI2                HOST_SFR(PG6FFPCI2)
+#define PG6SPCI1                 HOST_SFR(PG6SPCI1)
+#define PG6SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG6SPCI1)
+#define PG6SPCI2                 HOST_SFR(PG6SPCI2)
+#define PG6LEB                   HOST_SFR(PG6LEB)
+#define PG6PHASE                 HOST_SFR(PG6PHASE)
+#define PG6DC                    HOST_SFR(PG6DC)
+#define PG6DCA                   HOST_SFR(PG6DCA)
+#define PG6PER                   HOST_SFR(PG6PER)
+#define PG6TRIGA                 HOST_SFR(PG6TRIGA)
+#define PG6TRIGB                 HOST_SFR(PG6TRIGB)
+#define PG6TRIGC                 HOST_SFR(PG6TRIGC)
+#define PG6DT                    HOST_SFR(PG6DT)
+#define PG6DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG6DT)
+#define PG6CAP                   HOST_SFR(PG6CAP)
+#define PG7CON                   HOST_SFR(PG7CON)
+#define PG7CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG7CON)
+#define PG7STAT                  HOST_SFR(PG7STAT)
+#define PG7STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG7STAT)
+#define PG7IOCON1                HOST_SFR(PG7IOCON1)
+#define PG7IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG7IOCON1)
+#define PG7IOCON2                HOST_SFR(PG7IOCON2)
+#define PG7IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG7IOCON2)
+#define PG7EVT1                  HOST_SFR(PG7EVT1)
+#define PG7EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG7EVT1)
+#define PG7EVT2                  HOST_SFR(PG7EVT2)
+#define PG7EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG7EVT2)
+#define PG7FPCI1                 HOST_SFR(PG7FPCI1)
+#define PG7FPCI2                 HOST_SFR(PG7FPCI2)
+#define PG7CLPCI1                HOST_SFR(PG7CLPCI1)
+#define PG7CLPCI2                HOST_SFR(PG7CLPCI2)
+#define PG7FFPCI1                HOST_SFR(PG7FFPCI1)
+#define PG7FFPCI2                HOST_SFR(PG7FFPCI2)
+#define PG7SPCI1                 HOST_SFR(PG7SPCI1)
+#define PG7SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG7SPCI1)
+#define PG7SPCI2                 HOST_SFR(PG7SPCI2)
+#define PG7LEB                   HOST_SFR(PG7LEB)
+#define PG7PHASE                 HOST_SFR(PG7PHASE)
+#define PG7DC                    HOST_SFR(PG7DC)
+#define PG7DCA                   HOST_SFR(PG7DCA)
+#define PG7PER                   HOST_SFR(PG7PER)
+#define PG7TRIGA                 HOST_SFR(PG7TRIGA)
+#define PG7TRIGB                 HOST_SFR(PG7TRIGB)
+#define PG7TRIGC                 HOST_SFR(PG7TRIGC)
+#define PG7DT                    HOST_SFR(PG7DT)
+#define PG7DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG7DT)
+#define PG7CAP                   HOST_SFR(PG7CAP)
+#define PG8CON                   HOST_SFR(PG8CON)
+#define PG8CONbits               HOST_SFRBITS(HOST_PGCON_BITS_T, PG8CON)
+#define PG8STAT                  HOST_SFR(PG8STAT)
+#define PG8STATbits              HOST_SFRBITS(HOST_PGSTAT_BITS_T, PG8STAT)
+#define PG8IOCON1                HOST_SFR(PG8IOCON1)
+#define PG8IOCON1bits            HOST_SFRBITS(HOST_PGIOCON1_BITS_T, PG8IOCON1)
+#define PG8IOCON2                HOST_SFR(PG8IOCON2)
+#define PG8IOCON2bits            HOST_SFRBITS(HOST_PGIOCON2_BITS_T, PG8IOCON2)
+#define PG8EVT1                  HOST_SFR(PG8EVT1)
+#define PG8EVT1bits              HOST_SFRBITS(HOST_PGEVT1_BITS_T, PG8EVT1)
+#define PG8EVT2                  HOST_SFR(PG8EVT2)
+#define PG8EVT2bits              HOST_SFRBITS(HOST_PGEVT2_BITS_T, PG8EVT2)
+#define PG8FPCI1                 HOST_SFR(PG8FPCI1)
+#define PG8FPCI2                 HOST_SFR(PG8FPCI2)
+#define PG8CLPCI1                HOST_SFR(PG8CLPCI1)
+#define PG8CLPCI2                HOST_SFR(PG8CLPCI2)
+#define PG8FFPCI1                HOST_SFR(PG8FFPCI1)
+#define PG8FFPCI2                HOST_SFR(PG8FFPCI2)
+#define PG8SPCI1                 HOST_SFR(PG8SPCI1)
+#define PG8SPCI1bits             HOST_SFRBITS(HOST_PGSPCI1_BITS_T, PG8SPCI1)
+#define PG8SPCI2                 HOST_SFR(PG8SPCI2)
+#define PG8LEB                   HOST_SFR(PG8LEB)
+#define PG8PHASE                 HOST_SFR(PG8PHASE)
+#define PG8DC                    HOST_SFR(PG8DC)
+#define PG8DCA                   HOST_SFR(PG8DCA)
+#define PG8PER                   HOST_SFR(PG8PER)
+#define PG8TRIGA                 HOST_SFR(PG8TRIGA)
+#define PG8TRIGB                 HOST_SFR(PG8TRIGB)
+#define PG8TRIGC                 HOST_SFR(PG8TRIGC)
+#define PG8DT                    HOST_SFR(PG8DT)
+#define PG8DTbits                HOST_SFRBITS(HOST_PGDT_BITS_T, PG8DT)
+#define PG8CAP                   HOST_SFR(PG8CAP)
+#define APG1CON                  HOST_SFR(APG1CON)
+#define APG1CONbits              HOST_SFRBITS(HOST_PGCON_BITS_T, APG1CON)
+#define APG1STAT                 HOST_SFR(APG1STAT)
+#define APG1STATbits             HOST_SFRBITS(HOST_PGSTAT_BITS_T, APG1STAT)
+#define APG1IOCON1               HOST_SFR(APG1IOCON1)
+#define APG1IOCON1bits           HOST_SFRBITS(HOST_PGIOCON1_BITS_T, APG1IOCON1)
+#define APG1IOCON2               HOST_SFR(APG1IOCON2)
+#define APG1IOCON2bits           HOST_SFRBITS(HOST_PGIOCON2_BITS_T, APG1IOCON2)
+#define APG1EVT1                 HOST_SFR(APG1EVT1)
+#define APG1EVT1bits             HOST_SFRBITS(HOST_PGEVT1_BITS_T, APG1EVT1)
+#define APG1EVT2                 HOST_SFR(APG1EVT2)
+#define APG1EVT2bits             HOST_SFRBITS(HOST_PGEVT2_BITS_T, APG1EVT2)
+#define APG1FPCI1                HOST_SFR(APG1FPCI1)
+#define APG1FPCI2                HOST_SFR(APG1FPCI2)
+#define APG1CLPCI1               HOST_SFR(APG1CLPCI1)
+#define APG1CLPCI2               HOST_SFR(APG1CLPCI2)
+#define APG1FFPCI1               HOST_SFR(APG1FFPCI1)
+#define APG1FFPCI2               HOST_SFR(APG1FFPCI2)
+#define APG1SPCI1                HOST_SFR(APG1SPCI1)
+#define APG1SPCI1bits            HOST_SFRBITS(HOST_PGSPCI1_BITS_T, APG1SPCI1)
+#define APG1SPCI2                HOST_SFR(APG1SPCI2)
+#define APG1LEB                  HOST_SFR(APG1LEB)
+#define APG1PHASE                HOST_SFR(APG1PHASE)
+#define APG1DC                   HOST_SFR(APG1DC)
+#define APG1DCA                  HOST_SFR(APG1DCA)
+#define APG1PER                  HOST_SFR(APG1PER)
+#define APG1TRIGA                HOST_SFR(APG1TRIGA)
+#define APG1TRIGB                HOST_SFR(APG1TRIGB)
+#define APG1TRIGC                HOST_SFR(APG1TRIGC)
+#define APG1DT                   HOST_SFR(APG1DT)
+#define APG1DTbits               HOST_SFRBITS(HOST_PGDT_BITS_T, APG1DT)
+#define APG1CAP                  HOST_SFR(APG1CAP)
+#define APG2CON                  HOST_SFR(APG2CON)
+#define APG2CONbits              HOST_SFRBITS(HOST_PGCON_BITS_T, APG2CON)
+#define APG2STAT                 HOST_SFR(APG2STAT)
+#define APG2STATbits             HOST_SFRBITS(HOST_PGSTAT_BITS_T, APG2STAT)
+#define APG2IOCON1               HOST_SFR(APG2IOCON1)
+#define APG2IOCON1bits           HOST_SFRBITS(HOST_PGIOCON1_BITS_T, APG2IOCON1)
+#define APG2IOCON2               HOST_SFR(APG2IOCON2)
+#define APG2IOCON2bits           HOST_SFRBITS(HOST_PGIOCON2_BITS_T, APG2IOCON2)
+#define APG2EVT1                 HOST_SFR(APG2EVT1)
+#define APG2EVT1bits             HOST_SFRBITS(HOST_PGEVT1_BITS_T, APG2EVT1)
+#define APG2EVT2                 HOST_SFR(APG2EVT2)
+#define APG2EVT2bits             HOST_SFRBITS(HOST_PGEVT2_BITS_T, APG2EVT2)
+#define APG2FPCI1                HOST_SFR(APG2FPCI1)
+#define APG2FPCI2                HOST_SFR(APG2FPCI2)
+#define APG2CLPCI1               HOST_SFR(APG2CLPCI1)
+#define APG2CLPCI2               HOST_SFR(APG2CLPCI2)
+#define APG2FFPCI1               HOST_SFR(APG2FFPCI1)
+#define APG2FFPCI2               HOST_SFR(APG2FFPCI2)
+#define APG2SPCI1                HOST_SFR(APG2SPCI1)
+#define APG2SPCI1bits            HOST_SFRBITS(HOST_PGSPCI1_BITS_T, APG2SPCI1)
+#define APG2SPCI2                HOST_SFR(APG2SPCI2)
+#define APG2LEB                  HOST_SFR(APG2LEB)
+#define APG2PHASE                HOST_SFR(APG2PHASE)
+#define APG2DC                   HOST_SFR(APG2DC)
+#define APG2DCA                  HOST_SFR(APG2DCA)
+#define APG2PER                  HOST_SFR(APG2PER)
+#define APG2TRIGA                HOST_SFR(APG2TRIGA)
+#define APG2TRIGB                HOST_SFR(APG2TRIGB)
+#define APG2TRIGC                HOST_SFR(APG2TRIGC)
+#define APG2DT                   HOST_SFR(APG2DT)
+#define APG2DTbits               HOST_SFRBITS(HOST_PGDT_BITS_T, APG2DT)
+#define APG2CAP                  HOST_SFR(APG2CAP)
+#define APG3CON                  HOST_SFR(APG3CON)
+#define APG3CONbits              HOST_SFRBITS(HOST_PGCON_BITS_T, APG3CON)
+#define APG3STAT                 HOST_SFR(APG3STAT)
+#define APG3STATbits             HOST_SFRBITS(HOST_PGSTAT_BITS_T, APG3STAT)
+#define APG3IOCON1               HOST_SFR(APG3IOCON1)
+#define APG3IOCON1bits           HOST_SFRBITS(HOST_PGIOCON1_BITS_T, APG3IOCON1)
+#define APG3IOCON2               HOST_SFR(APG3IOCON2)
+#define APG3IOCON2bits           HOST_SFRBITS(HOST_PGIOCON2_BITS_T, APG3IOCON2)
+#define APG3EVT1                 HOST_SFR(APG3EVT1)
+#define APG3EVT1bits             HOST_SFRBITS(HOST_PGEVT1_BITS_T, APG3EVT1)
+#define APG3EVT2                 HOST_SFR(APG3EVT2)
+#define APG3EVT2bits             HOST_SFRBITS(HOST_PGEVT2_BITS_T, APG3EVT2)
+#define APG3FPCI1                HOST_SFR(APG3FPCI1)
+#define APG3FPCI2                HOST_SFR(APG3FPCI2)
+#define APG3CLPCI1               HOST_SFR(APG3CLPCI1)
+#define APG3CLPCI2               HOST_SFR(APG3CLPCI2)
+#define APG3FFPCI1               HOST_SFR(APG3FFPCI1)
+#define APG3FFPCI2               HOST_SFR(APG3FFPCI2)
+#define APG3SPCI1                HOST_SFR(APG3SPCI1)
+#define APG3SPCI1bits            HOST_SFRBITS(HOST_PGSPCI1_BITS_T, APG3SPCI1)
+#define APG3SPCI2                HOST_SFR(APG3SPCI2)
+#define APG3LEB                  HOST_SFR(APG3LEB)
+#define APG3PHASE                HOST_SFR(APG3PHASE)
+#define APG3DC                   HOST_SFR(APG3DC)
+#define APG3DCA                  HOST_SFR(APG3DCA)
+#define APG3PER                  HOST_SFR(APG3PER)
+#define APG3TRIGA                HOST_SFR(APG3TRIGA)
+#define APG3TRIGB                HOST_SFR(APG3TRIGB)
+#define APG3TRIGC                HOST_SFR(APG3TRIGC)
+#define APG3DT                   HOST_SFR(APG3DT)
+#define APG3DTbits               HOST_SFRBITS(HOST_PGDT_BITS_T, APG3DT)
+#define APG3CAP                  HOST_SFR(APG3CAP)
+#define OSCCTRL                  HOST_SFR(OSCCTRL)
+#define OSCCTRLbits              HOST_SFRBITS(HOST_OSCCTRL_BITS_T, OSCCTRL)
+#define OSCCFG                   HOST_SFR(OSCCFG)
+#define OSCCFGbits               HOST_SFRBITS(HOST_OSCCFG_BITS_T, OSCCFG)
+#define PLL1CON                  HOST_SFR(PLL1CON)
+#define PLL1CONbits              HOST_SFRBITS(HOST_PLLCON_BITS_T, PLL1CON)
+#define PLL1DIV                  HOST_SFR(PLL1DIV)
+#define PLL1DIVbits              HOST_SFRBITS(HOST_PLLDIV_BITS_T, PLL1DIV)
+#define VCO1DIV                  HOST_SFR(VCO1DIV)
+#define PLL2CON                  HOST_SFR(PLL2CON)
+#define PLL2CONbits              HOST_SFRBITS(HOST_PLLCON_BITS_T, PLL2CON)
+#define PLL2DIV                  HOST_SFR(PLL2DIV)
+#define PLL2DIVbits              HOST_SFRBITS(HOST_PLLDIV_BITS_T, PLL2DIV)
+#define VCO2DIV                  HOST_SFR(VCO2DIV)
+#define CLK1CON                  HOST_SFR(CLK1CON)
+#define CLK1CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK1CON)
+#define CLK1DIV                  HOST_SFR(CLK1DIV)
+#define CLK1DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK1DIV)
+#define CLK2CON                  HOST_SFR(CLK2CON)
+#define CLK2CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK2CON)
+#define CLK2DIV                  HOST_SFR(CLK2DIV)
+#define CLK2DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK2DIV)
+#define CLK3CON                  HOST_SFR(CLK3CON)
+#define CLK3CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK3CON)
+#define CLK3DIV                  HOST_SFR(CLK3DIV)
+#define CLK3DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK3DIV)
+#define CLK4CON                  HOST_SFR(CLK4CON)
+#define CLK4CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK4CON)
+#define CLK4DIV                  HOST_SFR(CLK4DIV)
+#define CLK4DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK4DIV)
+#define CLK5CON                  HOST_SFR(CLK5CON)
+#define CLK5CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK5CON)
+#define CLK5DIV                  HOST_SFR(CLK5DIV)
+#define CLK5DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK5DIV)
+#define CLK6CON                  HOST_SFR(CLK6CON)
+#define CLK6CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK6CON)
+#define CLK6DIV                  HOST_SFR(CLK6DIV)
+#define CLK6DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK6DIV)
+#define CLK7CON                  HOST_SFR(CLK7CON)
+#define CLK7CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK7CON)
+#define CLK7DIV                  HOST_SFR(CLK7DIV)
+#define CLK7DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK7DIV)
+#define CLK8CON                  HOST_SFR(CLK8CON)
+#define CLK8CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK8CON)
+#define CLK8DIV                  HOST_SFR(CLK8DIV)
+#define CLK8DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK8DIV)
+#define CLK9CON                  HOST_SFR(CLK9CON)
+#define CLK9CONbits              HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK9CON)
+#define CLK9DIV                  HOST_SFR(CLK9DIV)
+#define CLK9DIVbits              HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK9DIV)
+#define CLK10CON                 HOST_SFR(CLK10CON)
+#define CLK10CONbits             HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK10CON)
+#define CLK10DIV                 HOST_SFR(CLK10DIV)
+#define CLK10DIVbits             HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK10DIV)
+#define CLK11CON                 HOST_SFR(CLK11CON)
+#define CLK11CONbits             HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK11CON)
+#define CLK11DIV                 HOST_SFR(CLK11DIV)
+#define CLK11DIVbits             HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK11DIV)
+#define CLK12CON                 HOST_SFR(CLK12CON)
+#define CLK12CONbits             HOST_SFRBITS(HOST_CLKCON_BITS_T, CLK12CON)
+#define CLK12DIV                 HOST_SFR(CLK12DIV)
+#define CLK12DIVbits             HOST_SFRBITS(HOST_CLKDIV_BITS_T, CLK12DIV)
+#define AD1CON                   HOST_SFR(AD1CON)
+#define AD1CONbits               HOST_SFRBITS(HOST_ADCON_BITS_T, AD1CON)
+#define AD1CH0CON1               HOST_SFR(AD1CH0CON1)
+#define AD1CH0CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH0CON1)
+#define AD1CH0CON2               HOST_SFR(AD1CH0CON2)
+#define AD1CH0CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH0CON2)
+#define AD1CH0DATA               HOST_SFR(AD1CH0DATA)
+#define AD1CH1CON1               HOST_SFR(AD1CH1CON1)
+#define AD1CH1CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH1CON1)
+#define AD1CH1CON2               HOST_SFR(AD1CH1CON2)
+#define AD1CH1CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH1CON2)
+#define AD1CH1DATA               HOST_SFR(AD1CH1DATA)
+#define AD1CH2CON1               HOST_SFR(AD1CH2CON1)
+#define AD1CH2CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH2CON1)
+#define AD1CH2CON2               HOST_SFR(AD1CH2CON2)
+#define AD1CH2CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH2CON2)
+#define AD1CH2DATA               HOST_SFR(AD1CH2DATA)
+#define AD1CH3CON1               HOST_SFR(AD1CH3CON1)
+#define AD1CH3CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH3CON1)
+#define AD1CH3CON2               HOST_SFR(AD1CH3CON2)
+#define AD1CH3CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH3CON2)
+#define AD1CH3DATA               HOST_SFR(AD1CH3DATA)
+#define AD1CH4CON1               HOST_SFR(AD1CH4CON1)
+#define AD1CH4CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH4CON1)
+#define AD1CH4CON2               HOST_SFR(AD1CH4CON2)
+#define AD1CH4CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH4CON2)
+#define AD1CH4DATA               HOST_SFR(AD1CH4DATA)
+#define AD1CH5CON1               HOST_SFR(AD1CH5CON1)
+#define AD1CH5CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH5CON1)
+#define AD1CH5CON2               HOST_SFR(AD1CH5CON2)
+#define AD1CH5CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH5CON2)
+#define AD1CH5DATA               HOST_SFR(AD1CH5DATA)
+#define AD1CH6CON1               HOST_SFR(AD1CH6CON1)
+#define AD1CH6CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH6CON1)
+#define AD1CH6CON2               HOST_SFR(AD1CH6CON2)
+#define AD1CH6CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH6CON2)
+#define AD1CH6DATA               HOST_SFR(AD1CH6DATA)
+#define AD1CH7CON1               HOST_SFR(AD1CH7CON1)
+#define AD1CH7CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD1CH7CON1)
+#define AD1CH7CON2               HOST_SFR(AD1CH7CON2)
+#define AD1CH7CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD1CH7CON2)
+#define AD1CH7DATA               HOST_SFR(AD1CH7DATA)
+#define AD2CON                   HOST_SFR(AD2CON)
+#define AD2CONbits               HOST_SFRBITS(HOST_ADCON_BITS_T, AD2CON)
+#define AD2CH0CON1               HOST_SFR(AD2CH0CON1)
+#define AD2CH0CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH0CON1)
+#define AD2CH0CON2               HOST_SFR(AD2CH0CON2)
+#define AD2CH0CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH0CON2)
+#define AD2CH0DATA               HOST_SFR(AD2CH0DATA)
+#define AD2CH1CON1               HOST_SFR(AD2CH1CON1)
+#define AD2CH1CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH1CON1)
+#define AD2CH1CON2               HOST_SFR(AD2CH1CON2)
+#define AD2CH1CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH1CON2)
+#define AD2CH1DATA               HOST_SFR(AD2CH1DATA)
+#define AD2CH2CON1               HOST_SFR(AD2CH2CON1)
+#define AD2CH2CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH2CON1)
+#define AD2CH2CON2               HOST_SFR(AD2CH2CON2)
+#define AD2CH2CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH2CON2)
+#define AD2CH2DATA               HOST_SFR(AD2CH2DATA)
+#define AD2CH3CON1               HOST_SFR(AD2CH3CON1)
+#define AD2CH3CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH3CON1)
+#define AD2CH3CON2               HOST_SFR(AD2CH3CON2)
+#define AD2CH3CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH3CON2)
+#define AD2CH3DATA               HOST_SFR(AD2CH3DATA)
+#define AD2CH4CON1               HOST_SFR(AD2CH4CON1)
+#define AD2CH4CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH4CON1)
+#define AD2CH4CON2               HOST_SFR(AD2CH4CON2)
+#define AD2CH4CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH4CON2)
+#define AD2CH4DATA               HOST_SFR(AD2CH4DATA)
+#define AD2CH5CON1               HOST_SFR(AD2CH5CON1)
+#define AD2CH5CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH5CON1)
+#define AD2CH5CON2               HOST_SFR(AD2CH5CON2)
+#define AD2CH5CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH5CON2)
+#define AD2CH5DATA               HOST_SFR(AD2CH5DATA)
+#define AD2CH6CON1               HOST_SFR(AD2CH6CON1)
+#define AD2CH6CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH6CON1)
+#define AD2CH6CON2               HOST_SFR(AD2CH6CON2)
+#define AD2CH6CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH6CON2)
+#define AD2CH6DATA               HOST_SFR(AD2CH6DATA)
+#define AD2CH7CON1               HOST_SFR(AD2CH7CON1)
+#define AD2CH7CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD2CH7CON1)
+#define AD2CH7CON2               HOST_SFR(AD2CH7CON2)
+#define AD2CH7CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD2CH7CON2)
+#define AD2CH7DATA               HOST_SFR(AD2CH7DATA)
+#define AD3CON                   HOST_SFR(AD3CON)
+#define AD3CONbits               HOST_SFRBITS(HOST_ADCON_BITS_T, AD3CON)
+#define AD3CH0CON1               HOST_SFR(AD3CH0CON1)
+#define AD3CH0CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH0CON1)
+#define AD3CH0CON2               HOST_SFR(AD3CH0CON2)
+#define AD3CH0CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH0CON2)
+#define AD3CH0DATA               HOST_SFR(AD3CH0DATA)
+#define AD3CH1CON1               HOST_SFR(AD3CH1CON1)
+#define AD3CH1CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH1CON1)
+#define AD3CH1CON2               HOST_SFR(AD3CH1CON2)
+#define AD3CH1CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH1CON2)
+#define AD3CH1DATA               HOST_SFR(AD3CH1DATA)
+#define AD3CH2CON1               HOST_SFR(AD3CH2CON1)
+#define AD3CH2CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH2CON1)
+#define AD3CH2CON2               HOST_SFR(AD3CH2CON2)
+#define AD3CH2CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH2CON2)
+#define AD3CH2DATA               HOST_SFR(AD3CH2DATA)
+#define AD3CH3CON1               HOST_SFR(AD3CH3CON1)
+#define AD3CH3CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH3CON1)
+#define AD3CH3CON2               HOST_SFR(AD3CH3CON2)
+#define AD3CH3CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH3CON2)
+#define AD3CH3DATA               HOST_SFR(AD3CH3DATA)
+#define AD3CH4CON1               HOST_SFR(AD3CH4CON1)
+#define AD3CH4CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH4CON1)
+#define AD3CH4CON2               HOST_SFR(AD3CH4CON2)
+#define AD3CH4CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH4CON2)
+#define AD3CH4DATA               HOST_SFR(AD3CH4DATA)
+#define AD3CH5CON1               HOST_SFR(AD3CH5CON1)
+#define AD3CH5CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH5CON1)
+#define AD3CH5CON2               HOST_SFR(AD3CH5CON2)
+#define AD3CH5CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH5CON2)
+#define AD3CH5DATA               HOST_SFR(AD3CH5DATA)
+#define AD3CH6CON1               HOST_SFR(AD3CH6CON1)
+#define AD3CH6CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH6CON1)
+#define AD3CH6CON2               HOST_SFR(AD3CH6CON2)
+#define AD3CH6CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH6CON2)
+#define AD3CH6DATA               HOST_SFR(AD3CH6DATA)
+#define AD3CH7CON1               HOST_SFR(AD3CH7CON1)
+#define AD3CH7CON1bits           HOST_SFRBITS(HOST_ADCHCON1_BITS_T, AD3CH7CON1)
+#define AD3CH7CON2               HOST_SFR(AD3CH7CON2)
+#define AD3CH7CON2bits           HOST_SFRBITS(HOST_ADCHCON2_BITS_T, AD3CH7CON2)
+#define AD3CH7DATA               HOST_SFR(AD3CH7DATA)
+#define DACCTRL1                 HOST_SFR(DACCTRL1)
+#define DACCTRL1bits             HOST_SFRBITS(HOST_DACCTRL1_BITS_T, DACCTRL1)
+#define DACCTRL2                 HOST_SFR(DACCTRL2)
+#define DACCTRL2bits             HOST_SFRBITS(HOST_DACCTRL2_BITS_T, DACCTRL2)
+#define DAC1CON                  HOST_SFR(DAC1CON)
+#define DAC1CONbits              HOST_SFRBITS(HOST_DACCON_BITS_T, DAC1CON)
+#define DAC1DAT                  HOST_SFR(DAC1DAT)
+#define DAC1DATbits              HOST_SFRBITS(HOST_DACDAT_BITS_T, DAC1DAT)
+#define DAC1CMP                  HOST_SFR(DAC1CMP)
+#define DAC1CMPbits              HOST_SFRBITS(HOST_DACCMP_BITS_T, DAC1CMP)
+#define DAC1SLPCON               HOST_SFR(DAC1SLPCON)
+#define DAC1SLPCONbits           HOST_SFRBITS(HOST_DACSLPCON_BITS_T, DAC1SLPCON)
+#define DAC1SLPDAT               HOST_SFR(DAC1SLPDAT)
+#define DAC2CON                  HOST_SFR(DAC2CON)
+#define DAC2CONbits              HOST_SFRBITS(HOST_DACCON_BITS_T, DAC2CON)
+#define DAC2DAT                  HOST_SFR(DAC2DAT)
+#define DAC2DATbits              HOST_SFRBITS(HOST_DACDAT_BITS_T, DAC2DAT)
+#define DAC2CMP                  HOST_SFR(DAC2CMP)
+#define DAC2CMPbits              HOST_SFRBITS(HOST_DACCMP_BITS_T, DAC2CMP)
+#define DAC2SLPCON               HOST_SFR(DAC2SLPCON)
+#define DAC2SLPCONbits           HOST_SFRBITS(HOST_DACSLPCON_BITS_T, DAC2SLPCON)
+#define DAC2SLPDAT               HOST_SFR(DAC2SLPDAT)
+#define DAC3CON                  HOST_SFR(DAC3CON)
+#define DAC3CONbits              HOST_SFRBITS(HOST_DACCON_BITS_T, DAC3CON)
+#define DAC3DAT                  HOST_SFR(DAC3DAT)
+#define DAC3DATbits              HOST_SFRBITS(HOST_DACDAT_BITS_T, DAC3DAT)
+#define DAC3CMP                  HOST_SFR(DAC3CMP)
+#define DAC3CMPbits              HOST_SFRBITS(HOST_DACCMP_BITS_T, DAC3CMP)
+#define DAC3SLPCON               HOST_SFR(DAC3SLPCON)
+#define DAC3SLPCONbits           HOST_SFRBITS(HOST_DACSLPCON_BITS_T, DAC3SLPCON)
+#define DAC3SLPDAT               HOST_SFR(DAC3SLPDAT)
+#define U1CON                    HOST_SFR(U1CON)
+#define U1CONbits                HOST_SFRBITS(HOST_UCON_BITS_T, U1CON)
+#define U1STAT                   HOST_SFR(U1STAT)
+#define U1STATbits               HOST_SFRBITS(HOST_USTAT_BITS_T, U1STAT)
+#define U1BRG                    HOST_SFR(U1BRG)
+#define U1RXB                    HOST_SFR(U1RXB)
+#define U1RXBbits                HOST_SFRBITS(HOST_URXB_BITS_T, U1RXB)
+#define U1TXB                    HOST_SFR(U1TXB)
+#define U1TXBbits                HOST_SFRBITS(HOST_UTXB_BITS_T, U1TXB)
+#define U1PA                     HOST_SFR(U1PA)
+#define U1PB                     HOST_SFR(U1PB)
+#define U1CHK                    HOST_SFR(U1CHK)
+#define U1SCCON                  HOST_SFR(U1SCCON)
+#define U1UIR                    HOST_SFR(U1UIR)
+#define U1UIRbits                HOST_SFRBITS(HOST_UUIR_BITS_T, U1UIR)
+#define T1CON                    HOST_SFR(T1CON)
+#define T1CONbits                HOST_SFRBITS(HOST_TCON_BITS_T, T1CON)
+#define TMR1                     HOST_SFR(TMR1)
+#define PR1                      HOST_SFR(PR1)
+#define ANSELA                   HOST_SFR(ANSELA)
+#define ANSELAbits               HOST_SFRBITS(HOST_ANSELA_BITS_T, ANSELA)
+#define TRISA                    HOST_SFR(TRISA)
+#define TRISAbits                HOST_SFRBITS(HOST_TRISA_BITS_T, TRISA)
+#define PORTA                    HOST_SFR(PORTA)
+#define PORTAbits                HOST_SFRBITS(HOST_PORTA_BITS_T, PORTA)
+#define LATA                     HOST_SFR(LATA)
+#define LATAbits                 HOST_SFRBITS(HOST_LATA_BITS_T, LATA)
+#define ANSELB                   HOST_SFR(ANSELB)
+#define ANSELBbits               HOST_SFRBITS(HOST_ANSELB_BITS_T, ANSELB)
+#define TRISB                    HOST_SFR(TRISB)
+#define TRISBbits                HOST_SFRBITS(HOST_TRISB_BITS_T, TRISB)
+#define PORTB                    HOST_SFR(PORTB)
+#define PORTBbits                HOST_SFRBITS(HOST_PORTB_BITS_T, PORTB)
+#define LATB                     HOST_SFR(LATB)
+#define LATBbits                 HOST_SFRBITS(HOST_LATB_BITS_T, LATB)
+#define ANSELC                   HOST_SFR(ANSELC)
+#define ANSELCbits               HOST_SFRBITS(HOST_ANSELC_BITS_T, ANSELC)
+#define TRISC                    HOST_SFR(TRISC)
+#define TRISCbits                HOST_SFRBITS(HOST_TRISC_BITS_T, TRISC)
+#define PORTC                    HOST_SFR(PORTC)
+#define PORTCbits                HOST_SFRBITS(HOST_PORTC_BITS_T, PORTC)
+#define LATC                     HOST_SFR(LATC)
+#define LATCbits                 HOST_SFRBITS(HOST_LATC_BITS_T, LATC)
+#define ANSELD                   HOST_SFR(ANSELD)
+#define ANSELDbits               HOST_SFRBITS(HOST_ANSELD_BITS_T, ANSELD)
+#define TRISD                    HOST_SFR(TRISD)
+#define TRISDbits                HOST_SFRBITS(HOST_TRISD_BITS_T, TRISD)
+#define PORTD                    HOST_SFR(PORTD)
+#define PORTDbits                HOST_SFRBITS(HOST_PORTD_BITS_T, PORTD)
+#define LATD                     HOST_SFR(LATD)
+#define LATDbits                 HOST_SFRBITS(HOST_LATD_BITS_T, LATD)
+#define ANSELE                   HOST_SFR(ANSELE)
+#define ANSELEbits               HOST_SFRBITS(HOST_ANSELE_BITS_T, ANSELE)
+#define TRISE                    HOST_SFR(TRISE)
+#define TRISEbits                HOST_SFRBITS(HOST_TRISE_BITS_T, TRISE)
+#define PORTE                    HOST_SFR(PORTE)
+#define PORTEbits                HOST_SFRBITS(HOST_PORTE_BITS_T, PORTE)
+#define LATE                     HOST_SFR(LATE)
+#define LATEbits                 HOST_SFRBITS(HOST_LATE_BITS_T, LATE)
+#define ANSELF                   HOST_SFR(ANSELF)
+#define ANSELFbits               HOST_SFRBITS(HOST_ANSELF_BITS_T, ANSELF)
+#define TRISF                    HOST_SFR(TRISF)
+#define TRISFbits                HOST_SFRBITS(HOST_TRISF_BITS_T, TRISF)
+#define PORTF                    HOST_SFR(PORTF)
+#define PORTFbits                HOST_SFRBITS(HOST_PORTF_BITS_T, PORTF)
+#define LATF                     HOST_SFR(LATF)
+#define LATFbits                 HOST_SFRBITS(HOST_LATF_BITS_T, LATF)
+#define ANSELG                   HOST_SFR(ANSELG)
+#define ANSELGbits               HOST_SFRBITS(HOST_ANSELG_BITS_T, ANSELG)
+#define TRISG                    HOST_SFR(TRISG)
+#define TRISGbits                HOST_SFRBITS(HOST_TRISG_BITS_T, TRISG)
+#define PORTG                    HOST_SFR(PORTG)
+#define PORTGbits                HOST_SFRBITS(HOST_PORTG_BITS_T, PORTG)
+#define LATG                     HOST_SFR(LATG)
+#define LATGbits                 HOST_SFRBITS(HOST_LATG_BITS_T, LATG)
+#define RPOR0                    HOST_SFR(RPOR0)
+#define RPOR0bits                HOST_SFRBITS(HOST_RPOR0_BITS_T, RPOR0)
+#define RPOR1                    HOST_SFR(RPOR1)
+#define RPOR1bits                HOST_SFRBITS(HOST_RPOR1_BITS_T, RPOR1)
+#define RPOR2                    HOST_SFR(RPOR2)
+#define RPOR2bits                HOST_SFRBITS(HOST_RPOR2_BITS_T, RPOR2)
+#define RPOR3                    HOST_SFR(RPOR3)
+#define RPOR3bits                HOST_SFRBITS(HOST_RPOR3_BITS_T, RPOR3)
+#define RPOR4                    HOST_SFR(RPOR4)
+#define RPOR4bits                HOST_SFRBITS(HOST_RPOR4_BITS_T, RPOR4)
+#define RPOR5                    HOST_SFR(RPOR5)
+#define RPOR5bits                HOST_SFRBITS(HOST_RPOR5_BITS_T, RPOR5)
+#define RPOR6                    HOST_SFR(RPOR6)
+#define RPOR6bits                HOST_SFRBITS(HOST_RPOR6_BITS_T, RPOR6)
+#define RPOR7                    HOST_SFR(RPOR7)
+#define RPOR7bits                HOST_SFRBITS(HOST_RPOR7_BITS_T, RPOR7)
+#define RPOR8                    HOST_SFR(RPOR8)
+#define RPOR8bits                HOST_SFRBITS(HOST_RPOR8_BITS_T, RPOR8)
+#define RPOR9                    HOST_SFR(RPOR9)
+#define RPOR9bits                HOST_SFRBITS(HOST_RPOR9_BITS_T, RPOR9)
+#define RPOR10                   HOST_SFR(RPOR10)
+#define RPOR10bits               HOST_SFRBITS(HOST_RPOR10_BITS_T, RPOR10)
+#define RPOR11                   HOST_SFR(RPOR11)
+#define RPOR11bits               HOST_SFRBITS(HOST_RPOR11_BITS_T, RPOR11)
+#define RPOR12                   HOST_SFR(RPOR12)
+#define RPOR12bits               HOST_SFRBITS(HOST_RPOR12_BITS_T, RPOR12)
+#define RPOR13                   HOST_SFR(RPOR13)
+#define RPOR13bits               HOST_SFRBITS(HOST_RPOR13_BITS_T, RPOR13)
+#define RPOR14                   HOST_SFR(RPOR14)
+#define RPOR14bits               HOST_SFRBITS(HOST_RPOR14_BITS_T, RPOR14)
+#define RPOR15                   HOST_SFR(RPOR15)
+#define RPOR15bits               HOST_SFRBITS(HOST_RPOR15_BITS_T, RPOR15)
+#define RPOR16                   HOST_SFR(RPOR16)
+#define RPOR16bits               HOST_SFRBITS(HOST_RPOR16_BITS_T, RPOR16)
+#define RPOR17                   HOST_SFR(RPOR17)
+#define RPOR17bits               HOST_SFRBITS(HOST_RPOR17_BITS_T, RPOR17)
+#define RPOR18                   HOST_SFR(RPOR18)
+#define RPOR18bits               HOST_SFRBITS(HOST_RPOR18_BITS_T, RPOR18)
+#define RPOR19                   HOST_SFR(RPOR19)
+#define RPOR19bits               HOST_SFRBITS(HOST_RPOR19_BITS_T, RPOR19)
+#define RPOR20                   HOST_SFR(RPOR20)
+#define RPOR20bits               HOST_SFRBITS(HOST_RPOR20_BITS_T, RPOR20)
+#define RPOR21                   HOST_SFR(RPOR21)
+#define RPOR21bits               HOST_SFRBITS(HOST_RPOR21_BITS_T, RPOR21)
+#define RPOR22                   HOST_SFR(RPOR22)
+#define RPOR22bits               HOST_SFRBITS(HOST_RPOR22_BITS_T, RPOR22)
+#define RPOR23                   HOST_SFR(RPOR23)
+#define RPOR23bits               HOST_SFRBITS(HOST_RPOR23_BITS_T, RPOR23)
+#define RPOR24                   HOST_SFR(RPOR24)
+#define RPOR24bits               HOST_SFRBITS(HOST_RPOR24_BITS_T, RPOR24)
+#define RPOR25                   HOST_SFR(RPOR25)
+#define RPOR25bits               HOST_SFRBITS(HOST_RPOR25_BITS_T, RPOR25)
+#define RPOR26                   HOST_SFR(RPOR26)
+#define RPOR26bits               HOST_SFRBITS(HOST_RPOR26_BITS_T, RPOR26)
+#define RPOR27                   HOST_SFR(RPOR27)
+#define RPOR27bits               HOST_SFRBITS(HOST_RPOR27_BITS_T, RPOR27)
+#define RPOR28                   HOST_SFR(RPOR28)
+#define RPOR28bits               HOST_SFRBITS(HOST_RPOR28_BITS_T, RPOR28)
+#define RPOR29                   HOST_SFR(RPOR29)
+#define RPOR29bits               HOST_SFRBITS(HOST_RPOR29_BITS_T, RPOR29)
+#define RPOR30                   HOST_SFR(RPOR30)
+#define RPOR30bits               HOST_SFRBITS(HOST_RPOR30_BITS_T, RPOR30)
+#define RPOR31                   HOST_SFR(RPOR31)
+#define RPOR31bits               HOST_SFRBITS(HOST_RPOR31_BITS_T, RPOR31)
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="PERIPHERAL PIN SELECT ">
+
+#define _RP1R                    RPOR0bits.RP1R
+#define _RP2R                    RPOR0bits.RP2R
+#define _RP3R                    RPOR0bits.RP3R
+#define _RP4R                    RPOR0bits.RP4R
+#define _RP5R                    RPOR1bits.RP5R
+#define _RP6R                    RPOR1bits.RP6R
+#define _RP7R                    RPOR1bits.RP7R
+#define _RP8R                    RPOR1bits.RP8R
+#define _RP9R                    RPOR2bits.RP9R
+#define _RP10R                   RPOR2bits.RP10R
+#define _RP11R                   RPOR2bits.RP11R
+#define _RP12R                   RPOR2bits.RP12R
+#define _RP13R                   RPOR3bits.RP13R
+#define _RP14R                   RPOR3bits.RP14R
+#define _RP15R                   RPOR3bits.RP15R
+#define _RP16R                   RPOR3bits.RP16R
+#define _RP17R                   RPOR4bits.RP17R
+#define _RP18R                   RPOR4bits.RP18R
+#define _RP19R                   RPOR4bits.RP19R
+#define _RP20R                   RPOR4bits.RP20R
+#define _RP21R                   RPOR5bits.RP21R
+#define _RP22R                   RPOR5bits.RP22R
+#define _RP23R                   RPOR5bits.RP23R
+#define _RP24R                   RPOR5bits.RP24R
+#define _RP25R                   RPOR6bits.RP25R
+#define _RP26R                   RPOR6bits.RP26R
+#define _RP27R                   RPOR6bits.RP27R
+#define _RP28R                   RPOR6bits.RP28R
+#define _RP29R                   RPOR7bits.RP29R
+#define _RP30R                   RPOR7bits.RP30R
+#define _RP31R                   RPOR7bits.RP31R
+#define _RP32R                   RPOR7bits.RP32R
+#define _RP33R                   RPOR8bits.RP33R
+#define _RP34R                   RPOR8bits.RP34R
+#define _RP35R                   RPOR8bits.RP35R
+#define _RP36R                   RPOR8bits.RP36R
+#define _RP37R                   RPOR9bits.RP37R
+#define _RP38R                   RPOR9bits.RP38R
+#define _RP39R                   RPOR9bits.RP39R
+#define _RP40R                   RPOR9bits.RP40R
+#define _RP41R                   RPOR10bits.RP41R
+#define _RP42R                   RPOR10bits.RP42R
+#define _RP43R                   RPOR10bits.RP43R
+#define _RP44R                   RPOR10bits.RP44R
+#define _RP45R                   RPOR11bits.RP45R
+#define _RP46R                   RPOR11bits.RP46R
+#define _RP47R                   RPOR11bits.RP47R
+#define _RP48R                   RPOR11bits.RP48R
+#define _RP49R                   RPOR12bits.RP49R
+#define _RP50R                   RPOR12bits.RP50R
+#define _RP51R                   RPOR12bits.RP51R
+#define _RP52R                   RPOR12bits.RP52R
+#define _RP53R                   RPOR13bits.RP53R
+#define _RP54R                   RPOR13bits.RP54R
+#define _RP55R                   RPOR13bits.RP55R
+#define _RP56R                   RPOR13bits.RP56R
+#define _RP57R                   RPOR14bits.RP57R
+#define _RP58R                   RPOR14bits.RP58R
+#define _RP59R                   RPOR14bits.RP59R
+#define _RP60R                   RPOR14bits.RP60R
+#define _RP61R                   RPOR15bits.RP61R
+#define _RP62R                   RPOR15bits.RP62R
+#define _RP63R                   RPOR15bits.RP63R
+#define _RP64R                   RPOR15bits.RP64R
+#define _RP65R                   RPOR16bits.RP65R
+#define _RP66R                   RPOR16bits.RP66R
+#define _RP67R                   RPOR16bits.RP67R
+#define _RP68R                   RPOR16bits.RP68R
+#define _RP69R                   RPOR17bits.RP69R
+#define _RP70R                   RPOR17bits.RP70R
+#define _RP71R                   RPOR17bits.RP71R
+#define _RP72R                   RPOR17bits.RP72R
+#define _RP73R                   RPOR18bits.RP73R
+#define _RP74R                   RPOR18bits.RP74R
+#define _RP75R                   RPOR18bits.RP75R
+#define _RP76R                   RPOR18bits.RP76R
+#define _RP77R                   RPOR19bits.RP77R
+#define _RP78R                   RPOR19bits.RP78R
+#define _RP79R                   RPOR19bits.RP79R
+#define _RP80R                   RPOR19bits.RP80R
+#define _RP81R                   RPOR20bits.RP81R
+#define _RP82R                   RPOR20bits.RP82R
+#define _RP83R                   RPOR20bits.RP83R
+#define _RP84R                   RPOR20bits.RP84R
+#define _RP85R                   RPOR21bits.RP85R
+#define _RP86R                   RPOR21bits.RP86R
+#define _RP87R                   RPOR21bits.RP87R
+#define _RP88R                   RPOR21bits.RP88R
+#define _RP89R                   RPOR22bits.RP89R
+#define _RP90R                   RPOR22bits.RP90R
+#define _RP91R                   RPOR22bits.RP91R
+#define _RP92R                   RPOR22bits.RP92R
+#define _RP93R                   RPOR23bits.RP93R
+#define _RP94R                   RPOR23bits.RP94R
+#define _RP95R                   RPOR23bits.RP95R
+#define _RP96R                   RPOR23bits.RP96R
+#define _RP97R                   RPOR24bits.RP97R
+#define _RP98R                   RPOR24bits.RP98R
+#define _RP99R                   RPOR24bits.RP99R
+#define _RP100R                  RPOR24bits.RP100R
+#define _RP101R                  RPOR25bits.RP101R
+#define _RP102R                  RPOR25bits.RP102R
+#define _RP103R                  RPOR25bits.RP103R
+#define _RP104R                  RPOR25bits.RP104R
+#define _RP105R                  RPOR26bits.RP105R
+#define _RP106R                  RPOR26bits.RP106R
+#define _RP107R                  RPOR26bits.RP107R
+#define _RP108R                  RPOR26bits.RP108R
+#define _RP109R                  RPOR27bits.RP109R
+#define _RP110R                  RPOR27bits.RP110R
+#define _RP111R                  RPOR27bits.RP111R
+#define _RP112R                  RPOR27bits.RP112R
+#define _RP113R                  RPOR28bits.RP113R
+#define _RP114R                  RPOR28bits.RP114R
+#define _RP115R                  RPOR28bits.RP115R
+#define _RP116R                  RPOR28bits.RP116R
+#define _RP117R                  RPOR29bits.RP117R
+#define _RP118R                  RPOR29bits.RP118R
+#define _RP119R                  RPOR29bits.RP119R
+#define _RP120R                  RPOR29bits.RP120R
+#define _RP121R                  RPOR30bits.RP121R
+#define _RP122R                  RPOR30bits.RP122R
+#define _RP123R                  RPOR30bits.RP123R
+#define _RP124R                  RPOR30bits.RP124R
+#define _RP125R                  RPOR31bits.RP125R
+#define _RP126R                  RPOR31bits.RP126R
+#define _RP127R                  RPOR31bits.RP127R
+#define _RP128R                  RPOR31bits.RP128R
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="INTERRUPT FLAG/ENABLE/PRIORITY ">
+
+#define _AD1CH0IF                HOST_IRQ(AD1CH0).IF
+#define _AD1CH0IE                HOST_IRQ(AD1CH0).IE
+#define _AD1CH0IP                HOST_IRQ(AD1CH0).IP
+#define _AD1CH1IF                HOST_IRQ(AD1CH1).IF
+#define _AD1CH1IE                HOST_IRQ(AD1CH1).IE
+#define _AD1CH1IP                HOST_IRQ(AD1CH1).IP
+#define _AD1CH2IF                HOST_IRQ(AD1CH2).IF
+#define _AD1CH2IE                HOST_IRQ(AD1CH2).IE
+#define _AD1CH2IP                HOST_IRQ(AD1CH2).IP
+#define _AD1CH3IF                HOST_IRQ(AD1CH3).IF
+#define _AD1CH3IE                HOST_IRQ(AD1CH3).IE
+#define _AD1CH3IP                HOST_IRQ(AD1CH3).IP
+#define _AD1CH4IF                HOST_IRQ(AD1CH4).IF
+#define _AD1CH4IE                HOST_IRQ(AD1CH4).IE
+#define _AD1CH4IP                HOST_IRQ(AD1CH4).IP
+#define _AD1CH5IF                HOST_IRQ(AD1CH5).IF
+#define _AD1CH5IE                HOST_IRQ(AD1CH5).IE
+#define _AD1CH5IP                HOST_IRQ(AD1CH5).IP
+#define _AD1CH6IF                HOST_IRQ(AD1CH6).IF
+#define _AD1CH6IE                HOST_IRQ(AD1CH6).IE
+#define _AD1CH6IP                HOST_IRQ(AD1CH6).IP
+#define _AD1CH7IF                HOST_IRQ(AD1CH7).IF
+#define _AD1CH7IE                HOST_IRQ(AD1CH7).IE
+#define _AD1CH7IP                HOST_IRQ(AD1CH7).IP
+#define _AD2CH0IF                HOST_IRQ(AD2CH0).IF
+#define _AD2CH0IE                HOST_IRQ(AD2CH0).IE
+#define _AD2CH0IP                HOST_IRQ(AD2CH0).IP
+#define _AD2CH1IF                HOST_IRQ(AD2CH1).IF
+#define _AD2CH1IE                HOST_IRQ(AD2CH1).IE
+#define _AD2CH1IP                HOST_IRQ(AD2CH1).IP
+#define _AD2CH2IF                HOST_IRQ(AD2CH2).IF
+#define _AD2CH2IE                HOST_IRQ(AD2CH2).IE
+#define _AD2CH2IP                HOST_IRQ(AD2CH2).IP
+#define _AD2CH3IF                HOST_IRQ(AD2CH3).IF
+#define _AD2CH3IE                HOST_IRQ(AD2CH3).IE
+#define _AD2CH3IP                HOST_IRQ(AD2CH3).IP
+#define _AD2CH4IF                HOST_IRQ(AD2CH4).IF
+#define _AD2CH4IE                HOST_IRQ(AD2CH4).IE
+#define _AD2CH4IP                HOST_IRQ(AD2CH4).IP
+#define _AD2CH5IF                HOST_IRQ(AD2CH5).IF
+#define _AD2CH5IE                HOST_IRQ(AD2CH5).IE
+#define _AD2CH5IP                HOST_IRQ(AD2CH5).IP
+#define _AD2CH6IF                HOST_IRQ(AD2CH6).IF
+#define _AD2CH6IE                HOST_IRQ(AD2CH6).IE
+#define _AD2CH6IP                HOST_IRQ(AD2CH6).IP
+#define _AD2CH7IF                HOST_IRQ(AD2CH7).IF
+#define _AD2CH7IE                HOST_IRQ(AD2CH7).IE
+#define _AD2CH7IP                HOST_IRQ(AD2CH7).IP
+#define _AD3CH0IF                HOST_IRQ(AD3CH0).IF
+#define _AD3CH0IE                HOST_IRQ(AD3CH0).IE
+#define _AD3CH0IP                HOST_IRQ(AD3CH0).IP
+#define _AD3CH1IF                HOST_IRQ(AD3CH1).IF
+#define _AD3CH1IE                HOST_IRQ(AD3CH1).IE
+#define _AD3CH1IP                HOST_IRQ(AD3CH1).IP
+#define _AD3CH2IF                HOST_IRQ(AD3CH2).IF
+#define _AD3CH2IE                HOST_IRQ(AD3CH2).IE
+#define _AD3CH2IP                HOST_IRQ(AD3CH2).IP
+#define _AD3CH3IF                HOST_IRQ(AD3CH3).IF
+#define _AD3CH3IE                HOST_IRQ(AD3CH3).IE
+#define _AD3CH3IP                HOST_IRQ(AD3CH3).IP
+#define _AD3CH4IF                HOST_IRQ(AD3CH4).IF
+#define _AD3CH4IE                HOST_IRQ(AD3CH4).IE
+#define _AD3CH4IP                HOST_IRQ(AD3CH4).IP
+#define _AD3CH5IF                HOST_IRQ(AD3CH5).IF
+#define _AD3CH5IE                HOST_IRQ(AD3CH5).IE
+#define _AD3CH5IP                HOST_IRQ(AD3CH5).IP
+#define _AD3CH6IF                HOST_IRQ(AD3CH6).IF
+#define _AD3CH6IE                HOST_IRQ(AD3CH6).IE
+#define _AD3CH6IP                HOST_IRQ(AD3CH6).IP
+#define _AD3CH7IF                HOST_IRQ(AD3CH7).IF
+#define _AD3CH7IE                HOST_IRQ(AD3CH7).IE
+#define _AD3CH7IP                HOST_IRQ(AD3CH7).IP
+#define _T1IF                    HOST_IRQ(T1).IF
+#define _T1IE                    HOST_IRQ(T1).IE
+#define _T1IP                    HOST_IRQ(T1).IP
+#define _U1TXIF                  HOST_IRQ(U1TX).IF
+#define _U1TXIE                  HOST_IRQ(U1TX).IE
+#define _U1TXIP                  HOST_IRQ(U1TX).IP
+#define _U1RXIF                  HOST_IRQ(U1RX).IF
+#define _U1RXIE                  HOST_IRQ(U1RX).IE
+#define _U1RXIP                  HOST_IRQ(U1RX).IP
+#define _U1EIF                   HOST_IRQ(U1E).IF
+#define _U1EIE                   HOST_IRQ(U1E).IE
+#define _U1EIP                   HOST_IRQ(U1E).IP
+#define _PWM1IF                  HOST_IRQ(PWM1).IF
+#define _PWM1IE                  HOST_IRQ(PWM1).IE
+#define _PWM1IP                  HOST_IRQ(PWM1).IP
+#define _PWM2IF                  HOST_IRQ(PWM2).IF
+#define _PWM2IE                  HOST_IRQ(PWM2).IE
+#define _PWM2IP                  HOST_IRQ(PWM2).IP
+#define _PWM3IF                  HOST_IRQ(PWM3).IF
+#define _PWM3IE                  HOST_IRQ(PWM3).IE
+#define _PWM3IP                  HOST_IRQ(PWM3).IP
+#define _PWM4IF                  HOST_IRQ(PWM4).IF
+#define _PWM4IE                  HOST_IRQ(PWM4).IE
+#define _PWM4IP                  HOST_IRQ(PWM4).IP
+#define _PWM5IF                  HOST_IRQ(PWM5).IF
+#define _PWM5IE                  HOST_IRQ(PWM5).IE
+#define _PWM5IP                  HOST_IRQ(PWM5).IP
+#define _PWM6IF                  HOST_IRQ(PWM6).IF
+#define _PWM6IE                  HOST_IRQ(PWM6).IE
+#define _PWM6IP                  HOST_IRQ(PWM6).IP
+#define _PWM7IF                  HOST_IRQ(PWM7).IF
+#define _PWM7IE                  HOST_IRQ(PWM7).IE
+#define _PWM7IP                  HOST_IRQ(PWM7).IP
+#define _PWM8IF                  HOST_IRQ(PWM8).IF
+#define _PWM8IE                  HOST_IRQ(PWM8).IE
+#define _PWM8IP                  HOST_IRQ(PWM8).IP
+#define _DMA0IF                  HOST_IRQ(DMA0).IF
+#define _DMA0IE                  HOST_IRQ(DMA0).IE
+#define _DMA0IP                  HOST_IRQ(DMA0).IP
+#define _DMA1IF                  HOST_IRQ(DMA1).IF
+#define _DMA1IE                  HOST_IRQ(DMA1).IE
+#define _DMA1IP                  HOST_IRQ(DMA1).IP
+#define _DMA2IF                  HOST_IRQ(DMA2).IF
+#define _DMA2IE                  HOST_IRQ(DMA2).IE
+#define _DMA2IP                  HOST_IRQ(DMA2).IP
+#define _DMA3IF                  HOST_IRQ(DMA3).IF
+#define _DMA3IE                  HOST_IRQ(DMA3).IE
+#define _DMA3IP                  HOST_IRQ(DMA3).IP
+#define _DMA4IF                  HOST_IRQ(DMA4).IF
+#define _DMA4IE                  HOST_IRQ(DMA4).IE
+#define _DMA4IP                  HOST_IRQ(DMA4).IP
+#define _DMA5IF                  HOST_IRQ(DMA5).IF
+#define _DMA5IE                  HOST_IRQ(DMA5).IE
+#define _DMA5IP                  HOST_IRQ(DMA5).IP
+
+// </editor-fold>
+
+#ifdef __cplusplus  // Provide C++ Compatibility
+    }
+#endif
+
+#endif      // end of _HOST_XC_H
@@ -42,11 +42,65 @@
 #include <xc.h>
 
 #include "board_service.h"
+#include "boot_profile.h"
+#include "adc.h"
+#include "measure.h"
+#include "foc.h"
+#include "fast_loop.h"
 
 // </editor-fold>
 
 // <editor-fold defaultstate="collapsed" desc=" Global Variables ">
 
+/* Current control and measurement of each motor, indexed by PWM_MOTOR_T */
+MCAPP_FOC_T focMotor[PWM_MOTOR_COUNT];
+MCAPP_MEASURE_T measureMotor[PWM_MOTOR_COUNT];
+/* Scheduler of the current control of the three motors */
+MCAPP_FAST_LOOP_T fastLoop;
+
+// </editor-fold>
+
+// <editor-fold defaultstate="collapsed" desc="STATIC FUNCTIONS ">
+
+/**
+* <B> Function: MotorControlStart()  </B>
+*
+* @brief Function initializes the current control of the three motors and
+* enables the ADC interrupt of the motor sampled last in the PWM cycle, 
+* which runs the control of all motors. The control starts once the current
+* offsets of each motor are measured. The phase voltages are sampled every
+* MEASURE_PHASEVOLT_FACTOR PWM cycles.
+*
+*/
+static void MotorControlStart(void)
+{
+    uint16_t motor;
+
+    for (motor = 0; motor < PWM_MOTOR_COUNT; motor++)
+    {
+        MCAPP_MeasureCurrentInit(&measureMotor[motor]);
+        MCAPP_MeasurePhaseVoltInit(&measureMotor[motor], 
+            PWM_MotorVoltageTriggerSet(motor, MEASURE_PHASEVOLT_FACTOR));
+        MCAPP_FocInit(&focMotor[motor], motor, &pwmTiming);
+    }
+    MCAPP_FastLoopInit(&fastLoop, focMotor, measureMotor, &pwmTiming);
+    
+    MC1_ClearADCIF();
+    MC2_ClearADCIF();
+    MC3_ClearADCIF();
+    switch (fastLoop.last)
+    {
+        case PWM_MOTOR_MC1:
+            MC1_EnableADCInterrupt();
+            break;
+        case PWM_MOTOR_MC2:
+            MC2_EnableADCInterrupt();
+            break;
+        default:
+            MC3_EnableADCInterrupt();
+            break;
+    }
+}
 
 // </editor-fold>
 
@@ -59,11 +113,49 @@
 */
 int main (void)
 {
-    InitOscillator();
+    bool ready;
+    
+    BOOT_PROFILE_START();
+    
+    /* Start PLL1, the device runs on FRC until the bring-up completes */
+    BOOT_PROFILE_BEGIN("CLOCK_BringUpStart");
+    CLOCK_BringUpStart();
+    BOOT_PROFILE_END();
+    BOOT_PROFILE_BEGIN("SetupGPIOPorts");
     SetupGPIOPorts();
+    BOOT_PROFILE_END();
+    
+    /* Configure Peripherals while the clocks switch */
+    BOOT_PROFILE_BEGIN("HAL_ConfigurePeripherals");
+    HAL_ConfigurePeripherals();
+    BOOT_PROFILE_END();
+    
+    BOOT_PROFILE_BEGIN("CLOCK_BringUpTask");
+    while (CLOCK_BringUpBusy())
+    {
+        CLOCK_BringUpTask();
+    }
+    BOOT_PROFILE_END();
     
-    /* Initialize Peripherals */
-    HAL_InitPeripherals();
+    /* Peripherals stay disabled if the clocks fell back to FRC, the PWM
+       also if an ADC core did not become ready */
+    ready = (clockBringUp.state == CLOCK_STATE_READY);
+    if (ready)
+    {
+        BOOT_PROFILE_BEGIN("HAL_EnablePeripherals");
+        ready = HAL_EnablePeripherals();
+        BOOT_PROFILE_END();
+    }
+    
+    /* Boot timing report over UART1, built with BOOT_PROFILE only. It ends
+       the profile and releases Timer1 to the control */
+    BOOT_PROFILE_REPORT();
+    
+    if (ready)
+    {
+        /* Current control of the three motors from one ADC interrupt */
+        MotorControlStart();
+    }
     
     while(1)
     {
@@ -75,3 +167,33 @@ int main (void)
 
 // </editor-fold>
 
+// <editor-fold defaultstate="expanded" desc="INTERRUPT SERVICE ROUTINES ">
+
+/**
+* <B> Function: MC1_ADC_INTERRUPT, MC2_ADC_INTERRUPT, MC3_ADC_INTERRUPT </B>
+*
+* @brief ADC interrupts of the motors, after the last current sample of 
+* each PWM cycle. Only the interrupt of the motor sampled last is enabled,
+* it runs the current control of the three motors.
+*
+*/
+void __attribute__((__interrupt__, no_auto_psv)) MC1_ADC_INTERRUPT(void)
+{
+    MCAPP_FastLoopService(&fastLoop);
+    MC1_ClearADCIF();
+}
+
+void __attribute__((__interrupt__, no_auto_psv)) MC2_ADC_INTERRUPT(void)
+{
+    MCAPP_FastLoopService(&fastLoop);
+    MC2_ClearADCIF();
+}
+
+void __attribute__((__interrupt__, no_auto_psv)) MC3_ADC_INTERRUPT(void)
+{
+    MCAPP_FastLoopService(&fastLoop);
+    MC3_ClearADCIF();
+}
+
+// </editor-fold>
+